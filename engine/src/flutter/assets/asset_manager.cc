@@ -59,9 +59,9 @@ std::deque<std::unique_ptr<AssetResolver>> AssetManager::TakeResolvers() {
   return std::move(resolvers_);
 }
 
-// |AssetResolver|
-std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
-    const std::string& asset_name) const {
+std::unique_ptr<fml::Mapping> AssetManager::GetAsMappingWithResolverType(
+    const std::string& asset_name,
+    AssetResolver::AssetResolverType* resolver_type) const {
   if (asset_name.empty()) {
     return nullptr;
   }
@@ -70,6 +70,7 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
   for (const auto& resolver : resolvers_) {
     auto mapping = resolver->GetAsMapping(asset_name);
     if (mapping != nullptr) {
+      *resolver_type = resolver->GetType();
       return mapping;
     }
   }
@@ -77,6 +78,13 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
   return nullptr;
 }
 
+// |AssetResolver|
+std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
+    const std::string& asset_name) const {
+  AssetResolver::AssetResolverType resolver_type;
+  return GetAsMappingWithResolverType(asset_name, &resolver_type);
+}
+
 // |AssetResolver|
 std::vector<std::unique_ptr<fml::Mapping>> AssetManager::GetAsMappings(
     const std::string& asset_pattern,
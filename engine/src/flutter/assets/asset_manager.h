@@ -70,6 +70,20 @@ class AssetManager final : public AssetResolver {
 
   std::deque<std::unique_ptr<AssetResolver>> TakeResolvers();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Gets the mapping of an asset like `GetAsMapping`, and the
+  ///             type of the resolver that found it.
+  ///
+  /// @param[in]  asset_name     The name of the asset.
+  /// @param[out] resolver_type  Set to the type of the resolver that found
+  ///                            the asset, if any.
+  ///
+  /// @return     The mapping of the asset, or nullptr if no resolver has it.
+  ///
+  std::unique_ptr<fml::Mapping> GetAsMappingWithResolverType(
+      const std::string& asset_name,
+      AssetResolver::AssetResolverType* resolver_type) const;
+
   // |AssetResolver|
   bool IsValid() const override;
 
@@ -85,6 +85,14 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   bool IsDumpingSkp() const { return is_dumping_skp_; }
   void SetIsDumpingSkp(bool value) { is_dumping_skp_ = value; }
 
+  // The directory of the cache files that are not shaders, such as the font
+  // fallbacks of previous runs. It is invalid if the cache is, and it should
+  // only be written to on a worker task runner.
+  const std::shared_ptr<fml::UniqueFD>& GetCacheDirectory() const {
+    return cache_directory_;
+  }
+  bool IsReadOnly() const { return is_read_only_; }
+
   // Remove all files inside the persistent cache directory.
   // Return whether the purge is successful.
   bool Purge();
@@ -162,6 +162,10 @@ struct Settings {
   bool dump_skp_on_shader_compilation = false;
   bool cache_sksl = false;
   bool purge_persistent_cache = false;
+  // Whether the high-water marks of the memory accounting counters are
+  // tracked from the start. They can also be enabled later through the
+  // service protocol.
+  bool track_memory_high_water_marks = false;
   bool endless_trace_buffer = false;
   bool enable_dart_profiling = false;
   bool disable_dart_asserts = false;
@@ -364,6 +368,19 @@ struct Settings {
   /// This is used by the runOnPlatformThread API.
   bool enable_platform_isolates = false;
 
+  /// The longest time, in microseconds, that a platform isolate spends
+  /// handling its queued messages in one task of the platform thread. The
+  /// messages that are left are handled in a later task, so that the other
+  /// tasks of the platform thread are not delayed by isolates that receive
+  /// messages at high rates. At least one message is handled per task.
+  int64_t platform_isolate_message_drain_budget_us = 2000;
+
+  /// The number of compute isolates that the root isolate keeps ready to run,
+  /// once the first compute isolate was requested.
+  ///
+  /// This is used by the runInComputeIsolate API.
+  size_t compute_isolate_pool_size = 2;
+
   // If true, the UI thread is the platform thread on supported
   // platforms.
   bool merged_platform_ui_thread = true;
@@ -5,6 +5,7 @@
 #include "flutter/benchmarking/benchmarking.h"
 #include "flutter/display_list/testing/dl_test_snippets.h"
 #include "flutter/display_list/utils/dl_receiver_utils.h"
+#include "flutter/impeller/typographer/backends/skia/text_frame_skia.h"
 
 namespace flutter {
 
@@ -310,6 +311,63 @@ static void BM_DisplayListDispatchByVectorCull(
   }
 }
 
+// A text-heavy display list, like a scrolled list of paragraphs each made of
+// a few lines of text over a background.
+static sk_sp<DisplayList> BuildTextDisplayList(int paragraph_count) {
+  SkFont font = testing::CreateTestFontOfSize(14.0f);
+  auto text_frame = impeller::MakeTextFrameFromTextBlobSkia(
+      SkTextBlob::MakeFromString("The quick brown fox jumps", font));
+  DisplayListBuilder builder(/*prepare_rtree=*/true);
+  DlPaint background_paint(DlColor::kLightGrey());
+  DlPaint text_paint(DlColor::kBlack());
+  for (int i = 0; i < paragraph_count; i++) {
+    builder.Save();
+    builder.Translate(16.0f, i * 80.0f);
+    builder.DrawRect(DlRect::MakeWH(400, 72), background_paint);
+    for (int line = 0; line < 4; line++) {
+      text_paint.setColor(line == 0 ? DlColor::kBlue() : DlColor::kBlack());
+      builder.DrawTextFrame(text_frame, 8.0f, 18.0f * (line + 1), text_paint);
+    }
+    builder.Restore();
+  }
+  return builder.Build();
+}
+
+class DlTextFrameCounter : public DlOpReceiverIgnore {
+ public:
+  void drawTextFrame(const std::shared_ptr<impeller::TextFrame>& text_frame,
+                     DlScalar x,
+                     DlScalar y) override {
+    count++;
+  }
+
+  size_t count = 0;
+};
+
+// Finds the text frames of a display list by dispatching all of its ops, as
+// renderers did before the builder recorded a prepass table.
+static void BM_DisplayListTextFramesByDispatch(benchmark::State& state) {
+  auto display_list = BuildTextDisplayList(state.range(0));
+  while (state.KeepRunning()) {
+    DlTextFrameCounter counter;
+    display_list->Dispatch(counter);
+    benchmark::DoNotOptimize(counter.count);
+  }
+}
+
+// Finds the text frames of a display list from its prepass table.
+static void BM_DisplayListTextFramesByPrepassTable(benchmark::State& state) {
+  auto display_list = BuildTextDisplayList(state.range(0));
+  while (state.KeepRunning()) {
+    size_t count = 0;
+    for (const auto& entry : display_list->prepass_table()->text_frames) {
+      DlMatrix matrix = entry.matrix * DlMatrix::MakeTranslation(entry.offset);
+      count += matrix.GetMaxBasisLengthXY() > 0 ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+}
+
 BENCHMARK_CAPTURE(BM_DisplayListBuilderDefault,
                   kDefault,
                   DisplayListBuilderBenchmarkType::kDefault)
@@ -464,4 +522,14 @@ BENCHMARK_CAPTURE(BM_DisplayListDispatchByVectorCull,
                   DisplayListDispatchBenchmarkType::kCulledWithRtree)
     ->Unit(benchmark::kMicrosecond);
 
+BENCHMARK(BM_DisplayListTextFramesByDispatch)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_DisplayListTextFramesByPrepassTable)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace flutter
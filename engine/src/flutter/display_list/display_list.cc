@@ -6,6 +6,7 @@
 
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/dl_op_records.h"
+#include "flutter/fml/memory/memory_accounting.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -28,6 +29,8 @@ DisplayList::DisplayList()
       max_root_blend_mode_(DlBlendMode::kClear) {
   FML_DCHECK(offsets_.size() == 0u);
   FML_DCHECK(storage_.size() == 0u);
+  fml::MemoryAccounting::Add(fml::MemoryCategory::kDisplayList,
+                             fml::MemoryDomain::kCpu, bytes(false));
 }
 
 DisplayList::DisplayList(DisplayListStorage&& storage,
@@ -43,7 +46,8 @@ DisplayList::DisplayList(DisplayListStorage&& storage,
                          DlBlendMode max_root_blend_mode,
                          bool root_has_backdrop_filter,
                          bool root_is_unbounded,
-                         sk_sp<const DlRTree> rtree)
+                         sk_sp<const DlRTree> rtree,
+                         std::unique_ptr<const DlPrepassTable> prepass_table)
     : storage_(std::move(storage)),
       offsets_(std::move(offsets)),
       op_count_(op_count),
@@ -58,12 +62,19 @@ DisplayList::DisplayList(DisplayListStorage&& storage,
       root_has_backdrop_filter_(root_has_backdrop_filter),
       root_is_unbounded_(root_is_unbounded),
       max_root_blend_mode_(max_root_blend_mode),
-      rtree_(std::move(rtree)) {
+      rtree_(std::move(rtree)),
+      prepass_table_(std::move(prepass_table)) {
   FML_DCHECK(storage_.capacity() == storage_.size());
+  // Nested display lists account for their own bytes.
+  fml::MemoryAccounting::Add(fml::MemoryCategory::kDisplayList,
+                             fml::MemoryDomain::kCpu, bytes(false));
 }
 
 DisplayList::~DisplayList() {
   DisposeOps(storage_, offsets_);
+  fml::MemoryAccounting::Add(fml::MemoryCategory::kDisplayList,
+                             fml::MemoryDomain::kCpu,
+                             -static_cast<int64_t>(bytes(false)));
 }
 
 uint32_t DisplayList::next_unique_id() {
@@ -5,7 +5,10 @@
 #ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_H_
 #define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_H_
 
+#include <memory>
+
 #include "flutter/display_list/dl_blend_mode.h"
+#include "flutter/display_list/dl_prepass_table.h"
 #include "flutter/display_list/dl_storage.h"
 #include "flutter/display_list/geometry/dl_geometry_types.h"
 #include "flutter/display_list/geometry/dl_rtree.h"
@@ -356,6 +359,13 @@ class DisplayList : public SkRefCnt {
   /// be required for the indicated blend mode to do its work.
   DlBlendMode max_root_blend_mode() const { return max_root_blend_mode_; }
 
+  /// @brief    The text frames, backdrop filters and nested DisplayLists
+  ///           recorded in this DisplayList, or nullptr if it has none.
+  ///
+  /// Renderers can use this table to prepare for the ops that need work up
+  /// front, like glyph atlas updates, without dispatching the DisplayList.
+  const DlPrepassTable* prepass_table() const { return prepass_table_.get(); }
+
   /// @brief   Iterator utility class used for the |DisplayList::begin|
   ///          and |DisplayList::end| methods. It implements just the
   ///          basic methods to enable iteration-style for loops.
@@ -522,7 +532,8 @@ class DisplayList : public SkRefCnt {
               DlBlendMode max_root_blend_mode,
               bool root_has_backdrop_filter,
               bool root_is_unbounded,
-              sk_sp<const DlRTree> rtree);
+              sk_sp<const DlRTree> rtree,
+              std::unique_ptr<const DlPrepassTable> prepass_table);
 
   static uint32_t next_unique_id();
 
@@ -549,6 +560,7 @@ class DisplayList : public SkRefCnt {
   const DlBlendMode max_root_blend_mode_;
 
   const sk_sp<const DlRTree> rtree_;
+  const std::unique_ptr<const DlPrepassTable> prepass_table_;
 
   void DispatchOneOp(DlOpReceiver& receiver, const uint8_t* ptr) const;
 
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -6075,5 +6076,118 @@ TEST_F(DisplayListTest, DisplayListDetectsRuntimeEffect) {
   }
 }
 
+static std::shared_ptr<impeller::TextFrame> MakeTestTextFrame() {
+  SkFont font = CreateTestFontOfSize(20.0f);
+  return impeller::MakeTextFrameFromTextBlobSkia(
+      SkTextBlob::MakeFromText("Hello", 5, font));
+}
+
+TEST_F(DisplayListTest, PrepassTableRecordsTextFrames) {
+  DisplayListBuilder empty_builder;
+  empty_builder.DrawRect(DlRect::MakeLTRB(0, 0, 10, 10), DlPaint());
+  EXPECT_EQ(empty_builder.Build()->prepass_table(), nullptr);
+
+  auto text_frame = MakeTestTextFrame();
+  DisplayListBuilder builder;
+  builder.Translate(10, 20);
+  builder.Scale(2, 2);
+  DlPaint paint;
+  paint.setColor(DlColor::kRed());
+  paint.setDrawStyle(DlDrawStyle::kStroke);
+  paint.setStrokeWidth(3);
+  paint.setStrokeCap(DlStrokeCap::kRound);
+  builder.DrawTextFrame(text_frame, 5, 50, paint);
+  auto display_list = builder.Build();
+
+  const DlPrepassTable* table = display_list->prepass_table();
+  ASSERT_NE(table, nullptr);
+  EXPECT_TRUE(table->backdrops.empty());
+  EXPECT_TRUE(table->display_lists.empty());
+  ASSERT_EQ(table->text_frames.size(), 1u);
+  const DlPrepassTable::TextFrame& entry = table->text_frames[0];
+  EXPECT_EQ(entry.text_frame, text_frame);
+  EXPECT_EQ(entry.offset, DlPoint(5, 50));
+  EXPECT_EQ(entry.matrix, DlMatrix::MakeTranslation({10.0f, 20.0f}) *
+                              DlMatrix::MakeScale({2.0f, 2.0f, 1.0f}));
+  EXPECT_EQ(display_list->GetOpType(entry.op_index),
+            DisplayListOpType::kDrawTextFrame);
+  EXPECT_EQ(entry.color, DlColor::kRed());
+  EXPECT_EQ(entry.style, DlDrawStyle::kStroke);
+  EXPECT_EQ(entry.stroke_width, 3);
+  EXPECT_EQ(entry.stroke_cap, DlStrokeCap::kRound);
+}
+
+TEST_F(DisplayListTest, PrepassTableRecordsBackdropsAndNestedDisplayLists) {
+  DisplayListBuilder child_builder;
+  child_builder.DrawTextFrame(MakeTestTextFrame(), 0, 50, DlPaint());
+  auto child_dl = child_builder.Build();
+
+  DisplayListBuilder rect_builder;
+  rect_builder.DrawRect(DlRect::MakeLTRB(0, 0, 10, 10), DlPaint());
+  auto rect_dl = rect_builder.Build();
+
+  DisplayListBuilder builder;
+  builder.SaveLayer(std::nullopt, nullptr, &kTestBlurImageFilter1, 7);
+  builder.Restore();
+  builder.SaveLayer(std::nullopt, nullptr, &kTestBlurImageFilter1);
+  builder.Restore();
+  builder.Translate(0, 100);
+  builder.DrawDisplayList(child_dl);
+  // Display lists that have nothing to prepare for are not recorded.
+  builder.DrawDisplayList(rect_dl);
+  DlPaint save_paint;
+  save_paint.setImageFilter(kTestBlurImageFilter2.shared());
+  builder.SaveLayer(std::nullopt, &save_paint);
+  builder.DrawDisplayList(child_dl);
+  builder.Restore();
+  auto display_list = builder.Build();
+
+  const DlPrepassTable* table = display_list->prepass_table();
+  ASSERT_NE(table, nullptr);
+  EXPECT_TRUE(table->text_frames.empty());
+
+  ASSERT_EQ(table->backdrops.size(), 2u);
+  EXPECT_EQ(*table->backdrops[0].filter, kTestBlurImageFilter1);
+  EXPECT_EQ(table->backdrops[0].backdrop_id, 7);
+  EXPECT_EQ(table->backdrops[1].backdrop_id, std::nullopt);
+
+  ASSERT_EQ(table->display_lists.size(), 2u);
+  EXPECT_EQ(table->display_lists[0].display_list, child_dl);
+  EXPECT_EQ(table->display_lists[0].matrix,
+            DlMatrix::MakeTranslation({0.0f, 100.0f}));
+  EXPECT_FALSE(table->display_lists[0].is_filtered);
+  EXPECT_EQ(table->display_lists[1].display_list, child_dl);
+  EXPECT_TRUE(table->display_lists[1].is_filtered);
+}
+
+TEST_F(DisplayListTest, PrepassTableBoundsMatchRTree) {
+  auto text_frame = MakeTestTextFrame();
+  DisplayListBuilder builder(/*prepare_rtree=*/true);
+  builder.DrawTextFrame(text_frame, 0, 50, DlPaint());
+  builder.SaveLayer(std::nullopt, nullptr, &kTestBlurImageFilter1);
+  builder.Restore();
+  builder.DrawTextFrame(text_frame, 500, 550, DlPaint());
+  auto display_list = builder.Build();
+
+  const DlPrepassTable* table = display_list->prepass_table();
+  ASSERT_NE(table, nullptr);
+  ASSERT_EQ(table->text_frames.size(), 2u);
+  for (const DlPrepassTable::TextFrame& entry : table->text_frames) {
+    ASSERT_FALSE(entry.bounds.IsEmpty());
+    // The ops whose bounds intersect a cull rect are the ones that are
+    // dispatched when culling with it.
+    std::vector<DlIndex> indices = display_list->GetCulledIndices(entry.bounds);
+    EXPECT_NE(std::find(indices.begin(), indices.end(), entry.op_index),
+              indices.end());
+  }
+  EXPECT_FALSE(table->text_frames[0].bounds.IntersectsWithRect(
+      table->text_frames[1].bounds));
+  std::vector<DlIndex> indices =
+      display_list->GetCulledIndices(table->text_frames[0].bounds);
+  EXPECT_EQ(std::find(indices.begin(), indices.end(),
+                      table->text_frames[1].op_index),
+            indices.end());
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -34,6 +34,28 @@ static void CopyV(void* dst, const S* src, int n, Rest&&... rest) {
   CopyV(dst, std::forward<Rest>(rest)...);
 }
 
+// Sets the bounds of each prepass table entry to the union of the RTree
+// rects that were recorded for its op. Both the entries and the rects are
+// in the order of their ops.
+template <typename T>
+static void ResolvePrepassBounds(std::vector<T>& entries,
+                                 const std::vector<DlRect>& rects,
+                                 const std::vector<int>& indices) {
+  size_t rect_index = 0u;
+  for (T& entry : entries) {
+    const int op_index = static_cast<int>(entry.op_index);
+    while (rect_index < indices.size() && indices[rect_index] < op_index) {
+      rect_index++;
+    }
+    DlRect bounds;
+    for (size_t i = rect_index; i < indices.size() && indices[i] == op_index;
+         i++) {
+      bounds = bounds.IsEmpty() ? rects[i] : bounds.Union(rects[i]);
+    }
+    entry.bounds = bounds;
+  }
+}
+
 template <typename T, typename... Args>
 void* DisplayListBuilder::Push(size_t pod, Args&&... args) {
   // Plan out where and how large a space we need
@@ -81,6 +103,11 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
   if (rtree_data_.has_value()) {
     auto& rects = rtree_data_->rects;
     auto& indices = rtree_data_->indices;
+    if (prepass_table_) {
+      ResolvePrepassBounds(prepass_table_->text_frames, rects, indices);
+      ResolvePrepassBounds(prepass_table_->backdrops, rects, indices);
+      ResolvePrepassBounds(prepass_table_->display_lists, rects, indices);
+    }
     rtree = sk_make_sp<DlRTree>(rects.data(), rects.size(), indices.data(),
                                 [](int id) { return id >= 0; });
     // RTree bounds may be tighter due to applying filter bounds
@@ -108,12 +135,14 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
   std::vector<size_t> offsets;
   std::swap(offsets, offsets_);
   std::swap(storage, storage_);
+  std::unique_ptr<const DlPrepassTable> prepass_table =
+      std::move(prepass_table_);
 
   return sk_sp<DisplayList>(new DisplayList(
       std::move(storage), std::move(offsets), count, nested_bytes, nested_count,
       total_depth, bounds, opacity_compatible, is_safe, affects_transparency,
       max_root_blend_mode, root_has_backdrop_filter, root_is_unbounded,
-      std::move(rtree)));
+      std::move(rtree), std::move(prepass_table)));
 }
 
 static constexpr DlRect kEmpty = DlRect();
@@ -522,6 +551,11 @@ void DisplayListBuilder::saveLayer(const DlRect& bounds,
     if (backdrop) {
       Push<SaveLayerBackdropOp>(0, options, record_bounds, backdrop,
                                 backdrop_id);
+      DlPrepassTable::Backdrop& entry =
+          prepass_table().backdrops.emplace_back();
+      entry.filter = backdrop->shared();
+      entry.backdrop_id = backdrop_id;
+      entry.op_index = op_index_ - 1;
     } else {
       Push<SaveLayerOp>(0, options, record_bounds);
     }
@@ -1595,6 +1629,14 @@ void DisplayListBuilder::DrawDisplayList(const sk_sp<DisplayList> display_list,
   DlPaint current_paint = current_;
   Push<DrawDisplayListOp>(0, display_list,
                           opacity < SK_Scalar1 ? opacity : SK_Scalar1);
+  if (display_list->prepass_table()) {
+    DlPrepassTable::NestedDisplayList& entry =
+        prepass_table().display_lists.emplace_back();
+    entry.display_list = display_list;
+    entry.matrix = GetMatrix();
+    entry.op_index = op_index_ - 1;
+    entry.is_filtered = IsInFilteredLayer();
+  }
 
   // This depth increment accounts for every draw call in the child
   // DisplayList and is in addition to the implicit depth increment
@@ -1688,6 +1730,7 @@ void DisplayListBuilder::drawTextFrame(
 #endif  // OS_FUCHSIA
   if (unclipped) {
     Push<DrawTextFrameOp>(0, text_frame, x, y);
+    RecordPrepassTextFrame(text_frame, x, y);
     // There is no way to query if the glyphs of a text blob overlap and
     // there are no current guarantees from either Skia or Impeller that
     // they will protect overlapping glyphs from the effects of overdraw
@@ -1698,6 +1741,23 @@ void DisplayListBuilder::drawTextFrame(
   }
 }
 
+void DisplayListBuilder::RecordPrepassTextFrame(
+    const std::shared_ptr<impeller::TextFrame>& text_frame,
+    DlScalar x,
+    DlScalar y) {
+  DlPrepassTable::TextFrame& entry = prepass_table().text_frames.emplace_back();
+  entry.text_frame = text_frame;
+  entry.offset = DlPoint(x, y);
+  entry.matrix = GetMatrix();
+  entry.op_index = op_index_ - 1;
+  entry.color = current_.getColor();
+  entry.style = current_.getDrawStyle();
+  entry.stroke_width = current_.getStrokeWidth();
+  entry.stroke_miter = current_.getStrokeMiter();
+  entry.stroke_cap = current_.getStrokeCap();
+  entry.stroke_join = current_.getStrokeJoin();
+}
+
 void DisplayListBuilder::DrawTextFrame(
     const std::shared_ptr<impeller::TextFrame>& text_frame,
     DlScalar x,
@@ -1855,6 +1915,22 @@ bool DisplayListBuilder::SaveInfo::AccumulateBoundsLocal(const DlRect& bounds) {
   return true;
 }
 
+DlPrepassTable& DisplayListBuilder::prepass_table() {
+  if (!prepass_table_) {
+    prepass_table_ = std::make_unique<DlPrepassTable>();
+  }
+  return *prepass_table_;
+}
+
+bool DisplayListBuilder::IsInFilteredLayer() const {
+  for (const SaveInfo& save : save_stack_) {
+    if (save.is_save_layer && save.layer_info->filter) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool DisplayListBuilder::paint_nops_on_transparency() {
   // SkImageFilter::canComputeFastBounds tests for transparency behavior
   // This test assumes that the blend mode checked down below will
@@ -638,6 +638,10 @@ class DisplayListBuilder final : public virtual DlCanvas,
   std::vector<SaveInfo> save_stack_;
   std::optional<RTreeData> rtree_data_;
 
+  // The ops that renderers prepare for before rendering, created when the
+  // first of them is recorded.
+  std::unique_ptr<DlPrepassTable> prepass_table_;
+
   DlPaint current_;
 
   // Returns a reference to the SaveInfo structure at the top of the current
@@ -839,6 +843,21 @@ class DisplayListBuilder final : public virtual DlCanvas,
   bool AccumulateBounds(const DlRect& bounds) {
     return AccumulateBounds(bounds, current_info(), op_index_);
   }
+
+  // Returns the prepass table of the DisplayList being built, creating it
+  // if necessary.
+  DlPrepassTable& prepass_table();
+
+  // Records the text frame that was just pushed, along with the current
+  // transform and paint attributes, in the prepass table.
+  void RecordPrepassTextFrame(
+      const std::shared_ptr<impeller::TextFrame>& text_frame,
+      DlScalar x,
+      DlScalar y);
+
+  // Returns true if any enclosing saveLayer applies an image filter to
+  // its contents.
+  bool IsInFilteredLayer() const;
 };
 
 }  // namespace flutter
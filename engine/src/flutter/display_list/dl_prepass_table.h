@@ -0,0 +1,86 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DL_PREPASS_TABLE_H_
+#define FLUTTER_DISPLAY_LIST_DL_PREPASS_TABLE_H_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "flutter/display_list/dl_color.h"
+#include "flutter/display_list/dl_paint.h"
+#include "flutter/display_list/effects/dl_image_filter.h"
+#include "flutter/display_list/geometry/dl_geometry_types.h"
+#include "flutter/impeller/typographer/text_frame.h"
+#include "third_party/skia/include/core/SkRefCnt.h"
+
+namespace flutter {
+
+class DisplayList;
+
+/// @brief   The ops of a DisplayList that a renderer must prepare for
+///          before it renders them, recorded by the DisplayListBuilder.
+///
+/// Renderers use this table to fill glyph atlases and to plan the sharing of
+/// backdrop filters without dispatching every op of the DisplayList. The
+/// entries of each list are in the order of their ops.
+///
+/// The bounds of each entry are the bounds of its op in the root coordinates
+/// of the DisplayList, as used by its RTree. They are only meaningful if the
+/// DisplayList has an RTree, and an op whose bounds do not intersect a cull
+/// rect is not dispatched when culling with that rect, unless the cull rect
+/// contains the bounds of the entire DisplayList.
+struct DlPrepassTable {
+  struct TextFrame {
+    std::shared_ptr<impeller::TextFrame> text_frame;
+    DlPoint offset;
+    // The transform from the text frame to the root of the DisplayList.
+    DlMatrix matrix;
+    DlRect bounds;
+    // The index of the op in the DisplayList.
+    uint32_t op_index;
+
+    // The paint attributes that affect the rendering of the glyphs.
+    DlColor color;
+    DlDrawStyle style;
+    DlScalar stroke_width;
+    DlScalar stroke_miter;
+    DlStrokeCap stroke_cap;
+    DlStrokeJoin stroke_join;
+  };
+
+  struct Backdrop {
+    std::shared_ptr<DlImageFilter> filter;
+    std::optional<int64_t> backdrop_id;
+    DlRect bounds;
+    // The index of the op in the DisplayList.
+    uint32_t op_index;
+  };
+
+  struct NestedDisplayList {
+    sk_sp<DisplayList> display_list;
+    // The transform from the nested display list to the root of this one.
+    DlMatrix matrix;
+    DlRect bounds;
+    // The index of the op in the DisplayList.
+    uint32_t op_index;
+    // Whether the op is inside a saveLayer with an image filter, which may
+    // read contents of the nested display list from outside of a cull rect.
+    bool is_filtered;
+  };
+
+  std::vector<TextFrame> text_frames;
+  std::vector<Backdrop> backdrops;
+  std::vector<NestedDisplayList> display_lists;
+
+  bool is_empty() const {
+    return text_frames.empty() && backdrops.empty() && display_lists.empty();
+  }
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DL_PREPASS_TABLE_H_
@@ -20,6 +20,15 @@ DlImage::DlImage() = default;
 
 DlImage::~DlImage() = default;
 
+void DlImage::AccountForImageMemory() const {
+  std::call_once(memory_accounted_, [this]() {
+    accounted_memory_.emplace(fml::MemoryCategory::kImage,
+                              isTextureBacked() ? fml::MemoryDomain::kGpu
+                                                : fml::MemoryDomain::kCpu,
+                              GetApproximateByteSize());
+  });
+}
+
 int DlImage::width() const {
   return dimensions().fWidth;
 };
@@ -6,12 +6,14 @@
 #define FLUTTER_DISPLAY_LIST_IMAGE_DL_IMAGE_H_
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 
 #include "flutter/display_list/geometry/dl_geometry_types.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/memory/memory_accounting.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkRefCnt.h"
 
@@ -91,6 +93,14 @@ class DlImage : public SkRefCnt {
   ///
   virtual size_t GetApproximateByteSize() const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Accounts for the allocation of this image as held by
+  ///             `dart:ui` images until this image is destroyed. The
+  ///             allocation is only counted once, however many `dart:ui`
+  ///             images share this image.
+  ///
+  void AccountForImageMemory() const;
+
   //----------------------------------------------------------------------------
   /// @return     The width of the pixel grid. A convenience method that calls
   ///             |DlImage::dimensions|.
@@ -149,6 +159,10 @@ class DlImage : public SkRefCnt {
 
  protected:
   DlImage();
+
+ private:
+  mutable std::once_flag memory_accounted_;
+  mutable std::optional<fml::AccountedMemory> accounted_memory_;
 };
 
 }  // namespace flutter
@@ -0,0 +1,38 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/image/dl_image.h"
+#include "flutter/fml/memory/memory_accounting.h"
+#include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+namespace flutter {
+namespace testing {
+
+static int64_t GetImageBytes() {
+  return fml::MemoryAccounting::GetBytes(fml::MemoryCategory::kImage,
+                                         fml::MemoryDomain::kCpu);
+}
+
+TEST(DisplayListImage, AccountsForImageMemoryOnce) {
+  const int64_t initial_bytes = GetImageBytes();
+
+  SkBitmap bitmap;
+  ASSERT_TRUE(bitmap.tryAllocN32Pixels(16, 16));
+  sk_sp<DlImage> image = DlImage::Make(bitmap.asImage());
+  ASSERT_FALSE(image->isTextureBacked());
+  EXPECT_EQ(GetImageBytes(), initial_bytes);
+
+  // Like an image that is shared by two dart:ui images.
+  image->AccountForImageMemory();
+  image->AccountForImageMemory();
+  EXPECT_EQ(GetImageBytes() - initial_bytes,
+            static_cast<int64_t>(image->GetApproximateByteSize()));
+
+  image.reset();
+  EXPECT_EQ(GetImageBytes(), initial_bytes);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -73,6 +73,11 @@ void MutatorsStack::PushClipPath(const SkPath& path) {
   vector_.push_back(element);
 }
 
+void MutatorsStack::PushClipPath(const DlPath& path) {
+  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(path);
+  vector_.push_back(element);
+}
+
 void MutatorsStack::PushTransform(const SkMatrix& matrix) {
   std::shared_ptr<Mutator> element = std::make_shared<Mutator>(matrix);
   vector_.push_back(element);
@@ -91,6 +96,10 @@ void MutatorsStack::PushBackdropFilter(
   vector_.push_back(element);
 }
 
+void MutatorsStack::Push(std::shared_ptr<Mutator> mutator) {
+  vector_.push_back(std::move(mutator));
+}
+
 void MutatorsStack::Pop() {
   vector_.pop_back();
 }
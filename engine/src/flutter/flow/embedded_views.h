@@ -6,6 +6,7 @@
 #define FLUTTER_FLOW_EMBEDDED_VIEWS_H_
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -78,36 +79,11 @@ class ImageFilterMutation {
 // clipped. One mutation object must only contain one type of mutation.
 class Mutator {
  public:
-  Mutator(const Mutator& other) {
-    type_ = other.type_;
-    switch (other.type_) {
-      case kClipRect:
-        rect_ = other.rect_;
-        break;
-      case kClipRRect:
-        rrect_ = other.rrect_;
-        break;
-      case kClipPath:
-        path_ = new SkPath(*other.path_);
-        break;
-      case kTransform:
-        matrix_ = other.matrix_;
-        break;
-      case kOpacity:
-        alpha_ = other.alpha_;
-        break;
-      case kBackdropFilter:
-        filter_mutation_ = other.filter_mutation_;
-        break;
-      default:
-        break;
-    }
-  }
+  Mutator(const Mutator& other) = default;
 
   explicit Mutator(const SkRect& rect) : type_(kClipRect), rect_(rect) {}
   explicit Mutator(const SkRRect& rrect) : type_(kClipRRect), rrect_(rrect) {}
-  explicit Mutator(const SkPath& path)
-      : type_(kClipPath), path_(new SkPath(path)) {}
+  explicit Mutator(const SkPath& path) : Mutator(DlPath(path)) {}
   explicit Mutator(const SkMatrix& matrix)
       : type_(kTransform), matrix_(matrix) {}
   explicit Mutator(const int& alpha) : type_(kOpacity), alpha_(alpha) {}
@@ -119,7 +95,10 @@ class Mutator {
 
   explicit Mutator(const DlRect& rect) : Mutator(ToSkRect(rect)) {}
   explicit Mutator(const DlRoundRect& rrect) : Mutator(ToSkRRect(rrect)) {}
-  explicit Mutator(const DlPath& path) : Mutator(path.GetSkPath()) {}
+  // The path shares its storage with the layer that clips, so clip path
+  // mutators are as cheap to copy as the other types.
+  explicit Mutator(const DlPath& path)
+      : type_(kClipPath), alpha_(0), path_(path) {}
   explicit Mutator(const DlMatrix& matrix) : Mutator(ToSkMatrix(matrix)) {}
   explicit Mutator(const std::shared_ptr<DlImageFilter>& filter,
                    const DlRect& filter_rect)
@@ -128,7 +107,8 @@ class Mutator {
   const MutatorType& GetType() const { return type_; }
   const SkRect& GetRect() const { return rect_; }
   const SkRRect& GetRRect() const { return rrect_; }
-  const SkPath& GetPath() const { return *path_; }
+  const SkPath& GetPath() const { return path_->GetSkPath(); }
+  const DlPath& GetDlPath() const { return *path_; }
   const SkMatrix& GetMatrix() const { return matrix_; }
   const ImageFilterMutation& GetFilterMutation() const {
     return *filter_mutation_;
@@ -164,11 +144,7 @@ class Mutator {
     return type_ == kClipRect || type_ == kClipRRect || type_ == kClipPath;
   }
 
-  ~Mutator() {
-    if (type_ == kClipPath) {
-      delete path_;
-    }
-  };
+  ~Mutator() = default;
 
  private:
   MutatorType type_;
@@ -179,10 +155,10 @@ class Mutator {
     SkRect rect_;
     SkRRect rrect_;
     SkMatrix matrix_;
-    SkPath* path_;
     int alpha_;
   };
 
+  std::optional<DlPath> path_;
   std::shared_ptr<ImageFilterMutation> filter_mutation_;
 };  // Mutator
 
@@ -202,12 +178,18 @@ class MutatorsStack {
   void PushClipRect(const SkRect& rect);
   void PushClipRRect(const SkRRect& rrect);
   void PushClipPath(const SkPath& path);
+  void PushClipPath(const DlPath& path);
   void PushTransform(const SkMatrix& matrix);
   void PushOpacity(const int& alpha);
   // `filter_rect` is in global coordinates.
   void PushBackdropFilter(const std::shared_ptr<DlImageFilter>& filter,
                           const SkRect& filter_rect);
 
+  // Pushes a mutator that may be shared with other stacks. Mutators are
+  // immutable, so the layer state that a mutator describes only needs to
+  // allocate it once per frame, however many platform views it applies to.
+  void Push(std::shared_ptr<Mutator> mutator);
+
   // Removes the `Mutator` on the top of the stack
   // and destroys it.
   void Pop();
@@ -239,7 +221,12 @@ class MutatorsStack {
       return false;
     }
     for (size_t i = 0; i < vector_.size(); i++) {
-      if (*vector_[i] != *other.vector_[i]) {
+      // Mutators shared by views under the same layer states within a frame
+      // are trivially equal. Layer states are created again on every
+      // preroll, so stacks from different frames never share mutators and
+      // are always compared by value.
+      if (vector_[i] != other.vector_[i] &&
+          *vector_[i] != *other.vector_[i]) {
         return false;
       }
     }
@@ -280,11 +267,17 @@ class EmbeddedViewParams {
       : matrix_(matrix),
         size_points_(size_points),
         mutators_stack_(std::move(mutators_stack)) {
-    SkPath path;
     SkRect starting_rect = SkRect::MakeSize(size_points);
-    path.addRect(starting_rect);
-    path.transform(matrix);
-    final_bounding_rect_ = path.getBounds();
+    if (matrix.hasPerspective()) {
+      SkPath path;
+      path.addRect(starting_rect);
+      path.transform(matrix);
+      final_bounding_rect_ = path.getBounds();
+    } else {
+      // Affine transforms map the rect to a parallelogram, whose bounds are
+      // those of its corners.
+      final_bounding_rect_ = matrix.mapRect(starting_rect);
+    }
   }
 
   // The transformation Matrix corresponding to the sum of all the
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/embedded_views.h"
+
+#include <memory>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/flow/layers/layer_state_stack.h"
+
+namespace flutter {
+namespace {
+
+constexpr DlScalar kScreenWidth = 1080;
+constexpr DlScalar kScreenHeight = 2400;
+
+// Prerolls platform views nested under the transforms, clips and opacity of
+// a scrolling list of rounded cards, and compares their params against the
+// previous frame, as the embedders do to skip unchanged views.
+void BM_PrerollNestedPlatformViews(benchmark::State& state) {
+  const int64_t view_count = state.range(0);
+  const DlRect screen_rect = DlRect::MakeWH(kScreenWidth, kScreenHeight);
+  const DlRect card_rect = DlRect::MakeWH(kScreenWidth, 400);
+  const DlRoundRect card_rrect = DlRoundRect::MakeRectXY(card_rect, 16, 16);
+  const DlPath card_path = DlPath::MakeOval(card_rect.Expand(-8.0f));
+  const SkSize view_size = SkSize::Make(kScreenWidth - 32, 360);
+
+  LayerStateStack state_stack;
+  std::vector<std::unique_ptr<EmbeddedViewParams>> previous_params(view_count);
+  while (state.KeepRunning()) {
+    state_stack.set_preroll_delegate(screen_rect, DlMatrix());
+    auto viewport = state_stack.save();
+    viewport.clipRect(screen_rect, false);
+    viewport.translate(0, -100);
+    size_t unchanged_count = 0;
+    for (int64_t i = 0; i < view_count; i++) {
+      auto card = state_stack.save();
+      card.translate(0, i * card_rect.GetHeight());
+      card.clipRRect(card_rrect, true);
+      card.clipPath(card_path, true);
+      card.applyOpacity(card_rect, 0.9f);
+      card.translate(16, 20);
+
+      MutatorsStack mutators;
+      state_stack.fill(&mutators);
+      auto params = std::make_unique<EmbeddedViewParams>(
+          ToSkMatrix(state_stack.matrix()), view_size, std::move(mutators));
+      if (previous_params[i] && *previous_params[i] == *params) {
+        unchanged_count++;
+      }
+      previous_params[i] = std::move(params);
+    }
+    benchmark::DoNotOptimize(unchanged_count);
+  }
+}
+
+BENCHMARK(BM_PrerollNestedPlatformViews)->RangeMultiplier(2)->Range(1, 32);
+
+}  // namespace
+}  // namespace flutter
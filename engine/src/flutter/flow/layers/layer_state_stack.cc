@@ -248,8 +248,8 @@ class OpacityEntry : public LayerStateStack::StateEntry {
     stack->outstanding_.save_layer_bounds = old_bounds_;
     stack->outstanding_.opacity = old_opacity_;
   }
-  void update_mutators(MutatorsStack* mutators_stack) const override {
-    mutators_stack->PushOpacity(DlColor::toAlpha(opacity_));
+  std::shared_ptr<Mutator> make_mutator() const override {
+    return std::make_shared<Mutator>(int{DlColor::toAlpha(opacity_)});
   }
 
  private:
@@ -282,7 +282,7 @@ class ImageFilterEntry : public LayerStateStack::StateEntry {
   }
 
   // There is no ImageFilter mutator currently
-  // void update_mutators(MutatorsStack* mutators_stack) const override;
+  // std::shared_ptr<Mutator> make_mutator() const override;
 
  private:
   const DlRect bounds_;
@@ -314,7 +314,7 @@ class ColorFilterEntry : public LayerStateStack::StateEntry {
   }
 
   // There is no ColorFilter mutator currently
-  // void update_mutators(MutatorsStack* mutators_stack) const override;
+  // std::shared_ptr<Mutator> make_mutator() const override;
 
  private:
   const DlRect bounds_;
@@ -368,8 +368,8 @@ class TranslateEntry : public LayerStateStack::StateEntry {
   void apply(LayerStateStack* stack) const override {
     stack->delegate_->translate(tx_, ty_);
   }
-  void update_mutators(MutatorsStack* mutators_stack) const override {
-    mutators_stack->PushTransform(SkMatrix::Translate(tx_, ty_));
+  std::shared_ptr<Mutator> make_mutator() const override {
+    return std::make_shared<Mutator>(SkMatrix::Translate(tx_, ty_));
   }
 
  private:
@@ -386,8 +386,8 @@ class TransformMatrixEntry : public LayerStateStack::StateEntry {
   void apply(LayerStateStack* stack) const override {
     stack->delegate_->transform(matrix_);
   }
-  void update_mutators(MutatorsStack* mutators_stack) const override {
-    mutators_stack->PushTransform(ToSkMatrix(matrix_));
+  std::shared_ptr<Mutator> make_mutator() const override {
+    return std::make_shared<Mutator>(matrix_);
   }
 
  private:
@@ -417,8 +417,8 @@ class ClipRectEntry : public LayerStateStack::StateEntry {
     stack->delegate_->clipRect(clip_rect_, DlCanvas::ClipOp::kIntersect,
                                is_aa_);
   }
-  void update_mutators(MutatorsStack* mutators_stack) const override {
-    mutators_stack->PushClipRect(ToSkRect(clip_rect_));
+  std::shared_ptr<Mutator> make_mutator() const override {
+    return std::make_shared<Mutator>(clip_rect_);
   }
 
  private:
@@ -437,8 +437,8 @@ class ClipRRectEntry : public LayerStateStack::StateEntry {
     stack->delegate_->clipRRect(clip_rrect_, DlCanvas::ClipOp::kIntersect,
                                 is_aa_);
   }
-  void update_mutators(MutatorsStack* mutators_stack) const override {
-    mutators_stack->PushClipRRect(ToSkRRect(clip_rrect_));
+  std::shared_ptr<Mutator> make_mutator() const override {
+    return std::make_shared<Mutator>(clip_rrect_);
   }
 
  private:
@@ -458,8 +458,8 @@ class ClipPathEntry : public LayerStateStack::StateEntry {
     stack->delegate_->clipPath(clip_path_, DlCanvas::ClipOp::kIntersect,
                                is_aa_);
   }
-  void update_mutators(MutatorsStack* mutators_stack) const override {
-    mutators_stack->PushClipPath(clip_path_.GetSkPath());
+  std::shared_ptr<Mutator> make_mutator() const override {
+    return std::make_shared<Mutator>(clip_path_);
   }
 
  private:
@@ -630,6 +630,17 @@ void LayerStateStack::reapply_all() {
   FML_DCHECK(attributes == outstanding_);
 }
 
+void LayerStateStack::StateEntry::update_mutators(
+    MutatorsStack* mutators_stack) const {
+  if (!made_mutator_) {
+    mutator_ = make_mutator();
+    made_mutator_ = true;
+  }
+  if (mutator_) {
+    mutators_stack->Push(mutator_);
+  }
+}
+
 void LayerStateStack::fill(MutatorsStack* mutators) {
   for (auto& state : state_stack_) {
     state->update_mutators(mutators);
@@ -388,11 +388,20 @@ class LayerStateStack {
     virtual void apply(LayerStateStack* stack) const = 0;
     virtual void reapply(LayerStateStack* stack) const { apply(stack); }
     virtual void restore(LayerStateStack* stack) const {}
-    virtual void update_mutators(MutatorsStack* mutators_stack) const {}
+
+    // Pushes the mutator for this state, if it has one. The mutator is only
+    // created once and is shared by every platform view below this state.
+    void update_mutators(MutatorsStack* mutators_stack) const;
 
    protected:
     StateEntry() = default;
 
+    virtual std::shared_ptr<Mutator> make_mutator() const { return nullptr; }
+
+   private:
+    mutable std::shared_ptr<Mutator> mutator_;
+    mutable bool made_mutator_ = false;
+
     FML_DISALLOW_COPY_ASSIGN_AND_MOVE(StateEntry);
   };
   friend class SaveEntry;
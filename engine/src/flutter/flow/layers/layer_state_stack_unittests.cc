@@ -541,5 +541,26 @@ TEST(LayerStateStack, ColorFilterAndImageFilterInteraction) {
   ASSERT_EQ(state_stack.outstanding_color_filter(), nullptr);
 }
 
+TEST(LayerStateStack, FillSharesMutators) {
+  LayerStateStack state_stack;
+  state_stack.set_preroll_delegate(DlRect::MakeWH(100, 100), DlMatrix());
+  auto mutator = state_stack.save();
+  mutator.translate(10, 10);
+  mutator.clipPath(DlPath::MakeOval(DlRect::MakeWH(50, 50)), true);
+  mutator.applyOpacity(DlRect::MakeWH(50, 50), 0.5f);
+
+  MutatorsStack first;
+  state_stack.fill(&first);
+  MutatorsStack second;
+  state_stack.fill(&second);
+  ASSERT_EQ(first.stack_count(), 3u);
+  ASSERT_TRUE(first == second);
+  for (auto first_iter = first.Begin(), second_iter = second.Begin();
+       first_iter != first.End(); ++first_iter, ++second_iter) {
+    EXPECT_EQ(first_iter->get(), second_iter->get());
+  }
+  EXPECT_EQ(first.Begin()->get()->GetType(), MutatorType::kTransform);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -27,7 +27,8 @@ void PlatformViewLayer::Preroll(PrerollContext* context) {
   context->state_stack.fill(&mutators);
   std::unique_ptr<EmbeddedViewParams> params =
       std::make_unique<EmbeddedViewParams>(
-          ToSkMatrix(context->state_stack.matrix()), ToSkSize(size_), mutators);
+          ToSkMatrix(context->state_stack.matrix()), ToSkSize(size_),
+          std::move(mutators));
   context->view_embedder->PrerollCompositeEmbeddedView(view_id_,
                                                        std::move(params));
   context->view_embedder->PushVisitedPlatformView(view_id_);
@@ -189,6 +189,19 @@ TEST(MutatorsStack, Equality) {
   ASSERT_TRUE(stack == stack_other);
 }
 
+TEST(MutatorsStack, SharedMutatorsAreEqual) {
+  auto mutator = std::make_shared<Mutator>(SkMatrix::Scale(2, 2));
+  MutatorsStack stack;
+  stack.Push(mutator);
+  MutatorsStack stack_other;
+  stack_other.Push(mutator);
+  ASSERT_TRUE(stack == stack_other);
+  ASSERT_EQ(stack.Bottom()->get(), mutator.get());
+
+  stack_other.PushOpacity(240);
+  ASSERT_TRUE(stack != stack_other);
+}
+
 TEST(Mutator, Initialization) {
   SkRect rect = SkRect::MakeEmpty();
   Mutator mutator = Mutator(rect);
@@ -205,6 +218,12 @@ TEST(Mutator, Initialization) {
   ASSERT_TRUE(mutator3.GetType() == MutatorType::kClipPath);
   ASSERT_TRUE(mutator3.GetPath() == path);
 
+  DlPath dl_path(DlPath::MakeOval(DlRect::MakeLTRB(0, 0, 10, 10)));
+  Mutator dl_mutator = Mutator(dl_path);
+  ASSERT_TRUE(dl_mutator.GetType() == MutatorType::kClipPath);
+  ASSERT_TRUE(dl_mutator.GetDlPath() == dl_path);
+  ASSERT_TRUE(dl_mutator.GetPath() == dl_path.GetSkPath());
+
   SkMatrix matrix;
   matrix.setIdentity();
   Mutator mutator4 = Mutator(matrix);
@@ -237,6 +256,12 @@ TEST(Mutator, CopyConstructor) {
   Mutator copy3 = Mutator(mutator3);
   ASSERT_TRUE(mutator3 == copy3);
 
+  DlPath dl_path(DlPath::MakeOval(DlRect::MakeLTRB(0, 0, 10, 10)));
+  Mutator dl_mutator = Mutator(dl_path);
+  Mutator dl_copy = Mutator(dl_mutator);
+  ASSERT_TRUE(dl_mutator == dl_copy);
+  ASSERT_TRUE(dl_copy.GetDlPath() == dl_path);
+
   SkMatrix matrix;
   matrix.setIdentity();
   Mutator mutator4 = Mutator(matrix);
@@ -233,6 +233,8 @@ void RasterCache::EvictUnusedCacheEntries() {
 
 void RasterCache::EndFrame() {
   UpdateMetrics();
+  accounted_memory_.SetBytes(layer_metrics_.total_bytes() +
+                             picture_metrics_.total_bytes());
   TraceStatsToTimeline();
 }
 
@@ -240,6 +242,7 @@ void RasterCache::Clear() {
   cache_.clear();
   picture_metrics_ = {};
   layer_metrics_ = {};
+  accounted_memory_.SetBytes(0);
 }
 
 size_t RasterCache::GetCachedEntriesCount() const {
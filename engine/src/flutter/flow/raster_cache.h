@@ -14,6 +14,7 @@
 #include "flutter/flow/raster_cache_key.h"
 #include "flutter/flow/raster_cache_util.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/memory/memory_accounting.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkMatrix.h"
@@ -265,6 +266,9 @@ class RasterCache {
   RasterCacheMetrics picture_metrics_;
   mutable RasterCacheKey::Map<Entry> cache_;
   bool checkerboard_images_ = false;
+  // The bytes of the cached images as of the end of the last frame.
+  fml::AccountedMemory accounted_memory_{fml::MemoryCategory::kRasterCache,
+                                         fml::MemoryDomain::kGpu};
 
   void TraceStatsToTimeline() const;
 
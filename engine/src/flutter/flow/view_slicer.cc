@@ -4,12 +4,92 @@
 
 #include "flutter/flow/view_slicer.h"
 
+#include <algorithm>
 #include <unordered_map>
+#include <vector>
+
 #include "flow/embedded_views.h"
 #include "fml/logging.h"
 
 namespace flutter {
 
+namespace {
+
+// The bounds of a platform view, rounded both ways.
+struct PlatformViewBounds {
+  // The position of the view in the composition order.
+  size_t index;
+  DlIRect rounded_in;
+  DlIRect rounded_out;
+};
+
+// Computes the area of the slice drawn above any of the platform views that
+// precede it in the composition order, including its own.
+//
+// Rather than intersecting the slice's region with each of those views, the
+// rects of the region and the views are swept from left to right, so that
+// only the pairs that overlap horizontally are tested.
+DlRect ComputeOverlayRect(
+    const EmbedderViewSlice& slice,
+    size_t slice_index,
+    const std::vector<PlatformViewBounds>& views_by_left) {
+  std::vector<DlIRect> rects = slice.getRegion().getRects();
+  std::sort(rects.begin(), rects.end(),
+            [](const DlIRect& a, const DlIRect& b) {
+              return a.GetLeft() < b.GetLeft();
+            });
+
+  DlRect overlay_rect;
+  std::vector<const PlatformViewBounds*> active_views;
+  size_t next_view = 0;
+  for (const DlIRect& rect : rects) {
+    while (next_view < views_by_left.size() &&
+           views_by_left[next_view].rounded_in.GetLeft() < rect.GetRight()) {
+      const PlatformViewBounds& view = views_by_left[next_view++];
+      if (view.index <= slice_index && !view.rounded_in.IsEmpty()) {
+        active_views.push_back(&view);
+      }
+    }
+
+    for (size_t i = 0; i < active_views.size(); /*no-op*/) {
+      const PlatformViewBounds& view = *active_views[i];
+      // The remaining rects start at or after this one, so views that end
+      // before it cannot intersect any of them.
+      if (view.rounded_in.GetRight() <= rect.GetLeft()) {
+        active_views[i] = active_views.back();
+        active_views.pop_back();
+        continue;
+      }
+      i++;
+
+      // Ignore intersections of single width/height on the edge of the
+      // platform view.
+      // This is to address the following performance issue when interleaving
+      // adjacent platform views and layers: Since we `roundOut` both platform
+      // view rects and the layer rects, as long as the coordinate is
+      // fractional, there will be an intersection of a single pixel width (or
+      // height) after rounding out, even if they do not intersect before
+      // rounding out. We have to round out both platform view rect and the
+      // layer rect. Rounding in platform view rect will result in missing
+      // pixel on the intersection edge. Rounding in layer rect will result in
+      // missing pixel on the edge of the layer on top of the platform view.
+      if (!rect.IntersectsWithRect(view.rounded_in)) {
+        continue;
+      }
+
+      // Limit the number of native views, so it doesn't grow forever.
+      //
+      // In this case, the rects are merged into a single one that is the
+      // union of all the rects.
+      overlay_rect = overlay_rect.Union(
+          DlRect::Make(rect.IntersectionOrEmpty(view.rounded_out)));
+    }
+  }
+  return overlay_rect;
+}
+
+}  // namespace
+
 std::unordered_map<int64_t, SkRect> SliceViews(
     DlCanvas* background_canvas,
     const std::vector<int64_t>& composition_order,
@@ -20,6 +100,25 @@ std::unordered_map<int64_t, SkRect> SliceViews(
 
   auto current_frame_view_count = composition_order.size();
 
+  // Round the platform view rects once, sorted by their left edges for the
+  // sweep in `ComputeOverlayRect`.
+  std::vector<PlatformViewBounds> views_by_left;
+  views_by_left.reserve(current_frame_view_count);
+  for (size_t i = 0; i < current_frame_view_count; i++) {
+    auto maybe_rect = view_rects.find(composition_order[i]);
+    FML_DCHECK(maybe_rect != view_rects.end());
+    if (maybe_rect == view_rects.end()) {
+      continue;
+    }
+    const DlRect view_rect = ToDlRect(maybe_rect->second);
+    views_by_left.push_back(
+        {i, DlIRect::RoundIn(view_rect), DlIRect::RoundOut(view_rect)});
+  }
+  std::sort(views_by_left.begin(), views_by_left.end(),
+            [](const PlatformViewBounds& a, const PlatformViewBounds& b) {
+              return a.rounded_in.GetLeft() < b.rounded_in.GetLeft();
+            });
+
   // Restore the clip context after exiting this method since it's changed
   // below.
   DlAutoCanvasRestore save(background_canvas, /*do_save=*/true);
@@ -33,79 +132,14 @@ std::unordered_map<int64_t, SkRect> SliceViews(
 
     slice->end_recording();
 
-    DlRect full_joined_rect;
-
     // Determinate if Flutter UI intersects with any of the previous
     // platform views stacked by z position.
     //
     // This is done by querying the r-tree that holds the records for the
     // picture recorder corresponding to the flow layers added after a platform
     // view layer.
-    for (int j = i; j >= 0; j--) {
-      int64_t current_view_id = composition_order[j];
-      auto maybe_rect = view_rects.find(current_view_id);
-      FML_DCHECK(maybe_rect != view_rects.end());
-      if (maybe_rect == view_rects.end()) {
-        continue;
-      }
-
-      const SkRect current_view_rect = maybe_rect->second;
-      const DlIRect rounded_in_platform_view_rect =
-          DlIRect::RoundIn(ToDlRect(current_view_rect));
-      const DlRect rounded_out_platform_view_rect =
-          DlRect::RoundOut(ToDlRect(current_view_rect));
-
-      // Each rect corresponds to a native view that renders Flutter UI.
-      std::vector<DlIRect> intersection_rects =
-          slice->region(ToDlRect(current_view_rect)).getRects();
-
-      // Ignore intersections of single width/height on the edge of the platform
-      // view.
-      // This is to address the following performance issue when interleaving
-      // adjacent platform views and layers: Since we `roundOut` both platform
-      // view rects and the layer rects, as long as the coordinate is
-      // fractional, there will be an intersection of a single pixel width (or
-      // height) after rounding out, even if they do not intersect before
-      // rounding out. We have to round out both platform view rect and the
-      // layer rect. Rounding in platform view rect will result in missing pixel
-      // on the intersection edge. Rounding in layer rect will result in missing
-      // pixel on the edge of the layer on top of the platform view.
-      for (auto it = intersection_rects.begin(); it != intersection_rects.end();
-           /*no-op*/) {
-        // If intersection_rect does not intersect with the *rounded in*
-        // platform view rect, then the intersection must be a single pixel
-        // width (or height) on edge.
-        if (!it->IntersectsWithRect(rounded_in_platform_view_rect)) {
-          it = intersection_rects.erase(it);
-        } else {
-          ++it;
-        }
-      }
-
-      // Limit the number of native views, so it doesn't grow forever.
-      //
-      // In this case, the rects are merged into a single one that is the union
-      // of all the rects.
-      DlRect partial_joined_rect;
-      for (const DlIRect& rect : intersection_rects) {
-        partial_joined_rect = partial_joined_rect.Union(DlRect::Make(rect));
-      }
-
-      // Get the intersection rect with the `current_view_rect`,
-      if (partial_joined_rect.IntersectsWithRect(
-              rounded_out_platform_view_rect)) {
-        // Join the `partial_joined_rect` into `full_joined_rect` to get the
-        // rect above the current `slice`, only if it intersects the indicated
-        // view. This should always be the case because we just deleted any
-        // rects that don't intersect the "rounded-in" view, so they must
-        // all intersect the "rounded-out" view (or the partial join could
-        // be empty in which case this would be a NOP). Either way, the
-        // penalty for not checking the return value of the intersect method
-        // would be to join a non-overlapping rectangle into the overlay
-        // bounds - if the above implementation ever changes - so we check it.
-        full_joined_rect = full_joined_rect.Union(partial_joined_rect);
-      }
-    }
+    const DlRect full_joined_rect =
+        ComputeOverlayRect(*slice, i, views_by_left);
 
     if (!full_joined_rect.IsEmpty()) {
       overlay_layers.insert({view_id, ToSkRect(full_joined_rect)});
@@ -0,0 +1,68 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/view_slicer.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/dl_builder.h"
+
+namespace flutter {
+namespace {
+
+constexpr SkScalar kScreenWidth = 1080;
+constexpr SkScalar kScreenHeight = 2400;
+
+// Lays out platform views in a grid, with Flutter UI (a header and a button)
+// drawn over each of them, like a feed of ads or map tiles.
+void BM_SliceViews(benchmark::State& state) {
+  const int64_t view_count = state.range(0);
+  const SkScalar view_width = kScreenWidth / 2;
+  const SkScalar view_height = kScreenHeight / ((view_count + 1) / 2);
+
+  std::vector<int64_t> composition_order;
+  std::unordered_map<int64_t, SkRect> view_rects;
+  for (int64_t i = 0; i < view_count; i++) {
+    composition_order.push_back(i);
+    view_rects[i] = SkRect::MakeXYWH((i % 2) * view_width,
+                                     (i / 2) * view_height,  //
+                                     view_width, view_height);
+  }
+
+  DlPaint paint;
+  paint.setColor(DlColor::kBlack());
+  const SkRect screen_rect = SkRect::MakeWH(kScreenWidth, kScreenHeight);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>> slices;
+    for (int64_t i = 0; i < view_count; i++) {
+      auto slice = std::make_unique<DisplayListEmbedderViewSlice>(screen_rect);
+      const SkRect& view_rect = view_rects[i];
+      slice->canvas()->DrawRect(
+          SkRect::MakeXYWH(view_rect.x(), view_rect.y() + view_height / 2,
+                           view_width, 20),
+          paint);
+      slice->canvas()->DrawRect(
+          SkRect::MakeXYWH(view_rect.x() + 16, view_rect.bottom() - 40.5,
+                           100.5, 32),
+          paint);
+      slices[i] = std::move(slice);
+    }
+    DisplayListBuilder background_canvas(screen_rect);
+    state.ResumeTiming();
+
+    auto overlay_layers = SliceViews(&background_canvas, composition_order,
+                                     slices, view_rects);
+    benchmark::DoNotOptimize(overlay_layers);
+  }
+}
+
+BENCHMARK(BM_SliceViews)->DenseRange(10, 50, 10);
+
+}  // namespace
+}  // namespace flutter
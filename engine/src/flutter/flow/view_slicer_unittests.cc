@@ -134,5 +134,34 @@ TEST(ViewSlicerTest, OverlappingTwoPVs) {
   EXPECT_EQ(overlay->second, SkRect::MakeLTRB(0, 0, 100, 100));
 }
 
+TEST(ViewSlicerTest, IgnoresPlatformViewsAboveSlice) {
+  DisplayListBuilder builder(SkRect::MakeLTRB(0, 0, 100, 100));
+
+  std::vector<int64_t> composition_order = {1, 2, 3};
+  std::unordered_map<int64_t, std::unique_ptr<EmbedderViewSlice>> slices;
+  // The first slice only overlaps the views composited above it, so it is
+  // drawn into the background.
+  AddSliceOfSize(slices, 1, SkRect::MakeLTRB(50, 0, 100, 100));
+  AddSliceOfSize(slices, 2, SkRect::MakeLTRB(0, 0, 0, 0));
+  AddSliceOfSize(slices, 3, SkRect::MakeLTRB(10, 10, 90, 20));
+
+  std::unordered_map<int64_t, SkRect> view_rects = {
+      {1, SkRect::MakeLTRB(0, 0, 50, 50)},      //
+      {2, SkRect::MakeLTRB(50, 0, 100, 50)},    //
+      {3, SkRect::MakeLTRB(50, 50, 100, 100)},  //
+  };
+
+  auto computed_overlays =
+      SliceViews(&builder, composition_order, slices, view_rects);
+
+  EXPECT_EQ(computed_overlays.size(), 1u);
+
+  auto overlay = computed_overlays.find(3);
+  ASSERT_NE(overlay, computed_overlays.end());
+
+  // The third slice overlaps the first two views, but not its own.
+  EXPECT_EQ(overlay->second, SkRect::MakeLTRB(10, 10, 90, 20));
+}
+
 }  // namespace testing
 }  // namespace flutter
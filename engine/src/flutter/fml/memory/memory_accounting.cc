@@ -0,0 +1,156 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/memory/memory_accounting.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "flutter/fml/logging.h"
+
+namespace fml {
+
+namespace {
+
+struct AtomicCounter {
+  std::atomic<int64_t> bytes{0};
+  std::atomic<int64_t> high_water_mark_bytes{0};
+};
+
+AtomicCounter gCounters[kMemoryCategoryCount][kMemoryDomainCount];
+std::atomic<bool> gHighWaterMarkTrackingEnabled{false};
+
+AtomicCounter& GetCounter(MemoryCategory category, MemoryDomain domain) {
+  size_t category_index = static_cast<size_t>(category);
+  size_t domain_index = static_cast<size_t>(domain);
+  FML_DCHECK(category_index < kMemoryCategoryCount);
+  FML_DCHECK(domain_index < kMemoryDomainCount);
+  return gCounters[category_index][domain_index];
+}
+
+void RaiseHighWaterMark(AtomicCounter& counter, int64_t bytes) {
+  int64_t high_water_mark =
+      counter.high_water_mark_bytes.load(std::memory_order_relaxed);
+  while (bytes > high_water_mark &&
+         !counter.high_water_mark_bytes.compare_exchange_weak(
+             high_water_mark, bytes, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+void MemoryAccounting::Add(MemoryCategory category,
+                           MemoryDomain domain,
+                           int64_t bytes) {
+  if (bytes == 0) {
+    return;
+  }
+  AtomicCounter& counter = GetCounter(category, domain);
+  int64_t new_bytes =
+      counter.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  if (bytes > 0 &&
+      gHighWaterMarkTrackingEnabled.load(std::memory_order_relaxed)) {
+    RaiseHighWaterMark(counter, new_bytes);
+  }
+}
+
+int64_t MemoryAccounting::GetBytes(MemoryCategory category,
+                                   MemoryDomain domain) {
+  return GetCounter(category, domain).bytes.load(std::memory_order_relaxed);
+}
+
+MemoryAccounting::Snapshot MemoryAccounting::GetSnapshot() {
+  Snapshot snapshot;
+  bool tracking = IsHighWaterMarkTrackingEnabled();
+  for (size_t i = 0; i < kMemoryCategoryCount; i++) {
+    for (size_t j = 0; j < kMemoryDomainCount; j++) {
+      const AtomicCounter& counter = gCounters[i][j];
+      Counter& result = snapshot.counters[i][j];
+      result.bytes = counter.bytes.load(std::memory_order_relaxed);
+      if (tracking) {
+        // An update may have been counted, but not yet raised the
+        // high-water mark.
+        result.high_water_mark_bytes = std::max(
+            result.bytes,
+            counter.high_water_mark_bytes.load(std::memory_order_relaxed));
+      }
+    }
+  }
+  return snapshot;
+}
+
+void MemoryAccounting::SetHighWaterMarkTrackingEnabled(bool enabled) {
+  bool was_enabled = gHighWaterMarkTrackingEnabled.exchange(enabled);
+  if (enabled && !was_enabled) {
+    ResetHighWaterMarks();
+  }
+}
+
+bool MemoryAccounting::IsHighWaterMarkTrackingEnabled() {
+  return gHighWaterMarkTrackingEnabled.load(std::memory_order_relaxed);
+}
+
+void MemoryAccounting::ResetHighWaterMarks() {
+  for (auto& category_counters : gCounters) {
+    for (AtomicCounter& counter : category_counters) {
+      counter.high_water_mark_bytes.store(
+          counter.bytes.load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+    }
+  }
+}
+
+const char* MemoryAccounting::GetCategoryName(MemoryCategory category) {
+  switch (category) {
+    case MemoryCategory::kDisplayList:
+      return "displayList";
+    case MemoryCategory::kImage:
+      return "image";
+    case MemoryCategory::kRasterCache:
+      return "rasterCache";
+    case MemoryCategory::kHostBuffer:
+      return "hostBuffer";
+    case MemoryCategory::kGlyphAtlas:
+      return "glyphAtlas";
+    case MemoryCategory::kRenderTargetCache:
+      return "renderTargetCache";
+    case MemoryCategory::kFontCache:
+      return "fontCache";
+  }
+  FML_UNREACHABLE();
+}
+
+const char* MemoryAccounting::GetDomainName(MemoryDomain domain) {
+  switch (domain) {
+    case MemoryDomain::kCpu:
+      return "cpu";
+    case MemoryDomain::kGpu:
+      return "gpu";
+  }
+  FML_UNREACHABLE();
+}
+
+AccountedMemory::AccountedMemory(MemoryCategory category,
+                                 MemoryDomain domain,
+                                 int64_t bytes)
+    : category_(category), domain_(domain), bytes_(bytes) {
+  MemoryAccounting::Add(category_, domain_, bytes_);
+}
+
+AccountedMemory::~AccountedMemory() {
+  MemoryAccounting::Add(category_, domain_, -bytes_);
+}
+
+void AccountedMemory::Set(MemoryDomain domain, int64_t bytes) {
+  if (domain == domain_) {
+    MemoryAccounting::Add(category_, domain_, bytes - bytes_);
+  } else {
+    MemoryAccounting::Add(category_, domain_, -bytes_);
+    MemoryAccounting::Add(category_, domain, bytes);
+    domain_ = domain;
+  }
+  bytes_ = bytes;
+}
+
+}  // namespace fml
@@ -0,0 +1,141 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_MEMORY_MEMORY_ACCOUNTING_H_
+#define FLUTTER_FML_MEMORY_MEMORY_ACCOUNTING_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flutter/fml/macros.h"
+
+namespace fml {
+
+/// The subsystems of the engine whose memory is accounted for by
+/// |MemoryAccounting|.
+enum class MemoryCategory {
+  /// The storage of the display lists.
+  kDisplayList,
+  /// The images held by |dart:ui| images, each counted once however many
+  /// |dart:ui| images share it.
+  kImage,
+  /// The entries of the raster caches.
+  kRasterCache,
+  /// The buffers of the Impeller host buffers.
+  kHostBuffer,
+  /// The textures of the Impeller glyph atlases.
+  kGlyphAtlas,
+  /// The textures of the Impeller render target caches.
+  kRenderTargetCache,
+  /// The glyph cache of Skia, which the engine shares with text layout.
+  kFontCache,
+};
+
+static constexpr size_t kMemoryCategoryCount =
+    static_cast<size_t>(MemoryCategory::kFontCache) + 1;
+
+/// Where accounted memory resides.
+enum class MemoryDomain {
+  kCpu,
+  kGpu,
+};
+
+static constexpr size_t kMemoryDomainCount =
+    static_cast<size_t>(MemoryDomain::kGpu) + 1;
+
+//------------------------------------------------------------------------------
+/// @brief      Process-wide counters of the bytes of memory used by the
+///             subsystems of the engine, split by category and domain.
+///
+///             The counters are atomics that subsystems update as they
+///             allocate and free memory, so updating them is cheap and may
+///             happen on any thread. Subsystems that only know their total
+///             size, like caches that are trimmed at the end of a frame,
+///             update the counters with an |AccountedMemory| instead.
+///
+///             The high-water marks of the counters are only tracked once
+///             enabled, as that adds a compare-and-swap to every update.
+///
+class MemoryAccounting {
+ public:
+  struct Counter {
+    int64_t bytes = 0;
+    /// The largest value of |bytes| since high-water mark tracking was
+    /// enabled or the high-water marks were reset, or 0 if tracking is
+    /// disabled.
+    int64_t high_water_mark_bytes = 0;
+  };
+
+  struct Snapshot {
+    Counter counters[kMemoryCategoryCount][kMemoryDomainCount];
+
+    const Counter& Get(MemoryCategory category, MemoryDomain domain) const {
+      return counters[static_cast<size_t>(category)]
+                     [static_cast<size_t>(domain)];
+    }
+  };
+
+  /// Adds `bytes`, which may be negative, to the counter of a category.
+  static void Add(MemoryCategory category, MemoryDomain domain, int64_t bytes);
+
+  /// Returns the current bytes of the counter of a category.
+  static int64_t GetBytes(MemoryCategory category, MemoryDomain domain);
+
+  /// Returns the current values of all counters. The counters are read one
+  /// after the other, so the snapshot is not atomic as a whole.
+  static Snapshot GetSnapshot();
+
+  /// Enables or disables the tracking of the high-water marks. Enabling it
+  /// starts the high-water marks at the current values of the counters.
+  static void SetHighWaterMarkTrackingEnabled(bool enabled);
+
+  static bool IsHighWaterMarkTrackingEnabled();
+
+  /// Resets the high-water marks to the current values of the counters.
+  static void ResetHighWaterMarks();
+
+  /// Returns a stable name of a category, like "displayList".
+  static const char* GetCategoryName(MemoryCategory category);
+
+  /// Returns a stable name of a domain, "cpu" or "gpu".
+  static const char* GetDomainName(MemoryDomain domain);
+
+ private:
+  FML_DISALLOW_IMPLICIT_CONSTRUCTORS(MemoryAccounting);
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Accounts for the bytes of an object of a category for as long
+///             as the object lives.
+///
+///             This class is not thread-safe, but different instances may be
+///             used on different threads.
+///
+class AccountedMemory {
+ public:
+  explicit AccountedMemory(MemoryCategory category,
+                           MemoryDomain domain = MemoryDomain::kCpu,
+                           int64_t bytes = 0);
+
+  ~AccountedMemory();
+
+  /// Updates the accounted bytes, and the domain they reside in.
+  void Set(MemoryDomain domain, int64_t bytes);
+
+  /// Updates the accounted bytes, keeping their domain.
+  void SetBytes(int64_t bytes) { Set(domain_, bytes); }
+
+  int64_t GetBytes() const { return bytes_; }
+
+ private:
+  const MemoryCategory category_;
+  MemoryDomain domain_;
+  int64_t bytes_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AccountedMemory);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_MEMORY_MEMORY_ACCOUNTING_H_
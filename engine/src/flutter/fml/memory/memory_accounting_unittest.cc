@@ -0,0 +1,109 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/memory/memory_accounting.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace {
+
+// The counters are process-wide, so the tests only look at how they change.
+
+TEST(MemoryAccountingTest, AccountedMemoryUpdatesCounters) {
+  int64_t cpu_bytes =
+      MemoryAccounting::GetBytes(MemoryCategory::kImage, MemoryDomain::kCpu);
+  int64_t gpu_bytes =
+      MemoryAccounting::GetBytes(MemoryCategory::kImage, MemoryDomain::kGpu);
+  {
+    AccountedMemory memory(MemoryCategory::kImage, MemoryDomain::kCpu, 100);
+    EXPECT_EQ(MemoryAccounting::GetBytes(MemoryCategory::kImage,
+                                         MemoryDomain::kCpu),
+              cpu_bytes + 100);
+
+    memory.SetBytes(40);
+    EXPECT_EQ(MemoryAccounting::GetBytes(MemoryCategory::kImage,
+                                         MemoryDomain::kCpu),
+              cpu_bytes + 40);
+
+    memory.Set(MemoryDomain::kGpu, 70);
+    EXPECT_EQ(MemoryAccounting::GetBytes(MemoryCategory::kImage,
+                                         MemoryDomain::kCpu),
+              cpu_bytes);
+    EXPECT_EQ(MemoryAccounting::GetBytes(MemoryCategory::kImage,
+                                         MemoryDomain::kGpu),
+              gpu_bytes + 70);
+  }
+  EXPECT_EQ(
+      MemoryAccounting::GetBytes(MemoryCategory::kImage, MemoryDomain::kGpu),
+      gpu_bytes);
+}
+
+TEST(MemoryAccountingTest, CountsConcurrentUpdates) {
+  int64_t bytes = MemoryAccounting::GetBytes(MemoryCategory::kHostBuffer,
+                                             MemoryDomain::kGpu);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([]() {
+      for (int j = 0; j < 1000; j++) {
+        MemoryAccounting::Add(MemoryCategory::kHostBuffer, MemoryDomain::kGpu,
+                              3);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(MemoryAccounting::GetBytes(MemoryCategory::kHostBuffer,
+                                       MemoryDomain::kGpu),
+            bytes + 12000);
+  MemoryAccounting::Add(MemoryCategory::kHostBuffer, MemoryDomain::kGpu,
+                        -12000);
+}
+
+TEST(MemoryAccountingTest, TracksHighWaterMarksOnceEnabled) {
+  const MemoryCategory category = MemoryCategory::kGlyphAtlas;
+  const MemoryDomain domain = MemoryDomain::kGpu;
+  MemoryAccounting::SetHighWaterMarkTrackingEnabled(false);
+  EXPECT_EQ(MemoryAccounting::GetSnapshot()
+                .Get(category, domain)
+                .high_water_mark_bytes,
+            0);
+
+  MemoryAccounting::SetHighWaterMarkTrackingEnabled(true);
+  int64_t bytes = MemoryAccounting::GetBytes(category, domain);
+  {
+    AccountedMemory memory(category, domain, 500);
+    memory.SetBytes(200);
+    MemoryAccounting::Counter counter =
+        MemoryAccounting::GetSnapshot().Get(category, domain);
+    EXPECT_EQ(counter.bytes, bytes + 200);
+    EXPECT_EQ(counter.high_water_mark_bytes, bytes + 500);
+
+    MemoryAccounting::ResetHighWaterMarks();
+    EXPECT_EQ(MemoryAccounting::GetSnapshot()
+                  .Get(category, domain)
+                  .high_water_mark_bytes,
+              bytes + 200);
+  }
+  MemoryAccounting::SetHighWaterMarkTrackingEnabled(false);
+}
+
+TEST(MemoryAccountingTest, NamesAreStable) {
+  EXPECT_EQ(std::string(MemoryAccounting::GetCategoryName(
+                MemoryCategory::kDisplayList)),
+            "displayList");
+  EXPECT_EQ(std::string(MemoryAccounting::GetCategoryName(
+                MemoryCategory::kRenderTargetCache)),
+            "renderTargetCache");
+  EXPECT_EQ(std::string(MemoryAccounting::GetDomainName(MemoryDomain::kGpu)),
+            "gpu");
+}
+
+}  // namespace
+}  // namespace fml
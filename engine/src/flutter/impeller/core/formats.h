@@ -96,6 +96,12 @@ constexpr const char* StorageModeToString(StorageMode mode) {
 ///             esoteric formats and use blit passes to convert to a
 ///             non-esoteric pass.
 ///
+///             Block compressed formats are prefixed with the name of the
+///             compression scheme. They store texels in blocks of 4x4 texels
+///             and may only be sampled from. Their availability varies by
+///             device and must be checked with
+///             `Capabilities::SupportsCompressedPixelFormat`.
+///
 enum class PixelFormat : uint8_t {
   kUnknown,
   kA8UNormInt,
@@ -114,8 +120,29 @@ enum class PixelFormat : uint8_t {
   kS8UInt,
   kD24UnormS8Uint,
   kD32FloatS8UInt,
+  // Block compressed formats.
+  kBC1RGBAUNorm,
+  kBC3RGBAUNorm,
+  kBC7RGBAUNorm,
+  kETC2R8G8B8UNorm,
+  kETC2R8G8B8A8UNorm,
+  kASTC4x4UNorm,
 };
 
+constexpr bool IsBlockCompressed(PixelFormat format) {
+  switch (format) {
+    case PixelFormat::kBC1RGBAUNorm:
+    case PixelFormat::kBC3RGBAUNorm:
+    case PixelFormat::kBC7RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8UNorm:
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+    case PixelFormat::kASTC4x4UNorm:
+      return true;
+    default:
+      return false;
+  }
+}
+
 constexpr bool IsDepthWritable(PixelFormat format) {
   switch (format) {
     case PixelFormat::kD24UnormS8Uint:
@@ -171,6 +198,18 @@ constexpr const char* PixelFormatToString(PixelFormat format) {
       return "D24UnormS8Uint";
     case PixelFormat::kD32FloatS8UInt:
       return "D32FloatS8UInt";
+    case PixelFormat::kBC1RGBAUNorm:
+      return "BC1RGBAUNorm";
+    case PixelFormat::kBC3RGBAUNorm:
+      return "BC3RGBAUNorm";
+    case PixelFormat::kBC7RGBAUNorm:
+      return "BC7RGBAUNorm";
+    case PixelFormat::kETC2R8G8B8UNorm:
+      return "ETC2R8G8B8UNorm";
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+      return "ETC2R8G8B8A8UNorm";
+    case PixelFormat::kASTC4x4UNorm:
+      return "ASTC4x4UNorm";
   }
   FML_UNREACHABLE();
 }
@@ -463,9 +502,23 @@ IMPELLER_ENUM_IS_MASK(ColorWriteMaskBits);
 
 using ColorWriteMask = Mask<ColorWriteMaskBits>;
 
+//------------------------------------------------------------------------------
+/// @brief      The number of bytes used to store a single pixel of the given
+///             format.
+///
+///             Block compressed formats don't store individual pixels and
+///             return zero. Use `BytesForPixelFormatRegion` to compute the
+///             storage size of any format.
+///
 constexpr size_t BytesPerPixelForPixelFormat(PixelFormat format) {
   switch (format) {
     case PixelFormat::kUnknown:
+    case PixelFormat::kBC1RGBAUNorm:
+    case PixelFormat::kBC3RGBAUNorm:
+    case PixelFormat::kBC7RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8UNorm:
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+    case PixelFormat::kASTC4x4UNorm:
       return 0u;
     case PixelFormat::kA8UNormInt:
     case PixelFormat::kR8UNormInt:
@@ -493,6 +546,56 @@ constexpr size_t BytesPerPixelForPixelFormat(PixelFormat format) {
   return 0u;
 }
 
+/// The width and height in texels of a block of a block compressed format.
+static constexpr int64_t kCompressedBlockDimension = 4;
+
+constexpr size_t BytesPerBlockForPixelFormat(PixelFormat format) {
+  switch (format) {
+    case PixelFormat::kBC1RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8UNorm:
+      return 8u;
+    case PixelFormat::kBC3RGBAUNorm:
+    case PixelFormat::kBC7RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+    case PixelFormat::kASTC4x4UNorm:
+      return 16u;
+    default:
+      return 0u;
+  }
+}
+
+//------------------------------------------------------------------------------
+/// @brief      The number of bytes used to store a tightly packed row of
+///             `width` texels of the given format. For block compressed
+///             formats, this is a row of blocks.
+///
+constexpr size_t BytesPerRowForPixelFormat(PixelFormat format, int64_t width) {
+  if (width <= 0) {
+    return 0u;
+  }
+  if (IsBlockCompressed(format)) {
+    const auto blocks = (width + kCompressedBlockDimension - 1) /
+                        kCompressedBlockDimension;
+    return blocks * BytesPerBlockForPixelFormat(format);
+  }
+  return width * BytesPerPixelForPixelFormat(format);
+}
+
+//------------------------------------------------------------------------------
+/// @brief      The number of bytes used to store a tightly packed region of
+///             the given format and size.
+///
+constexpr size_t BytesForPixelFormatRegion(PixelFormat format, ISize size) {
+  if (size.IsEmpty()) {
+    return 0u;
+  }
+  auto rows = size.height;
+  if (IsBlockCompressed(format)) {
+    rows = (rows + kCompressedBlockDimension - 1) / kCompressedBlockDimension;
+  }
+  return rows * BytesPerRowForPixelFormat(format, size.width);
+}
+
 //------------------------------------------------------------------------------
 /// @brief      Describe the color attachment that will be used with this
 ///             pipeline.
@@ -35,6 +35,7 @@ HostBuffer::HostBuffer(const std::shared_ptr<Allocator>& allocator,
     FML_CHECK(device_buffer) << "Failed to allocate device buffer.";
     device_buffers_[i].push_back(device_buffer);
   }
+  UpdateAccountedMemory();
 }
 
 HostBuffer::~HostBuffer() {
@@ -105,6 +106,7 @@ bool HostBuffer::MaybeCreateNewBuffer() {
       return false;
     }
     device_buffers_[frame_index_].push_back(std::move(buffer));
+    UpdateAccountedMemory();
   }
   offset_ = 0;
   return true;
@@ -221,12 +223,23 @@ const std::shared_ptr<DeviceBuffer>& HostBuffer::GetCurrentBuffer() const {
   return device_buffers_[frame_index_][current_buffer_];
 }
 
+void HostBuffer::UpdateAccountedMemory() {
+  // One-off buffers of allocations larger than a block are owned by their
+  // buffer views, and are not accounted for.
+  size_t block_count = 0u;
+  for (const auto& buffers : device_buffers_) {
+    block_count += buffers.size();
+  }
+  accounted_memory_.SetBytes(block_count * kAllocatorBlockSize);
+}
+
 void HostBuffer::Reset() {
   // When resetting the host buffer state at the end of the frame, check if
   // there are any unused buffers and remove them.
   while (device_buffers_[frame_index_].size() > current_buffer_ + 1) {
     device_buffers_[frame_index_].pop_back();
   }
+  UpdateAccountedMemory();
 
   offset_ = 0u;
   current_buffer_ = 0u;
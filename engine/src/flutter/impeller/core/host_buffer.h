@@ -12,6 +12,7 @@
 #include <string>
 #include <type_traits>
 
+#include "flutter/fml/memory/memory_accounting.h"
 #include "impeller/core/allocator.h"
 #include "impeller/core/buffer_view.h"
 #include "impeller/core/platform.h"
@@ -153,6 +154,9 @@ class HostBuffer {
 
   const std::shared_ptr<DeviceBuffer>& GetCurrentBuffer() const;
 
+  /// Updates the accounted memory to the blocks of all arenas.
+  void UpdateAccountedMemory();
+
   [[nodiscard]] BufferView Emplace(const void* buffer, size_t length);
 
   explicit HostBuffer(const std::shared_ptr<Allocator>& allocator,
@@ -169,6 +173,8 @@ class HostBuffer {
   size_t current_buffer_ = 0u;
   size_t offset_ = 0u;
   size_t frame_index_ = 0u;
+  fml::AccountedMemory accounted_memory_{fml::MemoryCategory::kHostBuffer,
+                                         fml::MemoryDomain::kGpu};
 };
 
 }  // namespace impeller
@@ -985,6 +985,33 @@ TEST_P(AiksTest, CanEmptyPictureConvertToImage) {
   ASSERT_TRUE(OpenPlaygroundHere(recorder_builder.Build()));
 }
 
+TEST_P(AiksTest, CanRenderMultipleDisplayListsToTexturesAtOnce) {
+  AiksContext renderer(GetContext(), nullptr);
+
+  std::vector<sk_sp<flutter::DisplayList>> display_lists;
+  for (auto color : {DlColor::kRed(), DlColor::kGreen(), DlColor::kBlue()}) {
+    DisplayListBuilder recorder_builder;
+    DlPaint paint;
+    paint.setColor(color);
+    recorder_builder.DrawRect(SkRect::MakeXYWH(0, 0, 200, 200), paint);
+    display_lists.push_back(recorder_builder.Build());
+  }
+  const std::vector<ISize> sizes = {{200, 200}, {100, 200}, {200, 100}};
+
+  auto textures = DisplayListsToTextures(display_lists, sizes, renderer);
+  ASSERT_EQ(textures.size(), 3u);
+
+  DisplayListBuilder builder;
+  for (size_t i = 0; i < textures.size(); i++) {
+    ASSERT_NE(textures[i], nullptr);
+    EXPECT_EQ(textures[i]->GetSize(), sizes[i]);
+    builder.DrawImage(DlImageImpeller::Make(textures[i]),
+                      SkPoint::Make(i * 250, 0), {});
+  }
+
+  ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
+}
+
 TEST_P(AiksTest, DepthValuesForLineMode) {
   // Ensures that the additional draws created by line/polygon mode all
   // have the same depth values.
@@ -4,6 +4,7 @@
 
 #include "impeller/display_list/canvas.h"
 
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -38,6 +39,7 @@
 #include "impeller/entity/geometry/rect_geometry.h"
 #include "impeller/entity/geometry/round_rect_geometry.h"
 #include "impeller/entity/geometry/round_superellipse_geometry.h"
+#include "impeller/entity/geometry/shadow_vertices.h"
 #include "impeller/entity/geometry/stroke_path_geometry.h"
 #include "impeller/entity/save_layer_utils.h"
 #include "impeller/geometry/color.h"
@@ -158,6 +160,58 @@ static std::unique_ptr<EntityPassTarget> CreateRenderTarget(
       renderer.GetDeviceCapabilities().SupportsImplicitResolvingMSAA());
 }
 
+// A 64-bit hash of the verbs, points and conic weights of a path, which
+// identifies the same path across frames without converting it.
+static uint64_t HashPathContents(const SkPath& path) {
+  constexpr uint64_t kPrime = 0x100000001B3ull;
+  uint64_t hash = 0xCBF29CE484222325ull;
+  auto mix = [&hash](uint64_t value) { hash = (hash ^ value) * kPrime; };
+  auto mix_scalar = [&mix](SkScalar value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    mix(bits);
+  };
+
+  mix(static_cast<uint64_t>(path.getFillType()));
+  SkPath::Iter iterator(path, false);
+  SkPoint points[4];
+  SkPath::Verb verb;
+  while ((verb = iterator.next(points)) != SkPath::kDone_Verb) {
+    mix(verb);
+    int point_count = 0;
+    switch (verb) {
+      case SkPath::kMove_Verb:
+        point_count = 1;
+        break;
+      case SkPath::kLine_Verb:
+        point_count = 2;
+        break;
+      case SkPath::kConic_Verb:
+        mix_scalar(iterator.conicWeight());
+        [[fallthrough]];
+      case SkPath::kQuad_Verb:
+        point_count = 3;
+        break;
+      case SkPath::kCubic_Verb:
+        point_count = 4;
+        break;
+      case SkPath::kClose_Verb:
+      case SkPath::kDone_Verb:
+        break;
+    }
+    for (int i = 0; i < point_count; i++) {
+      mix_scalar(points[i].fX);
+      mix_scalar(points[i].fY);
+    }
+  }
+
+  // Final avalanche, as the multiply only carries bits upwards.
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
 }  // namespace
 
 Canvas::Canvas(ContentContext& renderer,
@@ -838,6 +892,36 @@ void Canvas::DrawVertices(const std::shared_ptr<VerticesGeometry>& vertices,
   AddRenderEntityToCurrentPass(entity);
 }
 
+bool Canvas::DrawShadowVertices(const flutter::DlPath& path,
+                                Sigma sigma,
+                                const Color& color) {
+  const SkPath& sk_path = path.GetSkPath();
+  if (sk_path.isInverseFillType() || !sk_path.isConvex()) {
+    return false;
+  }
+  const Scalar scale = GetCurrentTransform().GetMaxBasisLengthXY();
+  if (!(scale > 0)) {
+    return false;
+  }
+
+  const auto key = ShadowVerticesCache::Key::Make(HashPathContents(sk_path),
+                                                  sigma.sigma, scale);
+  std::shared_ptr<ShadowVertices> vertices =
+      renderer_.GetShadowVerticesCache().GetOrCreate(key, [&]() {
+        return ShadowVertices::Make(path.GetPath(), key.GetPenumbraRadius(),
+                                    key.GetScale(),
+                                    renderer_.GetTessellator());
+      });
+  if (!vertices) {
+    return false;
+  }
+
+  // The color, including its alpha, is carried by the vertices.
+  DrawVertices(std::make_shared<ShadowVerticesGeometry>(vertices, color),
+               BlendMode::kSourceOver, Paint{});
+  return true;
+}
+
 void Canvas::DrawAtlas(const std::shared_ptr<AtlasContents>& atlas_contents,
                        const Paint& paint) {
   atlas_contents->SetAlpha(paint.color.alpha);
@@ -1713,7 +1797,7 @@ bool Canvas::BlitToOnscreen() {
   return true;
 }
 
-void Canvas::EndReplay() {
+void Canvas::EndReplay(bool flush_command_buffers) {
   FML_DCHECK(render_passes_.size() == 1u);
   render_passes_.back().inline_pass_context->GetRenderPass();
   render_passes_.back().inline_pass_context->EndPass();
@@ -1726,7 +1810,7 @@ void Canvas::EndReplay() {
     BlitToOnscreen();
   }
 
-  if (!renderer_.GetContext()->FlushCommandBuffers()) {
+  if (flush_command_buffers && !renderer_.GetContext()->FlushCommandBuffers()) {
     // Not much we can do.
     VALIDATION_LOG << "Failed to submit command buffers";
   }
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "display_list/effects/dl_image_filter.h"
+#include "display_list/geometry/dl_path.h"
 #include "impeller/core/sampler_descriptor.h"
 #include "impeller/display_list/paint.h"
 #include "impeller/entity/contents/atlas_contents.h"
@@ -230,11 +231,25 @@ class Canvas {
   void DrawAtlas(const std::shared_ptr<AtlasContents>& atlas_contents,
                  const Paint& paint);
 
+  /// @brief Draws the Gaussian blurred silhouette of a convex path with a
+  ///        tessellated mesh that is cached across frames.
+  ///
+  /// @return Whether the shadow was drawn. Paths that have no mesh are left
+  ///         for the caller to draw with a mask blur.
+  bool DrawShadowVertices(const flutter::DlPath& path,
+                          Sigma sigma,
+                          const Color& color);
+
   void ClipGeometry(const Geometry& geometry,
                     Entity::ClipOperation clip_op,
                     bool is_aa = true);
 
-  void EndReplay();
+  /// @brief Ends the replay of the display list.
+  ///
+  /// @param flush_command_buffers Whether the enqueued command buffers are
+  ///        submitted. If false, the caller must flush them with
+  ///        `Context::FlushCommandBuffers`.
+  void EndReplay(bool flush_command_buffers = true);
 
   uint64_t GetOpDepth() const { return current_depth_; }
 
@@ -13,6 +13,7 @@
 #include "display_list/dl_sampling_options.h"
 #include "display_list/effects/dl_image_filter.h"
 #include "flutter/fml/logging.h"
+#include "impeller/base/validation.h"
 #include "impeller/core/formats.h"
 #include "impeller/display_list/aiks_context.h"
 #include "impeller/display_list/canvas.h"
@@ -608,6 +609,14 @@ void DlDispatcherBase::drawPath(const DlPath& path) {
   SimplifyOrDrawPath(GetCanvas(), path, paint_);
 }
 
+bool DlDispatcherBase::IsAnalyticShadowPath(const DlPath& path) {
+  DlRect rect;
+  bool closed;
+  SkRRect rrect;
+  return (path.IsRect(&rect, &closed) && closed) ||
+         (path.IsSkRRect(&rrect) && rrect.isSimple()) || path.IsOval(&rect);
+}
+
 void DlDispatcherBase::SimplifyOrDrawPath(Canvas& canvas,
                                           const DlPath& path,
                                           const Paint& paint) {
@@ -928,7 +937,14 @@ void DlDispatcherBase::drawShadow(const DlPath& path,
   GetCanvas().PreConcat(
       Matrix::MakeTranslation(Vector2(0, -occluder_z * light_position.y)));
 
-  SimplifyOrDrawPath(GetCanvas(), path, paint);
+  // Rectangles, simple round rectangles and ovals have analytic blurs. The
+  // shadows of other convex paths are drawn with a mesh that is tessellated
+  // once, rather than blurred every frame.
+  if (IsAnalyticShadowPath(path) ||
+      !GetCanvas().DrawShadowVertices(path, paint.mask_blur_descriptor->sigma,
+                                      spot_color)) {
+    SimplifyOrDrawPath(GetCanvas(), path, paint);
+  }
   AUTO_DEPTH_CHECK();
 
   GetCanvas().Restore();
@@ -976,262 +992,157 @@ void CanvasDlDispatcher::SetBackdropData(
   GetCanvas().SetBackdropData(std::move(backdrop), backdrop_count);
 }
 
-//// Text Frame Dispatcher
+//// First Pass Collector
 
-FirstPassDispatcher::FirstPassDispatcher(const ContentContext& renderer,
-                                         const Matrix& initial_matrix,
-                                         const Rect cull_rect)
-    : renderer_(renderer), matrix_(initial_matrix) {
-  cull_rect_state_.push_back(cull_rect);
+static Cap ToCap(flutter::DlStrokeCap cap) {
+  switch (cap) {
+    case flutter::DlStrokeCap::kButt:
+      return Cap::kButt;
+    case flutter::DlStrokeCap::kRound:
+      return Cap::kRound;
+    case flutter::DlStrokeCap::kSquare:
+      return Cap::kSquare;
+  }
+  return Cap::kButt;
 }
 
-FirstPassDispatcher::~FirstPassDispatcher() {
-  FML_DCHECK(cull_rect_state_.size() == 1);
+static Join ToJoin(flutter::DlStrokeJoin join) {
+  switch (join) {
+    case flutter::DlStrokeJoin::kMiter:
+      return Join::kMiter;
+    case flutter::DlStrokeJoin::kRound:
+      return Join::kRound;
+    case flutter::DlStrokeJoin::kBevel:
+      return Join::kBevel;
+  }
+  return Join::kMiter;
 }
 
-void FirstPassDispatcher::save() {
-  stack_.emplace_back(matrix_);
-  cull_rect_state_.push_back(cull_rect_state_.back());
+FirstPassCollector::FirstPassCollector(const ContentContext& renderer,
+                                       const Rect& cull_rect)
+    : renderer_(renderer), cull_rect_(cull_rect) {}
+
+FirstPassCollector::~FirstPassCollector() = default;
+
+void FirstPassCollector::Collect(const flutter::DisplayList& display_list) {
+  Collect(display_list, Matrix(), cull_rect_);
 }
 
-void FirstPassDispatcher::saveLayer(const DlRect& bounds,
-                                    const flutter::SaveLayerOptions options,
-                                    const flutter::DlImageFilter* backdrop,
-                                    std::optional<int64_t> backdrop_id) {
-  save();
+void FirstPassCollector::Collect(const flutter::DisplayList& display_list,
+                                 const Matrix& matrix,
+                                 std::optional<Rect> cull_rect) {
+  const flutter::DlPrepassTable* table = display_list.prepass_table();
+  if (table == nullptr) {
+    return;
+  }
 
-  backdrop_count_ += (backdrop == nullptr ? 0 : 1);
-  if (backdrop != nullptr && backdrop_id.has_value()) {
-    std::shared_ptr<flutter::DlImageFilter> shared_backdrop =
-        backdrop->shared();
-    std::unordered_map<int64_t, BackdropData>::iterator existing =
-        backdrop_data_.find(backdrop_id.value());
-    if (existing == backdrop_data_.end()) {
-      backdrop_data_[backdrop_id.value()] =
-          BackdropData{.backdrop_count = 1, .last_backdrop = shared_backdrop};
-    } else {
-      BackdropData& data = existing->second;
-      data.backdrop_count++;
-      if (data.all_filters_equal) {
-        data.all_filters_equal = (*data.last_backdrop == *shared_backdrop);
-        data.last_backdrop = shared_backdrop;
-      }
+  // Mirror the culling that dispatching the display list with the cull rect
+  // would apply, so that only the ops that will be rendered are collected.
+  std::optional<Rect> local_cull_rect;
+  if (cull_rect.has_value() && !cull_rect->IsMaximum() &&
+      !matrix.HasPerspective()) {
+    Rect local_cull_bounds = cull_rect->TransformBounds(matrix.Invert());
+    if (local_cull_bounds.IsEmpty()) {
+      return;
+    }
+    if (display_list.has_rtree() &&
+        !local_cull_bounds.Contains(display_list.GetBounds())) {
+      local_cull_rect = local_cull_bounds;
     }
   }
+  auto is_culled = [&local_cull_rect](const Rect& bounds) {
+    return local_cull_rect.has_value() &&
+           !local_cull_rect->IntersectsWithRect(bounds);
+  };
 
-  // This dispatcher does not track enough state to accurately compute
-  // cull rects with image filters.
-  auto global_cull_rect = cull_rect_state_.back();
-  if (has_image_filter_ || global_cull_rect.IsMaximum()) {
-    cull_rect_state_.back() = Rect::MakeMaximum();
-  } else {
-    auto global_save_bounds = bounds.TransformBounds(matrix_);
-    auto new_cull_rect = global_cull_rect.Intersection(global_save_bounds);
-    if (new_cull_rect.has_value()) {
-      cull_rect_state_.back() = new_cull_rect.value();
-    } else {
-      cull_rect_state_.back() = Rect::MakeLTRB(0, 0, 0, 0);
+  for (const flutter::DlPrepassTable::TextFrame& entry : table->text_frames) {
+    if (!is_culled(entry.bounds)) {
+      AddTextFrame(entry, matrix);
     }
   }
-}
-
-void FirstPassDispatcher::restore() {
-  matrix_ = stack_.back();
-  stack_.pop_back();
-  cull_rect_state_.pop_back();
-}
-
-void FirstPassDispatcher::translate(DlScalar tx, DlScalar ty) {
-  matrix_ = matrix_.Translate({tx, ty});
-}
-
-void FirstPassDispatcher::scale(DlScalar sx, DlScalar sy) {
-  matrix_ = matrix_.Scale({sx, sy, 1.0f});
-}
-
-void FirstPassDispatcher::rotate(DlScalar degrees) {
-  matrix_ = matrix_ * Matrix::MakeRotationZ(Degrees(degrees));
-}
-
-void FirstPassDispatcher::skew(DlScalar sx, DlScalar sy) {
-  matrix_ = matrix_ * Matrix::MakeSkew(sx, sy);
-}
-
-// clang-format off
-  // 2x3 2D affine subset of a 4x4 transform in row major order
-  void FirstPassDispatcher::transform2DAffine(DlScalar mxx, DlScalar mxy, DlScalar mxt,
-                                              DlScalar myx, DlScalar myy, DlScalar myt) {
-    matrix_ = matrix_ * Matrix::MakeColumn(
-        mxx,  myx,  0.0f, 0.0f,
-        mxy,  myy,  0.0f, 0.0f,
-        0.0f, 0.0f, 1.0f, 0.0f,
-        mxt,  myt,  0.0f, 1.0f
-    );
+  for (const flutter::DlPrepassTable::Backdrop& entry : table->backdrops) {
+    if (!is_culled(entry.bounds)) {
+      AddBackdrop(entry);
+    }
   }
-
-  // full 4x4 transform in row major order
-  void FirstPassDispatcher::transformFullPerspective(
-      DlScalar mxx, DlScalar mxy, DlScalar mxz, DlScalar mxt,
-      DlScalar myx, DlScalar myy, DlScalar myz, DlScalar myt,
-      DlScalar mzx, DlScalar mzy, DlScalar mzz, DlScalar mzt,
-      DlScalar mwx, DlScalar mwy, DlScalar mwz, DlScalar mwt) {
-    matrix_ = matrix_ * Matrix::MakeColumn(
-        mxx, myx, mzx, mwx,
-        mxy, myy, mzy, mwy,
-        mxz, myz, mzz, mwz,
-        mxt, myt, mzt, mwt
-    );
+  for (const flutter::DlPrepassTable::NestedDisplayList& entry :
+       table->display_lists) {
+    if (!is_culled(entry.bounds)) {
+      // Image filters may read the contents of the nested display list
+      // from outside of the cull rect.
+      Collect(*entry.display_list, matrix * entry.matrix,
+              entry.is_filtered ? std::nullopt : cull_rect);
+    }
   }
-// clang-format on
-
-void FirstPassDispatcher::transformReset() {
-  matrix_ = Matrix();
 }
 
-void FirstPassDispatcher::drawTextFrame(
-    const std::shared_ptr<impeller::TextFrame>& text_frame,
-    DlScalar x,
-    DlScalar y) {
+void FirstPassCollector::AddTextFrame(
+    const flutter::DlPrepassTable::TextFrame& entry,
+    const Matrix& matrix) {
+  const std::shared_ptr<TextFrame>& text_frame = entry.text_frame;
   GlyphProperties properties;
-  if (paint_.style == Paint::Style::kStroke) {
+  if (entry.style == flutter::DlDrawStyle::kStroke) {
     properties.stroke = true;
-    properties.stroke_cap = paint_.stroke_cap;
-    properties.stroke_join = paint_.stroke_join;
-    properties.stroke_miter = paint_.stroke_miter;
-    properties.stroke_width = paint_.stroke_width;
+    properties.stroke_cap = ToCap(entry.stroke_cap);
+    properties.stroke_join = ToJoin(entry.stroke_join);
+    properties.stroke_miter = entry.stroke_miter;
+    properties.stroke_width = entry.stroke_width;
   }
   if (text_frame->HasColor()) {
     // Alpha is always applied when rendering, remove it here so
     // we do not double-apply the alpha.
-    properties.color = paint_.color.WithAlpha(1.0);
+    properties.color = skia_conversions::ToColor(entry.color).WithAlpha(1.0);
   }
   auto scale = TextFrame::RoundScaledFontSize(
-      (matrix_ * Matrix::MakeTranslation(Point(x, y))).GetMaxBasisLengthXY());
+      (matrix * entry.matrix * Matrix::MakeTranslation(entry.offset))
+          .GetMaxBasisLengthXY());
 
   renderer_.GetLazyGlyphAtlas()->AddTextFrame(
       text_frame,                                       //
       scale,                                            //
-      Point(x, y),                                      //
+      entry.offset,                                     //
       (properties.stroke || text_frame->HasColor())     //
           ? std::optional<GlyphProperties>(properties)  //
           : std::nullopt                                //
   );
 }
 
-const Rect FirstPassDispatcher::GetCurrentLocalCullingBounds() const {
-  auto cull_rect = cull_rect_state_.back();
-  if (!cull_rect.IsEmpty() && !cull_rect.IsMaximum()) {
-    Matrix inverse = matrix_.Invert();
-    cull_rect = cull_rect.TransformBounds(inverse);
+void FirstPassCollector::AddBackdrop(
+    const flutter::DlPrepassTable::Backdrop& entry) {
+  backdrop_count_++;
+  if (!entry.backdrop_id.has_value()) {
+    return;
   }
-  return cull_rect;
-}
-
-void FirstPassDispatcher::drawDisplayList(
-    const sk_sp<flutter::DisplayList> display_list,
-    DlScalar opacity) {
-  [[maybe_unused]] size_t stack_depth = stack_.size();
-  save();
-  Paint old_paint = paint_;
-  paint_ = Paint{};
-  bool old_has_image_filter = has_image_filter_;
-  has_image_filter_ = false;
-
-  if (matrix_.HasPerspective()) {
-    display_list->Dispatch(*this);
+  std::unordered_map<int64_t, BackdropData>::iterator existing =
+      backdrop_data_.find(entry.backdrop_id.value());
+  if (existing == backdrop_data_.end()) {
+    backdrop_data_[entry.backdrop_id.value()] =
+        BackdropData{.backdrop_count = 1, .last_backdrop = entry.filter};
   } else {
-    Rect local_cull_bounds = GetCurrentLocalCullingBounds();
-    if (local_cull_bounds.IsMaximum()) {
-      display_list->Dispatch(*this);
-    } else if (!local_cull_bounds.IsEmpty()) {
-      IRect cull_rect = IRect::RoundOut(local_cull_bounds);
-      display_list->Dispatch(*this,
-                             SkIRect::MakeLTRB(cull_rect.GetLeft(),   //
-                                               cull_rect.GetTop(),    //
-                                               cull_rect.GetRight(),  //
-                                               cull_rect.GetBottom()  //
-                                               ));
+    BackdropData& data = existing->second;
+    data.backdrop_count++;
+    if (data.all_filters_equal) {
+      data.all_filters_equal = (*data.last_backdrop == *entry.filter);
+      data.last_backdrop = entry.filter;
     }
   }
-
-  restore();
-  paint_ = old_paint;
-  has_image_filter_ = old_has_image_filter;
-  FML_DCHECK(stack_depth == stack_.size());
-}
-
-// |flutter::DlOpReceiver|
-void FirstPassDispatcher::setDrawStyle(flutter::DlDrawStyle style) {
-  paint_.style = ToStyle(style);
-}
-
-// |flutter::DlOpReceiver|
-void FirstPassDispatcher::setColor(flutter::DlColor color) {
-  paint_.color = skia_conversions::ToColor(color);
-}
-
-// |flutter::DlOpReceiver|
-void FirstPassDispatcher::setStrokeWidth(DlScalar width) {
-  paint_.stroke_width = width;
-}
-
-// |flutter::DlOpReceiver|
-void FirstPassDispatcher::setStrokeMiter(DlScalar limit) {
-  paint_.stroke_miter = limit;
-}
-
-// |flutter::DlOpReceiver|
-void FirstPassDispatcher::setStrokeCap(flutter::DlStrokeCap cap) {
-  switch (cap) {
-    case flutter::DlStrokeCap::kButt:
-      paint_.stroke_cap = Cap::kButt;
-      break;
-    case flutter::DlStrokeCap::kRound:
-      paint_.stroke_cap = Cap::kRound;
-      break;
-    case flutter::DlStrokeCap::kSquare:
-      paint_.stroke_cap = Cap::kSquare;
-      break;
-  }
-}
-
-// |flutter::DlOpReceiver|
-void FirstPassDispatcher::setStrokeJoin(flutter::DlStrokeJoin join) {
-  switch (join) {
-    case flutter::DlStrokeJoin::kMiter:
-      paint_.stroke_join = Join::kMiter;
-      break;
-    case flutter::DlStrokeJoin::kRound:
-      paint_.stroke_join = Join::kRound;
-      break;
-    case flutter::DlStrokeJoin::kBevel:
-      paint_.stroke_join = Join::kBevel;
-      break;
-  }
-}
-
-// |flutter::DlOpReceiver|
-void FirstPassDispatcher::setImageFilter(const flutter::DlImageFilter* filter) {
-  if (filter == nullptr) {
-    has_image_filter_ = false;
-  } else {
-    has_image_filter_ = true;
-  }
 }
 
 std::pair<std::unordered_map<int64_t, BackdropData>, size_t>
-FirstPassDispatcher::TakeBackdropData() {
+FirstPassCollector::TakeBackdropData() {
   std::unordered_map<int64_t, BackdropData> temp;
   std::swap(temp, backdrop_data_);
   return std::make_pair(temp, backdrop_count_);
 }
 
-std::shared_ptr<Texture> DisplayListToTexture(
+// Renders the display list to a new texture, leaving its command buffers
+// enqueued on the context if `flush_command_buffers` is false.
+static std::shared_ptr<Texture> RenderToNewTexture(
     const sk_sp<flutter::DisplayList>& display_list,
     ISize size,
     AiksContext& context,
-    bool reset_host_buffer,
-    bool generate_mips) {
+    bool generate_mips,
+    bool flush_command_buffers) {
   int mip_count = 1;
   if (generate_mips) {
     mip_count = size.MipCount();
@@ -1263,9 +1174,9 @@ std::shared_ptr<Texture> DisplayListToTexture(
   }
 
   SkIRect sk_cull_rect = SkIRect::MakeWH(size.width, size.height);
-  impeller::FirstPassDispatcher collector(
-      context.GetContentContext(), impeller::Matrix(), Rect::MakeSize(size));
-  display_list->Dispatch(collector, sk_cull_rect);
+  impeller::FirstPassCollector collector(context.GetContentContext(),
+                                        Rect::MakeSize(size));
+  collector.Collect(*display_list);
   impeller::CanvasDlDispatcher impeller_dispatcher(
       context.GetContentContext(),               //
       target,                                    //
@@ -1276,15 +1187,60 @@ std::shared_ptr<Texture> DisplayListToTexture(
   const auto& [data, count] = collector.TakeBackdropData();
   impeller_dispatcher.SetBackdropData(data, count);
   display_list->Dispatch(impeller_dispatcher, sk_cull_rect);
-  impeller_dispatcher.FinishRecording();
+  impeller_dispatcher.FinishRecording(flush_command_buffers);
+
+  // The glyphs collected for this display list are no longer needed, as any
+  // atlas updates have already been enqueued ahead of the rendering work.
+  context.GetContentContext().GetLazyGlyphAtlas()->ResetTextFrames();
+
+  return target.GetRenderTargetTexture();
+}
+
+std::shared_ptr<Texture> DisplayListToTexture(
+    const sk_sp<flutter::DisplayList>& display_list,
+    ISize size,
+    AiksContext& context,
+    bool reset_host_buffer,
+    bool generate_mips) {
+  auto texture = RenderToNewTexture(display_list, size, context, generate_mips,
+                                    /*flush_command_buffers=*/true);
 
   if (reset_host_buffer) {
     context.GetContentContext().GetTransientsBuffer().Reset();
   }
-  context.GetContentContext().GetLazyGlyphAtlas()->ResetTextFrames();
   context.GetContext()->DisposeThreadLocalCachedResources();
 
-  return target.GetRenderTargetTexture();
+  return texture;
+}
+
+std::vector<std::shared_ptr<Texture>> DisplayListsToTextures(
+    const std::vector<sk_sp<flutter::DisplayList>>& display_lists,
+    const std::vector<ISize>& sizes,
+    AiksContext& context,
+    bool reset_host_buffer,
+    bool generate_mips) {
+  FML_DCHECK(display_lists.size() == sizes.size());
+  std::vector<std::shared_ptr<Texture>> textures;
+  textures.reserve(display_lists.size());
+  for (size_t i = 0; i < display_lists.size(); i++) {
+    textures.push_back(RenderToNewTexture(display_lists[i], sizes[i], context,
+                                          generate_mips,
+                                          /*flush_command_buffers=*/false));
+  }
+
+  if (!context.GetContext()->FlushCommandBuffers()) {
+    VALIDATION_LOG << "Failed to submit command buffers";
+    textures.assign(display_lists.size(), nullptr);
+  }
+
+  // Cached resources, such as command pools, must outlive the enqueued
+  // command buffers, so they are only disposed after the flush.
+  if (reset_host_buffer) {
+    context.GetContentContext().GetTransientsBuffer().Reset();
+  }
+  context.GetContext()->DisposeThreadLocalCachedResources();
+
+  return textures;
 }
 
 bool RenderToOnscreen(ContentContext& context,
@@ -1294,8 +1250,8 @@ bool RenderToOnscreen(ContentContext& context,
                       bool reset_host_buffer) {
   Rect ip_cull_rect = Rect::MakeLTRB(cull_rect.left(), cull_rect.top(),
                                      cull_rect.right(), cull_rect.bottom());
-  FirstPassDispatcher collector(context, impeller::Matrix(), ip_cull_rect);
-  display_list->Dispatch(collector, cull_rect);
+  FirstPassCollector collector(context, ip_cull_rect);
+  collector.Collect(*display_list);
 
   impeller::CanvasDlDispatcher impeller_dispatcher(
       context,                                   //
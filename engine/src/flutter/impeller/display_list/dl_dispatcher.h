@@ -248,6 +248,10 @@ class DlDispatcherBase : public flutter::DlOpReceiver {
   static void SimplifyOrDrawPath(Canvas& canvas,
                                  const DlPath& cache,
                                  const Paint& paint);
+
+  /// Whether SimplifyOrDrawPath draws the path as a shape with an analytic
+  /// mask blur.
+  static bool IsAnalyticShadowPath(const DlPath& path);
 };
 
 class CanvasDlDispatcher : public DlDispatcherBase {
@@ -282,7 +286,9 @@ class CanvasDlDispatcher : public DlDispatcherBase {
   }
   using DlDispatcherBase::saveLayer;
 
-  void FinishRecording() { canvas_.EndReplay(); }
+  void FinishRecording(bool flush_command_buffers = true) {
+    canvas_.EndReplay(flush_command_buffers);
+  }
 
   // |flutter::DlOpReceiver|
   void drawVertices(const std::shared_ptr<flutter::DlVertices>& vertices,
@@ -295,91 +301,45 @@ class CanvasDlDispatcher : public DlDispatcherBase {
   Canvas& GetCanvas() override;
 };
 
-/// Performs a first pass over the display list to collect infomation.
-/// Collects things like text frames and backdrop filters.
-class FirstPassDispatcher : public flutter::IgnoreAttributeDispatchHelper,
-                            public flutter::IgnoreClipDispatchHelper,
-                            public flutter::IgnoreDrawDispatchHelper {
+/// Collects the information that rendering a display list needs up front,
+/// like its text frames and backdrop filters.
+///
+/// The information is read from the prepass tables that were recorded when
+/// the display list and the display lists that it draws were built, rather
+/// than by dispatching their ops.
+class FirstPassCollector {
  public:
-  FirstPassDispatcher(const ContentContext& renderer,
-                      const Matrix& initial_matrix,
-                      const Rect cull_rect);
-
-  ~FirstPassDispatcher();
-
-  void save() override;
-
-  void saveLayer(const DlRect& bounds,
-                 const flutter::SaveLayerOptions options,
-                 const flutter::DlImageFilter* backdrop,
-                 std::optional<int64_t> backdrop_id) override;
-
-  void restore() override;
-
-  void translate(DlScalar tx, DlScalar ty) override;
-
-  void scale(DlScalar sx, DlScalar sy) override;
-
-  void rotate(DlScalar degrees) override;
-
-  void skew(DlScalar sx, DlScalar sy) override;
-
-  // clang-format off
-  // 2x3 2D affine subset of a 4x4 transform in row major order
-  void transform2DAffine(DlScalar mxx, DlScalar mxy, DlScalar mxt,
-                         DlScalar myx, DlScalar myy, DlScalar myt) override;
-
-  // full 4x4 transform in row major order
-  void transformFullPerspective(
-      DlScalar mxx, DlScalar mxy, DlScalar mxz, DlScalar mxt,
-      DlScalar myx, DlScalar myy, DlScalar myz, DlScalar myt,
-      DlScalar mzx, DlScalar mzy, DlScalar mzz, DlScalar mzt,
-      DlScalar mwx, DlScalar mwy, DlScalar mwz, DlScalar mwt) override;
-
-  void transformReset() override;
-
-  void drawTextFrame(const std::shared_ptr<impeller::TextFrame>& text_frame,
-                     DlScalar x,
-                     DlScalar y) override;
-
-  void drawDisplayList(const sk_sp<flutter::DisplayList> display_list,
-                       DlScalar opacity) override;
-
-  // |flutter::DlOpReceiver|
-  void setDrawStyle(flutter::DlDrawStyle style) override;
-
-  // |flutter::DlOpReceiver|
-  void setColor(flutter::DlColor color) override;
+  FirstPassCollector(const ContentContext& renderer, const Rect& cull_rect);
 
-  // |flutter::DlOpReceiver|
-  void setStrokeWidth(DlScalar width) override;
+  ~FirstPassCollector();
 
-  // |flutter::DlOpReceiver|
-  void setStrokeMiter(DlScalar limit) override;
-
-  // |flutter::DlOpReceiver|
-  void setStrokeCap(flutter::DlStrokeCap cap) override;
+  /// Adds the text frames that are not culled to the lazy glyph atlas and
+  /// accumulates the backdrop filters.
+  void Collect(const flutter::DisplayList& display_list);
 
-  // |flutter::DlOpReceiver|
-  void setStrokeJoin(flutter::DlStrokeJoin join) override;
+  std::pair<std::unordered_map<int64_t, BackdropData>, size_t>
+  TakeBackdropData();
 
-  // |flutter::DlOpReceiver|
-  void setImageFilter(const flutter::DlImageFilter* filter) override;
+ private:
+  // `cull_rect` is in the coordinates of the root display list, and is
+  // std::nullopt if the ops of this display list are not culled.
+  void Collect(const flutter::DisplayList& display_list,
+               const Matrix& matrix,
+               std::optional<Rect> cull_rect);
 
-  std::pair<std::unordered_map<int64_t, BackdropData>, size_t> TakeBackdropData();
+  void AddTextFrame(const flutter::DlPrepassTable::TextFrame& entry,
+                    const Matrix& matrix);
 
- private:
-  const Rect GetCurrentLocalCullingBounds() const;
+  void AddBackdrop(const flutter::DlPrepassTable::Backdrop& entry);
 
   const ContentContext& renderer_;
-  Matrix matrix_;
-  std::vector<Matrix> stack_;
+  const Rect cull_rect_;
   std::unordered_map<int64_t, BackdropData> backdrop_data_;
-  // note: cull rects are always in the global coordinate space.
-  std::vector<Rect> cull_rect_state_;
-  bool has_image_filter_ = false;
   size_t backdrop_count_ = 0;
-  Paint paint_;
+
+  FirstPassCollector(const FirstPassCollector&) = delete;
+
+  FirstPassCollector& operator=(const FirstPassCollector&) = delete;
 };
 
 /// Render the provided display list to a texture with the given size.
@@ -390,6 +350,20 @@ std::shared_ptr<Texture> DisplayListToTexture(
     bool reset_host_buffer = true,
     bool generate_mips = false);
 
+/// Render each of the provided display lists to a texture with the
+/// corresponding size.
+///
+/// The rendering work for all of the display lists is submitted together,
+/// which avoids the fixed cost of a submission per display list. The returned
+/// textures are in the same order as the display lists, and are null for
+/// display lists that could not be rendered.
+std::vector<std::shared_ptr<Texture>> DisplayListsToTextures(
+    const std::vector<sk_sp<flutter::DisplayList>>& display_lists,
+    const std::vector<ISize>& sizes,
+    AiksContext& context,
+    bool reset_host_buffer = true,
+    bool generate_mips = false);
+
 /// Render the provided display list to the render target.
 bool RenderToOnscreen(ContentContext& context, RenderTarget render_target,
                          const sk_sp<flutter::DisplayList>& display_list,
@@ -2,8 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdlib>
 #include <memory>
 #include <vector>
 
@@ -16,8 +18,10 @@
 #include "flutter/display_list/effects/dl_color_source.h"
 #include "flutter/display_list/effects/dl_image_filters.h"
 #include "flutter/display_list/effects/dl_mask_filter.h"
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/testing/testing.h"
 #include "gtest/gtest.h"
+#include "impeller/core/device_buffer.h"
 #include "impeller/display_list/aiks_context.h"
 #include "impeller/display_list/dl_dispatcher.h"
 #include "impeller/display_list/dl_image_impeller.h"
@@ -29,6 +33,9 @@
 #include "impeller/geometry/point.h"
 #include "impeller/geometry/scalar.h"
 #include "impeller/playground/widgets.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/command_queue.h"
 #include "third_party/imgui/imgui.h"
 #include "third_party/skia/include/core/SkBlurTypes.h"
 #include "third_party/skia/include/core/SkClipOp.h"
@@ -906,6 +913,103 @@ TEST_P(DisplayListTest, CanDrawShadow) {
   ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
 }
 
+// Copies the base mip level of a texture into host memory.
+static std::vector<uint8_t> ReadTexturePixels(
+    const std::shared_ptr<Context>& context,
+    const std::shared_ptr<Texture>& texture) {
+  DeviceBufferDescriptor buffer_descriptor;
+  buffer_descriptor.storage_mode = StorageMode::kHostVisible;
+  buffer_descriptor.size =
+      texture->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+  auto buffer =
+      context->GetResourceAllocator()->CreateBuffer(buffer_descriptor);
+  auto command_buffer = context->CreateCommandBuffer();
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!buffer || !blit_pass || !blit_pass->AddCopy(texture, buffer) ||
+      !blit_pass->EncodeCommands(context->GetResourceAllocator())) {
+    return {};
+  }
+  fml::AutoResetWaitableEvent latch;
+  if (!context->GetCommandQueue()
+           ->Submit({command_buffer},
+                    [&latch](CommandBuffer::Status) { latch.Signal(); })
+           .ok()) {
+    return {};
+  }
+  latch.Wait();
+  buffer->Invalidate();
+  const uint8_t* contents = buffer->OnGetContents();
+  return std::vector<uint8_t>(contents, contents + buffer_descriptor.size);
+}
+
+TEST_P(DisplayListTest, ShadowMeshMatchesMaskBlur) {
+  // A convex path without an analytic blur, which drawShadow draws with a
+  // tessellated shadow mesh.
+  SkRRect rrect;
+  const SkVector radii[4] = {{30, 30}, {30, 30}, {0, 0}, {0, 0}};
+  rrect.setRectRadii(SkRect::MakeXYWH(60, 40, 180, 100), radii);
+  const SkPath path = SkPath().addRRect(rrect);
+  ASSERT_TRUE(path.isConvex());
+  ASSERT_FALSE(rrect.isSimple());
+
+  const flutter::DlScalar elevation = 10;
+  flutter::DisplayListBuilder mesh_builder;
+  mesh_builder.DrawColor(flutter::DlColor::kWhite(),
+                         flutter::DlBlendMode::kSrc);
+  mesh_builder.DrawShadow(path, flutter::DlColor::kBlack(), elevation, false,
+                          1);
+
+  // The mask blur that drawShadow drew these paths with before, with the
+  // same offset, tonal color and sigma.
+  flutter::DisplayListBuilder blur_builder;
+  blur_builder.DrawColor(flutter::DlColor::kWhite(),
+                         flutter::DlBlendMode::kSrc);
+  blur_builder.Translate(0, elevation);
+  const Sigma sigma = Radius{elevation};
+  flutter::DlPaint blur_paint;
+  blur_paint.setColor(flutter::DlColor::kBlack().withAlphaF(0.25));
+  blur_paint.setMaskFilter(
+      flutter::DlBlurMaskFilter::Make(flutter::DlBlurStyle::kNormal,
+                                      sigma.sigma));
+  blur_builder.DrawPath(path, blur_paint);
+
+  AiksContext renderer(GetContext(), nullptr);
+  const ISize size(300, 200);
+  auto mesh_texture =
+      DisplayListToTexture(mesh_builder.Build(), size, renderer);
+  auto blur_texture =
+      DisplayListToTexture(blur_builder.Build(), size, renderer);
+  ASSERT_TRUE(mesh_texture);
+  ASSERT_TRUE(blur_texture);
+
+  // The penumbra is a linear ramp 1.2533 sigma to either side of the edge,
+  // which has the same slope as the Gaussian at the edge. Their coverage
+  // differs by at most about a tenth at the ends of the ramp, which is a few
+  // levels for a shadow at a quarter alpha.
+  std::vector<uint8_t> mesh_pixels =
+      ReadTexturePixels(GetContext(), mesh_texture);
+  std::vector<uint8_t> blur_pixels =
+      ReadTexturePixels(GetContext(), blur_texture);
+  ASSERT_EQ(mesh_pixels.size(), blur_pixels.size());
+  ASSERT_EQ(mesh_pixels.size(), static_cast<size_t>(size.Area() * 4));
+  int max_difference = 0;
+  double total_difference = 0;
+  for (size_t i = 0; i < mesh_pixels.size(); i++) {
+    const int difference = std::abs(mesh_pixels[i] - blur_pixels[i]);
+    max_difference = std::max(max_difference, difference);
+    total_difference += difference;
+  }
+  EXPECT_LE(max_difference, 10);
+  EXPECT_LT(total_difference / mesh_pixels.size(), 1.0);
+
+  flutter::DisplayListBuilder builder;
+  builder.DrawImage(DlImageImpeller::Make(mesh_texture), SkPoint::Make(0, 0),
+                    {});
+  builder.DrawImage(DlImageImpeller::Make(blur_texture),
+                    SkPoint::Make(size.width, 0), {});
+  ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
+}
+
 TEST_P(DisplayListTest, CanDrawZeroWidthLine) {
   flutter::DisplayListBuilder builder;
   std::vector<flutter::DlStrokeCap> caps = {
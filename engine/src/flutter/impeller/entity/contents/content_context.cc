@@ -13,6 +13,7 @@
 #include "impeller/core/texture_descriptor.h"
 #include "impeller/entity/contents/framebuffer_blend_contents.h"
 #include "impeller/entity/entity.h"
+#include "impeller/entity/geometry/shadow_vertices.h"
 #include "impeller/entity/render_target_cache.h"
 #include "impeller/renderer/command_buffer.h"
 #include "impeller/renderer/pipeline_descriptor.h"
@@ -245,6 +246,7 @@ ContentContext::ContentContext(
       lazy_glyph_atlas_(
           std::make_shared<LazyGlyphAtlas>(std::move(typographer_context))),
       tessellator_(std::make_shared<Tessellator>()),
+      shadow_vertices_cache_(std::make_shared<ShadowVerticesCache>()),
       render_target_cache_(render_target_allocator == nullptr
                                ? std::make_shared<RenderTargetCache>(
                                      context_->GetResourceAllocator())
@@ -557,6 +559,10 @@ Tessellator& ContentContext::GetTessellator() const {
   return *tessellator_;
 }
 
+ShadowVerticesCache& ContentContext::GetShadowVerticesCache() const {
+  return *shadow_vertices_cache_;
+}
+
 std::shared_ptr<Context> ContentContext::GetContext() const {
   return context_;
 }
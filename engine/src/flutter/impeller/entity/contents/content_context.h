@@ -363,6 +363,7 @@ struct ContentContextOptions {
 
 class Tessellator;
 class RenderTargetCache;
+class ShadowVerticesCache;
 
 class ContentContext {
  public:
@@ -377,6 +378,8 @@ class ContentContext {
 
   Tessellator& GetTessellator() const;
 
+  ShadowVerticesCache& GetShadowVerticesCache() const;
+
   PipelineRef GetFastGradientPipeline(ContentContextOptions opts) const {
     return GetPipeline(fast_gradient_pipelines_, opts);
   }
@@ -1006,6 +1009,7 @@ class ContentContext {
 
   bool is_valid_ = false;
   std::shared_ptr<Tessellator> tessellator_;
+  std::shared_ptr<ShadowVerticesCache> shadow_vertices_cache_;
   std::shared_ptr<RenderTargetAllocator> render_target_cache_;
   std::shared_ptr<HostBuffer> host_buffer_;
   std::shared_ptr<Texture> empty_texture_;
@@ -4,6 +4,7 @@
 
 #include "impeller/entity/contents/filters/yuv_to_rgb_filter_contents.h"
 
+#include "fml/logging.h"
 #include "impeller/core/formats.h"
 #include "impeller/entity/contents/anonymous_contents.h"
 #include "impeller/entity/contents/content_context.h"
@@ -37,6 +38,17 @@ void YUVToRGBFilterContents::SetYUVColorSpace(YUVColorSpace yuv_color_space) {
   yuv_color_space_ = yuv_color_space;
 }
 
+Matrix YUVToRGBFilterContents::GetYUVToRGBMatrix(
+    YUVColorSpace yuv_color_space) {
+  switch (yuv_color_space) {
+    case YUVColorSpace::kBT601LimitedRange:
+      return kMatrixBT601LimitedRange;
+    case YUVColorSpace::kBT601FullRange:
+      return kMatrixBT601FullRange;
+  }
+  FML_UNREACHABLE();
+}
+
 std::optional<Entity> YUVToRGBFilterContents::RenderFilter(
     const FilterInput::Vector& inputs,
     const ContentContext& renderer,
@@ -102,14 +114,7 @@ std::optional<Entity> YUVToRGBFilterContents::RenderFilter(
 
     FS::FragInfo frag_info;
     frag_info.yuv_color_space = static_cast<Scalar>(yuv_color_space);
-    switch (yuv_color_space) {
-      case YUVColorSpace::kBT601LimitedRange:
-        frag_info.matrix = kMatrixBT601LimitedRange;
-        break;
-      case YUVColorSpace::kBT601FullRange:
-        frag_info.matrix = kMatrixBT601FullRange;
-        break;
-    }
+    frag_info.matrix = GetYUVToRGBMatrix(yuv_color_space);
 
     raw_ptr<const Sampler> sampler =
         renderer.GetContext()->GetSamplerLibrary()->GetSampler({});
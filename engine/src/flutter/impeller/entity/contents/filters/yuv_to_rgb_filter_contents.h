@@ -17,6 +17,10 @@ class YUVToRGBFilterContents final : public FilterContents {
 
   void SetYUVColorSpace(YUVColorSpace yuv_color_space);
 
+  /// @brief  The matrix that converts YUV values in the given color space,
+  ///         once their offsets are removed, to RGB.
+  static Matrix GetYUVToRGBMatrix(YUVColorSpace yuv_color_space);
+
  private:
   // |FilterContents|
   std::optional<Entity> RenderFilter(
@@ -173,9 +173,14 @@ bool TextContents::Render(const ContentContext& renderer,
             reinterpret_cast<VS::PerVertexData*>(contents);
         size_t i = 0u;
         size_t bounds_offset = 0u;
+        Scalar rounded_scale = TextFrame::RoundScaledFontSize(scale_);
+        // The frame bounds only apply to this draw if it is the one that the
+        // frame was last added to the glyph atlas for, which is not the case
+        // for the other draws of a frame drawn more than once.
+        bool has_frame_bounds = frame_->HasPerFrameData(
+            rounded_scale, offset_, GetGlyphProperties());
         for (const TextRun& run : frame_->GetRuns()) {
           const Font& font = run.GetFont();
-          Scalar rounded_scale = TextFrame::RoundScaledFontSize(scale_);
           FontGlyphAtlas* font_atlas = nullptr;
 
           // Adjust glyph position based on the subpixel rounding
@@ -209,7 +214,7 @@ bool TextContents::Render(const ContentContext& renderer,
             // the glyph has been rendered and so its atlas position was not
             // known when the glyph was recorded. Perform a slow lookup into the
             // glyph atlas hash table.
-            if (frame_bounds.is_placeholder) {
+            if (!has_frame_bounds || frame_bounds.is_placeholder) {
               if (!font_atlas) {
                 font_atlas = atlas->GetOrCreateFontGlyphAtlas(
                     ScaledFont{font, rounded_scale});
@@ -235,6 +240,9 @@ bool TextContents::Render(const ContentContext& renderer,
               }
               atlas_glyph_bounds =
                   maybe_atlas_glyph_bounds.value().atlas_bounds;
+              if (!has_frame_bounds) {
+                glyph_bounds = maybe_atlas_glyph_bounds.value().glyph_bounds;
+              }
             }
 
             Rect scaled_bounds = glyph_bounds.Scale(1.0 / rounded_scale);
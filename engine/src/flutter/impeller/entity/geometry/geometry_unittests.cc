@@ -2,16 +2,19 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cmath>
 #include <memory>
 #include "flutter/testing/testing.h"
 #include "gtest/gtest.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/geometry/geometry.h"
+#include "impeller/entity/geometry/shadow_vertices.h"
 #include "impeller/entity/geometry/stroke_path_geometry.h"
 #include "impeller/geometry/constants.h"
 #include "impeller/geometry/geometry_asserts.h"
 #include "impeller/geometry/path_builder.h"
 #include "impeller/renderer/testing/mocks.h"
+#include "impeller/tessellator/tessellator.h"
 
 inline ::testing::AssertionResult SolidVerticesNear(
     std::vector<impeller::Point> a,
@@ -152,5 +155,117 @@ TEST(EntityGeometryTest, AlphaCoverageStrokePaths) {
   EXPECT_EQ(Geometry::MakeStrokePath({}, 40)->ComputeAlphaCoverage(matrix), 1);
 }
 
+TEST(EntityGeometryTest, ShadowVerticesSurroundConvexPaths) {
+  Tessellator tessellator;
+  // A card with only its top corners rounded, which has no analytic blur.
+  auto path = PathBuilder{}
+                  .AddRoundRect(RoundRect::MakeRectRadii(
+                      Rect::MakeLTRB(0, 0, 200, 100),
+                      {.top_left = Size(16, 16), .top_right = Size(16, 16)}))
+                  .TakePath();
+  auto vertices = ShadowVertices::Make(path, /*penumbra_radius=*/10,
+                                       /*scale=*/1, tessellator);
+  ASSERT_NE(vertices, nullptr);
+
+  EXPECT_RECT_NEAR(vertices->GetBounds(), Rect::MakeLTRB(-10, -10, 210, 110));
+  ASSERT_GE(vertices->GetUmbraVertexCount(), 3u);
+  for (size_t i = 0; i < vertices->GetUmbraVertexCount(); i++) {
+    EXPECT_TRUE(Rect::MakeLTRB(10, 10, 190, 90)
+                    .Expand(kEhCloseEnough)
+                    .Contains(vertices->GetVertices()[i]));
+  }
+  const auto& indices = vertices->GetIndices();
+  EXPECT_EQ(indices.size() % 3, 0u);
+  for (uint16_t index : indices) {
+    EXPECT_LT(index, vertices->GetVertices().size());
+  }
+
+  // The triangles tile the outer edge of the penumbra without overlapping.
+  Scalar triangle_area = 0;
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    const Point& a = vertices->GetVertices()[indices[i]];
+    const Point& b = vertices->GetVertices()[indices[i + 1]];
+    const Point& c = vertices->GetVertices()[indices[i + 2]];
+    triangle_area += std::abs((b - a).Cross(c - a)) / 2;
+  }
+  Scalar outer_area = 0;
+  const size_t outer_count =
+      vertices->GetVertices().size() - vertices->GetUmbraVertexCount();
+  for (size_t i = 0; i < outer_count; i++) {
+    const size_t offset = vertices->GetUmbraVertexCount();
+    outer_area += vertices->GetVertices()[offset + i].Cross(
+        vertices->GetVertices()[offset + (i + 1) % outer_count]);
+  }
+  EXPECT_NEAR(triangle_area, std::abs(outer_area) / 2, 1);
+}
+
+TEST(EntityGeometryTest, ShadowVerticesRejectConcaveAndThinPaths) {
+  Tessellator tessellator;
+  auto concave_path = PathBuilder{}
+                          .MoveTo({0, 0})
+                          .LineTo({100, 0})
+                          .LineTo({100, 100})
+                          .LineTo({50, 50})
+                          .LineTo({0, 100})
+                          .Close()
+                          .TakePath();
+  EXPECT_EQ(ShadowVertices::Make(concave_path, 5, 1, tessellator), nullptr);
+
+  auto thin_path =
+      PathBuilder{}.AddRect(Rect::MakeLTRB(0, 0, 100, 8)).TakePath();
+  EXPECT_EQ(ShadowVertices::Make(thin_path, 5, 1, tessellator), nullptr);
+  EXPECT_NE(ShadowVertices::Make(thin_path, 3, 1, tessellator), nullptr);
+}
+
+TEST(EntityGeometryTest, ShadowVerticesCacheBucketsAndEvicts) {
+  using Key = ShadowVerticesCache::Key;
+  // Nearby scales and sigmas share a mesh.
+  EXPECT_EQ(Key::Make(1, 8, 2), Key::Make(1, 8.01, 2.01));
+  EXPECT_FALSE(Key::Make(1, 8, 2) == Key::Make(1, 8, 3));
+  EXPECT_FALSE(Key::Make(1, 8, 2) == Key::Make(1, 10, 2));
+  EXPECT_FALSE(Key::Make(1, 8, 2) == Key::Make(2, 8, 2));
+  EXPECT_NEAR(Key::Make(1, 8, 2).GetScale(), 2, 1e-4);
+  EXPECT_NEAR(Key::Make(1, 8, 2).GetPenumbraRadius(),
+              8 * ShadowVertices::kPenumbraRadiusPerSigma, 1e-4);
+
+  Tessellator tessellator;
+  auto path = PathBuilder{}.AddRect(Rect::MakeLTRB(0, 0, 100, 100)).TakePath();
+  auto mesh = ShadowVertices::Make(path, 10, 1, tessellator);
+  ASSERT_NE(mesh, nullptr);
+
+  ShadowVerticesCache cache(/*budget_bytes=*/mesh->GetByteSize() * 2);
+  int factory_calls = 0;
+  auto factory = [&]() {
+    factory_calls++;
+    return mesh;
+  };
+  EXPECT_EQ(cache.GetOrCreate(Key::Make(1, 8, 1), factory), mesh);
+  EXPECT_EQ(cache.GetOrCreate(Key::Make(1, 8, 1), factory), mesh);
+  EXPECT_EQ(factory_calls, 1);
+
+  // Paths without a mesh are remembered too.
+  auto no_mesh_factory = [&]() -> std::shared_ptr<ShadowVertices> {
+    factory_calls++;
+    return nullptr;
+  };
+  EXPECT_EQ(cache.GetOrCreate(Key::Make(2, 8, 1), no_mesh_factory), nullptr);
+  EXPECT_EQ(cache.GetOrCreate(Key::Make(2, 8, 1), factory), nullptr);
+  EXPECT_EQ(factory_calls, 2);
+
+  // Caching a third entry evicts the least recently used one.
+  cache.GetOrCreate(Key::Make(3, 8, 1), factory);
+  EXPECT_EQ(factory_calls, 3);
+  cache.GetOrCreate(Key::Make(1, 8, 1), factory);
+  EXPECT_EQ(factory_calls, 4);
+
+  const auto stats = cache.GetStats();
+  EXPECT_EQ(stats.hit_count, 2u);
+  EXPECT_EQ(stats.miss_count, 4u);
+  EXPECT_LE(stats.resident_bytes, mesh->GetByteSize() * 2);
+
+  cache.Purge();
+  EXPECT_EQ(cache.GetStats().resident_bytes, 0u);
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -0,0 +1,437 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/geometry/shadow_vertices.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/geometry/constants.h"
+#include "impeller/tessellator/tessellator.h"
+
+namespace impeller {
+
+namespace {
+
+// The largest distance, in device pixels, that the round corners of the
+// penumbra may deviate from a true circle. The penumbra is soft, so this is
+// looser than the tolerance for filled circles.
+constexpr Scalar kCornerTolerance = 0.5f;
+
+// The number of scale buckets per octave.
+constexpr Scalar kScaleBucketsPerOctave = 16.0f;
+
+// The number of sigma buckets per device pixel.
+constexpr Scalar kSigmaBucketsPerPixel = 4.0f;
+
+// Unsupported paths are remembered with a nominal size, so that they also
+// count towards the budget.
+constexpr size_t kEntryByteSize = sizeof(ShadowVertices);
+
+bool IsSamePoint(const Point& a, const Point& b) {
+  return a.GetDistanceSquared(b) < kEhCloseEnough * kEhCloseEnough;
+}
+
+// Copies the points of the single contour of the polyline, without
+// consecutive duplicates, counter-clockwise in a y-up coordinate system.
+std::vector<Point> GetConvexContour(const Path::Polyline& polyline) {
+  if (polyline.contours.size() != 1u) {
+    return {};
+  }
+  auto [start, end] = polyline.GetContourPointBounds(0);
+  std::vector<Point> points;
+  points.reserve(end - start);
+  for (size_t i = start; i < end; i++) {
+    const Point& point = polyline.GetPoint(i);
+    if (points.empty() || !IsSamePoint(point, points.back())) {
+      points.push_back(point);
+    }
+  }
+  while (points.size() > 1u && IsSamePoint(points.back(), points.front())) {
+    points.pop_back();
+  }
+  if (points.size() < 3u) {
+    return {};
+  }
+
+  Scalar area = 0;
+  for (size_t i = 0; i < points.size(); i++) {
+    area += points[i].Cross(points[(i + 1) % points.size()]);
+  }
+  if (area < 0) {
+    std::reverse(points.begin(), points.end());
+  } else if (area == 0) {
+    return {};
+  }
+
+  // Every turn must be to the same side, allowing for collinear points.
+  for (size_t i = 0; i < points.size(); i++) {
+    const Point& a = points[i];
+    const Point& b = points[(i + 1) % points.size()];
+    const Point& c = points[(i + 2) % points.size()];
+    if ((b - a).Normalize().Cross((c - b).Normalize()) < -kEhCloseEnough) {
+      return {};
+    }
+  }
+  return points;
+}
+
+// The outward normal of the edge from a to b of a counter-clockwise contour.
+Vector2 GetOutwardNormal(const Point& a, const Point& b) {
+  const Vector2 direction = (b - a).Normalize();
+  return {direction.y, -direction.x};
+}
+
+// Clips a convex polygon to the points where dot(point, normal) <= offset.
+std::vector<Point> ClipToHalfPlane(const std::vector<Point>& polygon,
+                                   const Vector2& normal,
+                                   Scalar offset) {
+  std::vector<Point> result;
+  result.reserve(polygon.size() + 1);
+  auto add = [&result](const Point& point) {
+    if (result.empty() || !IsSamePoint(point, result.back())) {
+      result.push_back(point);
+    }
+  };
+  for (size_t i = 0; i < polygon.size(); i++) {
+    const Point& a = polygon[i];
+    const Point& b = polygon[(i + 1) % polygon.size()];
+    const Scalar distance_a = a.Dot(normal) - offset;
+    const Scalar distance_b = b.Dot(normal) - offset;
+    if (distance_a <= 0) {
+      add(a);
+    }
+    if ((distance_a < 0 && distance_b > 0) ||
+        (distance_a > 0 && distance_b < 0)) {
+      add(a + (b - a) * (distance_a / (distance_a - distance_b)));
+    }
+  }
+  while (result.size() > 1u && IsSamePoint(result.back(), result.front())) {
+    result.pop_back();
+  }
+  return result;
+}
+
+}  // namespace
+
+std::shared_ptr<ShadowVertices> ShadowVertices::Make(const Path& path,
+                                                     Scalar penumbra_radius,
+                                                     Scalar scale,
+                                                     Tessellator& tessellator) {
+  if (!(penumbra_radius > 0) || !(scale > 0)) {
+    return nullptr;
+  }
+  std::vector<Point> contour;
+  {
+    Path::Polyline polyline = tessellator.CreateTempPolyline(path, scale);
+    contour = GetConvexContour(polyline);
+  }
+  const size_t count = contour.size();
+  if (count == 0u) {
+    return nullptr;
+  }
+
+  std::vector<Vector2> normals(count);
+  for (size_t i = 0; i < count; i++) {
+    normals[i] = GetOutwardNormal(contour[i], contour[(i + 1) % count]);
+  }
+
+  // The umbra holds the points that are at least the penumbra radius inside
+  // every edge. Curves with a smaller radius turn into sharp corners.
+  std::vector<Point> umbra = contour;
+  for (size_t i = 0; i < count && !umbra.empty(); i++) {
+    umbra = ClipToHalfPlane(umbra, normals[i],
+                            normals[i].Dot(contour[i]) - penumbra_radius);
+  }
+  if (umbra.size() < 3u) {
+    return nullptr;
+  }
+  const size_t umbra_count = umbra.size();
+
+  // The largest angle a corner segment may span and stay within tolerance.
+  const Scalar pixel_radius = penumbra_radius * scale;
+  const Scalar max_segment_angle =
+      pixel_radius > kCornerTolerance
+          ? 2 * std::acos(1 - kCornerTolerance / pixel_radius)
+          : kPiOver2;
+
+  // The outer edge of the penumbra is the contour outset by the penumbra
+  // radius, with an arc around each vertex from the normal of the edge before
+  // it to the normal of the edge after it.
+  std::vector<Point> vertices = std::move(umbra);
+  std::vector<Vector2> outer_normals;
+  for (size_t i = 0; i < count; i++) {
+    const Vector2& previous = normals[(i + count - 1) % count];
+    const Scalar angle = previous.AngleTo(normals[i]).radians;
+    const size_t segments =
+        angle > kEhCloseEnough
+            ? static_cast<size_t>(std::ceil(angle / max_segment_angle))
+            : 0u;
+    for (size_t j = 0; j <= segments; j++) {
+      const Scalar t = segments == 0u ? 0 : static_cast<Scalar>(j) / segments;
+      const Vector2 normal = previous.Rotate(Radians{angle * t});
+      vertices.push_back(contour[i] + normal * penumbra_radius);
+      outer_normals.push_back(normal);
+    }
+  }
+  if (vertices.size() > std::numeric_limits<uint16_t>::max()) {
+    return nullptr;
+  }
+
+  // Both rings are convex and counter-clockwise, so the umbra vertex that is
+  // furthest along the normal of each outer vertex advances monotonically.
+  // The penumbra is triangulated by walking both rings together. Ties resolve
+  // to the first such vertex, so that the walk ends where it started.
+  auto support = [&](size_t umbra_index, const Vector2& normal) {
+    for (size_t step = 0; step < umbra_count; step++) {
+      const size_t next = (umbra_index + 1) % umbra_count;
+      if (vertices[next].Dot(normal) <= vertices[umbra_index].Dot(normal)) {
+        break;
+      }
+      umbra_index = next;
+    }
+    return umbra_index;
+  };
+  size_t first_support = 0;
+  for (size_t i = 1; i < umbra_count; i++) {
+    if (vertices[i].Dot(outer_normals[0]) >
+        vertices[first_support].Dot(outer_normals[0])) {
+      first_support = i;
+    }
+  }
+  std::vector<uint16_t> indices;
+  const size_t outer_count = outer_normals.size();
+  size_t current = first_support;
+  for (size_t k = 0; k < outer_count; k++) {
+    const size_t outer = umbra_count + k;
+    const size_t next_outer = umbra_count + (k + 1) % outer_count;
+    const size_t next = k + 1 < outer_count
+                            ? support(current, outer_normals[k + 1])
+                            : first_support;
+    indices.insert(indices.end(), {static_cast<uint16_t>(current),
+                                   static_cast<uint16_t>(outer),
+                                   static_cast<uint16_t>(next_outer)});
+    while (current != next) {
+      const size_t following = (current + 1) % umbra_count;
+      indices.insert(indices.end(), {static_cast<uint16_t>(current),
+                                     static_cast<uint16_t>(next_outer),
+                                     static_cast<uint16_t>(following)});
+      current = following;
+    }
+  }
+
+  // The umbra, which is convex.
+  for (size_t i = 1; i + 1 < umbra_count; i++) {
+    indices.insert(indices.end(), {0, static_cast<uint16_t>(i),
+                                   static_cast<uint16_t>(i + 1)});
+  }
+
+  return std::make_shared<ShadowVertices>(std::move(vertices),
+                                          std::move(indices), umbra_count);
+}
+
+ShadowVertices::ShadowVertices(std::vector<Point> vertices,
+                               std::vector<uint16_t> indices,
+                               size_t umbra_vertex_count)
+    : vertices_(std::move(vertices)),
+      indices_(std::move(indices)),
+      umbra_vertex_count_(umbra_vertex_count),
+      bounds_(Rect::MakePointBounds(vertices_).value_or(Rect())) {}
+
+ShadowVertices::~ShadowVertices() = default;
+
+size_t ShadowVertices::GetByteSize() const {
+  return sizeof(ShadowVertices) + vertices_.size() * sizeof(Point) +
+         indices_.size() * sizeof(uint16_t);
+}
+
+/////// Shadow Vertices Geometry ///////
+
+ShadowVerticesGeometry::ShadowVerticesGeometry(
+    std::shared_ptr<ShadowVertices> vertices,
+    const Color& color)
+    : vertices_(std::move(vertices)), color_(color.Premultiply()) {}
+
+ShadowVerticesGeometry::~ShadowVerticesGeometry() = default;
+
+bool ShadowVerticesGeometry::HasVertexColors() const {
+  return true;
+}
+
+bool ShadowVerticesGeometry::HasTextureCoordinates() const {
+  return false;
+}
+
+std::optional<Rect> ShadowVerticesGeometry::GetTextureCoordinateCoverge()
+    const {
+  return std::nullopt;
+}
+
+GeometryResult ShadowVerticesGeometry::GetPositionBuffer(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  const auto& vertices = vertices_->GetVertices();
+  const auto& indices = vertices_->GetIndices();
+  HostBuffer& host_buffer = renderer.GetTransientsBuffer();
+  return GeometryResult{
+      .type = PrimitiveType::kTriangle,
+      .vertex_buffer =
+          {
+              .vertex_buffer = host_buffer.Emplace(
+                  vertices.data(), vertices.size() * sizeof(Point),
+                  alignof(Point)),
+              .index_buffer = host_buffer.Emplace(
+                  indices.data(), indices.size() * sizeof(uint16_t),
+                  alignof(uint16_t)),
+              .vertex_count = indices.size(),
+              .index_type = IndexType::k16bit,
+          },
+      .transform = entity.GetShaderTransform(pass),
+  };
+}
+
+GeometryResult ShadowVerticesGeometry::GetPositionUVColorBuffer(
+    Rect texture_coverage,
+    Matrix effect_transform,
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  using VS = PorterDuffBlendPipeline::VertexShader;
+
+  const auto& vertices = vertices_->GetVertices();
+  const auto& indices = vertices_->GetIndices();
+  const size_t umbra_vertex_count = vertices_->GetUmbraVertexCount();
+  HostBuffer& host_buffer = renderer.GetTransientsBuffer();
+  BufferView vertex_buffer = host_buffer.Emplace(
+      vertices.size() * sizeof(VS::PerVertexData), alignof(VS::PerVertexData),
+      [&](uint8_t* data) {
+        VS::PerVertexData* vtx_contents =
+            reinterpret_cast<VS::PerVertexData*>(data);
+        for (size_t i = 0; i < vertices.size(); i++) {
+          vtx_contents[i] = {
+              .vertices = vertices[i],
+              .texture_coords = Point(),
+              .color = i < umbra_vertex_count ? color_
+                                              : Color::BlackTransparent(),
+          };
+        }
+      });
+
+  return GeometryResult{
+      .type = PrimitiveType::kTriangle,
+      .vertex_buffer =
+          {
+              .vertex_buffer = vertex_buffer,
+              .index_buffer = host_buffer.Emplace(
+                  indices.data(), indices.size() * sizeof(uint16_t),
+                  alignof(uint16_t)),
+              .vertex_count = indices.size(),
+              .index_type = IndexType::k16bit,
+          },
+      .transform = entity.GetShaderTransform(pass),
+  };
+}
+
+std::optional<Rect> ShadowVerticesGeometry::GetCoverage(
+    const Matrix& transform) const {
+  return vertices_->GetBounds().TransformBounds(transform);
+}
+
+/////// Shadow Vertices Cache ///////
+
+ShadowVerticesCache::Key ShadowVerticesCache::Key::Make(uint64_t path_hash,
+                                                        Scalar sigma,
+                                                        Scalar scale) {
+  Key key;
+  key.path_hash = path_hash;
+  // Clamped so that degenerate values still convert to integers.
+  key.scale_bucket = static_cast<int32_t>(std::round(
+      std::clamp(std::log2(scale), -64.0f, 64.0f) * kScaleBucketsPerOctave));
+  key.sigma_bucket = static_cast<int32_t>(std::round(
+      std::clamp(sigma * scale, 0.0f, 1e6f) * kSigmaBucketsPerPixel));
+  return key;
+}
+
+Scalar ShadowVerticesCache::Key::GetScale() const {
+  return std::exp2(scale_bucket / kScaleBucketsPerOctave);
+}
+
+Scalar ShadowVerticesCache::Key::GetPenumbraRadius() const {
+  return ShadowVertices::kPenumbraRadiusPerSigma * sigma_bucket /
+         (kSigmaBucketsPerPixel * GetScale());
+}
+
+bool ShadowVerticesCache::Key::operator==(const Key& other) const {
+  return path_hash == other.path_hash && scale_bucket == other.scale_bucket &&
+         sigma_bucket == other.sigma_bucket;
+}
+
+size_t ShadowVerticesCache::Key::Hash::operator()(const Key& key) const {
+  return fml::HashCombine(key.path_hash, key.scale_bucket, key.sigma_bucket);
+}
+
+double ShadowVerticesCache::Stats::GetHitRate() const {
+  const size_t total = hit_count + miss_count;
+  return total == 0 ? 0.0 : static_cast<double>(hit_count) / total;
+}
+
+ShadowVerticesCache::ShadowVerticesCache(size_t budget_bytes)
+    : budget_bytes_(budget_bytes) {}
+
+ShadowVerticesCache::~ShadowVerticesCache() = default;
+
+std::shared_ptr<ShadowVertices> ShadowVerticesCache::GetOrCreate(
+    const Key& key,
+    const MeshFactory& factory) {
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    entries_.splice(entries_.end(), entries_, found->second);
+    stats_.hit_count++;
+    TraceStatsToTimeline();
+    return found->second->vertices;
+  }
+  stats_.miss_count++;
+
+  std::shared_ptr<ShadowVertices> vertices = factory();
+  const size_t byte_size = vertices ? vertices->GetByteSize() : kEntryByteSize;
+  if (byte_size <= budget_bytes_) {
+    while (stats_.resident_bytes + byte_size > budget_bytes_) {
+      stats_.resident_bytes -= entries_.front().byte_size;
+      index_.erase(entries_.front().key);
+      entries_.pop_front();
+    }
+    entries_.push_back({key, vertices, byte_size});
+    index_[key] = std::prev(entries_.end());
+    stats_.resident_bytes += byte_size;
+  }
+  TraceStatsToTimeline();
+  return vertices;
+}
+
+void ShadowVerticesCache::Purge() {
+  entries_.clear();
+  index_.clear();
+  stats_.resident_bytes = 0;
+  TraceStatsToTimeline();
+}
+
+ShadowVerticesCache::Stats ShadowVerticesCache::GetStats() const {
+  return stats_;
+}
+
+void ShadowVerticesCache::TraceStatsToTimeline() const {
+  FML_TRACE_COUNTER("impeller", "ShadowVerticesCache",
+                    reinterpret_cast<int64_t>(this),  //
+                    "HitPercent",
+                    static_cast<int64_t>(stats_.GetHitRate() * 100),  //
+                    "ResidentKBytes", stats_.resident_bytes / 1024);
+}
+
+}  // namespace impeller
@@ -0,0 +1,236 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_ENTITY_GEOMETRY_SHADOW_VERTICES_H_
+#define FLUTTER_IMPELLER_ENTITY_GEOMETRY_SHADOW_VERTICES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "impeller/entity/geometry/vertices_geometry.h"
+#include "impeller/geometry/color.h"
+#include "impeller/geometry/path.h"
+
+namespace impeller {
+
+class Tessellator;
+
+//------------------------------------------------------------------------------
+/// @brief      A triangle mesh that approximates the Gaussian blurred
+///             silhouette of a convex path.
+///
+///             The mesh consists of an umbra, the path inset by the penumbra
+///             radius where the shadow is fully opaque, and a penumbra ring
+///             that fades linearly to transparent at the path outset by the
+///             same radius. The corners of the outer edge are round, as the
+///             blur of a corner is.
+///
+class ShadowVertices {
+ public:
+  /// The ratio of the penumbra radius to the blur sigma. A linear ramp that
+  /// is sqrt(2 pi) sigma wide has the same slope as the Gaussian at the edge
+  /// of the path.
+  static constexpr Scalar kPenumbraRadiusPerSigma = 1.2533141f;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Tessellates the shadow mesh for a path.
+  ///
+  /// @param[in]  path             The path casting the shadow.
+  /// @param[in]  penumbra_radius  Half the width of the penumbra, in the local
+  ///                              coordinates of the path.
+  /// @param[in]  scale            The scale of the transform the mesh is drawn
+  ///                              with, which determines the tessellation
+  ///                              tolerance.
+  /// @param[in]  tessellator      The tessellator used to flatten the path.
+  ///
+  /// @return     The mesh, or nullptr if the path is not a single convex
+  ///             contour, or is too thin to have an umbra.
+  ///
+  static std::shared_ptr<ShadowVertices> Make(const Path& path,
+                                              Scalar penumbra_radius,
+                                              Scalar scale,
+                                              Tessellator& tessellator);
+
+  ShadowVertices(std::vector<Point> vertices,
+                 std::vector<uint16_t> indices,
+                 size_t umbra_vertex_count);
+
+  ~ShadowVertices();
+
+  /// The vertices of the umbra, which are fully covered, followed by those of
+  /// the outer edge of the penumbra, which are not covered at all.
+  const std::vector<Point>& GetVertices() const { return vertices_; }
+
+  /// Triangle indices into the vertices.
+  const std::vector<uint16_t>& GetIndices() const { return indices_; }
+
+  size_t GetUmbraVertexCount() const { return umbra_vertex_count_; }
+
+  const Rect& GetBounds() const { return bounds_; }
+
+  size_t GetByteSize() const;
+
+ private:
+  const std::vector<Point> vertices_;
+  const std::vector<uint16_t> indices_;
+  const size_t umbra_vertex_count_;
+  const Rect bounds_;
+
+  ShadowVertices(const ShadowVertices&) = delete;
+
+  ShadowVertices& operator=(const ShadowVertices&) = delete;
+};
+
+/// @brief A geometry that draws a shadow mesh in a single color.
+class ShadowVerticesGeometry final : public VerticesGeometry {
+ public:
+  ShadowVerticesGeometry(std::shared_ptr<ShadowVertices> vertices,
+                         const Color& color);
+
+  ~ShadowVerticesGeometry() override;
+
+  // |VerticesGeometry|
+  GeometryResult GetPositionUVColorBuffer(Rect texture_coverage,
+                                          Matrix effect_transform,
+                                          const ContentContext& renderer,
+                                          const Entity& entity,
+                                          RenderPass& pass) const override;
+
+  // |Geometry|
+  GeometryResult GetPositionBuffer(const ContentContext& renderer,
+                                   const Entity& entity,
+                                   RenderPass& pass) const override;
+
+  // |Geometry|
+  std::optional<Rect> GetCoverage(const Matrix& transform) const override;
+
+  // |VerticesGeometry|
+  bool HasVertexColors() const override;
+
+  // |VerticesGeometry|
+  bool HasTextureCoordinates() const override;
+
+  // |VerticesGeometry|
+  std::optional<Rect> GetTextureCoordinateCoverge() const override;
+
+ private:
+  const std::shared_ptr<ShadowVertices> vertices_;
+  const Color color_;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      A cache of shadow meshes, so that the shadows of paths that are
+///             drawn every frame are only tessellated once.
+///
+///             Meshes are keyed by the contents of the path, and by the blur
+///             and transform scale quantized into buckets, so that animating
+///             the scale only occasionally needs a new mesh. The least
+///             recently used meshes are evicted to stay within a byte budget.
+///
+///             Like the tessellator, this class must only be accessed on the
+///             raster thread.
+///
+class ShadowVerticesCache {
+ public:
+  /// The default limit on the total size of the cached meshes.
+  static constexpr size_t kDefaultBudgetBytes = 2 * 1024 * 1024;
+
+  struct Key {
+    /// A hash of the path contents.
+    uint64_t path_hash = 0;
+    /// The transform scale, in sixteenths of an octave.
+    int32_t scale_bucket = 0;
+    /// The blur sigma in device pixels, in quarter pixels.
+    int32_t sigma_bucket = 0;
+
+    //--------------------------------------------------------------------------
+    /// @brief      Creates the key for the shadow of a path.
+    ///
+    /// @param[in]  path_hash  A hash of the path contents.
+    /// @param[in]  sigma      The blur sigma, in the local coordinates of the
+    ///                        path.
+    /// @param[in]  scale      The scale of the transform the shadow is drawn
+    ///                        with.
+    ///
+    static Key Make(uint64_t path_hash, Scalar sigma, Scalar scale);
+
+    /// @brief  The transform scale of the bucket.
+    Scalar GetScale() const;
+
+    /// @brief  The penumbra radius of the bucket, in the local coordinates of
+    ///         the path.
+    Scalar GetPenumbraRadius() const;
+
+    bool operator==(const Key& other) const;
+
+    struct Hash {
+      size_t operator()(const Key& key) const;
+    };
+  };
+
+  struct Stats {
+    /// Lookups served by a cached mesh.
+    size_t hit_count = 0;
+    /// Lookups that tessellated a mesh.
+    size_t miss_count = 0;
+    /// The total size of the cached meshes.
+    size_t resident_bytes = 0;
+
+    /// @brief  The fraction of lookups served without tessellating.
+    double GetHitRate() const;
+  };
+
+  using MeshFactory = std::function<std::shared_ptr<ShadowVertices>()>;
+
+  explicit ShadowVerticesCache(size_t budget_bytes = kDefaultBudgetBytes);
+
+  ~ShadowVerticesCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the cached mesh for the key, or create and cache it with
+  ///             the factory.
+  ///
+  ///             Paths that have no mesh are remembered as well, so that they
+  ///             are not tessellated again.
+  ///
+  /// @return     The mesh, or nullptr if the path has no mesh.
+  ///
+  std::shared_ptr<ShadowVertices> GetOrCreate(const Key& key,
+                                              const MeshFactory& factory);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Drops every cached mesh.
+  ///
+  void Purge();
+
+  Stats GetStats() const;
+
+ private:
+  struct Entry {
+    Key key;
+    std::shared_ptr<ShadowVertices> vertices;
+    size_t byte_size;
+  };
+
+  const size_t budget_bytes_;
+  // Cached meshes, least recently used first.
+  std::list<Entry> entries_;
+  std::unordered_map<Key, std::list<Entry>::iterator, Key::Hash> index_;
+  Stats stats_;
+
+  void TraceStatsToTimeline() const;
+
+  ShadowVerticesCache(const ShadowVerticesCache&) = delete;
+
+  ShadowVerticesCache& operator=(const ShadowVerticesCache&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_ENTITY_GEOMETRY_SHADOW_VERTICES_H_
@@ -3,11 +3,35 @@
 // found in the LICENSE file.
 
 #include "impeller/entity/render_target_cache.h"
+
+#include <algorithm>
+
 #include "impeller/core/formats.h"
 #include "impeller/renderer/render_target.h"
 
 namespace impeller {
 
+static size_t GetTextureByteSize(const RenderTarget& render_target) {
+  std::vector<const Texture*> textures;
+  auto add_texture = [&textures](const std::shared_ptr<Texture>& texture) {
+    // The depth and stencil attachments usually share a texture.
+    if (texture && std::find(textures.begin(), textures.end(),
+                             texture.get()) == textures.end()) {
+      textures.push_back(texture.get());
+    }
+  };
+  render_target.IterateAllAttachments([&](const Attachment& attachment) {
+    add_texture(attachment.texture);
+    add_texture(attachment.resolve_texture);
+    return true;
+  });
+  size_t bytes = 0;
+  for (const Texture* texture : textures) {
+    bytes += texture->GetTextureDescriptor().GetByteSizeOfAllMipLevels();
+  }
+  return bytes;
+}
+
 RenderTargetCache::RenderTargetCache(std::shared_ptr<Allocator> allocator,
                                      uint32_t keep_alive_frame_count)
     : RenderTargetAllocator(std::move(allocator)),
@@ -21,6 +45,7 @@ void RenderTargetCache::Start() {
 
 void RenderTargetCache::End() {
   std::vector<RenderTargetData> retain;
+  size_t retained_bytes = 0;
 
   for (RenderTargetData& td : render_target_data_) {
     if (td.used_this_frame) {
@@ -28,9 +53,13 @@ void RenderTargetCache::End() {
     } else if (td.keep_alive_frame_count > 0) {
       td.keep_alive_frame_count--;
       retain.push_back(td);
+    } else {
+      continue;
     }
+    retained_bytes += GetTextureByteSize(td.render_target);
   }
   render_target_data_.swap(retain);
+  accounted_memory_.SetBytes(retained_bytes);
 }
 
 RenderTarget RenderTargetCache::CreateOffscreen(
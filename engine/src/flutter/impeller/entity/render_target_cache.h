@@ -6,6 +6,8 @@
 #define FLUTTER_IMPELLER_ENTITY_RENDER_TARGET_CACHE_H_
 
 #include <string_view>
+
+#include "flutter/fml/memory/memory_accounting.h"
 #include "impeller/renderer/render_target.h"
 
 namespace impeller {
@@ -67,6 +69,10 @@ class RenderTargetCache : public RenderTargetAllocator {
 
   std::vector<RenderTargetData> render_target_data_;
   uint32_t keep_alive_frame_count_;
+  // The bytes of the textures of the cached render targets as of the end of
+  // the last frame.
+  fml::AccountedMemory accounted_memory_{
+      fml::MemoryCategory::kRenderTargetCache, fml::MemoryDomain::kGpu};
 
   RenderTargetCache(const RenderTargetCache&) = delete;
 
@@ -4,9 +4,11 @@
 
 #include "flutter/benchmarking/benchmarking.h"
 
+#include "impeller/entity/geometry/shadow_vertices.h"
 #include "impeller/entity/geometry/stroke_path_geometry.h"
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/path_builder.h"
+#include "impeller/tessellator/tessellator.h"
 #include "impeller/tessellator/tessellator_libtess.h"
 
 namespace impeller {
@@ -33,6 +35,9 @@ Path CreateCubic(bool closed);
 Path CreateQuadratic(bool closed);
 /// Create a rounded rect.
 Path CreateRRect();
+/// A scrolling list of cards with only their top corners rounded, whose
+/// shadows have no analytic blur.
+std::vector<Path> CreateCardList();
 }  // namespace
 
 static TessellatorLibtess tess;
@@ -133,6 +138,46 @@ BENCHMARK_CAPTURE(BM_Polyline, quad_polyline, CreateQuadratic(true));
 BENCHMARK_CAPTURE(BM_Polyline, unclosed_quad_polyline, CreateQuadratic(false));
 MAKE_STROKE_BENCHMARK_CAPTURE_ALL_CAPS_JOINS(Quadratic, false);
 
+// The shadow of every card in the list, for a blur sigma of 8 device pixels at
+// a device pixel ratio of 2, tessellated every frame.
+static void BM_ShadowVerticesTessellate(benchmark::State& state) {
+  Tessellator tessellator;
+  auto cards = CreateCardList();
+  const Scalar penumbra_radius = 4 * ShadowVertices::kPenumbraRadiusPerSigma;
+
+  size_t vertex_count = 0u;
+  while (state.KeepRunning()) {
+    for (const Path& card : cards) {
+      auto vertices =
+          ShadowVertices::Make(card, penumbra_radius, 2.0f, tessellator);
+      vertex_count += vertices->GetVertices().size();
+    }
+  }
+  state.counters["TotalVertexCount"] = vertex_count;
+}
+
+// The same shadows, looked up in the cache every frame.
+static void BM_ShadowVerticesCached(benchmark::State& state) {
+  Tessellator tessellator;
+  ShadowVerticesCache cache;
+  auto cards = CreateCardList();
+
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < cards.size(); i++) {
+      auto key = ShadowVerticesCache::Key::Make(i, 4.0f, 2.0f);
+      auto vertices = cache.GetOrCreate(key, [&]() {
+        return ShadowVertices::Make(cards[i], key.GetPenumbraRadius(),
+                                    key.GetScale(), tessellator);
+      });
+      benchmark::DoNotOptimize(vertices);
+    }
+  }
+  state.counters["HitRate"] = cache.GetStats().GetHitRate();
+}
+
+BENCHMARK(BM_ShadowVerticesTessellate);
+BENCHMARK(BM_ShadowVerticesCached);
+
 BENCHMARK_CAPTURE(BM_Convex, rrect_convex, CreateRRect(), true);
 // A round rect has no ends so we don't need to try it with all cap values
 // but it does have joins and even though they should all be almost
@@ -150,6 +195,20 @@ Path CreateRRect() {
       .TakePath();
 }
 
+std::vector<Path> CreateCardList() {
+  std::vector<Path> cards;
+  for (int i = 0; i < 20; i++) {
+    const Scalar top = i * 120.0f;
+    cards.push_back(
+        PathBuilder{}
+            .AddRoundRect(RoundRect::MakeRectRadii(
+                Rect::MakeXYWH(16, top, 360, 96 + (i % 3) * 8),
+                {.top_left = Size(12, 12), .top_right = Size(12, 12)}))
+            .TakePath());
+  }
+  return cards;
+}
+
 Path CreateCubic(bool closed) {
   auto builder = PathBuilder{};
   builder  //
@@ -219,6 +219,12 @@ bool CapabilitiesGLES::SupportsPrimitiveRestart() const {
   return false;
 }
 
+bool CapabilitiesGLES::SupportsCompressedPixelFormat(PixelFormat format) const {
+  // Uploads to block compressed textures require glCompressedTexImage2D which
+  // the GLES backend doesn't use yet.
+  return false;
+}
+
 PixelFormat CapabilitiesGLES::GetDefaultGlyphAtlasFormat() const {
   return default_glyph_atlas_format_;
 }
@@ -116,6 +116,9 @@ class CapabilitiesGLES final
   // |Capabilities|
   bool SupportsPrimitiveRestart() const override;
 
+  // |Capabilities|
+  bool SupportsCompressedPixelFormat(PixelFormat format) const override;
+
   // |Capabilities|
   PixelFormat GetDefaultColorFormat() const override;
 
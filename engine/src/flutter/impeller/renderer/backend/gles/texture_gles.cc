@@ -39,6 +39,12 @@ static bool IsDepthStencilFormat(PixelFormat format) {
     case PixelFormat::kB10G10R10XR:
     case PixelFormat::kB10G10R10XRSRGB:
     case PixelFormat::kB10G10R10A10XR:
+    case PixelFormat::kBC1RGBAUNorm:
+    case PixelFormat::kBC3RGBAUNorm:
+    case PixelFormat::kBC7RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8UNorm:
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+    case PixelFormat::kASTC4x4UNorm:
       return false;
   }
   FML_UNREACHABLE();
@@ -110,6 +116,12 @@ struct TexImage2DData {
       case PixelFormat::kB10G10R10XRSRGB:
       case PixelFormat::kB10G10R10XR:
       case PixelFormat::kB10G10R10A10XR:
+      case PixelFormat::kBC1RGBAUNorm:
+      case PixelFormat::kBC3RGBAUNorm:
+      case PixelFormat::kBC7RGBAUNorm:
+      case PixelFormat::kETC2R8G8B8UNorm:
+      case PixelFormat::kETC2R8G8B8A8UNorm:
+      case PixelFormat::kASTC4x4UNorm:
         return;
     }
     is_valid_ = true;
@@ -387,6 +399,12 @@ static std::optional<GLenum> ToRenderBufferFormat(PixelFormat format) {
     case PixelFormat::kB10G10R10XRSRGB:
     case PixelFormat::kB10G10R10XR:
     case PixelFormat::kB10G10R10A10XR:
+    case PixelFormat::kBC1RGBAUNorm:
+    case PixelFormat::kBC3RGBAUNorm:
+    case PixelFormat::kBC7RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8UNorm:
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+    case PixelFormat::kASTC4x4UNorm:
       return std::nullopt;
   }
   FML_UNREACHABLE();
@@ -156,12 +156,10 @@ bool BlitPassMTL::OnCopyTextureToBufferCommand(
   auto source_size_mtl =
       MTLSizeMake(source_region.GetWidth(), source_region.GetHeight(), 1);
 
-  auto destination_bytes_per_pixel =
-      BytesPerPixelForPixelFormat(source->GetTextureDescriptor().format);
-  auto destination_bytes_per_row =
-      source_size_mtl.width * destination_bytes_per_pixel;
-  auto destination_bytes_per_image =
-      source_size_mtl.height * destination_bytes_per_row;
+  auto destination_bytes_per_row = BytesPerRowForPixelFormat(
+      source->GetTextureDescriptor().format, source_region.GetWidth());
+  auto destination_bytes_per_image = BytesForPixelFormatRegion(
+      source->GetTextureDescriptor().format, source_region.GetSize());
 
 #ifdef IMPELLER_DEBUG
   if (is_metal_trace_active_) {
@@ -209,10 +207,8 @@ bool BlitPassMTL::OnCopyBufferToTextureCommand(
   auto source_size_mtl = MTLSizeMake(destination_region.GetWidth(),
                                      destination_region.GetHeight(), 1);
 
-  auto destination_bytes_per_pixel =
-      BytesPerPixelForPixelFormat(destination->GetTextureDescriptor().format);
-  auto source_bytes_per_row =
-      destination_region.GetWidth() * destination_bytes_per_pixel;
+  auto source_bytes_per_row = BytesPerRowForPixelFormat(
+      destination->GetTextureDescriptor().format, destination_region.GetWidth());
 
 #ifdef IMPELLER_DEBUG
   if (is_metal_trace_active_) {
@@ -52,9 +52,28 @@ static bool DeviceSupportsComputeSubgroups(id<MTLDevice> device) {
   return supports_subgroups;
 }
 
+static bool DeviceSupportsBCTextureCompression(id<MTLDevice> device) {
+  if (@available(macOS 11.0, iOS 16.4, tvOS 16.4, *)) {
+    return [device supportsBCTextureCompression];
+  }
+  return false;
+}
+
+static bool DeviceSupportsETC2AndASTCTextureCompression(id<MTLDevice> device) {
+  // Refer to the "ETC2 and ASTC" pixel formats in the table below:
+  // https://developer.apple.com/metal/Metal-Feature-Set-Tables.pdf
+  if (@available(macOS 11.0, iOS 13, tvOS 13, *)) {
+    return [device supportsFamily:MTLGPUFamilyApple2];
+  }
+  return false;
+}
+
 static std::unique_ptr<Capabilities> InferMetalCapabilities(
     id<MTLDevice> device,
     PixelFormat color_format) {
+  const bool supports_bc = DeviceSupportsBCTextureCompression(device);
+  const bool supports_etc2_and_astc =
+      DeviceSupportsETC2AndASTCTextureCompression(device);
   return CapabilitiesBuilder()
       .SetSupportsOffscreenMSAA(true)
       .SetSupportsSSBO(true)
@@ -71,6 +90,15 @@ static std::unique_ptr<Capabilities> InferMetalCapabilities(
       .SetDefaultGlyphAtlasFormat(PixelFormat::kA8UNormInt)
       .SetSupportsTriangleFan(false)
       .SetMaximumRenderPassAttachmentSize(DeviceMaxTextureSizeSupported(device))
+      .SetSupportsCompressedPixelFormat(PixelFormat::kBC1RGBAUNorm, supports_bc)
+      .SetSupportsCompressedPixelFormat(PixelFormat::kBC3RGBAUNorm, supports_bc)
+      .SetSupportsCompressedPixelFormat(PixelFormat::kBC7RGBAUNorm, supports_bc)
+      .SetSupportsCompressedPixelFormat(PixelFormat::kETC2R8G8B8UNorm,
+                                        supports_etc2_and_astc)
+      .SetSupportsCompressedPixelFormat(PixelFormat::kETC2R8G8B8A8UNorm,
+                                        supports_etc2_and_astc)
+      .SetSupportsCompressedPixelFormat(PixelFormat::kASTC4x4UNorm,
+                                        supports_etc2_and_astc)
       .Build();
 }
 
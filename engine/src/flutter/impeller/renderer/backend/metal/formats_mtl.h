@@ -73,6 +73,11 @@ MTLPixelFormat SafeMTLPixelFormatBGR10_XR();
 /// Returns PixelFormat::kUnknown if MTLPixelFormatBGR10_XR isn't supported.
 MTLPixelFormat SafeMTLPixelFormatBGRA10_XR();
 
+/// Safe accessor for the block compressed Metal pixel formats.
+/// Returns MTLPixelFormatInvalid if the format isn't block compressed or isn't
+/// available in this version of the OS.
+MTLPixelFormat SafeMTLPixelFormatBlockCompressed(PixelFormat format);
+
 constexpr MTLPixelFormat ToMTLPixelFormat(PixelFormat format) {
   switch (format) {
     case PixelFormat::kUnknown:
@@ -107,6 +112,13 @@ constexpr MTLPixelFormat ToMTLPixelFormat(PixelFormat format) {
       return SafeMTLPixelFormatBGR10_XR();
     case PixelFormat::kB10G10R10A10XR:
       return SafeMTLPixelFormatBGRA10_XR();
+    case PixelFormat::kBC1RGBAUNorm:
+    case PixelFormat::kBC3RGBAUNorm:
+    case PixelFormat::kBC7RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8UNorm:
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+    case PixelFormat::kASTC4x4UNorm:
+      return SafeMTLPixelFormatBlockCompressed(format);
   }
   return MTLPixelFormatInvalid;
 };
@@ -143,4 +143,42 @@ MTLPixelFormat SafeMTLPixelFormatBGRA10_XR() {
   }
 }
 
+MTLPixelFormat SafeMTLPixelFormatBlockCompressed(PixelFormat format) {
+  switch (format) {
+    case PixelFormat::kBC1RGBAUNorm:
+      if (@available(iOS 16.4, macOS 10.11, *)) {
+        return MTLPixelFormatBC1_RGBA;
+      }
+      break;
+    case PixelFormat::kBC3RGBAUNorm:
+      if (@available(iOS 16.4, macOS 10.11, *)) {
+        return MTLPixelFormatBC3_RGBA;
+      }
+      break;
+    case PixelFormat::kBC7RGBAUNorm:
+      if (@available(iOS 16.4, macOS 10.11, *)) {
+        return MTLPixelFormatBC7_RGBAUnorm;
+      }
+      break;
+    case PixelFormat::kETC2R8G8B8UNorm:
+      if (@available(iOS 8, macOS 11.0, *)) {
+        return MTLPixelFormatETC2_RGB8;
+      }
+      break;
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+      if (@available(iOS 8, macOS 11.0, *)) {
+        return MTLPixelFormatEAC_RGBA8;
+      }
+      break;
+    case PixelFormat::kASTC4x4UNorm:
+      if (@available(iOS 8, macOS 11.0, *)) {
+        return MTLPixelFormatASTC_4x4_LDR;
+      }
+      break;
+    default:
+      break;
+  }
+  return MTLPixelFormatInvalid;
+}
+
 }  // namespace impeller
@@ -6,6 +6,8 @@
 
 #include <algorithm>
 #include <array>
+#include <initializer_list>
+#include <utility>
 
 #include "impeller/base/validation.h"
 #include "impeller/core/formats.h"
@@ -214,6 +216,8 @@ static const char* GetExtensionName(OptionalDeviceExtensionVK ext) {
       return "VK_KHR_portability_subset";
     case OptionalDeviceExtensionVK::kEXTImageCompressionControl:
       return VK_EXT_IMAGE_COMPRESSION_CONTROL_EXTENSION_NAME;
+    case OptionalDeviceExtensionVK::kEXTExtendedDynamicState:
+      return VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME;
     case OptionalDeviceExtensionVK::kLast:
       return "Unknown";
   }
@@ -404,6 +408,11 @@ CapabilitiesVK::GetEnabledDeviceFeatures(
     supported_chain
         .unlink<vk::PhysicalDeviceImageCompressionControlFeaturesEXT>();
   }
+  if (!IsExtensionInList(enabled_extensions.value(),
+                         OptionalDeviceExtensionVK::kEXTExtendedDynamicState)) {
+    supported_chain
+        .unlink<vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT>();
+  }
 
   device.getFeatures2(&supported_chain.get());
 
@@ -417,6 +426,12 @@ CapabilitiesVK::GetEnabledDeviceFeatures(
     // We require this for enabling wireframes in the playground. But its not
     // necessarily a big deal if we don't have this feature.
     required.fillModeNonSolid = supported.fillModeNonSolid;
+
+    // Block compressed textures are uploaded directly when available and
+    // decoded on the CPU otherwise.
+    required.textureCompressionBC = supported.textureCompressionBC;
+    required.textureCompressionETC2 = supported.textureCompressionETC2;
+    required.textureCompressionASTC_LDR = supported.textureCompressionASTC_LDR;
   }
   // VK_KHR_sampler_ycbcr_conversion features.
   if (IsExtensionInList(
@@ -449,6 +464,20 @@ CapabilitiesVK::GetEnabledDeviceFeatures(
         .unlink<vk::PhysicalDeviceImageCompressionControlFeaturesEXT>();
   }
 
+  // VK_EXT_extended_dynamic_state
+  if (IsExtensionInList(enabled_extensions.value(),
+                        OptionalDeviceExtensionVK::kEXTExtendedDynamicState)) {
+    auto& required =
+        required_chain.get<vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT>();
+    const auto& supported =
+        supported_chain
+            .get<vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT>();
+
+    required.extendedDynamicState = supported.extendedDynamicState;
+  } else {
+    required_chain.unlink<vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT>();
+  }
+
   // Vulkan 1.1
   {
     auto& required =
@@ -485,6 +514,12 @@ bool CapabilitiesVK::SupportsPrimitiveRestart() const {
   return true;
 }
 
+// |Capabilities|
+bool CapabilitiesVK::SupportsCompressedPixelFormat(PixelFormat format) const {
+  return supported_compressed_pixel_formats_.find(format) !=
+         supported_compressed_pixel_formats_.end();
+}
+
 void CapabilitiesVK::SetOffscreenFormat(PixelFormat pixel_format) const {
   default_color_format_ = pixel_format;
 }
@@ -591,6 +626,41 @@ bool CapabilitiesVK::SetPhysicalDevice(
           .get<vk::PhysicalDeviceImageCompressionControlFeaturesEXT>()
           .imageCompressionControl;
 
+  supports_extended_dynamic_state_ =
+      enabled_features
+          .isLinked<vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT>() &&
+      enabled_features.get<vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT>()
+          .extendedDynamicState;
+
+  {
+    // Block compressed formats may only be used if the feature for their
+    // family was enabled on the device.
+    const auto& features = enabled_features.get().features;
+    const auto supports_sampling = [&device](PixelFormat format) {
+      const auto properties =
+          device.getFormatProperties(ToVKImageFormat(format));
+      const auto required_features = vk::FormatFeatureFlagBits::eSampledImage |
+                                     vk::FormatFeatureFlagBits::eTransferDst;
+      return (properties.optimalTilingFeatures & required_features) ==
+             required_features;
+    };
+    supported_compressed_pixel_formats_.clear();
+    for (const auto& [format, feature_enabled] :
+         std::initializer_list<std::pair<PixelFormat, bool>>{
+             {PixelFormat::kBC1RGBAUNorm, features.textureCompressionBC},
+             {PixelFormat::kBC3RGBAUNorm, features.textureCompressionBC},
+             {PixelFormat::kBC7RGBAUNorm, features.textureCompressionBC},
+             {PixelFormat::kETC2R8G8B8UNorm, features.textureCompressionETC2},
+             {PixelFormat::kETC2R8G8B8A8UNorm,
+              features.textureCompressionETC2},
+             {PixelFormat::kASTC4x4UNorm, features.textureCompressionASTC_LDR},
+         }) {
+      if (feature_enabled && supports_sampling(format)) {
+        supported_compressed_pixel_formats_.insert(format);
+      }
+    }
+  }
+
   max_render_pass_attachment_size_ =
       ISize{device_properties_.limits.maxFramebufferWidth,
             device_properties_.limits.maxFramebufferHeight};
@@ -698,6 +768,10 @@ bool CapabilitiesVK::SupportsTextureFixedRateCompression() const {
   return supports_texture_fixed_rate_compression_;
 }
 
+bool CapabilitiesVK::SupportsExtendedDynamicState() const {
+  return supports_extended_dynamic_state_;
+}
+
 std::optional<vk::ImageCompressionFixedRateFlagBitsEXT>
 CapabilitiesVK::GetSupportedFRCRate(CompressionType compression_type,
                                     const FRCFormatDescriptor& desc) const {
@@ -140,6 +140,14 @@ enum class OptionalDeviceExtensionVK : uint32_t {
   ///
   kEXTImageCompressionControl,
 
+  //----------------------------------------------------------------------------
+  /// To set cull mode, winding order, and depth and stencil state per draw
+  /// instead of baking them into each pipeline variant.
+  ///
+  /// https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/VK_EXT_extended_dynamic_state.html
+  ///
+  kEXTExtendedDynamicState,
+
   kLast,
 };
 
@@ -198,7 +206,8 @@ class CapabilitiesVK final : public Capabilities,
       vk::StructureChain<vk::PhysicalDeviceFeatures2,
                          vk::PhysicalDeviceSamplerYcbcrConversionFeaturesKHR,
                          vk::PhysicalDevice16BitStorageFeatures,
-                         vk::PhysicalDeviceImageCompressionControlFeaturesEXT>;
+                         vk::PhysicalDeviceImageCompressionControlFeaturesEXT,
+                         vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT>;
 
   std::optional<PhysicalDeviceFeatures> GetEnabledDeviceFeatures(
       const vk::PhysicalDevice& physical_device) const;
@@ -247,6 +256,9 @@ class CapabilitiesVK final : public Capabilities,
   // |Capabilities|
   bool SupportsPrimitiveRestart() const override;
 
+  // |Capabilities|
+  bool SupportsCompressedPixelFormat(PixelFormat format) const override;
+
   // |Capabilities|
   PixelFormat GetDefaultColorFormat() const override;
 
@@ -281,6 +293,13 @@ class CapabilitiesVK final : public Capabilities,
       CompressionType compression_type,
       const FRCFormatDescriptor& desc) const;
 
+  //----------------------------------------------------------------------------
+  /// @return     If cull mode, winding order, and depth and stencil state may
+  ///             be set dynamically on the command buffer instead of being
+  ///             baked into pipelines.
+  ///
+  bool SupportsExtendedDynamicState() const;
+
  private:
   bool validations_enabled_ = false;
   std::map<std::string, std::set<std::string>> exts_;
@@ -296,6 +315,8 @@ class CapabilitiesVK final : public Capabilities,
   bool supports_compute_subgroups_ = false;
   bool supports_device_transient_textures_ = false;
   bool supports_texture_fixed_rate_compression_ = false;
+  bool supports_extended_dynamic_state_ = false;
+  std::set<PixelFormat> supported_compressed_pixel_formats_;
   ISize max_render_pass_attachment_size_ = ISize{0, 0};
   bool has_triangle_fans_ = true;
   bool is_valid_ = false;
@@ -391,10 +391,15 @@ void ContextVK::Setup(Settings settings) {
   auto sampler_library =
       std::shared_ptr<SamplerLibraryVK>(new SamplerLibraryVK(device_holder));
 
+  std::shared_ptr<fml::ConcurrentTaskRunner> shader_module_task_runner;
+  if (settings.enable_parallel_shader_module_creation) {
+    shader_module_task_runner = raster_message_loop_->GetTaskRunner();
+  }
   auto shader_library = std::shared_ptr<ShaderLibraryVK>(
       new ShaderLibraryVK(device_holder,                   //
-                          settings.shader_libraries_data)  //
-  );
+                          settings.shader_libraries_data,  //
+                          shader_module_task_runner        //
+                          ));
 
   if (!shader_library->IsValid()) {
     VALIDATION_LOG << "Could not create shader library.";
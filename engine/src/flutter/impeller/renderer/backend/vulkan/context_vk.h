@@ -84,6 +84,9 @@ class ContextVK final : public Context,
     bool disable_surface_control = false;
     /// If validations are requested but cannot be enabled, log a fatal error.
     bool fatal_missing_validations = false;
+    /// Whether the shader modules are created on the worker threads of the
+    /// context instead of serially on the calling thread.
+    bool enable_parallel_shader_module_creation = true;
 
     std::optional<EmbedderData> embedder_data;
 
@@ -175,6 +175,18 @@ constexpr vk::Format ToVKImageFormat(PixelFormat format) {
       return vk::Format::eR8Unorm;
     case PixelFormat::kR8G8UNormInt:
       return vk::Format::eR8G8Unorm;
+    case PixelFormat::kBC1RGBAUNorm:
+      return vk::Format::eBc1RgbaUnormBlock;
+    case PixelFormat::kBC3RGBAUNorm:
+      return vk::Format::eBc3UnormBlock;
+    case PixelFormat::kBC7RGBAUNorm:
+      return vk::Format::eBc7UnormBlock;
+    case PixelFormat::kETC2R8G8B8UNorm:
+      return vk::Format::eEtc2R8G8B8UnormBlock;
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+      return vk::Format::eEtc2R8G8B8A8UnormBlock;
+    case PixelFormat::kASTC4x4UNorm:
+      return vk::Format::eAstc4x4UnormBlock;
   }
 
   FML_UNREACHABLE();
@@ -206,6 +218,18 @@ constexpr PixelFormat ToPixelFormat(vk::Format format) {
       return PixelFormat::kR8UNormInt;
     case vk::Format::eR8G8Unorm:
       return PixelFormat::kR8G8UNormInt;
+    case vk::Format::eBc1RgbaUnormBlock:
+      return PixelFormat::kBC1RGBAUNorm;
+    case vk::Format::eBc3UnormBlock:
+      return PixelFormat::kBC3RGBAUNorm;
+    case vk::Format::eBc7UnormBlock:
+      return PixelFormat::kBC7RGBAUNorm;
+    case vk::Format::eEtc2R8G8B8UnormBlock:
+      return PixelFormat::kETC2R8G8B8UNorm;
+    case vk::Format::eEtc2R8G8B8A8UnormBlock:
+      return PixelFormat::kETC2R8G8B8A8UNorm;
+    case vk::Format::eAstc4x4UnormBlock:
+      return PixelFormat::kASTC4x4UNorm;
     default:
       return PixelFormat::kUnknown;
   }
@@ -426,6 +450,12 @@ constexpr bool PixelFormatIsDepthStencil(PixelFormat format) {
     case PixelFormat::kB10G10R10XR:
     case PixelFormat::kB10G10R10XRSRGB:
     case PixelFormat::kB10G10R10A10XR:
+    case PixelFormat::kBC1RGBAUNorm:
+    case PixelFormat::kBC3RGBAUNorm:
+    case PixelFormat::kBC7RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8UNorm:
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+    case PixelFormat::kASTC4x4UNorm:
       return false;
     case PixelFormat::kS8UInt:
     case PixelFormat::kD24UnormS8Uint:
@@ -525,6 +555,12 @@ constexpr vk::ImageAspectFlags ToVKImageAspectFlags(PixelFormat format) {
     case PixelFormat::kB10G10R10XR:
     case PixelFormat::kB10G10R10XRSRGB:
     case PixelFormat::kB10G10R10A10XR:
+    case PixelFormat::kBC1RGBAUNorm:
+    case PixelFormat::kBC3RGBAUNorm:
+    case PixelFormat::kBC7RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8UNorm:
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+    case PixelFormat::kASTC4x4UNorm:
       return vk::ImageAspectFlagBits::eColor;
     case PixelFormat::kS8UInt:
       return vk::ImageAspectFlagBits::eStencil;
@@ -599,6 +635,12 @@ constexpr vk::ImageAspectFlags ToImageAspectFlags(PixelFormat format) {
     case PixelFormat::kB10G10R10XR:
     case PixelFormat::kB10G10R10XRSRGB:
     case PixelFormat::kB10G10R10A10XR:
+    case PixelFormat::kBC1RGBAUNorm:
+    case PixelFormat::kBC3RGBAUNorm:
+    case PixelFormat::kBC7RGBAUNorm:
+    case PixelFormat::kETC2R8G8B8UNorm:
+    case PixelFormat::kETC2R8G8B8A8UNorm:
+    case PixelFormat::kASTC4x4UNorm:
       return vk::ImageAspectFlagBits::eColor;
     case PixelFormat::kS8UInt:
       return vk::ImageAspectFlagBits::eStencil;
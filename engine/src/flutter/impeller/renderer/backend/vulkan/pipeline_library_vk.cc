@@ -155,6 +155,96 @@ std::unique_ptr<ComputePipelineVK> PipelineLibraryVK::CreateComputePipeline(
   );
 }
 
+std::shared_ptr<PipelineVK> PipelineLibraryVK::CreatePipeline(
+    const PipelineDescriptor& desc) {
+  if (!pso_cache_->GetCapabilities()->SupportsExtendedDynamicState()) {
+    auto pipeline = CreateFullPipeline(desc);
+    if (pipeline) {
+      ReportPipelineCountsToTrace(/*created_vk_pipeline=*/true);
+    }
+    return pipeline;
+  }
+
+  // Pipelines that only differ in dynamic state share the same Vulkan
+  // pipeline object. The state is set on the command buffer per draw instead.
+  auto dynamic_state_desc = PipelineVK::GetDynamicStateDescriptor(desc);
+  std::shared_ptr<PipelineVK> parent;
+  {
+    Lock lock(dynamic_state_pipelines_mutex_);
+    if (auto found = dynamic_state_pipelines_.find(dynamic_state_desc);
+        found != dynamic_state_pipelines_.end()) {
+      parent = found->second.lock();
+    }
+  }
+  if (parent) {
+    std::shared_ptr<PipelineVK> pipeline =
+        PipelineVK::CreateSharingDynamicState(desc, weak_from_this(),
+                                              std::move(parent));
+    if (pipeline) {
+      ReportPipelineCountsToTrace(/*created_vk_pipeline=*/false);
+      return pipeline;
+    }
+  }
+
+  auto pipeline = CreateFullPipeline(desc);
+  if (!pipeline) {
+    return nullptr;
+  }
+  {
+    Lock lock(dynamic_state_pipelines_mutex_);
+    auto& entry = dynamic_state_pipelines_[std::move(dynamic_state_desc)];
+    if (entry.expired()) {
+      entry = pipeline;
+    }
+  }
+  ReportPipelineCountsToTrace(/*created_vk_pipeline=*/true);
+  return pipeline;
+}
+
+void PipelineLibraryVK::ReportPipelineCountsToTrace(bool created_vk_pipeline) {
+  const int64_t variants = ++pipeline_variant_count_;
+  const int64_t vk_pipelines =
+      created_vk_pipeline ? ++vk_pipeline_count_ : vk_pipeline_count_.load();
+  static constexpr int64_t kImpellerPipelineCountTraceID = 1989;
+  FML_TRACE_COUNTER("impeller",                      //
+                    "PipelineCount",                 // series name
+                    kImpellerPipelineCountTraceID,   // series ID
+                    "PipelineVariants", variants,    //
+                    "VulkanPipelines", vk_pipelines  //
+  );
+}
+
+std::shared_ptr<PipelineVK> PipelineLibraryVK::CreateFullPipeline(
+    const PipelineDescriptor& desc) {
+  // Pipelines that only differ in fixed function state from a pipeline that
+  // has already been created are created as derivatives of that pipeline. The
+  // base pipeline is kept alive for the duration of the creation of the
+  // derivative.
+  const auto derivative_key = PipelineVK::GetDerivativeKey(desc);
+  std::shared_ptr<PipelineVK> base_pipeline;
+  {
+    Lock lock(derivative_bases_mutex_);
+    if (auto found = derivative_bases_.find(derivative_key);
+        found != derivative_bases_.end()) {
+      base_pipeline = found->second.lock();
+    }
+  }
+
+  std::shared_ptr<PipelineVK> pipeline = PipelineVK::Create(
+      desc,                                                          //
+      device_holder_.lock(),                                         //
+      weak_from_this(),                                              //
+      /*immutable_sampler=*/{},                                      //
+      base_pipeline ? base_pipeline->GetPipeline() : vk::Pipeline{}  //
+  );
+
+  if (pipeline && !base_pipeline) {
+    Lock lock(derivative_bases_mutex_);
+    derivative_bases_[derivative_key] = pipeline;
+  }
+  return pipeline;
+}
+
 // |PipelineLibrary|
 PipelineFuture<PipelineDescriptor> PipelineLibraryVK::GetPipeline(
     PipelineDescriptor descriptor,
@@ -188,11 +278,8 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryVK::GetPipeline(
       return;
     }
 
-    promise->set_value(PipelineVK::Create(
-        descriptor,                                            //
-        PipelineLibraryVK::Cast(*thiz).device_holder_.lock(),  //
-        weak_this                                              //
-        ));
+    promise->set_value(
+        PipelineLibraryVK::Cast(*thiz).CreatePipeline(descriptor));
   };
 
   if (async) {
@@ -268,11 +355,28 @@ bool PipelineLibraryVK::HasPipeline(const PipelineDescriptor& descriptor) {
 // |PipelineLibrary|
 void PipelineLibraryVK::RemovePipelinesWithEntryPoint(
     std::shared_ptr<const ShaderFunction> function) {
+  auto uses_function = [&function](const PipelineDescriptor& desc) {
+    auto entrypoint = desc.GetEntrypointForStage(function->GetStage());
+    return entrypoint && entrypoint->IsEqual(*function);
+  };
+
+  // Shader functions are compared by name, so the Vulkan pipelines shared by
+  // variants and the derivative bases must be forgotten as well. Otherwise,
+  // the pipelines of a reloaded function would reuse the ones of the old
+  // shader code.
   Lock lock(pipelines_mutex_);
+  Lock dynamic_state_lock(dynamic_state_pipelines_mutex_);
+  Lock derivative_bases_lock(derivative_bases_mutex_);
 
   fml::erase_if(pipelines_, [&](auto item) {
-    return item->first.GetEntrypointForStage(function->GetStage())
-        ->IsEqual(*function);
+    return uses_function(item->first);
+  });
+  fml::erase_if(dynamic_state_pipelines_, [&](auto item) {
+    return uses_function(item->first);
+  });
+  fml::erase_if(derivative_bases_, [&](auto item) {
+    std::shared_ptr<PipelineVK> base = item->second.lock();
+    return !base || uses_function(base->GetDescriptor());
   });
 }
 
@@ -6,6 +6,7 @@
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_PIPELINE_LIBRARY_VK_H_
 
 #include <atomic>
+#include <unordered_map>
 
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/unique_fd.h"
@@ -42,6 +43,17 @@ class PipelineLibraryVK final
   std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner_;
   Mutex pipelines_mutex_;
   PipelineMap pipelines_ IPLR_GUARDED_BY(pipelines_mutex_);
+  Mutex dynamic_state_pipelines_mutex_;
+  std::unordered_map<PipelineDescriptor,
+                     std::weak_ptr<PipelineVK>,
+                     ComparableHash<PipelineDescriptor>,
+                     ComparableEqual<PipelineDescriptor>>
+      dynamic_state_pipelines_ IPLR_GUARDED_BY(dynamic_state_pipelines_mutex_);
+  std::atomic_int64_t pipeline_variant_count_ = 0;
+  std::atomic_int64_t vk_pipeline_count_ = 0;
+  Mutex derivative_bases_mutex_;
+  std::unordered_map<size_t, std::weak_ptr<PipelineVK>> derivative_bases_
+      IPLR_GUARDED_BY(derivative_bases_mutex_);
   Mutex compute_pipelines_mutex_;
   ComputePipelineMap compute_pipelines_ IPLR_GUARDED_BY(
       compute_pipelines_mutex_);
@@ -74,6 +86,13 @@ class PipelineLibraryVK final
   void RemovePipelinesWithEntryPoint(
       std::shared_ptr<const ShaderFunction> function) override;
 
+  std::shared_ptr<PipelineVK> CreatePipeline(const PipelineDescriptor& desc);
+
+  std::shared_ptr<PipelineVK> CreateFullPipeline(
+      const PipelineDescriptor& desc);
+
+  void ReportPipelineCountsToTrace(bool created_vk_pipeline);
+
   std::unique_ptr<ComputePipelineVK> CreateComputePipeline(
       const ComputePipelineDescriptor& desc);
 
@@ -4,6 +4,7 @@
 
 #include "impeller/renderer/backend/vulkan/pipeline_vk.h"
 
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/status_or.h"
 #include "flutter/fml/trace_event.h"
@@ -85,6 +86,7 @@ static void ReportPipelineCreationFeedbackToTrace(
     const vk::PipelineCreationFeedbackCreateInfoEXT& feedback) {
   static int64_t gPipelineCacheHits = 0;
   static int64_t gPipelineCacheMisses = 0;
+  static int64_t gBasePipelineAccelerations = 0;
   static int64_t gPipelines = 0;
   if (feedback.pPipelineCreationFeedback->flags &
       vk::PipelineCreationFeedbackFlagBits::eApplicationPipelineCacheHit) {
@@ -92,6 +94,10 @@ static void ReportPipelineCreationFeedbackToTrace(
   } else {
     gPipelineCacheMisses++;
   }
+  if (feedback.pPipelineCreationFeedback->flags &
+      vk::PipelineCreationFeedbackFlagBits::eBasePipelineAcceleration) {
+    gBasePipelineAccelerations++;
+  }
   gPipelines++;
   static constexpr int64_t kImpellerPipelineTraceID = 1988;
   FML_TRACE_COUNTER("impeller",                                   //
@@ -99,6 +105,8 @@ static void ReportPipelineCreationFeedbackToTrace(
                     kImpellerPipelineTraceID,                     // series ID
                     "PipelineCacheHits", gPipelineCacheHits,      //
                     "PipelineCacheMisses", gPipelineCacheMisses,  //
+                    "BasePipelineAccelerations",                  //
+                    gBasePipelineAccelerations,                   //
                     "TotalPipelines", gPipelines                  //
   );
 }
@@ -250,7 +258,8 @@ fml::StatusOr<vk::UniquePipeline> MakePipeline(
     const std::shared_ptr<DeviceHolderVK>& device_holder,
     const std::shared_ptr<PipelineCacheVK>& pso_cache,
     const vk::PipelineLayout& pipeline_layout,
-    const vk::RenderPass& render_pass) {
+    const vk::RenderPass& render_pass,
+    vk::Pipeline base_pipeline) {
   vk::StructureChain<vk::GraphicsPipelineCreateInfo,
                      vk::PipelineCreationFeedbackCreateInfoEXT>
       chain;
@@ -275,6 +284,23 @@ fml::StatusOr<vk::UniquePipeline> MakePipeline(
       vk::DynamicState::eScissor,
       vk::DynamicState::eStencilReference,
   };
+  // With extended dynamic state, the static cull, winding, depth, and stencil
+  // state specified below is ignored and must be set on the command buffer.
+  // See `PipelineVK::SetDynamicState`.
+  if (caps->SupportsExtendedDynamicState()) {
+    dynamic_states.insert(dynamic_states.end(),
+                          {
+                              vk::DynamicState::eCullModeEXT,
+                              vk::DynamicState::eFrontFaceEXT,
+                              vk::DynamicState::eDepthTestEnableEXT,
+                              vk::DynamicState::eDepthWriteEnableEXT,
+                              vk::DynamicState::eDepthCompareOpEXT,
+                              vk::DynamicState::eStencilTestEnableEXT,
+                              vk::DynamicState::eStencilOpEXT,
+                              vk::DynamicState::eStencilCompareMask,
+                              vk::DynamicState::eStencilWriteMask,
+                          });
+  }
   dynamic_create_state_info.setDynamicStates(dynamic_states);
   pipeline_info.setPDynamicState(&dynamic_create_state_info);
 
@@ -379,10 +405,19 @@ fml::StatusOr<vk::UniquePipeline> MakePipeline(
   blend_state.setAttachments(attachment_blend_state);
   pipeline_info.setPColorBlendState(&blend_state);
 
-  // Convention wisdom says that the base acceleration pipelines are never used
-  // by drivers for cache hits. Instead, the PSO cache is the preferred
-  // mechanism.
-  pipeline_info.setBasePipelineHandle(VK_NULL_HANDLE);
+  // Every pipeline may be the base of derivatives that share its shader stages
+  // and vertex layout but differ in fixed function state. Drivers are free to
+  // ignore the base pipeline and the PSO cache remains the primary mechanism
+  // for speeding up pipeline creation. Whether the driver took advantage of
+  // the base is reported via pipeline creation feedback.
+  vk::PipelineCreateFlags create_flags =
+      vk::PipelineCreateFlagBits::eAllowDerivatives;
+  if (base_pipeline) {
+    create_flags |= vk::PipelineCreateFlagBits::eDerivative;
+  }
+  pipeline_info.setFlags(create_flags);
+  pipeline_info.setBasePipelineHandle(base_pipeline);
+  pipeline_info.setBasePipelineIndex(-1);
   pipeline_info.setSubpass(0u);
   pipeline_info.setRenderPass(render_pass);
 
@@ -464,8 +499,10 @@ std::unique_ptr<PipelineVK> PipelineVK::Create(
     const PipelineDescriptor& desc,
     const std::shared_ptr<DeviceHolderVK>& device_holder,
     const std::weak_ptr<PipelineLibrary>& weak_library,
-    std::shared_ptr<SamplerVK> immutable_sampler) {
-  TRACE_EVENT1("flutter", "PipelineVK::Create", "Name", desc.GetLabel().data());
+    std::shared_ptr<SamplerVK> immutable_sampler,
+    vk::Pipeline base_pipeline) {
+  TRACE_EVENT2("flutter", "PipelineVK::Create", "Name", desc.GetLabel().data(),
+               "Derivative", base_pipeline ? "true" : "false");
 
   auto library = weak_library.lock();
 
@@ -496,7 +533,8 @@ std::unique_ptr<PipelineVK> PipelineVK::Create(
 
   fml::StatusOr<vk::UniquePipeline> pipeline =
       MakePipeline(desc, device_holder, pso_cache,
-                   pipeline_layout.value().get(), render_pass.get());
+                   pipeline_layout.value().get(), render_pass.get(),
+                   base_pipeline);
   if (!pipeline.ok()) {
     return nullptr;
   }
@@ -515,9 +553,24 @@ std::unique_ptr<PipelineVK> PipelineVK::Create(
     VALIDATION_LOG << "Could not create a valid pipeline.";
     return nullptr;
   }
+  pipeline_vk->uses_dynamic_state_ =
+      pso_cache->GetCapabilities()->SupportsExtendedDynamicState();
   return pipeline_vk;
 }
 
+std::unique_ptr<PipelineVK> PipelineVK::CreateSharingDynamicState(
+    const PipelineDescriptor& desc,
+    const std::weak_ptr<PipelineLibrary>& weak_library,
+    std::shared_ptr<PipelineVK> parent) {
+  if (!parent || !parent->IsValid() || !parent->UsesDynamicState()) {
+    return nullptr;
+  }
+  FML_DCHECK(GetDynamicStateDescriptor(desc).IsEqual(
+      GetDynamicStateDescriptor(parent->GetDescriptor())));
+  return std::unique_ptr<PipelineVK>(
+      new PipelineVK(weak_library, desc, std::move(parent)));
+}
+
 PipelineVK::PipelineVK(std::weak_ptr<DeviceHolderVK> device_holder,
                        std::weak_ptr<PipelineLibrary> library,
                        const PipelineDescriptor& desc,
@@ -536,6 +589,16 @@ PipelineVK::PipelineVK(std::weak_ptr<DeviceHolderVK> device_holder,
   is_valid_ = pipeline_ && render_pass_ && layout_ && descriptor_set_layout_;
 }
 
+PipelineVK::PipelineVK(std::weak_ptr<PipelineLibrary> library,
+                       const PipelineDescriptor& desc,
+                       std::shared_ptr<PipelineVK> dynamic_state_parent)
+    : Pipeline(std::move(library), desc),
+      device_holder_(dynamic_state_parent->device_holder_),
+      dynamic_state_parent_(std::move(dynamic_state_parent)),
+      uses_dynamic_state_(true) {
+  is_valid_ = dynamic_state_parent_->IsValid();
+}
+
 PipelineVK::~PipelineVK() {
   if (auto device = device_holder_.lock(); !device) {
     descriptor_set_layout_.release();
@@ -550,17 +613,69 @@ bool PipelineVK::IsValid() const {
 }
 
 vk::Pipeline PipelineVK::GetPipeline() const {
+  if (dynamic_state_parent_) {
+    return dynamic_state_parent_->GetPipeline();
+  }
   return *pipeline_;
 }
 
 const vk::PipelineLayout& PipelineVK::GetPipelineLayout() const {
+  if (dynamic_state_parent_) {
+    return dynamic_state_parent_->GetPipelineLayout();
+  }
   return *layout_;
 }
 
 const vk::DescriptorSetLayout& PipelineVK::GetDescriptorSetLayout() const {
+  if (dynamic_state_parent_) {
+    return dynamic_state_parent_->GetDescriptorSetLayout();
+  }
   return *descriptor_set_layout_;
 }
 
+bool PipelineVK::UsesDynamicState() const {
+  return uses_dynamic_state_;
+}
+
+static void SetDynamicStencilFaceState(
+    const vk::CommandBuffer& command_buffer,
+    vk::StencilFaceFlags face,
+    const std::optional<StencilAttachmentDescriptor>& stencil) {
+  // Absent stencil descriptors map to the same default op state used for
+  // static pipeline state.
+  const auto state =
+      stencil.has_value() ? ToVKStencilOpState(*stencil) : vk::StencilOpState{};
+  command_buffer.setStencilOpEXT(face, state.failOp, state.passOp,
+                                 state.depthFailOp, state.compareOp);
+  command_buffer.setStencilCompareMask(face, state.compareMask);
+  command_buffer.setStencilWriteMask(face, state.writeMask);
+}
+
+void PipelineVK::SetDynamicState(
+    const vk::CommandBuffer& command_buffer) const {
+  FML_DCHECK(uses_dynamic_state_);
+  const auto& desc = GetDescriptor();
+
+  command_buffer.setCullModeEXT(ToVKCullModeFlags(desc.GetCullMode()));
+  command_buffer.setFrontFaceEXT(ToVKFrontFace(desc.GetWindingOrder()));
+
+  const auto depth = desc.GetDepthStencilAttachmentDescriptor();
+  command_buffer.setDepthTestEnableEXT(depth.has_value());
+  command_buffer.setDepthWriteEnableEXT(depth.has_value() &&
+                                        depth->depth_write_enabled);
+  command_buffer.setDepthCompareOpEXT(
+      depth.has_value() ? ToVKCompareOp(depth->depth_compare)
+                        : vk::CompareOp::eNever);
+
+  const auto front = desc.GetFrontStencilAttachmentDescriptor();
+  const auto back = desc.GetBackStencilAttachmentDescriptor();
+  command_buffer.setStencilTestEnableEXT(front.has_value() || back.has_value());
+  SetDynamicStencilFaceState(command_buffer, vk::StencilFaceFlagBits::eFront,
+                             front);
+  SetDynamicStencilFaceState(command_buffer, vk::StencilFaceFlagBits::eBack,
+                             back);
+}
+
 std::shared_ptr<PipelineVK> PipelineVK::CreateVariantForImmutableSamplers(
     const std::shared_ptr<SamplerVK>& immutable_sampler) const {
   if (!immutable_sampler) {
@@ -577,7 +692,44 @@ std::shared_ptr<PipelineVK> PipelineVK::CreateVariantForImmutableSamplers(
     return nullptr;
   }
   return (immutable_sampler_variants_[cache_key] =
-              Create(desc_, device_holder, library_, immutable_sampler));
+              Create(desc_, device_holder, library_, immutable_sampler,
+                     GetPipeline()));
+}
+
+size_t PipelineVK::GetDerivativeKey(const PipelineDescriptor& desc) {
+  auto seed = fml::HashCombine();
+  for (const auto& entry : desc.GetStageEntrypoints()) {
+    fml::HashCombineSeed(seed, entry.first);
+    if (entry.second) {
+      fml::HashCombineSeed(seed, entry.second->GetHash());
+    }
+  }
+  for (const auto& constant : desc.GetSpecializationConstants()) {
+    fml::HashCombineSeed(seed, constant);
+  }
+  if (const auto& vertex_descriptor = desc.GetVertexDescriptor()) {
+    fml::HashCombineSeed(seed, vertex_descriptor->GetHash());
+  }
+  return seed;
+}
+
+PipelineDescriptor PipelineVK::GetDynamicStateDescriptor(
+    const PipelineDescriptor& desc) {
+  PipelineDescriptor dynamic_desc = desc;
+  dynamic_desc.SetLabel("");
+  dynamic_desc.SetCullMode(CullMode::kNone);
+  dynamic_desc.SetWindingOrder(WindingOrder::kClockwise);
+  // Whether there are depth and stencil attachments, and their pixel formats,
+  // decide the compatible render pass the pipeline is created with, so only
+  // their dynamic state is replaced with defaults.
+  if (desc.GetDepthStencilAttachmentDescriptor().has_value()) {
+    dynamic_desc.SetDepthStencilAttachmentDescriptor(
+        DepthAttachmentDescriptor{});
+  }
+  if (desc.HasStencilAttachmentDescriptors()) {
+    dynamic_desc.SetStencilAttachmentDescriptors(StencilAttachmentDescriptor{});
+  }
+  return dynamic_desc;
 }
 
 }  // namespace impeller
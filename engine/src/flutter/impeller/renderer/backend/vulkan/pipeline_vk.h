@@ -33,7 +33,58 @@ class PipelineVK final
       const PipelineDescriptor& desc,
       const std::shared_ptr<DeviceHolderVK>& device_holder,
       const std::weak_ptr<PipelineLibrary>& weak_library,
-      std::shared_ptr<SamplerVK> immutable_sampler = {});
+      std::shared_ptr<SamplerVK> immutable_sampler = {},
+      vk::Pipeline base_pipeline = {});
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get a key that is the same for pipeline descriptors that only
+  ///             differ in fixed function state (blending, stencil, sample
+  ///             count, etc.) but use the same shader stages, specialization
+  ///             constants, and vertex layout. Pipelines with the same key
+  ///             may be created as derivatives of one another.
+  ///
+  /// @param[in]  desc  The pipeline descriptor.
+  ///
+  /// @return     The derivative key.
+  ///
+  static size_t GetDerivativeKey(const PipelineDescriptor& desc);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Create a pipeline for the given descriptor that shares the
+  ///             Vulkan pipeline object of a pipeline created with dynamic
+  ///             state. The descriptors of both pipelines must have the same
+  ///             dynamic state descriptor.
+  ///
+  /// @see        `GetDynamicStateDescriptor`
+  ///
+  /// @param[in]  desc          The pipeline descriptor.
+  /// @param[in]  weak_library  The library that owns the pipeline.
+  /// @param[in]  parent        The pipeline whose Vulkan pipeline object to
+  ///                           share.
+  ///
+  /// @return     The pipeline.
+  ///
+  static std::unique_ptr<PipelineVK> CreateSharingDynamicState(
+      const PipelineDescriptor& desc,
+      const std::weak_ptr<PipelineLibrary>& weak_library,
+      std::shared_ptr<PipelineVK> parent);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get a copy of the descriptor with all state that is set
+  ///             dynamically (cull mode, winding order, and depth and stencil
+  ///             test state) reset to defaults. Whether the descriptor has
+  ///             depth and stencil attachments is kept, as it decides the
+  ///             compatible render pass. Descriptors that only differ in
+  ///             dynamic state have equal dynamic state descriptors and may
+  ///             share a Vulkan pipeline object when the device supports
+  ///             VK_EXT_extended_dynamic_state.
+  ///
+  /// @param[in]  desc  The pipeline descriptor.
+  ///
+  /// @return     The dynamic state descriptor.
+  ///
+  static PipelineDescriptor GetDynamicStateDescriptor(
+      const PipelineDescriptor& desc);
 
   // |Pipeline|
   ~PipelineVK() override;
@@ -44,6 +95,20 @@ class PipelineVK final
 
   const vk::DescriptorSetLayout& GetDescriptorSetLayout() const;
 
+  //----------------------------------------------------------------------------
+  /// @return     If cull mode, winding order, and depth and stencil state must
+  ///             be set on the command buffer after binding this pipeline.
+  ///
+  bool UsesDynamicState() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record the dynamic state of this pipeline's descriptor into
+  ///             the command buffer. Only valid if `UsesDynamicState`.
+  ///
+  /// @param[in]  command_buffer  The command buffer the pipeline is bound to.
+  ///
+  void SetDynamicState(const vk::CommandBuffer& command_buffer) const;
+
   std::shared_ptr<PipelineVK> CreateVariantForImmutableSamplers(
       const std::shared_ptr<SamplerVK>& immutable_sampler) const;
 
@@ -62,6 +127,8 @@ class PipelineVK final
   vk::UniquePipelineLayout layout_;
   vk::UniqueDescriptorSetLayout descriptor_set_layout_;
   std::shared_ptr<SamplerVK> immutable_sampler_;
+  std::shared_ptr<PipelineVK> dynamic_state_parent_;
+  bool uses_dynamic_state_ = false;
   mutable Mutex immutable_sampler_variants_mutex_;
   mutable ImmutableSamplerVariants immutable_sampler_variants_ IPLR_GUARDED_BY(
       immutable_sampler_variants_mutex_);
@@ -76,6 +143,10 @@ class PipelineVK final
              vk::UniqueDescriptorSetLayout descriptor_set_layout,
              std::shared_ptr<SamplerVK> immutable_sampler);
 
+  PipelineVK(std::weak_ptr<PipelineLibrary> library,
+             const PipelineDescriptor& desc,
+             std::shared_ptr<PipelineVK> dynamic_state_parent);
+
   // |Pipeline|
   bool IsValid() const override;
 
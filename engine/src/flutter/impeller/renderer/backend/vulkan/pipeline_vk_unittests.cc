@@ -0,0 +1,170 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/mapping.h"
+#include "gtest/gtest.h"
+#include "impeller/renderer/backend/vulkan/capabilities_vk.h"
+#include "impeller/renderer/backend/vulkan/pipeline_vk.h"
+#include "impeller/renderer/backend/vulkan/test/mock_vulkan.h"
+#include "impeller/renderer/pipeline_descriptor.h"
+
+namespace impeller {
+namespace testing {
+
+TEST(PipelineVKTest, DerivativeKeyIgnoresFixedFunctionState) {
+  PipelineDescriptor a;
+  a.SetLabel("A");
+  a.SetSampleCount(SampleCount::kCount1);
+  a.SetSpecializationConstants({1.0f});
+
+  ColorAttachmentDescriptor color;
+  color.format = PixelFormat::kR8G8B8A8UNormInt;
+  color.blending_enabled = true;
+
+  PipelineDescriptor b = a;
+  b.SetLabel("B");
+  b.SetSampleCount(SampleCount::kCount4);
+  b.SetColorAttachmentDescriptor(0u, color);
+  b.SetStencilPixelFormat(PixelFormat::kS8UInt);
+  b.SetCullMode(CullMode::kBackFace);
+
+  EXPECT_NE(a.GetHash(), b.GetHash());
+  EXPECT_EQ(PipelineVK::GetDerivativeKey(a), PipelineVK::GetDerivativeKey(b));
+}
+
+TEST(PipelineVKTest, DerivativeKeyIncludesSpecializationConstants) {
+  PipelineDescriptor a;
+  a.SetSpecializationConstants({1.0f});
+
+  PipelineDescriptor b = a;
+  b.SetSpecializationConstants({0.0f});
+
+  EXPECT_NE(PipelineVK::GetDerivativeKey(a), PipelineVK::GetDerivativeKey(b));
+}
+
+TEST(PipelineVKTest, DynamicStateDescriptorIgnoresDynamicState) {
+  PipelineDescriptor a;
+  a.SetLabel("A");
+  a.SetStencilPixelFormat(PixelFormat::kS8UInt);
+  a.SetStencilAttachmentDescriptors(StencilAttachmentDescriptor{});
+  a.SetDepthStencilAttachmentDescriptor(DepthAttachmentDescriptor{});
+
+  StencilAttachmentDescriptor stencil;
+  stencil.stencil_compare = CompareFunction::kEqual;
+  stencil.depth_stencil_pass = StencilOperation::kIncrementClamp;
+  DepthAttachmentDescriptor depth;
+  depth.depth_compare = CompareFunction::kLess;
+  depth.depth_write_enabled = true;
+
+  PipelineDescriptor b = a;
+  b.SetLabel("B");
+  b.SetStencilAttachmentDescriptors(stencil);
+  b.SetDepthStencilAttachmentDescriptor(depth);
+  b.SetCullMode(CullMode::kBackFace);
+  b.SetWindingOrder(WindingOrder::kCounterClockwise);
+
+  EXPECT_FALSE(a.IsEqual(b));
+  EXPECT_TRUE(PipelineVK::GetDynamicStateDescriptor(a).IsEqual(
+      PipelineVK::GetDynamicStateDescriptor(b)));
+}
+
+TEST(PipelineVKTest, DynamicStateDescriptorKeepsDepthStencilAttachments) {
+  PipelineDescriptor without_attachments;
+  without_attachments.SetStencilPixelFormat(PixelFormat::kS8UInt);
+
+  // The compatible render pass of a pipeline only has a depth or stencil
+  // attachment if the descriptor has depth or stencil state.
+  PipelineDescriptor with_stencil = without_attachments;
+  with_stencil.SetStencilAttachmentDescriptors(StencilAttachmentDescriptor{});
+  PipelineDescriptor with_depth = without_attachments;
+  with_depth.SetDepthStencilAttachmentDescriptor(DepthAttachmentDescriptor{});
+
+  PipelineDescriptor key =
+      PipelineVK::GetDynamicStateDescriptor(without_attachments);
+  PipelineDescriptor stencil_key =
+      PipelineVK::GetDynamicStateDescriptor(with_stencil);
+  PipelineDescriptor depth_key =
+      PipelineVK::GetDynamicStateDescriptor(with_depth);
+  EXPECT_FALSE(key.IsEqual(stencil_key));
+  EXPECT_FALSE(key.IsEqual(depth_key));
+  EXPECT_FALSE(stencil_key.IsEqual(depth_key));
+}
+
+TEST(PipelineVKTest, DynamicStateDescriptorKeepsRenderPassCompatibility) {
+  PipelineDescriptor a;
+  a.SetStencilPixelFormat(PixelFormat::kS8UInt);
+
+  PipelineDescriptor b = a;
+  b.SetStencilPixelFormat(PixelFormat::kD24UnormS8Uint);
+
+  ColorAttachmentDescriptor color;
+  color.format = PixelFormat::kR8G8B8A8UNormInt;
+  color.blending_enabled = true;
+  PipelineDescriptor c = a;
+  c.SetColorAttachmentDescriptor(0u, color);
+
+  EXPECT_FALSE(PipelineVK::GetDynamicStateDescriptor(a).IsEqual(
+      PipelineVK::GetDynamicStateDescriptor(b)));
+  EXPECT_FALSE(PipelineVK::GetDynamicStateDescriptor(a).IsEqual(
+      PipelineVK::GetDynamicStateDescriptor(c)));
+}
+
+TEST(PipelineVKTest, ReloadedShaderDoesNotReuseStalePipelines) {
+  std::shared_ptr<ContextVK> context =
+      MockVulkanContextBuilder()
+          .SetDeviceExtensions({"VK_KHR_swapchain",
+                                VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME})
+          .Build();
+  ASSERT_TRUE(context);
+  ASSERT_TRUE(CapabilitiesVK::Cast(*context->GetCapabilities())
+                  .SupportsExtendedDynamicState());
+
+  const std::shared_ptr<ShaderLibrary>& library = context->GetShaderLibrary();
+  const std::shared_ptr<PipelineLibrary>& pipeline_library =
+      context->GetPipelineLibrary();
+  std::vector<uint8_t> spirv = {0x03, 0x02, 0x23, 0x07};
+  auto register_runtime_effect = [&]() {
+    library->RegisterFunction("runtime_effect_main", ShaderStage::kFragment,
+                              std::make_shared<fml::DataMapping>(spirv),
+                              [](bool) {});
+    return library->GetFunction("runtime_effect_main", ShaderStage::kFragment);
+  };
+
+  std::shared_ptr<const ShaderFunction> function = register_runtime_effect();
+  ASSERT_TRUE(function);
+  PipelineDescriptor desc;
+  desc.SetVertexDescriptor(std::make_shared<VertexDescriptor>());
+  desc.AddStageEntrypoint(function);
+  // The old pipeline stays alive, as it would while a frame using it is in
+  // flight.
+  std::shared_ptr<Pipeline<PipelineDescriptor>> old_pipeline =
+      pipeline_library->GetPipeline(desc).Get();
+  ASSERT_TRUE(old_pipeline);
+
+  // Reload the runtime effect the way RuntimeEffectContents does.
+  pipeline_library->RemovePipelinesWithEntryPoint(function);
+  library->UnregisterFunction("runtime_effect_main", ShaderStage::kFragment);
+  std::shared_ptr<const ShaderFunction> reloaded = register_runtime_effect();
+  ASSERT_TRUE(reloaded);
+  ASSERT_TRUE(reloaded->IsEqual(*function));
+  desc.AddStageEntrypoint(reloaded);
+
+  EXPECT_FALSE(pipeline_library->HasPipeline(desc));
+  std::shared_ptr<Pipeline<PipelineDescriptor>> new_pipeline =
+      pipeline_library->GetPipeline(desc).Get();
+  ASSERT_TRUE(new_pipeline);
+  EXPECT_NE(PipelineVK::Cast(*new_pipeline).GetPipeline(),
+            PipelineVK::Cast(*old_pipeline).GetPipeline());
+
+  // Variants that only differ in dynamic state share the new pipeline.
+  desc.SetCullMode(CullMode::kBackFace);
+  std::shared_ptr<Pipeline<PipelineDescriptor>> variant =
+      pipeline_library->GetPipeline(desc).Get();
+  ASSERT_TRUE(variant);
+  EXPECT_EQ(PipelineVK::Cast(*variant).GetPipeline(),
+            PipelineVK::Cast(*new_pipeline).GetPipeline());
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -491,6 +491,9 @@ fml::Status RenderPassVK::Draw() {
   const auto pipeline_layout = pipeline_vk.GetPipelineLayout();
   command_buffer_vk_.bindPipeline(vk::PipelineBindPoint::eGraphics,
                                   pipeline_vk.GetPipeline());
+  if (pipeline_vk.UsesDynamicState()) {
+    pipeline_vk.SetDynamicState(command_buffer_vk_);
+  }
 
   for (auto i = 0u; i < descriptor_write_offset_; i++) {
     write_workspace_[i].dstSet = descriptor_set;
@@ -4,9 +4,11 @@
 
 #include "impeller/renderer/backend/vulkan/shader_library_vk.h"
 
+#include <atomic>
 #include <cstdint>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/shader_function_vk.h"
@@ -48,22 +50,31 @@ static std::string VKShaderNameToShaderKeyName(const std::string& name,
   return stream.str();
 }
 
+namespace {
+struct PendingShaderFunction {
+  std::string name;
+  ShaderStage stage;
+  std::shared_ptr<fml::Mapping> code;
+};
+}  // namespace
+
 ShaderLibraryVK::ShaderLibraryVK(
     std::weak_ptr<DeviceHolderVK> device_holder,
-    const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data)
+    const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_task_runner)
     : device_holder_(std::move(device_holder)) {
   TRACE_EVENT0("impeller", "CreateShaderLibrary");
-  bool success = true;
+  std::vector<PendingShaderFunction> pending_functions;
   auto iterator = [&](auto type,         //
                       const auto& name,  //
                       const auto& code   //
                       ) -> bool {
     const auto stage = ToShaderStage(type);
-    if (!RegisterFunction(VKShaderNameToShaderKeyName(name, stage), stage,
-                          code)) {
-      success = false;
-      return false;
-    }
+    pending_functions.push_back(PendingShaderFunction{
+        .name = VKShaderNameToShaderKeyName(name, stage),
+        .stage = stage,
+        .code = code,
+    });
     return true;
   };
   for (const auto& library_data : shader_libraries_data) {
@@ -75,6 +86,34 @@ ShaderLibraryVK::ShaderLibraryVK(
     blob_library.IterateAllShaders(iterator);
   }
 
+  // Shader modules don't depend on one another and vkCreateShaderModule needs
+  // no external synchronization. On devices where module creation is slow,
+  // doing this serially is a significant part of context startup.
+  //
+  // Pipelines are not scheduled by dependency. They are created in the order
+  // ContentContext requests them on the FIFO worker runner, after all modules
+  // exist.
+  std::atomic_bool success = true;
+  if (worker_task_runner && pending_functions.size() > 1u) {
+    fml::CountDownLatch latch(pending_functions.size());
+    for (const auto& function : pending_functions) {
+      worker_task_runner->PostTask([&]() {
+        if (!RegisterFunction(function.name, function.stage, function.code)) {
+          success = false;
+        }
+        latch.CountDown();
+      });
+    }
+    latch.Wait();
+  } else {
+    for (const auto& function : pending_functions) {
+      if (!RegisterFunction(function.name, function.stage, function.code)) {
+        success = false;
+        break;
+      }
+    }
+  }
+
   if (!success) {
     VALIDATION_LOG << "Could not create shader modules for all shader blobs.";
     return;
@@ -128,6 +167,7 @@ bool ShaderLibraryVK::RegisterFunction(
     const std::string& name,
     ShaderStage stage,
     const std::shared_ptr<fml::Mapping>& code) {
+  TRACE_EVENT1("impeller", "CreateShaderModule", "Name", name.c_str());
   if (!code) {
     return false;
   }
@@ -5,6 +5,7 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_SHADER_LIBRARY_VK_H_
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_SHADER_LIBRARY_VK_H_
 
+#include "flutter/fml/concurrent_message_loop.h"
 #include "impeller/base/comparable.h"
 #include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/device_holder_vk.h"
@@ -30,9 +31,17 @@ class ShaderLibraryVK final : public ShaderLibrary {
   ShaderFunctionMap functions_ IPLR_GUARDED_BY(functions_mutex_);
   bool is_valid_ = false;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Creates shader modules for all shaders in the given
+  ///             libraries. If a worker task runner is specified, module
+  ///             creation is fanned out over it and the constructor waits for
+  ///             all modules to be created.
+  ///
   ShaderLibraryVK(
       std::weak_ptr<DeviceHolderVK> device_holder,
-      const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data);
+      const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& worker_task_runner =
+          nullptr);
 
   // |ShaderLibrary|
   std::shared_ptr<const ShaderFunction> GetFunction(std::string_view name,
@@ -4,6 +4,8 @@
 
 #include "impeller/renderer/backend/vulkan/test/mock_vulkan.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <utility>
@@ -198,20 +200,44 @@ void vkGetPhysicalDeviceQueueFamilyProperties(
   }
 }
 
+static thread_local std::vector<std::string> g_device_extensions;
+
 VkResult vkEnumerateDeviceExtensionProperties(
     VkPhysicalDevice physicalDevice,
     const char* pLayerName,
     uint32_t* pPropertyCount,
     VkExtensionProperties* pProperties) {
   if (!pProperties) {
-    *pPropertyCount = 1;
+    *pPropertyCount = g_device_extensions.size();
   } else {
-    strcpy(pProperties[0].extensionName, "VK_KHR_swapchain");
-    pProperties[0].specVersion = 0;
+    uint32_t count = 0;
+    for (const std::string& ext : g_device_extensions) {
+      strncpy(pProperties[count].extensionName, ext.c_str(),
+              sizeof(VkExtensionProperties::extensionName));
+      pProperties[count].specVersion = 0;
+      count++;
+    }
   }
   return VK_SUCCESS;
 }
 
+void vkGetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice,
+                                  VkPhysicalDeviceFeatures2* pFeatures) {
+  // Only the features of the mocked device extensions are reported.
+  bool has_extended_dynamic_state =
+      std::find(g_device_extensions.begin(), g_device_extensions.end(),
+                VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME) !=
+      g_device_extensions.end();
+  auto* next = static_cast<VkBaseOutStructure*>(pFeatures->pNext);
+  for (; next != nullptr; next = next->pNext) {
+    if (next->sType ==
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT) {
+      reinterpret_cast<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT*>(next)
+          ->extendedDynamicState = has_extended_dynamic_state;
+    }
+  }
+}
+
 VkResult vkCreateDevice(VkPhysicalDevice physicalDevice,
                         const VkDeviceCreateInfo* pCreateInfo,
                         const VkAllocationCallbacks* pAllocator,
@@ -387,7 +413,10 @@ VkResult vkCreateGraphicsPipelines(
     VkPipeline* pPipelines) {
   MockDevice* mock_device = reinterpret_cast<MockDevice*>(device);
   mock_device->AddCalledFunction("vkCreateGraphicsPipelines");
-  *pPipelines = reinterpret_cast<VkPipeline>(0x99999999);
+  static std::atomic<uint64_t> next_pipeline = 0x99999999;
+  for (uint32_t i = 0; i < createInfoCount; i++) {
+    pPipelines[i] = reinterpret_cast<VkPipeline>(next_pipeline++);
+  }
   return VK_SUCCESS;
 }
 
@@ -772,6 +801,8 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
   } else if (strcmp("vkEnumerateDeviceExtensionProperties", pName) == 0) {
     return reinterpret_cast<PFN_vkVoidFunction>(
         vkEnumerateDeviceExtensionProperties);
+  } else if (strcmp("vkGetPhysicalDeviceFeatures2", pName) == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(vkGetPhysicalDeviceFeatures2);
   } else if (strcmp("vkCreateDevice", pName) == 0) {
     return reinterpret_cast<PFN_vkVoidFunction>(vkCreateDevice);
   } else if (strcmp("vkCreateInstance", pName) == 0) {
@@ -937,6 +968,7 @@ std::shared_ptr<ContextVK> MockVulkanContextBuilder::Build() {
   }
   g_instance_extensions = instance_extensions_;
   g_instance_layers = instance_layers_;
+  g_device_extensions = device_extensions_;
   g_format_properties_callback = format_properties_callback_;
   g_physical_device_properties_callback = physical_properties_callback_;
   settings.embedder_data = embedder_data_;
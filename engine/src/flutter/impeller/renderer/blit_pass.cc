@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "impeller/renderer/blit_pass.h"
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -98,9 +99,8 @@ bool BlitPass::AddCopy(std::shared_ptr<Texture> source,
     source_region = IRect::MakeSize(source->GetSize());
   }
 
-  auto bytes_per_pixel =
-      BytesPerPixelForPixelFormat(source->GetTextureDescriptor().format);
-  auto bytes_per_image = source_region->Area() * bytes_per_pixel;
+  auto bytes_per_image = BytesForPixelFormatRegion(
+      source->GetTextureDescriptor().format, source_region->GetSize());
   if (destination_offset + bytes_per_image >
       destination->GetDeviceBufferDescriptor().size) {
     VALIDATION_LOG
@@ -142,9 +142,30 @@ bool BlitPass::AddCopy(BufferView source,
     return false;
   }
 
-  auto bytes_per_pixel =
-      BytesPerPixelForPixelFormat(destination->GetTextureDescriptor().format);
-  auto bytes_per_region = destination_region_value.Area() * bytes_per_pixel;
+  const auto destination_format = destination->GetTextureDescriptor().format;
+  if (IsBlockCompressed(destination_format)) {
+    // Copies into block compressed textures must cover whole blocks, except
+    // at the right and bottom edges of the mip level.
+    const auto is_block_aligned = [](int64_t value) {
+      return value % kCompressedBlockDimension == 0;
+    };
+    const auto mip_width =
+        std::max<int64_t>(1, destination_size.width >> mip_level);
+    const auto mip_height =
+        std::max<int64_t>(1, destination_size.height >> mip_level);
+    if (!is_block_aligned(destination_region_value.GetX()) ||
+        !is_block_aligned(destination_region_value.GetY()) ||
+        (!is_block_aligned(destination_region_value.GetWidth()) &&
+         destination_region_value.GetRight() != mip_width) ||
+        (!is_block_aligned(destination_region_value.GetHeight()) &&
+         destination_region_value.GetBottom() != mip_height)) {
+      VALIDATION_LOG << "Blit region must be aligned to the blocks of a "
+                        "compressed destination texture.";
+      return false;
+    }
+  }
+  auto bytes_per_region = BytesForPixelFormatRegion(
+      destination_format, destination_region_value.GetSize());
 
   if (source.GetRange().length != bytes_per_region) {
     VALIDATION_LOG
@@ -179,6 +200,11 @@ bool BlitPass::GenerateMipmap(std::shared_ptr<Texture> texture,
                       "with no texture.";
     return false;
   }
+  if (IsBlockCompressed(texture->GetTextureDescriptor().format)) {
+    VALIDATION_LOG << "Mipmaps cannot be generated for block compressed "
+                      "textures.";
+    return false;
+  }
 
   return OnGenerateMipmapCommand(std::move(texture), label);
 }
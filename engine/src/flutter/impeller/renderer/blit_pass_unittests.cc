@@ -9,6 +9,7 @@
 #include "fml/mapping.h"
 #include "gtest/gtest.h"
 #include "impeller/base/validation.h"
+#include "impeller/core/buffer_view.h"
 #include "impeller/core/device_buffer.h"
 #include "impeller/core/device_buffer_descriptor.h"
 #include "impeller/core/formats.h"
@@ -199,6 +200,81 @@ TEST_P(BlitPassTest, CanBlitToHigherTextureMipLevels) {
   EXPECT_TRUE(context->GetCommandQueue()->Submit({std::move(cmd_buffer)}).ok());
 }
 
+TEST_P(BlitPassTest, CanBlitToCompressedTextureMipLevels) {
+  auto context = GetContext();
+  if (!context->GetCapabilities()->SupportsCompressedPixelFormat(
+          PixelFormat::kBC1RGBAUNorm)) {
+    GTEST_SKIP() << "BC1 textures are not supported on this device.";
+  }
+  auto cmd_buffer = context->CreateCommandBuffer();
+  auto blit_pass = cmd_buffer->CreateBlitPass();
+
+  TextureDescriptor dst_format;
+  dst_format.storage_mode = StorageMode::kDevicePrivate;
+  dst_format.format = PixelFormat::kBC1RGBAUNorm;
+  dst_format.size = {8, 6};
+  dst_format.mip_count = 2;
+  auto dst = context->GetResourceAllocator()->CreateTexture(dst_format);
+
+  // Two by two blocks of eight bytes for the base level, one for the next.
+  DeviceBufferDescriptor src_format;
+  src_format.size = 32;
+  src_format.storage_mode = StorageMode::kHostVisible;
+  auto src = context->GetResourceAllocator()->CreateBuffer(src_format);
+
+  ASSERT_TRUE(dst);
+  ASSERT_TRUE(src);
+
+  EXPECT_TRUE(blit_pass->AddCopy(BufferView(src, Range(0, 32)), dst,
+                                 IRect::MakeLTRB(0, 0, 8, 6), "",
+                                 /*mip_level=*/0, /*slice=*/0));
+  EXPECT_TRUE(blit_pass->AddCopy(BufferView(src, Range(0, 8)), dst,
+                                 IRect::MakeLTRB(0, 0, 4, 3), "",
+                                 /*mip_level=*/1, /*slice=*/0));
+  EXPECT_TRUE(blit_pass->EncodeCommands(GetContext()->GetResourceAllocator()));
+  EXPECT_TRUE(context->GetCommandQueue()->Submit({std::move(cmd_buffer)}).ok());
+}
+
+TEST_P(BlitPassTest, ChecksCompressedTextureBlockAlignment) {
+  ScopedValidationDisable scope;
+  auto context = GetContext();
+  if (!context->GetCapabilities()->SupportsCompressedPixelFormat(
+          PixelFormat::kBC1RGBAUNorm)) {
+    GTEST_SKIP() << "BC1 textures are not supported on this device.";
+  }
+  auto cmd_buffer = context->CreateCommandBuffer();
+  auto blit_pass = cmd_buffer->CreateBlitPass();
+
+  TextureDescriptor dst_format;
+  dst_format.storage_mode = StorageMode::kDevicePrivate;
+  dst_format.format = PixelFormat::kBC1RGBAUNorm;
+  dst_format.size = {16, 16};
+  auto dst = context->GetResourceAllocator()->CreateTexture(dst_format);
+
+  DeviceBufferDescriptor src_format;
+  src_format.size = 8;
+  src_format.storage_mode = StorageMode::kHostVisible;
+  auto src = context->GetResourceAllocator()->CreateBuffer(src_format);
+
+  ASSERT_TRUE(dst);
+  ASSERT_TRUE(src);
+
+  // Regions must start on a block boundary.
+  EXPECT_FALSE(blit_pass->AddCopy(DeviceBuffer::AsBufferView(src), dst,
+                                  IRect::MakeXYWH(2, 0, 4, 4), "",
+                                  /*mip_level=*/0, /*slice=*/0));
+  // Partial blocks are only allowed at the edges of the texture.
+  EXPECT_FALSE(blit_pass->AddCopy(DeviceBuffer::AsBufferView(src), dst,
+                                  IRect::MakeXYWH(0, 0, 2, 2), "",
+                                  /*mip_level=*/0, /*slice=*/0));
+  EXPECT_TRUE(blit_pass->AddCopy(DeviceBuffer::AsBufferView(src), dst,
+                                 IRect::MakeXYWH(4, 4, 4, 4), "",
+                                 /*mip_level=*/0, /*slice=*/0));
+
+  // Mipmaps cannot be generated for compressed textures.
+  EXPECT_FALSE(blit_pass->GenerateMipmap(dst));
+}
+
 TEST_P(BlitPassTest, CanResizeTextures) {
   auto context = GetContext();
   auto cmd_buffer = context->CreateCommandBuffer();
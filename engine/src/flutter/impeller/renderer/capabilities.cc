@@ -3,6 +3,9 @@
 // found in the LICENSE file.
 
 #include "impeller/renderer/capabilities.h"
+
+#include <utility>
+
 #include "impeller/core/formats.h"
 
 namespace impeller {
@@ -91,6 +94,11 @@ class StandardCapabilities final : public Capabilities {
   // |Capabilities|
   bool SupportsPrimitiveRestart() const override { return true; }
 
+  // |Capabilities|
+  bool SupportsCompressedPixelFormat(PixelFormat format) const override {
+    return supported_compressed_pixel_formats_.count(format) > 0;
+  }
+
  private:
   StandardCapabilities(bool supports_offscreen_msaa,
                        bool supports_ssbo,
@@ -106,7 +114,8 @@ class StandardCapabilities final : public Capabilities {
                        PixelFormat default_stencil_format,
                        PixelFormat default_depth_stencil_format,
                        PixelFormat default_glyph_atlas_format,
-                       ISize default_maximum_render_pass_attachment_size)
+                       ISize default_maximum_render_pass_attachment_size,
+                       std::set<PixelFormat> supported_compressed_pixel_formats)
       : supports_offscreen_msaa_(supports_offscreen_msaa),
         supports_ssbo_(supports_ssbo),
         supports_texture_to_texture_blits_(supports_texture_to_texture_blits),
@@ -123,7 +132,9 @@ class StandardCapabilities final : public Capabilities {
         default_depth_stencil_format_(default_depth_stencil_format),
         default_glyph_atlas_format_(default_glyph_atlas_format),
         default_maximum_render_pass_attachment_size_(
-            default_maximum_render_pass_attachment_size) {}
+            default_maximum_render_pass_attachment_size),
+        supported_compressed_pixel_formats_(
+            std::move(supported_compressed_pixel_formats)) {}
 
   friend class CapabilitiesBuilder;
 
@@ -142,6 +153,7 @@ class StandardCapabilities final : public Capabilities {
   PixelFormat default_depth_stencil_format_ = PixelFormat::kUnknown;
   PixelFormat default_glyph_atlas_format_ = PixelFormat::kUnknown;
   ISize default_maximum_render_pass_attachment_size_ = ISize(1, 1);
+  std::set<PixelFormat> supported_compressed_pixel_formats_;
 
   StandardCapabilities(const StandardCapabilities&) = delete;
 
@@ -238,6 +250,20 @@ CapabilitiesBuilder& CapabilitiesBuilder::SetMaximumRenderPassAttachmentSize(
   return *this;
 }
 
+CapabilitiesBuilder& CapabilitiesBuilder::SetSupportsCompressedPixelFormat(
+    PixelFormat format,
+    bool value) {
+  if (!IsBlockCompressed(format)) {
+    return *this;
+  }
+  if (value) {
+    supported_compressed_pixel_formats_.insert(format);
+  } else {
+    supported_compressed_pixel_formats_.erase(format);
+  }
+  return *this;
+}
+
 std::unique_ptr<Capabilities> CapabilitiesBuilder::Build() {
   return std::unique_ptr<StandardCapabilities>(new StandardCapabilities(  //
       supports_offscreen_msaa_,                                           //
@@ -254,7 +280,8 @@ std::unique_ptr<Capabilities> CapabilitiesBuilder::Build() {
       default_stencil_format_.value_or(PixelFormat::kUnknown),            //
       default_depth_stencil_format_.value_or(PixelFormat::kUnknown),      //
       default_glyph_atlas_format_.value_or(PixelFormat::kUnknown),        //
-      default_maximum_render_pass_attachment_size_.value_or(ISize{1, 1})  //
+      default_maximum_render_pass_attachment_size_.value_or(ISize{1, 1}), //
+      supported_compressed_pixel_formats_                                 //
       ));
 }
 
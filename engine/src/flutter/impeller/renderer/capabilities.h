@@ -6,6 +6,7 @@
 #define FLUTTER_IMPELLER_RENDERER_CAPABILITIES_H_
 
 #include <memory>
+#include <set>
 
 #include "impeller/core/formats.h"
 
@@ -89,6 +90,12 @@ class Capabilities {
   /// @brief Whether primitive restart is supported.
   virtual bool SupportsPrimitiveRestart() const = 0;
 
+  /// @brief  Whether textures of the given block compressed `PixelFormat` may
+  ///         be created, uploaded to, and sampled from.
+  ///
+  ///         Always returns false for formats that aren't block compressed.
+  virtual bool SupportsCompressedPixelFormat(PixelFormat format) const = 0;
+
   /// @brief  Returns a supported `PixelFormat` for textures that store
   ///         4-channel colors (red/green/blue/alpha).
   virtual PixelFormat GetDefaultColorFormat() const = 0;
@@ -160,6 +167,9 @@ class CapabilitiesBuilder {
 
   CapabilitiesBuilder& SetMaximumRenderPassAttachmentSize(ISize size);
 
+  CapabilitiesBuilder& SetSupportsCompressedPixelFormat(PixelFormat format,
+                                                        bool value);
+
   std::unique_ptr<Capabilities> Build();
 
  private:
@@ -179,6 +189,7 @@ class CapabilitiesBuilder {
   std::optional<PixelFormat> default_glyph_atlas_format_ = std::nullopt;
   std::optional<ISize> default_maximum_render_pass_attachment_size_ =
       std::nullopt;
+  std::set<PixelFormat> supported_compressed_pixel_formats_;
 
   CapabilitiesBuilder(const CapabilitiesBuilder&) = delete;
 
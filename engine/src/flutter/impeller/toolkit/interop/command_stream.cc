@@ -0,0 +1,412 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/toolkit/interop/command_stream.h"
+
+#include <cstring>
+
+#include "impeller/base/validation.h"
+#include "impeller/toolkit/interop/formats.h"
+
+namespace impeller::interop {
+
+namespace {
+
+class CommandStreamReader {
+ public:
+  explicit CommandStreamReader(const ImpellerCommandStream& stream)
+      : stream_(stream) {}
+
+  bool IsAtEnd() const { return offset_ >= stream_.word_count; }
+
+  uint64_t GetOffset() const { return offset_; }
+
+  bool Read(uint32_t& value) {
+    if (IsAtEnd()) {
+      return false;
+    }
+    value = stream_.words[offset_++];
+    return true;
+  }
+
+  bool Read(Scalar& value) {
+    uint32_t word = 0u;
+    if (!Read(word)) {
+      return false;
+    }
+    static_assert(sizeof(word) == sizeof(value));
+    std::memcpy(&value, &word, sizeof(value));
+    return true;
+  }
+
+  bool Read(Point& point) { return Read(point.x) && Read(point.y); }
+
+  bool Read(Rect& rect) {
+    ImpellerRect c_rect = {};
+    if (!Read(c_rect.x) || !Read(c_rect.y) || !Read(c_rect.width) ||
+        !Read(c_rect.height)) {
+      return false;
+    }
+    rect = ToImpellerType(c_rect);
+    return true;
+  }
+
+  bool Read(RoundingRadii& radii) {
+    ImpellerRoundingRadii c_radii = {};
+    if (!Read(c_radii.top_left.x) || !Read(c_radii.top_left.y) ||
+        !Read(c_radii.bottom_left.x) || !Read(c_radii.bottom_left.y) ||
+        !Read(c_radii.top_right.x) || !Read(c_radii.top_right.y) ||
+        !Read(c_radii.bottom_right.x) || !Read(c_radii.bottom_right.y)) {
+      return false;
+    }
+    radii = ToImpellerType(c_radii);
+    return true;
+  }
+
+  bool Read(Matrix& matrix) {
+    ImpellerMatrix c_matrix = {};
+    for (auto& element : c_matrix.m) {
+      if (!Read(element)) {
+        return false;
+      }
+    }
+    matrix = ToImpellerType(c_matrix);
+    return true;
+  }
+
+  bool Read(flutter::DlCanvas::ClipOp& op) {
+    uint32_t value = 0u;
+    if (!Read(value) || value > kImpellerClipOperationIntersect) {
+      return false;
+    }
+    op = ToImpellerType(static_cast<ImpellerClipOperation>(value));
+    return true;
+  }
+
+  bool Read(flutter::DlImageSampling& sampling) {
+    uint32_t value = 0u;
+    if (!Read(value) || value > kImpellerTextureSamplingLinear) {
+      return false;
+    }
+    sampling = ToDisplayListType(static_cast<ImpellerTextureSampling>(value));
+    return true;
+  }
+
+  template <class InteropClass, class CHandle>
+  bool ReadHandle(const CHandle* table,
+                  uint32_t table_count,
+                  bool optional,
+                  const InteropClass*& object) {
+    uint32_t index = 0u;
+    if (!Read(index)) {
+      return false;
+    }
+    if (index == IMPELLER_COMMAND_STREAM_NULL_INDEX) {
+      object = nullptr;
+      return optional;
+    }
+    if (table == nullptr || index >= table_count || table[index] == nullptr) {
+      return false;
+    }
+    object = reinterpret_cast<const InteropClass*>(table[index]);
+    return true;
+  }
+
+  bool Read(const Paint*& paint, bool optional = false) {
+    return ReadHandle(stream_.paints, stream_.paint_count, optional, paint);
+  }
+
+  bool Read(const Path*& path) {
+    return ReadHandle(stream_.paths, stream_.path_count, false, path);
+  }
+
+  bool Read(const Texture*& texture) {
+    return ReadHandle(stream_.textures, stream_.texture_count, false, texture);
+  }
+
+  bool Read(const ImageFilter*& filter) {
+    return ReadHandle(stream_.image_filters, stream_.image_filter_count, true,
+                      filter);
+  }
+
+  bool Read(const DisplayList*& dl) {
+    return ReadHandle(stream_.display_lists, stream_.display_list_count, false,
+                      dl);
+  }
+
+  bool Read(const Paragraph*& paragraph) {
+    return ReadHandle(stream_.paragraphs, stream_.paragraph_count, false,
+                      paragraph);
+  }
+
+ private:
+  const ImpellerCommandStream& stream_;
+  uint64_t offset_ = 0u;
+};
+
+// Decodes each command in the stream and, if a builder is supplied, records
+// it. When the builder is null, the stream is only validated.
+bool DispatchCommands(const ImpellerCommandStream& stream,
+                      DisplayListBuilder* builder) {
+  CommandStreamReader reader(stream);
+  while (!reader.IsAtEnd()) {
+    const auto command_offset = reader.GetOffset();
+    uint32_t command = 0u;
+    reader.Read(command);
+    bool valid = false;
+    switch (static_cast<ImpellerCommand>(command)) {
+      case kImpellerCommandSave:
+        valid = true;
+        if (builder) {
+          builder->Save();
+        }
+        break;
+      case kImpellerCommandSaveLayer: {
+        Rect bounds;
+        const Paint* paint = nullptr;
+        const ImageFilter* backdrop = nullptr;
+        valid = reader.Read(bounds) && reader.Read(paint, true) &&
+                reader.Read(backdrop);
+        if (valid && builder) {
+          builder->SaveLayer(bounds, paint, backdrop);
+        }
+      } break;
+      case kImpellerCommandRestore:
+        valid = true;
+        if (builder) {
+          builder->Restore();
+        }
+        break;
+      case kImpellerCommandScale: {
+        Size scale;
+        valid = reader.Read(scale.width) && reader.Read(scale.height);
+        if (valid && builder) {
+          builder->Scale(scale);
+        }
+      } break;
+      case kImpellerCommandRotate: {
+        Scalar degrees = 0.0f;
+        valid = reader.Read(degrees);
+        if (valid && builder) {
+          builder->Rotate(Degrees{degrees});
+        }
+      } break;
+      case kImpellerCommandTranslate: {
+        Point translation;
+        valid = reader.Read(translation);
+        if (valid && builder) {
+          builder->Translate(translation);
+        }
+      } break;
+      case kImpellerCommandTransform: {
+        Matrix matrix;
+        valid = reader.Read(matrix);
+        if (valid && builder) {
+          builder->Transform(matrix);
+        }
+      } break;
+      case kImpellerCommandSetTransform: {
+        Matrix matrix;
+        valid = reader.Read(matrix);
+        if (valid && builder) {
+          builder->SetTransform(matrix);
+        }
+      } break;
+      case kImpellerCommandResetTransform:
+        valid = true;
+        if (builder) {
+          builder->ResetTransform();
+        }
+        break;
+      case kImpellerCommandRestoreToCount: {
+        uint32_t count = 0u;
+        valid = reader.Read(count);
+        if (valid && builder) {
+          builder->RestoreToCount(count);
+        }
+      } break;
+      case kImpellerCommandClipRect: {
+        Rect rect;
+        auto op = flutter::DlCanvas::ClipOp::kIntersect;
+        valid = reader.Read(rect) && reader.Read(op);
+        if (valid && builder) {
+          builder->ClipRect(rect, op);
+        }
+      } break;
+      case kImpellerCommandClipOval: {
+        Rect rect;
+        auto op = flutter::DlCanvas::ClipOp::kIntersect;
+        valid = reader.Read(rect) && reader.Read(op);
+        if (valid && builder) {
+          builder->ClipOval(rect, op);
+        }
+      } break;
+      case kImpellerCommandClipRoundedRect: {
+        Rect rect;
+        RoundingRadii radii;
+        auto op = flutter::DlCanvas::ClipOp::kIntersect;
+        valid = reader.Read(rect) && reader.Read(radii) && reader.Read(op);
+        if (valid && builder) {
+          builder->ClipRoundedRect(rect, radii, op);
+        }
+      } break;
+      case kImpellerCommandClipPath: {
+        const Path* path = nullptr;
+        auto op = flutter::DlCanvas::ClipOp::kIntersect;
+        valid = reader.Read(path) && reader.Read(op);
+        if (valid && builder) {
+          builder->ClipPath(*path, op);
+        }
+      } break;
+      case kImpellerCommandDrawPaint: {
+        const Paint* paint = nullptr;
+        valid = reader.Read(paint);
+        if (valid && builder) {
+          builder->DrawPaint(*paint);
+        }
+      } break;
+      case kImpellerCommandDrawLine: {
+        Point from;
+        Point to;
+        const Paint* paint = nullptr;
+        valid = reader.Read(from) && reader.Read(to) && reader.Read(paint);
+        if (valid && builder) {
+          builder->DrawLine(from, to, *paint);
+        }
+      } break;
+      case kImpellerCommandDrawDashedLine: {
+        Point from;
+        Point to;
+        Scalar on_length = 0.0f;
+        Scalar off_length = 0.0f;
+        const Paint* paint = nullptr;
+        valid = reader.Read(from) && reader.Read(to) &&
+                reader.Read(on_length) && reader.Read(off_length) &&
+                reader.Read(paint);
+        if (valid && builder) {
+          builder->DrawDashedLine(from, to, on_length, off_length, *paint);
+        }
+      } break;
+      case kImpellerCommandDrawRect: {
+        Rect rect;
+        const Paint* paint = nullptr;
+        valid = reader.Read(rect) && reader.Read(paint);
+        if (valid && builder) {
+          builder->DrawRect(rect, *paint);
+        }
+      } break;
+      case kImpellerCommandDrawOval: {
+        Rect rect;
+        const Paint* paint = nullptr;
+        valid = reader.Read(rect) && reader.Read(paint);
+        if (valid && builder) {
+          builder->DrawOval(rect, *paint);
+        }
+      } break;
+      case kImpellerCommandDrawRoundedRect: {
+        Rect rect;
+        RoundingRadii radii;
+        const Paint* paint = nullptr;
+        valid = reader.Read(rect) && reader.Read(radii) && reader.Read(paint);
+        if (valid && builder) {
+          builder->DrawRoundedRect(rect, radii, *paint);
+        }
+      } break;
+      case kImpellerCommandDrawRoundedRectDifference: {
+        Rect outer_rect;
+        RoundingRadii outer_radii;
+        Rect inner_rect;
+        RoundingRadii inner_radii;
+        const Paint* paint = nullptr;
+        valid = reader.Read(outer_rect) && reader.Read(outer_radii) &&
+                reader.Read(inner_rect) && reader.Read(inner_radii) &&
+                reader.Read(paint);
+        if (valid && builder) {
+          builder->DrawRoundedRectDifference(outer_rect, outer_radii,
+                                             inner_rect, inner_radii, *paint);
+        }
+      } break;
+      case kImpellerCommandDrawPath: {
+        const Path* path = nullptr;
+        const Paint* paint = nullptr;
+        valid = reader.Read(path) && reader.Read(paint);
+        if (valid && builder) {
+          builder->DrawPath(*path, *paint);
+        }
+      } break;
+      case kImpellerCommandDrawTexture: {
+        const Texture* texture = nullptr;
+        Point point;
+        auto sampling = flutter::DlImageSampling::kLinear;
+        const Paint* paint = nullptr;
+        valid = reader.Read(texture) && reader.Read(point) &&
+                reader.Read(sampling) && reader.Read(paint, true);
+        if (valid && builder) {
+          builder->DrawTexture(*texture, point, sampling, paint);
+        }
+      } break;
+      case kImpellerCommandDrawTextureRect: {
+        const Texture* texture = nullptr;
+        Rect src_rect;
+        Rect dst_rect;
+        auto sampling = flutter::DlImageSampling::kLinear;
+        const Paint* paint = nullptr;
+        valid = reader.Read(texture) && reader.Read(src_rect) &&
+                reader.Read(dst_rect) && reader.Read(sampling) &&
+                reader.Read(paint, true);
+        if (valid && builder) {
+          builder->DrawTextureRect(*texture, src_rect, dst_rect, sampling,
+                                   paint);
+        }
+      } break;
+      case kImpellerCommandDrawDisplayList: {
+        const DisplayList* dl = nullptr;
+        Scalar opacity = 1.0f;
+        valid = reader.Read(dl) && reader.Read(opacity);
+        if (valid && builder) {
+          builder->DrawDisplayList(*dl, opacity);
+        }
+      } break;
+      case kImpellerCommandDrawParagraph: {
+        const Paragraph* paragraph = nullptr;
+        Point point;
+        valid = reader.Read(paragraph) && reader.Read(point);
+        if (valid && builder) {
+          builder->DrawParagraph(*paragraph, point);
+        }
+      } break;
+    }
+    if (!valid) {
+      VALIDATION_LOG << "Malformed command (" << command
+                     << ") in command stream at word offset " << command_offset
+                     << ".";
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool ExecuteCommandStream(DisplayListBuilder& builder,
+                          const ImpellerCommandStream& stream) {
+  if (stream.version != IMPELLER_COMMAND_STREAM_VERSION) {
+    VALIDATION_LOG << "Unsupported command stream version (" << stream.version
+                   << "). Expected version "
+                   << IMPELLER_COMMAND_STREAM_VERSION << ".";
+    return false;
+  }
+  if (stream.word_count > 0u && stream.words == nullptr) {
+    VALIDATION_LOG << "Command stream has no words.";
+    return false;
+  }
+  // Validate the entire stream up front so that malformed streams don't leave
+  // the builder with a partially recorded set of commands.
+  if (!DispatchCommands(stream, nullptr)) {
+    return false;
+  }
+  return DispatchCommands(stream, &builder);
+}
+
+}  // namespace impeller::interop
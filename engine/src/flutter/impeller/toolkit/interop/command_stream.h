@@ -0,0 +1,27 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_TOOLKIT_INTEROP_COMMAND_STREAM_H_
+#define FLUTTER_IMPELLER_TOOLKIT_INTEROP_COMMAND_STREAM_H_
+
+#include "impeller/toolkit/interop/dl_builder.h"
+#include "impeller/toolkit/interop/impeller.h"
+
+namespace impeller::interop {
+
+//------------------------------------------------------------------------------
+/// @brief      Validates and then records all commands in the stream into the
+///             builder. Nothing is recorded if the stream is malformed.
+///
+/// @param      builder  The builder to record commands into.
+/// @param[in]  stream   The command stream.
+///
+/// @return     If the commands were recorded into the builder.
+///
+bool ExecuteCommandStream(DisplayListBuilder& builder,
+                          const ImpellerCommandStream& stream);
+
+}  // namespace impeller::interop
+
+#endif  // FLUTTER_IMPELLER_TOOLKIT_INTEROP_COMMAND_STREAM_H_
@@ -15,6 +15,7 @@
 #include "impeller/renderer/context.h"
 #include "impeller/toolkit/interop/color_filter.h"
 #include "impeller/toolkit/interop/color_source.h"
+#include "impeller/toolkit/interop/command_stream.h"
 #include "impeller/toolkit/interop/context.h"
 #include "impeller/toolkit/interop/dl_builder.h"
 #include "impeller/toolkit/interop/formats.h"
@@ -660,6 +661,13 @@ void ImpellerDisplayListBuilderDrawTextureRect(
   );
 }
 
+IMPELLER_EXTERN_C
+bool ImpellerDisplayListBuilderExecuteCommandStream(
+    ImpellerDisplayListBuilder builder,
+    const ImpellerCommandStream* stream) {
+  return ExecuteCommandStream(*GetPeer(builder), *stream);
+}
+
 IMPELLER_EXTERN_C
 void ImpellerColorSourceRetain(ImpellerColorSource color_source) {
   ObjectBase::SafeRetain(color_source);
@@ -171,6 +171,11 @@ IMPELLER_DEFINE_HANDLE(ImpellerDisplayList);
 ///
 /// Display list builders are context-agnostic.
 ///
+/// Display list builders are not thread-safe. However, multiple builders may
+/// be used to record display lists concurrently on different threads. The
+/// resulting display lists may then be drawn to a surface on the thread that
+/// owns the surface.
+///
 IMPELLER_DEFINE_HANDLE(ImpellerDisplayListBuilder);
 
 //------------------------------------------------------------------------------
@@ -178,6 +183,9 @@ IMPELLER_DEFINE_HANDLE(ImpellerDisplayListBuilder);
 ///
 /// Like display lists, paints are context-agnostic.
 ///
+/// Paints may be referenced by builders on multiple threads concurrently as
+/// long as they are not being mutated at the same time.
+///
 IMPELLER_DEFINE_HANDLE(ImpellerPaint);
 
 //------------------------------------------------------------------------------
@@ -215,20 +223,28 @@ IMPELLER_DEFINE_HANDLE(ImpellerMaskFilter);
 /// These are typically expensive to create and applications will only ever need
 /// to create a single one of these during their lifetimes.
 ///
-/// Unlike graphics context, typograhy contexts are not thread-safe. These must
-/// be created, used, and collected on a single thread.
+/// Typography contexts are thread-safe. Paragraph builders created using the
+/// same typography context may be used concurrently on different threads. Font
+/// registration and paragraph layout are serialized on the font collection
+/// owned by the context.
 ///
 IMPELLER_DEFINE_HANDLE(ImpellerTypographyContext);
 
 //------------------------------------------------------------------------------
 /// An immutable, fully laid out paragraph.
 ///
+/// Paragraphs are thread-safe and may be drawn into display list builders on
+/// multiple threads.
+///
 IMPELLER_DEFINE_HANDLE(ImpellerParagraph);
 
 //------------------------------------------------------------------------------
 /// Paragraph builders allow for the creation of fully laid out paragraphs
 /// (which themselves are immutable).
 ///
+/// Paragraph builders are not thread-safe but multiple builders may be used
+/// concurrently on different threads.
+///
 /// To build a paragraph, users push/pop paragraph styles onto a stack then add
 /// UTF-8 encoded text. The properties on the top of paragraph style stack when
 /// the text is added are used to layout and shape that subset of the paragraph.
@@ -562,6 +578,119 @@ typedef struct ImpellerMapping {
   ImpellerCallback IMPELLER_NULLABLE on_release;
 } ImpellerMapping;
 
+//------------------------------------------------------------------------------
+/// The version of the command stream encoding. This version must be specified
+/// in the `ImpellerCommandStream` supplied to
+/// `ImpellerDisplayListBuilderExecuteCommandStream`.
+///
+#define IMPELLER_COMMAND_STREAM_VERSION 1
+
+//------------------------------------------------------------------------------
+/// The handle index used in a command stream to specify that an optional
+/// handle (like the paint in `kImpellerCommandDrawTexture`) is absent.
+///
+#define IMPELLER_COMMAND_STREAM_NULL_INDEX 0xFFFFFFFFU
+
+//------------------------------------------------------------------------------
+/// A command stream is a tightly packed sequence of 32-bit words. Each command
+/// starts with a word containing a `ImpellerCommand` followed by the arguments
+/// of that command inline. The arguments are encoded as follows:
+///
+/// * `f`: A 32-bit IEEE 754 float.
+/// * `u`: A 32-bit unsigned integer.
+/// * `rect`: 4 floats in the order of `ImpellerRect` fields.
+/// * `radii`: 8 floats in the order of `ImpellerRoundingRadii` fields.
+/// * `matrix`: 16 floats in the order of `ImpellerMatrix` fields.
+/// * `<table>`: A 32-bit index into the named handle table of the
+///   `ImpellerCommandStream`. Optional handles may be specified as
+///   `IMPELLER_COMMAND_STREAM_NULL_INDEX`.
+///
+/// Enumerations (clip operations and texture sampling) are encoded as `u`.
+///
+typedef enum ImpellerCommand {
+  /// No arguments.
+  kImpellerCommandSave,
+  /// Arguments: bounds `rect`, optional `paints`, optional `image_filters`.
+  kImpellerCommandSaveLayer,
+  /// No arguments.
+  kImpellerCommandRestore,
+  /// Arguments: x-scale `f`, y-scale `f`.
+  kImpellerCommandScale,
+  /// Arguments: angle in degrees `f`.
+  kImpellerCommandRotate,
+  /// Arguments: x-translation `f`, y-translation `f`.
+  kImpellerCommandTranslate,
+  /// Arguments: `matrix`.
+  kImpellerCommandTransform,
+  /// Arguments: `matrix`.
+  kImpellerCommandSetTransform,
+  /// No arguments.
+  kImpellerCommandResetTransform,
+  /// Arguments: count `u`.
+  kImpellerCommandRestoreToCount,
+  /// Arguments: `rect`, `ImpellerClipOperation` `u`.
+  kImpellerCommandClipRect,
+  /// Arguments: oval bounds `rect`, `ImpellerClipOperation` `u`.
+  kImpellerCommandClipOval,
+  /// Arguments: `rect`, `radii`, `ImpellerClipOperation` `u`.
+  kImpellerCommandClipRoundedRect,
+  /// Arguments: `paths`, `ImpellerClipOperation` `u`.
+  kImpellerCommandClipPath,
+  /// Arguments: `paints`.
+  kImpellerCommandDrawPaint,
+  /// Arguments: from x `f`, from y `f`, to x `f`, to y `f`, `paints`.
+  kImpellerCommandDrawLine,
+  /// Arguments: from x `f`, from y `f`, to x `f`, to y `f`, on length `f`, off
+  /// length `f`, `paints`.
+  kImpellerCommandDrawDashedLine,
+  /// Arguments: `rect`, `paints`.
+  kImpellerCommandDrawRect,
+  /// Arguments: oval bounds `rect`, `paints`.
+  kImpellerCommandDrawOval,
+  /// Arguments: `rect`, `radii`, `paints`.
+  kImpellerCommandDrawRoundedRect,
+  /// Arguments: outer `rect`, outer `radii`, inner `rect`, inner `radii`,
+  /// `paints`.
+  kImpellerCommandDrawRoundedRectDifference,
+  /// Arguments: `paths`, `paints`.
+  kImpellerCommandDrawPath,
+  /// Arguments: `textures`, x `f`, y `f`, `ImpellerTextureSampling` `u`,
+  /// optional `paints`.
+  kImpellerCommandDrawTexture,
+  /// Arguments: `textures`, source `rect`, destination `rect`,
+  /// `ImpellerTextureSampling` `u`, optional `paints`.
+  kImpellerCommandDrawTextureRect,
+  /// Arguments: `display_lists`, opacity `f`.
+  kImpellerCommandDrawDisplayList,
+  /// Arguments: `paragraphs`, x `f`, y `f`.
+  kImpellerCommandDrawParagraph,
+} ImpellerCommand;
+
+//------------------------------------------------------------------------------
+/// A batch of display list builder commands along with the tables of handles
+/// referenced by those commands.
+///
+/// @see        `ImpellerCommand` for the encoding of the commands.
+///
+typedef struct ImpellerCommandStream {
+  /// Must be `IMPELLER_COMMAND_STREAM_VERSION`.
+  uint32_t version;
+  const uint32_t* IMPELLER_NULLABLE words;
+  uint64_t word_count;
+  const ImpellerPaint IMPELLER_NONNULL* IMPELLER_NULLABLE paints;
+  uint32_t paint_count;
+  const ImpellerPath IMPELLER_NONNULL* IMPELLER_NULLABLE paths;
+  uint32_t path_count;
+  const ImpellerTexture IMPELLER_NONNULL* IMPELLER_NULLABLE textures;
+  uint32_t texture_count;
+  const ImpellerImageFilter IMPELLER_NONNULL* IMPELLER_NULLABLE image_filters;
+  uint32_t image_filter_count;
+  const ImpellerDisplayList IMPELLER_NONNULL* IMPELLER_NULLABLE display_lists;
+  uint32_t display_list_count;
+  const ImpellerParagraph IMPELLER_NONNULL* IMPELLER_NULLABLE paragraphs;
+  uint32_t paragraph_count;
+} ImpellerCommandStream;
+
 //------------------------------------------------------------------------------
 // Version
 //------------------------------------------------------------------------------
@@ -1973,6 +2102,38 @@ void ImpellerDisplayListBuilderDrawTextureRect(
     ImpellerTextureSampling sampling,
     ImpellerPaint IMPELLER_NULLABLE paint);
 
+//------------------------------------------------------------------------------
+// Display List Builder: Command Streams
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+/// @brief      Record all the commands in the command stream into the display
+///             list builder in a single call.
+///
+///             Each command in the stream is equivalent to a call to the
+///             corresponding `ImpellerDisplayListBuilder` method. The objects
+///             referenced by the stream are specified in the handle tables of
+///             the stream and are only referenced by index in the commands
+///             themselves. The handles are borrowed for the duration of this
+///             call and are not retained or released on a per-command basis.
+///
+///             The entire stream is validated before any command is recorded.
+///             If the stream is malformed (unknown command, truncated
+///             arguments, out-of-bounds handle indices, or a version mismatch),
+///             nothing is recorded into the builder and false is returned.
+///
+/// @see        `ImpellerCommandStream`
+///
+/// @param[in]  builder  The builder.
+/// @param[in]  stream   The command stream.
+///
+/// @return     If the commands in the stream were recorded into the builder.
+///
+IMPELLER_EXPORT
+bool ImpellerDisplayListBuilderExecuteCommandStream(
+    ImpellerDisplayListBuilder IMPELLER_NONNULL builder,
+    const ImpellerCommandStream* IMPELLER_NONNULL stream);
+
 //------------------------------------------------------------------------------
 // Typography Context
 //------------------------------------------------------------------------------
@@ -76,6 +76,7 @@ struct Proc {
   PROC(ImpellerDisplayListBuilderDrawRoundedRectDifference) \
   PROC(ImpellerDisplayListBuilderDrawTexture)               \
   PROC(ImpellerDisplayListBuilderDrawTextureRect)           \
+  PROC(ImpellerDisplayListBuilderExecuteCommandStream)      \
   PROC(ImpellerDisplayListBuilderGetSaveCount)              \
   PROC(ImpellerDisplayListBuilderGetTransform)              \
   PROC(ImpellerDisplayListBuilderNew)                       \
@@ -1360,6 +1361,14 @@ class DisplayListBuilder final
     return *this;
   }
 
+  //----------------------------------------------------------------------------
+  /// @see      ImpellerDisplayListBuilderExecuteCommandStream
+  ///
+  bool ExecuteCommandStream(const ImpellerCommandStream& stream) {
+    return gGlobalProcTable.ImpellerDisplayListBuilderExecuteCommandStream(
+        Get(), &stream);
+  }
+
   //----------------------------------------------------------------------------
   /// @see      ImpellerDisplayListBuilderGetSaveCount
   ///
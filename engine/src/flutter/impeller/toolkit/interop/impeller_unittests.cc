@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+#include <thread>
+#include <vector>
+
 #include "flutter/fml/native_library.h"
 #include "flutter/testing/testing.h"
 #include "impeller/base/allocation.h"
@@ -23,6 +27,35 @@
 
 namespace impeller::interop::testing {
 
+namespace {
+
+struct CommandStreamWriter {
+  std::vector<uint32_t> words;
+
+  CommandStreamWriter& Command(ImpellerCommand command) {
+    words.push_back(command);
+    return *this;
+  }
+
+  CommandStreamWriter& U(uint32_t value) {
+    words.push_back(value);
+    return *this;
+  }
+
+  CommandStreamWriter& F(float value) {
+    uint32_t word = 0u;
+    std::memcpy(&word, &value, sizeof(word));
+    words.push_back(word);
+    return *this;
+  }
+
+  CommandStreamWriter& R(const ImpellerRect& rect) {
+    return F(rect.x).F(rect.y).F(rect.width).F(rect.height);
+  }
+};
+
+}  // namespace
+
 using InteropPlaygroundTest = PlaygroundTest;
 INSTANTIATE_OPENGLES_PLAYGROUND_SUITE(InteropPlaygroundTest);
 
@@ -469,4 +502,164 @@ TEST_P(InteropPlaygroundTest, CanRenderTextAlignments) {
       }));
 }
 
+TEST_P(InteropPlaygroundTest, CommandStreamMatchesPerCallAPI) {
+  auto paint = Adopt<Paint>(ImpellerPaintNew());
+  ImpellerColor color = {0.0, 0.0, 1.0, 1.0};
+  ImpellerPaintSetColor(paint.GetC(), &color);
+  ImpellerRect rect = {10, 20, 100, 200};
+  ImpellerRect clip = {0, 0, 500, 500};
+
+  auto expected_builder =
+      Adopt<DisplayListBuilder>(ImpellerDisplayListBuilderNew(nullptr));
+  ImpellerDisplayListBuilderSave(expected_builder.GetC());
+  ImpellerDisplayListBuilderClipRect(expected_builder.GetC(), &clip,
+                                     kImpellerClipOperationIntersect);
+  ImpellerDisplayListBuilderTranslate(expected_builder.GetC(), 110, 210);
+  ImpellerDisplayListBuilderDrawRect(expected_builder.GetC(), &rect,
+                                     paint.GetC());
+  ImpellerDisplayListBuilderDrawOval(expected_builder.GetC(), &rect,
+                                     paint.GetC());
+  ImpellerDisplayListBuilderRestore(expected_builder.GetC());
+  auto expected = Adopt<DisplayList>(
+      ImpellerDisplayListBuilderCreateDisplayListNew(expected_builder.GetC()));
+  ASSERT_TRUE(expected);
+
+  CommandStreamWriter writer;
+  writer.Command(kImpellerCommandSave)
+      .Command(kImpellerCommandClipRect)
+      .R(clip)
+      .U(kImpellerClipOperationIntersect)
+      .Command(kImpellerCommandTranslate)
+      .F(110)
+      .F(210)
+      .Command(kImpellerCommandDrawRect)
+      .R(rect)
+      .U(0u)
+      .Command(kImpellerCommandDrawOval)
+      .R(rect)
+      .U(0u)
+      .Command(kImpellerCommandRestore);
+
+  ImpellerPaint paints[] = {paint.GetC()};
+  ImpellerCommandStream stream = {};
+  stream.version = IMPELLER_COMMAND_STREAM_VERSION;
+  stream.words = writer.words.data();
+  stream.word_count = writer.words.size();
+  stream.paints = paints;
+  stream.paint_count = 1u;
+
+  auto builder =
+      Adopt<DisplayListBuilder>(ImpellerDisplayListBuilderNew(nullptr));
+  ASSERT_TRUE(
+      ImpellerDisplayListBuilderExecuteCommandStream(builder.GetC(), &stream));
+  auto dl = Adopt<DisplayList>(
+      ImpellerDisplayListBuilderCreateDisplayListNew(builder.GetC()));
+  ASSERT_TRUE(dl);
+  ASSERT_TRUE(dl->GetDisplayList()->Equals(expected->GetDisplayList()));
+}
+
+TEST_P(InteropPlaygroundTest, MalformedCommandStreamRecordsNothing) {
+  auto paint = Adopt<Paint>(ImpellerPaintNew());
+  ImpellerPaint paints[] = {paint.GetC()};
+  ImpellerRect rect = {10, 20, 100, 200};
+
+  CommandStreamWriter writer;
+  writer.Command(kImpellerCommandSave)
+      .Command(kImpellerCommandDrawRect)
+      .R(rect)
+      .U(0u)
+      // Out-of-bounds paint index.
+      .Command(kImpellerCommandDrawRect)
+      .R(rect)
+      .U(1u);
+
+  ImpellerCommandStream stream = {};
+  stream.version = IMPELLER_COMMAND_STREAM_VERSION;
+  stream.words = writer.words.data();
+  stream.word_count = writer.words.size();
+  stream.paints = paints;
+  stream.paint_count = 1u;
+
+  auto builder =
+      Adopt<DisplayListBuilder>(ImpellerDisplayListBuilderNew(nullptr));
+  ASSERT_FALSE(
+      ImpellerDisplayListBuilderExecuteCommandStream(builder.GetC(), &stream));
+  ASSERT_EQ(ImpellerDisplayListBuilderGetSaveCount(builder.GetC()), 1u);
+
+  // Truncated arguments.
+  stream.word_count = 3u;
+  ASSERT_FALSE(
+      ImpellerDisplayListBuilderExecuteCommandStream(builder.GetC(), &stream));
+
+  // Version mismatch.
+  stream.word_count = writer.words.size() - 6u;
+  stream.version = IMPELLER_COMMAND_STREAM_VERSION + 1u;
+  ASSERT_FALSE(
+      ImpellerDisplayListBuilderExecuteCommandStream(builder.GetC(), &stream));
+
+  stream.version = IMPELLER_COMMAND_STREAM_VERSION;
+  ASSERT_TRUE(
+      ImpellerDisplayListBuilderExecuteCommandStream(builder.GetC(), &stream));
+  ASSERT_EQ(ImpellerDisplayListBuilderGetSaveCount(builder.GetC()), 2u);
+}
+
+TEST_P(InteropPlaygroundTest, CanRecordDisplayListsConcurrently) {
+  constexpr size_t kThreadCount = 8u;
+  constexpr size_t kDisplayListsPerThread = 16u;
+
+  // The typography context is shared by paragraph builders on all threads.
+  hpp::TypographyContext tc;
+  ASSERT_TRUE(tc);
+
+  std::vector<std::vector<hpp::DisplayList>> results(kThreadCount);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreadCount; i++) {
+    threads.emplace_back([&tc, &results, i]() {
+      hpp::Paint paint;
+      paint.SetColor({static_cast<float>(i) / kThreadCount, 0.0, 1.0, 1.0});
+      hpp::ParagraphStyle style;
+      style.SetFontFamily("Roboto");
+      style.SetFontSize(18.0);
+      style.SetForeground(paint);
+      for (size_t j = 0; j < kDisplayListsPerThread; j++) {
+        hpp::DisplayListBuilder builder;
+        builder.DrawPath(hpp::PathBuilder{}.AddOval({0, 0, 40, 40}).Build(),
+                         paint);
+        hpp::ParagraphBuilder p_builder(tc);
+        p_builder.PushStyle(style);
+        const std::string text = "Thread " + std::to_string(i);
+        p_builder.AddText(reinterpret_cast<const uint8_t*>(text.data()),
+                          text.size());
+        auto paragraph = p_builder.Build(200.0);
+        builder.DrawParagraph(paragraph, {45.0, 10.0});
+        results[i].emplace_back(builder.Build());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Compose the display lists recorded on the workers on this thread.
+  hpp::DisplayListBuilder builder;
+  for (size_t i = 0; i < kThreadCount; i++) {
+    ASSERT_EQ(results[i].size(), kDisplayListsPerThread);
+    for (size_t j = 0; j < kDisplayListsPerThread; j++) {
+      ASSERT_TRUE(results[i][j]);
+      builder.Save();
+      builder.Translate(i * 150.0f, j * 45.0f);
+      builder.DrawDisplayList(results[i][j], 1.0);
+      builder.Restore();
+    }
+  }
+  auto dl = builder.Build();
+
+  ASSERT_TRUE(
+      OpenPlaygroundHere([&](const auto& context, const auto& surface) -> bool {
+        hpp::Surface window(surface.GetC());
+        window.Draw(dl);
+        return true;
+      }));
+}
+
 }  // namespace impeller::interop::testing
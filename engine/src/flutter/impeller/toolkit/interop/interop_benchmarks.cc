@@ -0,0 +1,98 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstring>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "impeller/toolkit/interop/impeller.h"
+
+namespace impeller::interop {
+
+namespace {
+
+void PushFloat(std::vector<uint32_t>& words, float value) {
+  uint32_t word = 0u;
+  std::memcpy(&word, &value, sizeof(word));
+  words.push_back(word);
+}
+
+}  // namespace
+
+// Records `state.range(0)` translated rectangles using one C API call per
+// builder operation.
+static void BM_DrawRectsPerCall(benchmark::State& state) {
+  const auto count = state.range(0);
+  ImpellerPaint paint = ImpellerPaintNew();
+  ImpellerColor color = {1.0, 0.0, 0.0, 1.0};
+  ImpellerPaintSetColor(paint, &color);
+  const ImpellerRect rect = {0, 0, 10, 10};
+  for (auto _ : state) {
+    ImpellerDisplayListBuilder builder = ImpellerDisplayListBuilderNew(nullptr);
+    for (int64_t i = 0; i < count; i++) {
+      ImpellerDisplayListBuilderSave(builder);
+      ImpellerDisplayListBuilderTranslate(builder, i % 100, i / 100);
+      ImpellerDisplayListBuilderDrawRect(builder, &rect, paint);
+      ImpellerDisplayListBuilderRestore(builder);
+    }
+    ImpellerDisplayList dl =
+        ImpellerDisplayListBuilderCreateDisplayListNew(builder);
+    benchmark::DoNotOptimize(dl);
+    ImpellerDisplayListRelease(dl);
+    ImpellerDisplayListBuilderRelease(builder);
+  }
+  ImpellerPaintRelease(paint);
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Records the same rectangles as `BM_DrawRectsPerCall` by encoding them into a
+// command stream (which is included in the measurement) and submitting the
+// stream in a single call.
+static void BM_DrawRectsCommandStream(benchmark::State& state) {
+  const auto count = state.range(0);
+  ImpellerPaint paint = ImpellerPaintNew();
+  ImpellerColor color = {1.0, 0.0, 0.0, 1.0};
+  ImpellerPaintSetColor(paint, &color);
+  const ImpellerRect rect = {0, 0, 10, 10};
+  std::vector<uint32_t> words;
+  words.reserve(count * 11);
+  ImpellerCommandStream stream = {};
+  stream.version = IMPELLER_COMMAND_STREAM_VERSION;
+  stream.paints = &paint;
+  stream.paint_count = 1u;
+  for (auto _ : state) {
+    words.clear();
+    for (int64_t i = 0; i < count; i++) {
+      words.push_back(kImpellerCommandSave);
+      words.push_back(kImpellerCommandTranslate);
+      PushFloat(words, i % 100);
+      PushFloat(words, i / 100);
+      words.push_back(kImpellerCommandDrawRect);
+      PushFloat(words, rect.x);
+      PushFloat(words, rect.y);
+      PushFloat(words, rect.width);
+      PushFloat(words, rect.height);
+      words.push_back(0u);
+      words.push_back(kImpellerCommandRestore);
+    }
+    stream.words = words.data();
+    stream.word_count = words.size();
+    ImpellerDisplayListBuilder builder = ImpellerDisplayListBuilderNew(nullptr);
+    if (!ImpellerDisplayListBuilderExecuteCommandStream(builder, &stream)) {
+      state.SkipWithError("Could not execute command stream.");
+    }
+    ImpellerDisplayList dl =
+        ImpellerDisplayListBuilderCreateDisplayListNew(builder);
+    benchmark::DoNotOptimize(dl);
+    ImpellerDisplayListRelease(dl);
+    ImpellerDisplayListBuilderRelease(builder);
+  }
+  ImpellerPaintRelease(paint);
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(BM_DrawRectsPerCall)->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK(BM_DrawRectsCommandStream)->RangeMultiplier(10)->Range(10, 100000);
+
+}  // namespace impeller::interop
@@ -26,10 +26,12 @@ class ObjectBase {
 
   ObjectBase& operator=(ObjectBase&&) = delete;
 
-  void Retain() { ref_count_++; }
+  void Retain() { ref_count_.fetch_add(1u, std::memory_order_relaxed); }
 
   void Release() {
-    if (ref_count_-- == 1u) {
+    // The release must synchronize with all prior accesses to the object from
+    // other threads before the object is collected on this one.
+    if (ref_count_.fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
       delete this;
     }
   }
@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <thread>
+#include <vector>
+
 #include "flutter/testing/testing.h"
 #include "impeller/toolkit/interop/impeller.h"
 #include "impeller/toolkit/interop/object.h"
@@ -95,4 +98,26 @@ TEST(InteropObjectTest, CanCopyAssignMove) {
   ASSERT_EQ(move_o->GetRefCountForTests(), 1u);
 }
 
+TEST(InteropObjectTest, CanRetainAndReleaseConcurrently) {
+  bool destructed = false;
+  {
+    auto object = Adopt(new FlagObject(destructed));
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 8u; i++) {
+      threads.emplace_back([object]() {
+        for (size_t j = 0; j < 10000u; j++) {
+          auto copy = Ref(object.Get());
+          ASSERT_GE(copy->GetRefCountForTests(), 2u);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(object->GetRefCountForTests(), 1u);
+    ASSERT_FALSE(destructed);
+  }
+  ASSERT_TRUE(destructed);
+}
+
 }  // namespace impeller::interop::testing
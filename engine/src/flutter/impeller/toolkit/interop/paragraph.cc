@@ -12,34 +12,42 @@ Paragraph::Paragraph(std::unique_ptr<txt::Paragraph> paragraph)
 Paragraph::~Paragraph() = default;
 
 Scalar Paragraph::GetMaxWidth() const {
+  std::scoped_lock lock(mutex_);
   return paragraph_->GetMaxWidth();
 }
 
 Scalar Paragraph::GetHeight() const {
+  std::scoped_lock lock(mutex_);
   return paragraph_->GetHeight();
 }
 
 Scalar Paragraph::GetLongestLineWidth() const {
+  std::scoped_lock lock(mutex_);
   return paragraph_->GetLongestLine();
 }
 
 Scalar Paragraph::GetMinIntrinsicWidth() const {
+  std::scoped_lock lock(mutex_);
   return paragraph_->GetMinIntrinsicWidth();
 }
 
 Scalar Paragraph::GetMaxIntrinsicWidth() const {
+  std::scoped_lock lock(mutex_);
   return paragraph_->GetMaxIntrinsicWidth();
 }
 
 Scalar Paragraph::GetIdeographicBaseline() const {
+  std::scoped_lock lock(mutex_);
   return paragraph_->GetIdeographicBaseline();
 }
 
 Scalar Paragraph::GetAlphabeticBaseline() const {
+  std::scoped_lock lock(mutex_);
   return paragraph_->GetAlphabeticBaseline();
 }
 
 uint32_t Paragraph::GetLineCount() const {
+  std::scoped_lock lock(mutex_);
   return paragraph_->GetNumberOfLines();
 }
 
@@ -47,4 +55,12 @@ const std::unique_ptr<txt::Paragraph>& Paragraph::GetHandle() const {
   return paragraph_;
 }
 
+void Paragraph::Paint(flutter::DisplayListBuilder& builder, Point point) const {
+  if (!paragraph_) {
+    return;
+  }
+  std::scoped_lock lock(mutex_);
+  paragraph_->Paint(&builder, point.x, point.y);
+}
+
 }  // namespace impeller::interop
@@ -5,7 +5,11 @@
 #ifndef FLUTTER_IMPELLER_TOOLKIT_INTEROP_PARAGRAPH_H_
 #define FLUTTER_IMPELLER_TOOLKIT_INTEROP_PARAGRAPH_H_
 
+#include <mutex>
+
+#include "flutter/display_list/dl_builder.h"
 #include "flutter/third_party/txt/src/txt/paragraph.h"
+#include "impeller/geometry/point.h"
 #include "impeller/toolkit/interop/impeller.h"
 #include "impeller/toolkit/interop/object.h"
 
@@ -41,8 +45,23 @@ class Paragraph final
 
   const std::unique_ptr<txt::Paragraph>& GetHandle() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Paint the paragraph into the builder at the specified point.
+  ///
+  ///             Painting populates caches within the laid out paragraph. So
+  ///             concurrent paints of the same paragraph into different
+  ///             builders are serialized, along with the metric queries that
+  ///             read the same state.
+  ///
+  /// @param      builder  The builder.
+  /// @param[in]  point    The point.
+  ///
+  void Paint(flutter::DisplayListBuilder& builder, Point point) const;
+
  private:
   std::unique_ptr<txt::Paragraph> paragraph_;
+  // Guards the laid out paragraph, whose caches are populated on paint.
+  mutable std::mutex mutex_;
 };
 
 }  // namespace impeller::interop
@@ -32,7 +32,9 @@ void ParagraphBuilder::AddText(const uint8_t* data, size_t byte_length) {
 }
 
 ScopedObject<Paragraph> ParagraphBuilder::Build(Scalar width) const {
-  auto txt_paragraph = GetBuilder()->Build();
+  const auto& builder = GetBuilder();
+  auto lock = context_->LockFontCollection();
+  auto txt_paragraph = builder->Build();
   if (!txt_paragraph) {
     return nullptr;
   }
@@ -45,6 +47,7 @@ const std::unique_ptr<txt::ParagraphBuilder>& ParagraphBuilder::GetBuilder(
   if (lazy_builder_) {
     return lazy_builder_;
   }
+  auto lock = context_->LockFontCollection();
   lazy_builder_ = std::make_unique<txt::ParagraphBuilderSkia>(
       style,                          //
       context_->GetFontCollection(),  //
@@ -40,6 +40,10 @@ TypographyContext::GetFontCollection() const {
   return collection_;
 }
 
+std::unique_lock<std::mutex> TypographyContext::LockFontCollection() const {
+  return std::unique_lock<std::mutex>(collection_mutex_);
+}
+
 static sk_sp<SkTypeface> CreateTypefaceFromFontData(
     std::unique_ptr<fml::Mapping> font_data) {
   if (!font_data) {
@@ -71,6 +75,7 @@ bool TypographyContext::RegisterFont(std::unique_ptr<fml::Mapping> font_data,
   if (typeface == nullptr) {
     return false;
   }
+  auto lock = LockFontCollection();
   size_t result = 0u;
   if (family_name_alias == nullptr) {
     result = asset_font_manager_->registerTypeface(std::move(typeface));
@@ -6,6 +6,7 @@
 #define FLUTTER_IMPELLER_TOOLKIT_INTEROP_TYPOGRAPHY_CONTEXT_H_
 
 #include <memory>
+#include <mutex>
 
 #include "flutter/third_party/skia/modules/skparagraph/include/TypefaceFontProvider.h"
 #include "flutter/third_party/txt/src/txt/font_collection.h"
@@ -30,6 +31,16 @@ class TypographyContext final
 
   const std::shared_ptr<txt::FontCollection>& GetFontCollection() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Acquire exclusive access to the font collection. The font
+  ///             collection (and the caches within it) is shared by all
+  ///             paragraph builders created using this context and must only
+  ///             be accessed while this lock is held.
+  ///
+  /// @return     The lock on the font collection.
+  ///
+  [[nodiscard]] std::unique_lock<std::mutex> LockFontCollection() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Registers custom font data. If an alias for the family name is
   ///             provided, subsequent lookups will need to use that same alias.
@@ -44,6 +55,7 @@ class TypographyContext final
                     const char* family_name_alias);
 
  private:
+  mutable std::mutex collection_mutex_;
   std::shared_ptr<txt::FontCollection> collection_;
   sk_sp<skia::textlayout::TypefaceFontProvider> asset_font_manager_;
 };
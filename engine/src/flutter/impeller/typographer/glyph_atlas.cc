@@ -65,6 +65,9 @@ const std::shared_ptr<Texture>& GlyphAtlas::GetTexture() const {
 
 void GlyphAtlas::SetTexture(std::shared_ptr<Texture> texture) {
   texture_ = std::move(texture);
+  accounted_memory_.SetBytes(
+      texture_ ? texture_->GetTextureDescriptor().GetByteSizeOfAllMipLevels()
+               : 0);
 }
 
 size_t GlyphAtlas::GetAtlasGeneration() const {
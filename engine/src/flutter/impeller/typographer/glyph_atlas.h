@@ -10,6 +10,7 @@
 #include <optional>
 
 #include "flutter/fml/build_config.h"
+#include "flutter/fml/memory/memory_accounting.h"
 
 #if defined(OS_FUCHSIA)
 // TODO(gaaclarke): Migrate to use absl. I couldn't get it working since absl
@@ -191,6 +192,8 @@ class GlyphAtlas {
  private:
   const Type type_;
   std::shared_ptr<Texture> texture_;
+  fml::AccountedMemory accounted_memory_{fml::MemoryCategory::kGlyphAtlas,
+                                         fml::MemoryDomain::kGpu};
   size_t generation_ = 0;
 
 #if defined(IMPELLER_TYPOGRAPHER_USE_STD_HASH)
@@ -35,16 +35,27 @@ void LazyGlyphAtlas::AddTextFrame(const std::shared_ptr<TextFrame>& frame,
                                   Scalar scale,
                                   Point offset,
                                   std::optional<GlyphProperties> properties) {
-  frame->SetPerFrameData(scale, offset, properties);
   FML_DCHECK(alpha_atlas_ == nullptr && color_atlas_ == nullptr);
-  if (frame->GetAtlasType() == GlyphAtlas::Type::kAlphaBitmap) {
-    alpha_text_frames_.push_back(frame);
+  std::shared_ptr<TextFrame> added_frame = frame;
+  if (!added_text_frames_.insert(frame.get()).second) {
+    if (frame->HasPerFrameData(scale, offset, properties)) {
+      return;
+    }
+    // The frame is drawn more than once with different per frame data. Keep
+    // the data of its first draw, and collect the glyphs of this one with a
+    // copy so that they are added to the atlas too.
+    added_frame = std::make_shared<TextFrame>(*frame);
+  }
+  added_frame->SetPerFrameData(scale, offset, properties);
+  if (added_frame->GetAtlasType() == GlyphAtlas::Type::kAlphaBitmap) {
+    alpha_text_frames_.push_back(std::move(added_frame));
   } else {
-    color_text_frames_.push_back(frame);
+    color_text_frames_.push_back(std::move(added_frame));
   }
 }
 
 void LazyGlyphAtlas::ResetTextFrames() {
+  added_text_frames_.clear();
   alpha_text_frames_.clear();
   color_text_frames_.clear();
   alpha_atlas_.reset();
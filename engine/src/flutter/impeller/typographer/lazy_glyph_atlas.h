@@ -5,6 +5,8 @@
 #ifndef FLUTTER_IMPELLER_TYPOGRAPHER_LAZY_GLYPH_ATLAS_H_
 #define FLUTTER_IMPELLER_TYPOGRAPHER_LAZY_GLYPH_ATLAS_H_
 
+#include <unordered_set>
+
 #include "impeller/renderer/context.h"
 #include "impeller/typographer/glyph_atlas.h"
 #include "impeller/typographer/text_frame.h"
@@ -34,6 +36,9 @@ class LazyGlyphAtlas {
  private:
   std::shared_ptr<TypographerContext> typographer_context_;
 
+  // The text frames added since the last reset, which may be drawn more than
+  // once.
+  std::unordered_set<const TextFrame*> added_text_frames_;
   std::vector<std::shared_ptr<TextFrame>> alpha_text_frames_;
   std::vector<std::shared_ptr<TextFrame>> color_text_frames_;
   std::shared_ptr<GlyphAtlasContext> alpha_context_;
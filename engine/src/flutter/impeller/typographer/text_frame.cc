@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "impeller/typographer/text_frame.h"
+#include "flutter/fml/hash_combine.h"
 #include "impeller/geometry/scalar.h"
 #include "impeller/typographer/font.h"
 #include "impeller/typographer/font_glyph_pair.h"
@@ -50,6 +51,53 @@ bool TextFrame::HasColor() const {
   return has_color_;
 }
 
+std::size_t TextFrame::GetHash() const {
+  std::size_t hash = fml::HashCombine(has_color_, bounds_.GetLeft(),
+                                      bounds_.GetTop(), bounds_.GetRight(),
+                                      bounds_.GetBottom());
+  for (const TextRun& run : runs_) {
+    fml::HashCombineSeed(hash, run.GetFont().GetHash(),
+                         run.GetFont().GetAxisAlignment(),
+                         run.GetGlyphCount());
+    for (const TextRun::GlyphPosition& glyph_position :
+         run.GetGlyphPositions()) {
+      fml::HashCombineSeed(hash, glyph_position.glyph,
+                           glyph_position.position.x,
+                           glyph_position.position.y);
+    }
+  }
+  return hash;
+}
+
+bool TextFrame::IsEqual(const TextFrame& other) const {
+  if (has_color_ != other.has_color_ || bounds_ != other.bounds_ ||
+      runs_.size() != other.runs_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < runs_.size(); i++) {
+    const TextRun& run = runs_[i];
+    const TextRun& other_run = other.runs_[i];
+    if (!run.GetFont().IsEqual(other_run.GetFont()) ||
+        run.GetFont().GetAxisAlignment() !=
+            other_run.GetFont().GetAxisAlignment() ||
+        run.GetGlyphCount() != other_run.GetGlyphCount()) {
+      return false;
+    }
+    const std::vector<TextRun::GlyphPosition>& positions =
+        run.GetGlyphPositions();
+    const std::vector<TextRun::GlyphPosition>& other_positions =
+        other_run.GetGlyphPositions();
+    for (size_t j = 0; j < positions.size(); j++) {
+      if (!std::equal_to<Glyph>{}(positions[j].glyph,
+                                  other_positions[j].glyph) ||
+          positions[j].position != other_positions[j].position) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 // static
 Scalar TextFrame::RoundScaledFontSize(Scalar scale) {
   // An arbitrarily chosen maximum text scale to ensure that regardless of the
@@ -101,10 +149,7 @@ Point TextFrame::ComputeSubpixelPosition(
 void TextFrame::SetPerFrameData(Scalar scale,
                                 Point offset,
                                 std::optional<GlyphProperties> properties) {
-  if (!ScalarNearlyEqual(scale_, scale) ||
-      !ScalarNearlyEqual(offset_.x, offset.x) ||
-      !ScalarNearlyEqual(offset_.y, offset.y) ||
-      !TextPropertiesEquals(properties_, properties)) {
+  if (!HasPerFrameData(scale, offset, properties)) {
     bound_values_.clear();
   }
   scale_ = scale;
@@ -112,6 +157,16 @@ void TextFrame::SetPerFrameData(Scalar scale,
   properties_ = properties;
 }
 
+bool TextFrame::HasPerFrameData(
+    Scalar scale,
+    Point offset,
+    const std::optional<GlyphProperties>& properties) const {
+  return ScalarNearlyEqual(scale_, scale) &&
+         ScalarNearlyEqual(offset_.x, offset.x) &&
+         ScalarNearlyEqual(offset_.y, offset.y) &&
+         TextPropertiesEquals(properties_, properties);
+}
+
 Scalar TextFrame::GetScale() const {
   return scale_;
 }
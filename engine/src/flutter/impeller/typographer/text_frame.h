@@ -17,8 +17,10 @@ namespace impeller {
 ///             This object is typically the entrypoint in the Impeller type
 ///             rendering subsystem.
 ///
-/// A text frame should not be reused in multiple places within a single frame,
-/// as internally it is used as a cache for various glyph properties.
+/// A text frame caches the glyph atlas positions of its glyphs for the scale,
+/// offset and properties that it was last added to a glyph atlas with. If a
+/// text frame is drawn more than once in a single frame, only the first draw
+/// uses that cache and the others look their glyphs up in the atlas.
 class TextFrame {
  public:
   TextFrame();
@@ -70,6 +72,18 @@ class TextFrame {
   /// @brief      The type of atlas this run should be place in.
   GlyphAtlas::Type GetAtlasType() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      A hash of the runs, bounds and color of this text frame,
+  ///             which ignores the per frame data.
+  ///
+  std::size_t GetHash() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the runs, bounds and color of two text frames are
+  ///             equal, so that one can be drawn in place of the other.
+  ///
+  bool IsEqual(const TextFrame& other) const;
+
   /// @brief Verifies that all glyphs in this text frame have computed bounds
   ///        information.
   bool IsFrameComplete() const;
@@ -85,6 +99,12 @@ class TextFrame {
                        Point offset,
                        std::optional<GlyphProperties> properties);
 
+  /// @brief Whether the frame bounds of this text frame were computed for the
+  ///        given scale, offset and properties.
+  bool HasPerFrameData(Scalar scale,
+                       Point offset,
+                       const std::optional<GlyphProperties>& properties) const;
+
   // A generation id for the glyph atlas this text run was associated
   // with. As long as the frame generation matches the atlas generation,
   // the contents are guaranteed to be populated and do not need to be
@@ -0,0 +1,61 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/typographer/text_frame_cache.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace impeller {
+
+static constexpr size_t kMinPurgeThreshold = 256;
+
+TextFrameCache::TextFrameCache() : purge_threshold_(kMinPurgeThreshold) {}
+
+TextFrameCache::~TextFrameCache() = default;
+
+std::shared_ptr<TextFrame> TextFrameCache::Intern(
+    std::shared_ptr<TextFrame> frame) {
+  if (!frame) {
+    return frame;
+  }
+  std::size_t hash = frame->GetHash();
+
+  Lock lock(mutex_);
+  auto [begin, end] = frames_.equal_range(hash);
+  for (auto it = begin; it != end;) {
+    std::shared_ptr<TextFrame> cached = it->second.lock();
+    if (!cached) {
+      it = frames_.erase(it);
+      continue;
+    }
+    if (cached->IsEqual(*frame)) {
+      return cached;
+    }
+    ++it;
+  }
+
+  // Remove the entries of the frames that are no longer alive once the cache
+  // doubled in size, which amortizes the cost of purging over the interned
+  // frames.
+  if (frames_.size() >= purge_threshold_) {
+    for (auto it = frames_.begin(); it != frames_.end();) {
+      if (it->second.expired()) {
+        it = frames_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    purge_threshold_ = std::max(kMinPurgeThreshold, frames_.size() * 2);
+  }
+  frames_.emplace(hash, frame);
+  return frame;
+}
+
+size_t TextFrameCache::GetEntryCount() const {
+  Lock lock(mutex_);
+  return frames_.size();
+}
+
+}  // namespace impeller
@@ -0,0 +1,68 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_TYPOGRAPHER_TEXT_FRAME_CACHE_H_
+#define FLUTTER_IMPELLER_TYPOGRAPHER_TEXT_FRAME_CACHE_H_
+
+#include <memory>
+#include <unordered_map>
+
+#include "impeller/base/thread.h"
+#include "impeller/typographer/text_frame.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Interns text frames by their runs, bounds and color, so that
+///             the same text shaped again, for example by the paragraphs of a
+///             rebuilt picture, is drawn with the same text frame.
+///
+///             Text frames cache the glyph atlas positions of their glyphs
+///             for as long as the atlas generation does not change, which
+///             the draws of an interned frame in later frames then reuse
+///             instead of looking their glyphs up in the atlas again.
+///
+///             The cache only holds weak references to the frames. Spawned
+///             engines share the cache of their font collection, which is
+///             safe as they also share the raster thread that draws the
+///             frames. A cache should not be shared by engines that render
+///             on different raster threads.
+///
+///             This class is thread-safe.
+///
+class TextFrameCache {
+ public:
+  TextFrameCache();
+
+  ~TextFrameCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns a live text frame of the cache that is equal to
+  ///             `frame`, or adds `frame` to the cache and returns it if
+  ///             there is none.
+  ///
+  std::shared_ptr<TextFrame> Intern(std::shared_ptr<TextFrame> frame);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of entries of the cache, some of which may refer
+  ///             to text frames that are no longer alive.
+  ///
+  size_t GetEntryCount() const;
+
+ private:
+  mutable Mutex mutex_;
+  std::unordered_multimap<std::size_t, std::weak_ptr<TextFrame>> frames_
+      IPLR_GUARDED_BY(mutex_);
+  // The entry count at which the entries of frames that are no longer alive
+  // are removed.
+  size_t purge_threshold_ IPLR_GUARDED_BY(mutex_);
+
+  TextFrameCache(const TextFrameCache&) = delete;
+
+  TextFrameCache& operator=(const TextFrameCache&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_TYPOGRAPHER_TEXT_FRAME_CACHE_H_
@@ -13,6 +13,7 @@
 #include "impeller/typographer/font_glyph_pair.h"
 #include "impeller/typographer/lazy_glyph_atlas.h"
 #include "impeller/typographer/rectangle_packer.h"
+#include "impeller/typographer/text_frame_cache.h"
 #include "third_party/skia/include/core/SkFont.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkRect.h"
@@ -655,6 +656,50 @@ TEST_P(TypographerTest, InvalidAtlasForcesRepopulation) {
   EXPECT_TRUE(second_atlas_context->GetGlyphAtlas()->IsValid());
 }
 
+TEST(TypographerTest, TextFrameCacheInternsEqualFrames) {
+  SkFont font = flutter::testing::CreateTestFontOfSize(12);
+  TextFrameCache cache;
+
+  auto frame = cache.Intern(MakeTextFrameFromTextBlobSkia(
+      SkTextBlob::MakeFromString("the quick brown fox", font)));
+  auto same_frame = cache.Intern(MakeTextFrameFromTextBlobSkia(
+      SkTextBlob::MakeFromString("the quick brown fox", font)));
+  auto other_frame = cache.Intern(MakeTextFrameFromTextBlobSkia(
+      SkTextBlob::MakeFromString("the lazy dog", font)));
+
+  EXPECT_EQ(frame, same_frame);
+  EXPECT_NE(frame, other_frame);
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+
+  // Frames that are no longer alive are replaced.
+  other_frame.reset();
+  auto new_frame = MakeTextFrameFromTextBlobSkia(
+      SkTextBlob::MakeFromString("the lazy dog", font));
+  EXPECT_EQ(cache.Intern(new_frame), new_frame);
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+}
+
+TEST_P(TypographerTest, LazyGlyphAtlasCollectsGlyphsOfEachDrawOfFrame) {
+  SkFont font = flutter::testing::CreateTestFontOfSize(12);
+  auto frame =
+      MakeTextFrameFromTextBlobSkia(SkTextBlob::MakeFromString("A", font));
+  auto host_buffer = HostBuffer::Create(GetContext()->GetResourceAllocator(),
+                                        GetContext()->GetIdleWaiter());
+  LazyGlyphAtlas lazy_atlas(TypographerContextSkia::Make());
+
+  lazy_atlas.AddTextFrame(frame, /*scale=*/1.0f, {0, 0}, std::nullopt);
+  lazy_atlas.AddTextFrame(frame, /*scale=*/2.0f, {0, 0}, std::nullopt);
+  auto atlas = lazy_atlas.CreateOrGetGlyphAtlas(
+      *GetContext(), *host_buffer, GlyphAtlas::Type::kAlphaBitmap);
+
+  ASSERT_TRUE(atlas && atlas->IsValid());
+  // The glyph is added to the atlas at both scales, and the frame keeps the
+  // bounds of its first draw.
+  EXPECT_EQ(atlas->GetGlyphCount(), 2u);
+  EXPECT_TRUE(frame->HasPerFrameData(1.0f, {0, 0}, std::nullopt));
+  EXPECT_TRUE(frame->IsFrameComplete());
+}
+
 }  // namespace testing
 }  // namespace impeller
 
@@ -134,6 +134,14 @@ constexpr FlutterGPUPixelFormat FromImpellerPixelFormat(
       return FlutterGPUPixelFormat::kD24UnormS8Uint;
     case impeller::PixelFormat::kD32FloatS8UInt:
       return FlutterGPUPixelFormat::kD32FloatS8UInt;
+    case impeller::PixelFormat::kBC1RGBAUNorm:
+    case impeller::PixelFormat::kBC3RGBAUNorm:
+    case impeller::PixelFormat::kBC7RGBAUNorm:
+    case impeller::PixelFormat::kETC2R8G8B8UNorm:
+    case impeller::PixelFormat::kETC2R8G8B8A8UNorm:
+    case impeller::PixelFormat::kASTC4x4UNorm:
+      // Block compressed formats aren't exposed to Flutter GPU.
+      return FlutterGPUPixelFormat::kUnknown;
   }
 }
 
@@ -0,0 +1,86 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+part of dart.ui;
+
+/// Runs [computation] in a new background isolate and returns the result.
+///
+/// This behaves like [Isolate.run], except that the isolate is taken from a
+/// small pool of isolates that the engine creates ahead of time in the
+/// isolate group of the main isolate. These isolates skip the setup of the
+/// `dart:ui` APIs that are only available to the main isolate, so the
+/// computation starts sooner than in an isolate spawned by [Isolate.spawn].
+///
+/// Each computation runs in its own isolate, which exits once the
+/// computation completed. No global state is shared between computations.
+///
+/// The [computation] and any state it captures are sent to that isolate.
+/// See [SendPort.send] for information about what types can be sent.
+///
+/// If [computation] is asynchronous (returns a `Future<R>`) then
+/// that future is awaited in the new isolate, completing the entire
+/// asynchronous computation, before returning the result.
+///
+/// If [computation] throws, the `Future` returned by this function completes
+/// with that error.
+///
+/// If this method is invoked from an isolate other than the main isolate, it
+/// uses [Isolate.run] instead.
+///
+/// This API is currently experimental.
+Future<R> runInComputeIsolate<R>(FutureOr<R> Function() computation) {
+  final Completer<R> resultCompleter = Completer<R>();
+  final RawReceivePort receiver = RawReceivePort();
+  receiver.handler = (Object? message) {
+    if (message is SendPort) {
+      try {
+        message.send(_ComputationRequest(0, computation));
+      } catch (e, s) {
+        // Let the compute isolate exit.
+        message.send(null);
+        receiver.close();
+        resultCompleter.completeError(e, s);
+      }
+      return;
+    }
+    receiver.close();
+    if (message is _ComputationResult) {
+      _completeComputation(resultCompleter, message);
+    } else {
+      // This is the compute isolate's onExit handler, which shouldn't be
+      // called before the result was sent.
+      resultCompleter.completeError(RemoteError(
+          'Computation ended without result', StackTrace.empty.toString()));
+    }
+  };
+  final SendPort sendPort = receiver.sendPort;
+  final bool spawned;
+  try {
+    spawned = _nativeSpawnComputeIsolate(() => _computeIsolateMain(sendPort));
+  } on Object {
+    receiver.close();
+    rethrow;
+  }
+  if (!spawned) {
+    receiver.close();
+    return Isolate.run<R>(computation);
+  }
+  return resultCompleter.future;
+}
+
+void _computeIsolateMain(SendPort sendPort) {
+  final RawReceivePort computationPort = RawReceivePort();
+  computationPort.handler = (_ComputationRequest? message) {
+    // Once the computation completed, the isolate has no open ports left and
+    // exits.
+    computationPort.close();
+    if (message != null) {
+      _runComputation(sendPort, message);
+    }
+  };
+  Isolate.current.addOnExitListener(sendPort);
+  sendPort.send(computationPort.sendPort);
+}
+
+@Native<Bool Function(Handle)>(symbol: 'ComputeIsolateNativeApi::Spawn')
+external bool _nativeSpawnComputeIsolate(Function entryPoint);
@@ -37,6 +37,7 @@
 #include "flutter/lib/ui/text/font_collection.h"
 #include "flutter/lib/ui/text/paragraph.h"
 #include "flutter/lib/ui/text/paragraph_builder.h"
+#include "flutter/lib/ui/window/compute_isolate.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "flutter/lib/ui/window/platform_isolate.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -92,6 +93,8 @@ typedef CanvasPath Path;
   V(IsolateNameServerNatives::RemovePortNameMapping)               \
   V(NativeStringAttribute::initLocaleStringAttribute)              \
   V(NativeStringAttribute::initSpellOutStringAttribute)            \
+  V(Paragraph::layoutAll)                                          \
+  V(Picture::toImages)                                             \
   V(PlatformConfigurationNativeApi::DefaultRouteName)              \
   V(PlatformConfigurationNativeApi::ScheduleFrame)                 \
   V(PlatformConfigurationNativeApi::EndWarmUpFrame)                \
@@ -111,6 +114,7 @@ typedef CanvasPath Path;
   V(PlatformConfigurationNativeApi::GetScaledFontSize)             \
   V(PlatformIsolateNativeApi::IsRunningOnPlatformThread)           \
   V(PlatformIsolateNativeApi::Spawn)                               \
+  V(ComputeIsolateNativeApi::Spawn)                                \
   V(DartRuntimeHooks::Logger_PrintDebugString)                     \
   V(DartRuntimeHooks::Logger_PrintString)                          \
   V(DartRuntimeHooks::ScheduleMicrotask)                           \
@@ -142,6 +146,7 @@ typedef CanvasPath Path;
   V(Canvas, drawAtlas)                           \
   V(Canvas, drawCircle)                          \
   V(Canvas, drawColor)                           \
+  V(Canvas, drawCommands)                        \
   V(Canvas, drawDRRect)                          \
   V(Canvas, drawImage)                           \
   V(Canvas, drawImageNine)                       \
@@ -212,6 +217,7 @@ typedef CanvasPath Path;
   V(ParagraphBuilder, addPlaceholder)            \
   V(ParagraphBuilder, addText)                   \
   V(ParagraphBuilder, build)                     \
+  V(ParagraphBuilder, buildIncremental)          \
   V(ParagraphBuilder, pop)                       \
   V(ParagraphBuilder, pushStyle)                 \
   V(Paragraph, alphabeticBaseline)               \
@@ -307,6 +307,63 @@ external void _finishCallResponse(bool didPass);
 @pragma('vm:entry-point')
 void messageCallback(dynamic data) {}
 
+// Records a picture made of the simple canvas operations that are typical of
+// framework painting. Used by ui_benchmarks.cc.
+@pragma('vm:entry-point')
+void recordCanvasPrimitives(int count) {
+  final PictureRecorder recorder = PictureRecorder();
+  final Canvas canvas = Canvas(recorder);
+  final Paint fill = Paint()..color = const Color(0xFF2196F3);
+  final Paint stroke = Paint()
+    ..color = const Color(0xFF000000)
+    ..style = PaintingStyle.stroke
+    ..strokeWidth = 2;
+  for (int i = 0; i < count; i++) {
+    final double offset = (i % 100).toDouble();
+    canvas.save();
+    canvas.translate(offset, offset);
+    canvas.clipRect(const Rect.fromLTWH(0, 0, 50, 50));
+    canvas.drawRect(const Rect.fromLTWH(0, 0, 40, 20), fill);
+    canvas.drawRRect(RRect.fromLTRBR(0, 20, 40, 40, const Radius.circular(4)), stroke);
+    canvas.drawCircle(const Offset(20, 20), 10, fill);
+    canvas.drawLine(Offset.zero, const Offset(40, 40), stroke);
+    canvas.restore();
+  }
+  recorder.endRecording().dispose();
+}
+
+// Records a picture with the canvas and path operations that pass typed data
+// to the engine. Used by ui_benchmarks.cc.
+@pragma('vm:entry-point')
+void recordCanvasTypedDataCalls(int count) {
+  final PictureRecorder recorder = PictureRecorder();
+  final Canvas canvas = Canvas(recorder);
+  final Float64List matrix4 = Float64List.fromList(<double>[
+    1, 0, 0, 0,
+    0, 1, 0, 0,
+    0, 0, 1, 0,
+    1, 1, 0, 1,
+  ]);
+  const List<Offset> points = <Offset>[Offset.zero, Offset(10, 0), Offset(10, 10)];
+  for (int i = 0; i < count; i++) {
+    canvas.transform(matrix4);
+    canvas.getTransform();
+    canvas.getLocalClipBounds();
+    canvas.getDestinationClipBounds();
+    Path().addPolygon(points, true);
+  }
+  recorder.endRecording().dispose();
+}
+
+@pragma('vm:external-name', 'ComputeIsolateReady')
+external void _computeIsolateReady();
+
+// The entry point of the compute isolates spawned by ui_benchmarks.cc.
+@pragma('vm:entry-point')
+void computeIsolateMain() {
+  _computeIsolateReady();
+}
+
 @pragma('vm:entry-point')
 @pragma('vm:external-name', 'ValidateConfiguration')
 external void validateConfiguration();
@@ -3217,11 +3217,12 @@ base class _NativePath extends NativeFieldWrapperClass1 implements Path {
 
   @override
   void addPolygon(List<Offset> points, bool close) {
-    _addPolygon(_encodePointList(points), close);
+    final Float32List encodedPoints = _encodePointList(points);
+    _addPolygon(encodedPoints.address, points.length, close);
   }
 
-  @Native<Void Function(Pointer<Void>, Handle, Bool)>(symbol: 'Path::addPolygon')
-  external void _addPolygon(Float32List points, bool close);
+  @Native<Void Function(Pointer<Void>, Pointer<Float>, Int32, Bool)>(symbol: 'Path::addPolygon', isLeaf: true)
+  external void _addPolygon(Pointer<Float> points, int pointCount, bool close);
 
   @override
   void addRRect(RRect rrect) {
@@ -6206,6 +6207,116 @@ abstract class Canvas {
   void drawShadow(Path path, Color color, double elevation, bool transparentOccluder);
 }
 
+// Whether [_NativeCanvas] records simple operations into a
+// [_CanvasCommandBuffer] rather than calling into the engine for each of them.
+//
+// The engine's benchmarks toggle this to compare both paths.
+@pragma('vm:entry-point')
+bool _canvasCommandBatchingEnabled = true;
+
+// Accumulates simple canvas operations so that they can be handed to the
+// engine in a single call instead of one native call per operation.
+//
+// The encoding must match Canvas::drawCommands in canvas.cc. Each command is
+// an op code followed by its arguments. Operations that take a paint end with
+// an index into [paints], which holds snapshots of the paint data at the time
+// the operation was recorded. Only paints without native objects (shaders,
+// color filters, and image filters) may be recorded since those objects may be
+// disposed before the commands are flushed.
+final class _CanvasCommandBuffer {
+  static const int kSave = 0;
+  static const int kRestore = 1;
+  static const int kTranslate = 2;
+  static const int kScale = 3;
+  static const int kRotate = 4;
+  static const int kClipRect = 5;
+  static const int kDrawLine = 6;
+  static const int kDrawRect = 7;
+  static const int kDrawOval = 8;
+  static const int kDrawCircle = 9;
+  static const int kDrawRRect = 10;
+
+  // The number of values in the largest command (kDrawRRect).
+  static const int _kMaxCommandLength = 14;
+  // The buffer starts small so that canvases that only record a few commands
+  // don't pay for a full buffer, and grows up to its capacity.
+  static const int _kInitialCapacity = 64;
+  static const int _kCapacity = 4096;
+
+  // How many of the most recently recorded paints are checked for a match
+  // before a new snapshot is taken.
+  static const int _kPaintLookback = 4;
+
+  Float64List commands = Float64List(_kInitialCapacity);
+  int length = 0;
+  List<ByteData> paints = <ByteData>[];
+
+  bool get isEmpty => length == 0;
+
+  // Makes room for another command of any kind, growing the buffer if it is
+  // not at its capacity yet. Returns false if the buffer must be flushed
+  // first.
+  bool reserve() {
+    if (length + _kMaxCommandLength <= commands.length) {
+      return true;
+    }
+    if (commands.length >= _kCapacity) {
+      return false;
+    }
+    final Float64List grown = Float64List(math.min(commands.length * 2, _kCapacity));
+    grown.setRange(0, length, commands);
+    commands = grown;
+    return true;
+  }
+
+  static bool canRecord(Paint paint) {
+    final List<Object?>? objects = paint._objects;
+    if (objects == null) {
+      return true;
+    }
+    for (final Object? object in objects) {
+      if (object != null) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void add(double value) {
+    commands[length++] = value;
+  }
+
+  void addPaint(Paint paint) {
+    final Uint32List data = paint._data.buffer.asUint32List();
+    final int count = paints.length;
+    final int stop = math.max(0, count - _kPaintLookback);
+    for (int i = count - 1; i >= stop; i--) {
+      if (_equals(paints[i].buffer.asUint32List(), data)) {
+        add(i.toDouble());
+        return;
+      }
+    }
+    final ByteData snapshot = ByteData(Paint._kDataByteCount);
+    snapshot.buffer.asUint32List().setAll(0, data);
+    paints.add(snapshot);
+    add(count.toDouble());
+  }
+
+  static bool _equals(Uint32List a, Uint32List b) {
+    for (int i = 0; i < a.length; i++) {
+      if (a[i] != b[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void reset() {
+    length = 0;
+    paints = <ByteData>[];
+  }
+}
+
 base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   _NativeCanvas(PictureRecorder recorder, [ Rect? cullRect ])  {
     if (recorder.isRecording) {
@@ -6225,9 +6336,49 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   // garbage collected until PictureRecorder.endRecording is called.
   _NativePictureRecorder? _recorder;
 
+  // Simple operations recorded since the last call into the engine. Must be
+  // flushed before any other native call on this canvas. Created on the first
+  // batched operation.
+  _CanvasCommandBuffer? _commandBuffer;
+
+  // Returns the command buffer if there is room for another command, flushing
+  // it first if needed, or null if commands are not being batched.
+  _CanvasCommandBuffer? _beginCommand() {
+    if (!_canvasCommandBatchingEnabled) {
+      _flushCommands();
+      return null;
+    }
+    final _CanvasCommandBuffer buffer = _commandBuffer ??= _CanvasCommandBuffer();
+    if (!buffer.reserve()) {
+      _flushCommands();
+    }
+    return buffer;
+  }
+
+  void _flushCommands() {
+    final _CanvasCommandBuffer? buffer = _commandBuffer;
+    if (buffer == null || buffer.isEmpty) {
+      return;
+    }
+    _drawCommands(buffer.commands, buffer.length, buffer.paints);
+    buffer.reset();
+  }
+
+  @Native<Void Function(Pointer<Void>, Handle, Int32, Handle)>(symbol: 'Canvas::drawCommands')
+  external void _drawCommands(Float64List commands, int length, List<ByteData> paints);
+
   @override
+  void save() {
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null) {
+      _save();
+      return;
+    }
+    buffer.add(_CanvasCommandBuffer.kSave.toDouble());
+  }
+
   @Native<Void Function(Pointer<Void>)>(symbol: 'Canvas::save', isLeaf: true)
-  external void save();
+  external void _save();
 
   static Rect _sorted(Rect rect) {
     if (rect.isEmpty) {
@@ -6243,6 +6394,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
 
   @override
   void saveLayer(Rect? bounds, Paint paint) {
+    _flushCommands();
     if (bounds == null) {
       _saveLayerWithoutBounds(paint._objects, paint._data);
     } else {
@@ -6258,55 +6410,114 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   external void _saveLayer(double left, double top, double right, double bottom, List<Object?>? paintObjects, ByteData paintData);
 
   @override
+  void restore() {
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null) {
+      _restore();
+      return;
+    }
+    buffer.add(_CanvasCommandBuffer.kRestore.toDouble());
+  }
+
   @Native<Void Function(Pointer<Void>)>(symbol: 'Canvas::restore', isLeaf: true)
-  external void restore();
+  external void _restore();
 
   @override
+  void restoreToCount(int count) {
+    _flushCommands();
+    _restoreToCount(count);
+  }
+
   @Native<Void Function(Pointer<Void>, Int32)>(symbol: 'Canvas::restoreToCount', isLeaf: true)
-  external void restoreToCount(int count);
+  external void _restoreToCount(int count);
 
   @override
+  int getSaveCount() {
+    _flushCommands();
+    return _getSaveCount();
+  }
+
   @Native<Int32 Function(Pointer<Void>)>(symbol: 'Canvas::getSaveCount', isLeaf: true)
-  external int getSaveCount();
+  external int _getSaveCount();
 
   @override
+  void translate(double dx, double dy) {
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null) {
+      _translate(dx, dy);
+      return;
+    }
+    buffer
+      ..add(_CanvasCommandBuffer.kTranslate.toDouble())
+      ..add(dx)
+      ..add(dy);
+  }
+
   @Native<Void Function(Pointer<Void>, Double, Double)>(symbol: 'Canvas::translate', isLeaf: true)
-  external void translate(double dx, double dy);
+  external void _translate(double dx, double dy);
 
   @override
-  void scale(double sx, [double? sy]) => _scale(sx, sy ?? sx);
+  void scale(double sx, [double? sy]) {
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null) {
+      _scale(sx, sy ?? sx);
+      return;
+    }
+    buffer
+      ..add(_CanvasCommandBuffer.kScale.toDouble())
+      ..add(sx)
+      ..add(sy ?? sx);
+  }
 
   @Native<Void Function(Pointer<Void>, Double, Double)>(symbol: 'Canvas::scale', isLeaf: true)
   external void _scale(double sx, double sy);
 
   @override
+  void rotate(double radians) {
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null) {
+      _rotate(radians);
+      return;
+    }
+    buffer
+      ..add(_CanvasCommandBuffer.kRotate.toDouble())
+      ..add(radians);
+  }
+
   @Native<Void Function(Pointer<Void>, Double)>(symbol: 'Canvas::rotate', isLeaf: true)
-  external void rotate(double radians);
+  external void _rotate(double radians);
 
   @override
+  void skew(double sx, double sy) {
+    _flushCommands();
+    _skew(sx, sy);
+  }
+
   @Native<Void Function(Pointer<Void>, Double, Double)>(symbol: 'Canvas::skew', isLeaf: true)
-  external void skew(double sx, double sy);
+  external void _skew(double sx, double sy);
 
   @override
   void transform(Float64List matrix4) {
     if (matrix4.length != 16) {
       throw ArgumentError('"matrix4" must have 16 entries.');
     }
-    _transform(matrix4);
+    _flushCommands();
+    _transform(matrix4.address);
   }
 
-  @Native<Void Function(Pointer<Void>, Handle)>(symbol: 'Canvas::transform')
-  external void _transform(Float64List matrix4);
+  @Native<Void Function(Pointer<Void>, Pointer<Double>)>(symbol: 'Canvas::transform', isLeaf: true)
+  external void _transform(Pointer<Double> matrix4);
 
   @override
   Float64List getTransform() {
     final Float64List matrix4 = Float64List(16);
-    _getTransform(matrix4);
+    _flushCommands();
+    _getTransform(matrix4.address);
     return matrix4;
   }
 
-  @Native<Void Function(Pointer<Void>, Handle)>(symbol: 'Canvas::getTransform')
-  external void _getTransform(Float64List matrix4);
+  @Native<Void Function(Pointer<Void>, Pointer<Double>)>(symbol: 'Canvas::getTransform', isLeaf: true)
+  external void _getTransform(Pointer<Double> matrix4);
 
   @override
   void clipRect(Rect rect, { ClipOp clipOp = ClipOp.intersect, bool doAntiAlias = true }) {
@@ -6315,7 +6526,19 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     // Even if rect is still empty - which implies it has a zero dimension -
     // we still need to perform the clipRect operation as it will effectively
     // nullify any further rendering until the next restore call.
-    _clipRect(rect.left, rect.top, rect.right, rect.bottom, clipOp.index, doAntiAlias);
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null) {
+      _clipRect(rect.left, rect.top, rect.right, rect.bottom, clipOp.index, doAntiAlias);
+      return;
+    }
+    buffer
+      ..add(_CanvasCommandBuffer.kClipRect.toDouble())
+      ..add(rect.left)
+      ..add(rect.top)
+      ..add(rect.right)
+      ..add(rect.bottom)
+      ..add(clipOp.index.toDouble())
+      ..add(doAntiAlias ? 1.0 : 0.0);
   }
 
   @Native<Void Function(Pointer<Void>, Double, Double, Double, Double, Int32, Bool)>(symbol: 'Canvas::clipRect', isLeaf: true)
@@ -6324,6 +6547,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   @override
   void clipRRect(RRect rrect, {bool doAntiAlias = true}) {
     assert(_rrectIsValid(rrect));
+    _flushCommands();
     _clipRRect(rrect._getValue32(), doAntiAlias);
   }
 
@@ -6332,6 +6556,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
 
   @override
   void clipPath(Path path, {bool doAntiAlias = true}) {
+    _flushCommands();
     _clipPath(path as _NativePath, doAntiAlias);
   }
 
@@ -6341,25 +6566,28 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   @override
   Rect getLocalClipBounds() {
     final Float64List bounds = Float64List(4);
-    _getLocalClipBounds(bounds);
+    _flushCommands();
+    _getLocalClipBounds(bounds.address);
     return Rect.fromLTRB(bounds[0], bounds[1], bounds[2], bounds[3]);
   }
 
-  @Native<Void Function(Pointer<Void>, Handle)>(symbol: 'Canvas::getLocalClipBounds')
-  external void _getLocalClipBounds(Float64List bounds);
+  @Native<Void Function(Pointer<Void>, Pointer<Double>)>(symbol: 'Canvas::getLocalClipBounds', isLeaf: true)
+  external void _getLocalClipBounds(Pointer<Double> bounds);
 
   @override
   Rect getDestinationClipBounds() {
     final Float64List bounds = Float64List(4);
-    _getDestinationClipBounds(bounds);
+    _flushCommands();
+    _getDestinationClipBounds(bounds.address);
     return Rect.fromLTRB(bounds[0], bounds[1], bounds[2], bounds[3]);
   }
 
-  @Native<Void Function(Pointer<Void>, Handle)>(symbol: 'Canvas::getDestinationClipBounds')
-  external void _getDestinationClipBounds(Float64List bounds);
+  @Native<Void Function(Pointer<Void>, Pointer<Double>)>(symbol: 'Canvas::getDestinationClipBounds', isLeaf: true)
+  external void _getDestinationClipBounds(Pointer<Double> bounds);
 
   @override
   void drawColor(Color color, BlendMode blendMode) {
+    _flushCommands();
     _drawColor(color.value, blendMode.index);
   }
 
@@ -6370,7 +6598,19 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   void drawLine(Offset p1, Offset p2, Paint paint) {
     assert(_offsetIsValid(p1));
     assert(_offsetIsValid(p2));
-    _drawLine(p1.dx, p1.dy, p2.dx, p2.dy, paint._objects, paint._data);
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null || !_CanvasCommandBuffer.canRecord(paint)) {
+      _flushCommands();
+      _drawLine(p1.dx, p1.dy, p2.dx, p2.dy, paint._objects, paint._data);
+      return;
+    }
+    buffer
+      ..add(_CanvasCommandBuffer.kDrawLine.toDouble())
+      ..add(p1.dx)
+      ..add(p1.dy)
+      ..add(p2.dx)
+      ..add(p2.dy)
+      ..addPaint(paint);
   }
 
   @Native<Void Function(Pointer<Void>, Double, Double, Double, Double, Handle, Handle)>(symbol: 'Canvas::drawLine')
@@ -6378,6 +6618,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
 
   @override
   void drawPaint(Paint paint) {
+    _flushCommands();
     _drawPaint(paint._objects, paint._data);
   }
 
@@ -6389,17 +6630,57 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     assert(_rectIsValid(rect));
     rect = _sorted(rect);
     if (paint.style != PaintingStyle.fill || !rect.isEmpty) {
-      _drawRect(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      _drawRectOrOval(_CanvasCommandBuffer.kDrawRect, rect, paint);
     }
   }
 
   @Native<Void Function(Pointer<Void>, Double, Double, Double, Double, Handle, Handle)>(symbol: 'Canvas::drawRect')
   external void _drawRect(double left, double top, double right, double bottom, List<Object?>? paintObjects, ByteData paintData);
 
+  void _drawRectOrOval(int command, Rect rect, Paint paint) {
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null || !_CanvasCommandBuffer.canRecord(paint)) {
+      _flushCommands();
+      if (command == _CanvasCommandBuffer.kDrawRect) {
+        _drawRect(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      } else {
+        _drawOval(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      }
+      return;
+    }
+    buffer
+      ..add(command.toDouble())
+      ..add(rect.left)
+      ..add(rect.top)
+      ..add(rect.right)
+      ..add(rect.bottom)
+      ..addPaint(paint);
+  }
+
   @override
   void drawRRect(RRect rrect, Paint paint) {
     assert(_rrectIsValid(rrect));
-    _drawRRect(rrect._getValue32(), paint._objects, paint._data);
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null || !_CanvasCommandBuffer.canRecord(paint)) {
+      _flushCommands();
+      _drawRRect(rrect._getValue32(), paint._objects, paint._data);
+      return;
+    }
+    buffer
+      ..add(_CanvasCommandBuffer.kDrawRRect.toDouble())
+      ..add(rrect.left)
+      ..add(rrect.top)
+      ..add(rrect.right)
+      ..add(rrect.bottom)
+      ..add(rrect.tlRadiusX)
+      ..add(rrect.tlRadiusY)
+      ..add(rrect.trRadiusX)
+      ..add(rrect.trRadiusY)
+      ..add(rrect.brRadiusX)
+      ..add(rrect.brRadiusY)
+      ..add(rrect.blRadiusX)
+      ..add(rrect.blRadiusY)
+      ..addPaint(paint);
   }
 
   @Native<Void Function(Pointer<Void>, Handle, Handle, Handle)>(symbol: 'Canvas::drawRRect')
@@ -6409,6 +6690,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   void drawDRRect(RRect outer, RRect inner, Paint paint) {
     assert(_rrectIsValid(outer));
     assert(_rrectIsValid(inner));
+    _flushCommands();
     _drawDRRect(outer._getValue32(), inner._getValue32(), paint._objects, paint._data);
   }
 
@@ -6420,7 +6702,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     assert(_rectIsValid(rect));
     rect = _sorted(rect);
     if (paint.style != PaintingStyle.fill || !rect.isEmpty) {
-      _drawOval(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      _drawRectOrOval(_CanvasCommandBuffer.kDrawOval, rect, paint);
     }
   }
 
@@ -6430,7 +6712,18 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   @override
   void drawCircle(Offset c, double radius, Paint paint) {
     assert(_offsetIsValid(c));
-    _drawCircle(c.dx, c.dy, radius, paint._objects, paint._data);
+    final _CanvasCommandBuffer? buffer = _beginCommand();
+    if (buffer == null || !_CanvasCommandBuffer.canRecord(paint)) {
+      _flushCommands();
+      _drawCircle(c.dx, c.dy, radius, paint._objects, paint._data);
+      return;
+    }
+    buffer
+      ..add(_CanvasCommandBuffer.kDrawCircle.toDouble())
+      ..add(c.dx)
+      ..add(c.dy)
+      ..add(radius)
+      ..addPaint(paint);
   }
 
   @Native<Void Function(Pointer<Void>, Double, Double, Double, Handle, Handle)>(symbol: 'Canvas::drawCircle')
@@ -6439,6 +6732,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   @override
   void drawArc(Rect rect, double startAngle, double sweepAngle, bool useCenter, Paint paint) {
     assert(_rectIsValid(rect));
+    _flushCommands();
     _drawArc(rect.left, rect.top, rect.right, rect.bottom, startAngle, sweepAngle, useCenter, paint._objects, paint._data);
   }
 
@@ -6456,6 +6750,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
 
   @override
   void drawPath(Path path, Paint paint) {
+    _flushCommands();
     _drawPath(path as _NativePath, paint._objects, paint._data);
   }
 
@@ -6466,6 +6761,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   void drawImage(Image image, Offset offset, Paint paint) {
     assert(!image.debugDisposed);
     assert(_offsetIsValid(offset));
+    _flushCommands();
     final String? error = _drawImage(image._image, offset.dx, offset.dy, paint._objects, paint._data, paint.filterQuality.index);
     if (error != null) {
       throw PictureRasterizationException._(error, stack: image._debugStack);
@@ -6480,6 +6776,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     assert(!image.debugDisposed);
     assert(_rectIsValid(src));
     assert(_rectIsValid(dst));
+    _flushCommands();
     final String? error = _drawImageRect(image._image,
                                          src.left,
                                          src.top,
@@ -6517,6 +6814,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     assert(!image.debugDisposed);
     assert(_rectIsValid(center));
     assert(_rectIsValid(dst));
+    _flushCommands();
     final String? error = _drawImageNine(image._image,
                                          center.left,
                                          center.top,
@@ -6552,6 +6850,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   @override
   void drawPicture(Picture picture) {
     assert(!picture.debugDisposed);
+    _flushCommands();
     _drawPicture(picture as _NativePicture);
   }
 
@@ -6564,11 +6863,13 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     assert(!nativeParagraph.debugDisposed);
     assert(_offsetIsValid(offset));
     assert(!nativeParagraph._needsLayout);
+    _flushCommands();
     nativeParagraph._paint(this, offset.dx, offset.dy);
   }
 
   @override
   void drawPoints(PointMode pointMode, List<Offset> points, Paint paint) {
+    _flushCommands();
     _drawPoints(paint._objects, paint._data, pointMode.index, _encodePointList(points));
   }
 
@@ -6577,6 +6878,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     if (points.length % 2 != 0) {
       throw ArgumentError('"points" must have an even number of values.');
     }
+    _flushCommands();
     _drawPoints(paint._objects, paint._data, pointMode.index, points);
   }
 
@@ -6586,6 +6888,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
   @override
   void drawVertices(Vertices vertices, BlendMode blendMode, Paint paint) {
     assert(!vertices.debugDisposed);
+    _flushCommands();
     _drawVertices(vertices, blendMode.index, paint._objects, paint._data);
   }
 
@@ -6636,6 +6939,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     final Float32List? cullRectBuffer = cullRect?._getValue32();
     final int qualityIndex = paint.filterQuality.index;
 
+    _flushCommands();
     final String? error = _drawAtlas(
       paint._objects, paint._data, qualityIndex, atlas._image, rstTransformBuffer, rectBuffer,
       colorBuffer, (blendMode ?? BlendMode.src).index, cullRectBuffer
@@ -6668,6 +6972,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
     }
     final int qualityIndex = paint.filterQuality.index;
 
+    _flushCommands();
     final String? error = _drawAtlas(
       paint._objects, paint._data, qualityIndex, atlas._image, rstTransforms, rects,
       colors, (blendMode ?? BlendMode.src).index, cullRect?._getValue32()
@@ -6692,6 +6997,7 @@ base class _NativeCanvas extends NativeFieldWrapperClass1 implements Canvas {
 
   @override
   void drawShadow(Path path, Color color, double elevation, bool transparentOccluder) {
+    _flushCommands();
     _drawShadow(path as _NativePath, color.value, elevation, transparentOccluder);
   }
 
@@ -6734,6 +7040,52 @@ abstract class Picture {
   /// `height` (bottom) bounds. Content outside these bounds is clipped.
   Future<Image> toImage(int width, int height);
 
+  /// Creates an image from each of the given pictures.
+  ///
+  /// The image for `pictures[i]` is `widths[i]` pixels wide and `heights[i]`
+  /// pixels high, and is rasterized as [toImage] would. The images are
+  /// returned in the same order as the pictures. If any of the pictures can
+  /// not be rasterized, the returned future completes with an error.
+  ///
+  /// The engine may render all of the pictures in a single pass on the GPU,
+  /// which takes less time than calling [toImage] for each of them when there
+  /// are many of them.
+  static Future<List<Image>> toImages(List<Picture> pictures, List<int> widths, List<int> heights) {
+    assert(pictures.length == widths.length && pictures.length == heights.length);
+    for (int index = 0; index < pictures.length; index += 1) {
+      assert(!pictures[index].debugDisposed);
+      if (widths[index] <= 0 || heights[index] <= 0) {
+        throw Exception('Invalid image dimensions.');
+      }
+    }
+    if (pictures.isEmpty) {
+      return Future<List<Image>>.value(<Image>[]);
+    }
+    if (pictures.any((Picture picture) => picture is! _NativePicture)) {
+      return Future.wait(<Future<Image>>[
+        for (int index = 0; index < pictures.length; index += 1)
+          pictures[index].toImage(widths[index], heights[index]),
+      ]);
+    }
+    return _futurize(
+      (_Callback<List<Image>> callback) => _NativePicture._toImages(
+        List<_NativePicture>.from(pictures),
+        Uint32List.fromList(widths),
+        Uint32List.fromList(heights),
+        (List<Object?>? images) {
+          if (images == null) {
+            callback(null);
+          } else {
+            callback(<Image>[
+              for (final _Image image in images.cast<_Image>())
+                Image._(image, image.width, image.height),
+            ]);
+          }
+        },
+      ),
+    );
+  }
+
   /// Synchronously creates a handle to an image of this picture.
   ///
   /// {@template dart.ui.painting.Picture.toImageSync}
@@ -6797,6 +7149,14 @@ base class _NativePicture extends NativeFieldWrapperClass1 implements Picture {
   @Native<Handle Function(Pointer<Void>, Uint32, Uint32, Handle)>(symbol: 'Picture::toImage')
   external String? _toImage(int width, int height, void Function(_Image?) callback);
 
+  @Native<Handle Function(Handle, Handle, Handle, Handle)>(symbol: 'Picture::toImages')
+  external static String? _toImages(
+    List<_NativePicture> pictures,
+    Uint32List widths,
+    Uint32List heights,
+    void Function(List<Object?>?) callback,
+  );
+
   @override
   Image toImageSync(int width, int height) {
     assert(!_disposed);
@@ -6902,6 +7262,7 @@ base class _NativePictureRecorder extends NativeFieldWrapperClass1 implements Pi
     if (_canvas == null) {
       throw StateError('PictureRecorder did not start recording.');
     }
+    _canvas!._flushCommands();
     final _NativePicture picture = _NativePicture._();
     _endRecording(picture);
     _canvas!._recorder = null;
@@ -5,6 +5,7 @@
 #include "flutter/lib/ui/painting/canvas.h"
 
 #include <cmath>
+#include <vector>
 
 #include "flutter/display_list/dl_builder.h"
 #include "flutter/lib/ui/floating_point.h"
@@ -20,6 +21,35 @@ namespace flutter {
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, Canvas);
 
+namespace {
+
+// Op codes of the command stream encoded by _CanvasCommandBuffer in
+// painting.dart. Must be kept in sync.
+enum class CanvasCommand {
+  kSave = 0,
+  kRestore = 1,
+  kTranslate = 2,
+  kScale = 3,
+  kRotate = 4,
+  kClipRect = 5,
+  kDrawLine = 6,
+  kDrawRect = 7,
+  kDrawOval = 8,
+  kDrawCircle = 9,
+  kDrawRRect = 10,
+  kLast = kDrawRRect,
+};
+
+constexpr int kLastClipOp = static_cast<int>(DlCanvas::ClipOp::kIntersect);
+
+// Whether |value| is one of the integers from 0 to |last|, which can be cast to
+// an enum with those values.
+bool IsEnumValue(double value, int last) {
+  return value >= 0.0 && value <= last && value == std::floor(value);
+}
+
+}  // namespace
+
 void Canvas::Create(Dart_Handle wrapper,
                     PictureRecorder* recorder,
                     double left,
@@ -133,7 +163,7 @@ void Canvas::skew(double sx, double sy) {
   }
 }
 
-void Canvas::transform(const tonic::Float64List& matrix4) {
+void Canvas::transform(const double* matrix4) {
   // The Float array stored by Dart Matrix4 is in column-major order
   // DisplayList TransformFullPerspective takes row-major matrix order
   if (display_list_builder_) {
@@ -147,11 +177,10 @@ void Canvas::transform(const tonic::Float64List& matrix4) {
   }
 }
 
-void Canvas::getTransform(Dart_Handle matrix4_handle) {
+void Canvas::getTransform(double* matrix4) {
   if (display_list_builder_) {
     // The Float array stored by DlMatrix is in column-major order
     DlMatrix matrix = builder()->GetMatrix();
-    auto matrix4 = tonic::Float64List(matrix4_handle);
     for (int i = 0; i < 16; i++) {
       matrix4[i] = matrix.m[i];
     }
@@ -190,9 +219,8 @@ void Canvas::clipPath(const CanvasPath* path, bool doAntiAlias) {
   }
 }
 
-void Canvas::getDestinationClipBounds(Dart_Handle rect_handle) {
+void Canvas::getDestinationClipBounds(double* rect) {
   if (display_list_builder_) {
-    auto rect = tonic::Float64List(rect_handle);
     DlRect bounds = builder()->GetDestinationClipCoverage();
     rect[0] = bounds.GetLeft();
     rect[1] = bounds.GetTop();
@@ -201,9 +229,8 @@ void Canvas::getDestinationClipBounds(Dart_Handle rect_handle) {
   }
 }
 
-void Canvas::getLocalClipBounds(Dart_Handle rect_handle) {
+void Canvas::getLocalClipBounds(double* rect) {
   if (display_list_builder_) {
-    auto rect = tonic::Float64List(rect_handle);
     DlRect bounds = builder()->GetLocalClipCoverage();
     rect[0] = bounds.GetLeft();
     rect[1] = bounds.GetTop();
@@ -614,6 +641,189 @@ Dart_Handle Canvas::drawAtlas(Dart_Handle paint_objects,
   return Dart_Null();
 }
 
+void Canvas::drawCommands(Dart_Handle commands_handle,
+                          int length,
+                          Dart_Handle paints) {
+  if (!display_list_builder_) {
+    return;
+  }
+
+  // Copy the commands out of the typed data so that the Dart API may be used
+  // to look up paints while decoding.
+  std::vector<double> commands;
+  {
+    tonic::Float64List list(commands_handle);
+    if (length < 0 || length > list.num_elements()) {
+      Dart_ThrowException(ToDart("Invalid canvas command stream length."));
+      return;
+    }
+    commands.assign(list.data(), list.data() + length);
+  }
+
+  intptr_t paint_count = 0;
+  if (Dart_IsError(Dart_ListLength(paints, &paint_count))) {
+    Dart_ThrowException(ToDart("Invalid canvas command stream paints."));
+    return;
+  }
+
+  size_t offset = 0u;
+  auto has = [&](size_t count) { return offset + count <= commands.size(); };
+  auto read = [&]() { return SafeNarrow(commands[offset++]); };
+
+  // Consecutive commands usually use the same paint with the same flags. Only
+  // decode the paint again when either changes.
+  intptr_t decoded_paint_index = -1;
+  const DisplayListAttributeFlags* decoded_flags = nullptr;
+  DlPaint decoded_paint;
+  auto read_paint = [&](const DisplayListAttributeFlags& flags)
+      -> const DlPaint* {
+    const double index = commands[offset++];
+    if (!(index >= 0 && index < paint_count)) {
+      return nullptr;
+    }
+    const auto paint_index = static_cast<intptr_t>(index);
+    if (paint_index != decoded_paint_index || &flags != decoded_flags) {
+      Dart_Handle paint_data = Dart_ListGetAt(paints, paint_index);
+      if (Dart_IsError(paint_data) || Dart_IsNull(paint_data)) {
+        return nullptr;
+      }
+      decoded_paint = DlPaint();
+      Paint(Dart_Null(), paint_data)
+          .paint(decoded_paint, flags, DlTileMode::kDecal);
+      decoded_paint_index = paint_index;
+      decoded_flags = &flags;
+    }
+    return &decoded_paint;
+  };
+
+  while (offset < commands.size()) {
+    const double command_value = commands[offset++];
+    if (!IsEnumValue(command_value, static_cast<int>(CanvasCommand::kLast))) {
+      Dart_ThrowException(ToDart("Malformed canvas command stream."));
+      return;
+    }
+    const auto command =
+        static_cast<CanvasCommand>(static_cast<int>(command_value));
+    bool valid = true;
+    switch (command) {
+      case CanvasCommand::kSave:
+        builder()->Save();
+        break;
+      case CanvasCommand::kRestore:
+        builder()->Restore();
+        break;
+      case CanvasCommand::kTranslate:
+        if ((valid = has(2))) {
+          const auto dx = read();
+          const auto dy = read();
+          builder()->Translate(dx, dy);
+        }
+        break;
+      case CanvasCommand::kScale:
+        if ((valid = has(2))) {
+          const auto sx = read();
+          const auto sy = read();
+          builder()->Scale(sx, sy);
+        }
+        break;
+      case CanvasCommand::kRotate:
+        if ((valid = has(1))) {
+          builder()->Rotate(read() * 180.0f / static_cast<float>(M_PI));
+        }
+        break;
+      case CanvasCommand::kClipRect:
+        if ((valid = has(6) &&
+                     IsEnumValue(commands[offset + 4], kLastClipOp))) {
+          const auto left = read();
+          const auto top = read();
+          const auto right = read();
+          const auto bottom = read();
+          const auto clip_op = static_cast<DlCanvas::ClipOp>(
+              static_cast<int>(commands[offset++]));
+          const bool anti_alias = commands[offset++] != 0.0;
+          builder()->ClipRect(DlRect::MakeLTRB(left, top, right, bottom),
+                              clip_op, anti_alias);
+        }
+        break;
+      case CanvasCommand::kDrawLine:
+        if ((valid = has(5))) {
+          const auto x1 = read();
+          const auto y1 = read();
+          const auto x2 = read();
+          const auto y2 = read();
+          const DlPaint* paint = read_paint(kDrawLineFlags);
+          if ((valid = paint != nullptr)) {
+            builder()->DrawLine(DlPoint(x1, y1), DlPoint(x2, y2), *paint);
+          }
+        }
+        break;
+      case CanvasCommand::kDrawRect:
+      case CanvasCommand::kDrawOval:
+        if ((valid = has(5))) {
+          const auto left = read();
+          const auto top = read();
+          const auto right = read();
+          const auto bottom = read();
+          const auto rect = DlRect::MakeLTRB(left, top, right, bottom);
+          if (command == CanvasCommand::kDrawRect) {
+            const DlPaint* paint = read_paint(kDrawRectFlags);
+            if ((valid = paint != nullptr)) {
+              builder()->DrawRect(rect, *paint);
+            }
+          } else {
+            const DlPaint* paint = read_paint(kDrawOvalFlags);
+            if ((valid = paint != nullptr)) {
+              builder()->DrawOval(rect, *paint);
+            }
+          }
+        }
+        break;
+      case CanvasCommand::kDrawCircle:
+        if ((valid = has(4))) {
+          const auto x = read();
+          const auto y = read();
+          const auto radius = read();
+          const DlPaint* paint = read_paint(kDrawCircleFlags);
+          if ((valid = paint != nullptr)) {
+            builder()->DrawCircle(DlPoint(x, y), radius, *paint);
+          }
+        }
+        break;
+      case CanvasCommand::kDrawRRect:
+        if ((valid = has(13))) {
+          // Same layout and conversion as the Float32List decoded by
+          // DartConverter<RRect>.
+          float values[12];
+          for (float& value : values) {
+            value = static_cast<float>(commands[offset++]);
+          }
+          const auto rect =
+              DlRect::MakeLTRB(values[0], values[1], values[2], values[3]);
+          impeller::RoundingRadii radii = {
+              .top_left = DlSize(values[4], values[5]),
+              .top_right = DlSize(values[6], values[7]),
+              .bottom_left = DlSize(values[10], values[11]),
+              .bottom_right = DlSize(values[8], values[9]),
+          };
+          const DlPaint* paint = read_paint(kDrawRRectFlags);
+          if ((valid = paint != nullptr)) {
+            builder()->DrawRoundRect(
+                DlRoundRect::MakeRectRadii(rect.GetPositive(), radii),
+                *paint);
+          }
+        }
+        break;
+      default:
+        valid = false;
+        break;
+    }
+    if (!valid) {
+      Dart_ThrowException(ToDart("Malformed canvas command stream."));
+      return;
+    }
+  }
+}
+
 void Canvas::drawShadow(const CanvasPath* path,
                         uint32_t color,
                         double elevation,
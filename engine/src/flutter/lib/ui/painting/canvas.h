@@ -51,8 +51,8 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
   void scale(double sx, double sy);
   void rotate(double radians);
   void skew(double sx, double sy);
-  void transform(const tonic::Float64List& matrix4);
-  void getTransform(Dart_Handle matrix4_handle);
+  void transform(const double* matrix4);
+  void getTransform(double* matrix4);
 
   void clipRect(double left,
                 double top,
@@ -62,8 +62,8 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
                 bool doAntiAlias = true);
   void clipRRect(const RRect& rrect, bool doAntiAlias = true);
   void clipPath(const CanvasPath* path, bool doAntiAlias = true);
-  void getDestinationClipBounds(Dart_Handle rect_handle);
-  void getLocalClipBounds(Dart_Handle rect_handle);
+  void getDestinationClipBounds(double* rect);
+  void getLocalClipBounds(double* rect);
 
   void drawColor(uint32_t color, DlBlendMode blend_mode);
 
@@ -179,6 +179,12 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
                         DlBlendMode blend_mode,
                         Dart_Handle cull_rect_handle);
 
+  // Replays a stream of commands encoded by _CanvasCommandBuffer in
+  // painting.dart. The first |length| values of |commands| are decoded and
+  // each paint index in them refers to the paint data at that index in
+  // |paints|.
+  void drawCommands(Dart_Handle commands, int length, Dart_Handle paints);
+
   void drawShadow(const CanvasPath* path,
                   uint32_t color,
                   double elevation,
@@ -0,0 +1,235 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+#include <cstring>
+#include <utility>
+
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr uint64_t kPrime1 = 0x9E3779B97F4A7C15ull;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+
+uint64_t Rotate(uint64_t value, int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+uint64_t Round(uint64_t accumulator, uint64_t input) {
+  return Rotate(accumulator + input * kPrime2, 31) * kPrime1;
+}
+
+uint64_t ReadUint64(const uint8_t* bytes) {
+  uint64_t value;
+  std::memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+DecodedImageCache::Key DecodedImageCache::Key::Make(
+    const ImageDescriptor& descriptor,
+    uint64_t content_hash,
+    uint32_t target_width,
+    uint32_t target_height) {
+  const SkImageInfo& image_info = descriptor.image_info();
+  Key key;
+  key.content_hash = content_hash;
+  key.content = descriptor.data();
+  key.is_compressed = descriptor.is_compressed();
+  key.color_type = image_info.colorType();
+  key.alpha_type = image_info.alphaType();
+  key.width = image_info.width();
+  key.height = image_info.height();
+  key.row_bytes = key.is_compressed ? 0 : descriptor.row_bytes();
+  key.target_width = target_width;
+  key.target_height = target_height;
+  return key;
+}
+
+bool DecodedImageCache::Key::operator==(const Key& other) const {
+  if (content_hash != other.content_hash ||
+      is_compressed != other.is_compressed || color_type != other.color_type ||
+      alpha_type != other.alpha_type || width != other.width ||
+      height != other.height || row_bytes != other.row_bytes ||
+      target_width != other.target_width ||
+      target_height != other.target_height) {
+    return false;
+  }
+  // The hash is not collision resistant, so equal hashes are confirmed by
+  // comparing the buffers. Keys usually share their buffer, for example when
+  // an entry is erased, which skips the comparison.
+  if (content == other.content) {
+    return true;
+  }
+  return content && other.content && content->equals(other.content.get());
+}
+
+size_t DecodedImageCache::Key::Hash::operator()(const Key& key) const {
+  return fml::HashCombine(key.content_hash,
+                          key.content ? key.content->size() : 0,
+                          key.target_width, key.target_height);
+}
+
+double DecodedImageCache::Stats::GetHitRate() const {
+  const size_t total = hit_count + coalesced_count + miss_count;
+  return total == 0 ? 0.0
+                    : static_cast<double>(hit_count + coalesced_count) / total;
+}
+
+DecodedImageCache::DecodedImageCache(size_t budget_bytes)
+    : budget_bytes_(budget_bytes) {}
+
+DecodedImageCache::~DecodedImageCache() = default;
+
+uint64_t DecodedImageCache::HashContents(const SkData& data) {
+  // Four independent lanes over 32 byte stripes keep the multipliers busy, so
+  // that hashing runs close to memory bandwidth.
+  const uint8_t* bytes = data.bytes();
+  const size_t size = data.size();
+  const uint8_t* const end = bytes + size;
+
+  uint64_t lanes[4] = {kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1};
+  while (end - bytes >= 32) {
+    for (int i = 0; i < 4; i++) {
+      lanes[i] = Round(lanes[i], ReadUint64(bytes + i * 8));
+    }
+    bytes += 32;
+  }
+  uint64_t hash = Rotate(lanes[0], 1) + Rotate(lanes[1], 7) +
+                  Rotate(lanes[2], 12) + Rotate(lanes[3], 18);
+  hash += size;
+  while (end - bytes >= 8) {
+    hash = Rotate(hash ^ Round(0, ReadUint64(bytes)), 27) * kPrime1 + kPrime2;
+    bytes += 8;
+  }
+  while (bytes < end) {
+    hash = Rotate(hash ^ (*bytes * kPrime2), 11) * kPrime1;
+    bytes++;
+  }
+
+  // Final avalanche so that every input bit affects every output bit.
+  hash ^= hash >> 33;
+  hash *= kPrime2;
+  hash ^= hash >> 29;
+  hash *= kPrime1;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+sk_sp<DlImage> DecodedImageCache::Lookup(const Key& key) {
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.end(), entries_, found->second);
+  stats_.hit_count++;
+  TraceStatsToTimeline();
+  return found->second->image;
+}
+
+bool DecodedImageCache::AwaitDecode(const Key& key, ImageResult result) {
+  auto& results = pending_[key];
+  const bool is_first = results.empty();
+  results.push_back(std::move(result));
+  if (is_first) {
+    stats_.miss_count++;
+  } else {
+    stats_.coalesced_count++;
+  }
+  TraceStatsToTimeline();
+  return is_first;
+}
+
+void DecodedImageCache::Complete(const Key& key,
+                                 const sk_sp<DlImage>& image,
+                                 const std::string& decode_error) {
+  if (image && index_.find(key) == index_.end()) {
+    const size_t byte_size = image->GetApproximateByteSize();
+    if (byte_size <= budget_bytes_) {
+      while (stats_.resident_bytes + byte_size > budget_bytes_) {
+        EvictOne();
+      }
+      entries_.push_back({key, image, byte_size});
+      index_[key] = std::prev(entries_.end());
+      images_[image.get()] = std::prev(entries_.end());
+      stats_.resident_bytes += byte_size;
+      TraceStatsToTimeline();
+    }
+  }
+
+  auto found = pending_.find(key);
+  if (found != pending_.end()) {
+    // The results may request more decodes, so they are invoked only once the
+    // pending entry is gone.
+    std::vector<ImageResult> results = std::move(found->second);
+    pending_.erase(found);
+    for (const auto& result : results) {
+      result(image, decode_error);
+    }
+  }
+
+  // Nothing keeps the image alive if every result failed to wrap it.
+  auto cached = index_.find(key);
+  if (cached != index_.end() && cached->second->retain_count == 0) {
+    Erase(cached->second);
+  }
+}
+
+void DecodedImageCache::Retain(const DlImage* image) {
+  auto found = images_.find(image);
+  if (found != images_.end()) {
+    found->second->retain_count++;
+  }
+}
+
+void DecodedImageCache::Release(const DlImage* image) {
+  auto found = images_.find(image);
+  if (found != images_.end() && --found->second->retain_count == 0) {
+    Erase(found->second);
+  }
+}
+
+void DecodedImageCache::Purge() {
+  entries_.clear();
+  index_.clear();
+  images_.clear();
+  stats_.resident_bytes = 0;
+  TraceStatsToTimeline();
+}
+
+DecodedImageCache::Stats DecodedImageCache::GetStats() const {
+  return stats_;
+}
+
+void DecodedImageCache::EvictOne() {
+  // Every cached image is held by a CanvasImage, so evicting one stops sharing
+  // it rather than freeing it. The least recently used one goes first.
+  Erase(entries_.begin());
+}
+
+void DecodedImageCache::Erase(std::list<Entry>::iterator entry) {
+  stats_.resident_bytes -= entry->byte_size;
+  index_.erase(entry->key);
+  images_.erase(entry->image.get());
+  entries_.erase(entry);
+  TraceStatsToTimeline();
+}
+
+void DecodedImageCache::TraceStatsToTimeline() const {
+#if !FLUTTER_RELEASE
+  FML_TRACE_COUNTER("flutter", "DecodedImageCache",
+                    reinterpret_cast<int64_t>(this),  //
+                    "HitPercent",
+                    static_cast<int64_t>(stats_.GetHitRate() * 100),  //
+                    "ResidentKBytes", stats_.resident_bytes / 1024);
+#endif  // !FLUTTER_RELEASE
+}
+
+}  // namespace flutter
@@ -0,0 +1,179 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+#define FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/display_list/image/dl_image.h"
+#include "flutter/fml/macros.h"
+#include "flutter/lib/ui/painting/image_descriptor.h"
+#include "third_party/skia/include/core/SkData.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A cache of decoded images keyed by the contents of the buffer
+///             they were decoded from and the size they were decoded at.
+///
+///             A key matches when the hashes of two buffers are equal and
+///             their bytes compare equal too, so a hash collision can't hand
+///             out the image of another buffer.
+///
+///             Requests for an image that is already being decoded wait for
+///             that decode instead of starting another one. A decoded image
+///             is only kept while it is retained by at least one
+///             `CanvasImage`, so the cache shares images that are alive anyway
+///             and never keeps one alive after the application disposed it.
+///             Shared images are additionally limited to a byte budget.
+///
+///             This class must only be accessed on the UI thread.
+///
+class DecodedImageCache {
+ public:
+  /// The default limit on the total size of the shared images.
+  static constexpr size_t kDefaultBudgetBytes = 32 * 1024 * 1024;
+
+  using ImageResult = std::function<void(sk_sp<DlImage>, std::string)>;
+
+  struct Key {
+    uint64_t content_hash = 0;
+    // The buffer the image is decoded from, which keys with equal hashes
+    // compare byte by byte.
+    sk_sp<SkData> content;
+    bool is_compressed = false;
+    SkColorType color_type = kUnknown_SkColorType;
+    SkAlphaType alpha_type = kUnknown_SkAlphaType;
+    int width = 0;
+    int height = 0;
+    int row_bytes = 0;
+    uint32_t target_width = 0;
+    uint32_t target_height = 0;
+
+    //--------------------------------------------------------------------------
+    /// @brief      Creates the key for decoding a descriptor at a target size.
+    ///
+    /// @param[in]  content_hash  The `HashContents` of the descriptor data,
+    ///                           which is computed off the UI thread.
+    ///
+    static Key Make(const ImageDescriptor& descriptor,
+                    uint64_t content_hash,
+                    uint32_t target_width,
+                    uint32_t target_height);
+
+    bool operator==(const Key& other) const;
+
+    struct Hash {
+      size_t operator()(const Key& key) const;
+    };
+  };
+
+  struct Stats {
+    /// Requests served by a cached image.
+    size_t hit_count = 0;
+    /// Requests that waited on a decode started by an identical request.
+    size_t coalesced_count = 0;
+    /// Requests that started a decode.
+    size_t miss_count = 0;
+    /// The total size of the cached images.
+    size_t resident_bytes = 0;
+
+    /// @brief  The fraction of requests served without starting a decode.
+    double GetHitRate() const;
+  };
+
+  explicit DecodedImageCache(size_t budget_bytes = kDefaultBudgetBytes);
+
+  ~DecodedImageCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      A fast, non-cryptographic 64-bit hash of the data. It reads
+  ///             every byte, so it is called on a worker thread. Keys with
+  ///             equal hashes also compare their data.
+  ///
+  static uint64_t HashContents(const SkData& data);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the cached image for the key and mark it as most recently
+  ///             used.
+  ///
+  /// @return     The image, or nullptr if it is not cached.
+  ///
+  sk_sp<DlImage> Lookup(const Key& key);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Register a result to be invoked when the decode for the key
+  ///             completes.
+  ///
+  /// @return     Whether this is the first request for the key, in which case
+  ///             the caller must start the decode and report its outcome to
+  ///             `Complete`.
+  ///
+  bool AwaitDecode(const Key& key, ImageResult result);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Caches the decoded image, if any, and invokes every result
+  ///             waiting on the key. The image is dropped again if none of
+  ///             the results retained it.
+  ///
+  void Complete(const Key& key,
+                const sk_sp<DlImage>& image,
+                const std::string& decode_error);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records that a `CanvasImage` holds the image. Images that
+  ///             are not cached are ignored.
+  ///
+  void Retain(const DlImage* image);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records that a `CanvasImage` let go of the image, and drops
+  ///             the image once no `CanvasImage` holds it anymore.
+  ///
+  void Release(const DlImage* image);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Drops every cached image. Pending decodes are unaffected.
+  ///
+  void Purge();
+
+  Stats GetStats() const;
+
+ private:
+  struct Entry {
+    Key key;
+    sk_sp<DlImage> image;
+    size_t byte_size;
+    // The number of `CanvasImage`s that hold the image.
+    size_t retain_count = 0;
+  };
+
+  const size_t budget_bytes_;
+  // Cached images, least recently used first.
+  std::list<Entry> entries_;
+  std::unordered_map<Key, std::list<Entry>::iterator, Key::Hash> index_;
+  // The cached entries by their image, for `Retain` and `Release`.
+  std::unordered_map<const DlImage*, std::list<Entry>::iterator> images_;
+  std::unordered_map<Key, std::vector<ImageResult>, Key::Hash> pending_;
+  Stats stats_;
+
+  void EvictOne();
+
+  void Erase(std::list<Entry>::iterator entry);
+
+  void TraceStatsToTimeline() const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DecodedImageCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
@@ -0,0 +1,210 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+#include <vector>
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+class FakeDlImage : public DlImage {
+ public:
+  explicit FakeDlImage(size_t byte_size) : byte_size_(byte_size) {}
+
+  sk_sp<SkImage> skia_image() const override { return nullptr; }
+
+  std::shared_ptr<impeller::Texture> impeller_texture() const override {
+    return nullptr;
+  }
+
+  bool isOpaque() const override { return false; }
+
+  bool isTextureBacked() const override { return true; }
+
+  bool isUIThreadSafe() const override { return true; }
+
+  SkISize dimensions() const override { return SkISize::Make(1, 1); }
+
+  size_t GetApproximateByteSize() const override { return byte_size_; }
+
+ private:
+  size_t byte_size_;
+};
+
+DecodedImageCache::Key MakeKey(uint64_t content_hash,
+                               uint32_t target_width = 10,
+                               uint32_t target_height = 10) {
+  DecodedImageCache::Key key;
+  key.content_hash = content_hash;
+  key.content = SkData::MakeWithCopy(&content_hash, sizeof(content_hash));
+  key.is_compressed = true;
+  key.width = 10;
+  key.height = 10;
+  key.target_width = target_width;
+  key.target_height = target_height;
+  return key;
+}
+
+// Completes a decode whose result holds on to the image, like a codec that
+// wraps it in a CanvasImage.
+void CompleteAndRetain(DecodedImageCache& cache,
+                       const DecodedImageCache::Key& key,
+                       const sk_sp<DlImage>& image) {
+  cache.AwaitDecode(key, [&cache](sk_sp<DlImage> image, const std::string&) {
+    cache.Retain(image.get());
+  });
+  cache.Complete(key, image, {});
+}
+
+}  // namespace
+
+TEST(DecodedImageCacheTest, HashesContents) {
+  std::vector<uint8_t> bytes(1000);
+  for (size_t i = 0; i < bytes.size(); i++) {
+    bytes[i] = i * 7;
+  }
+  auto data = SkData::MakeWithCopy(bytes.data(), bytes.size());
+  auto same_data = SkData::MakeWithCopy(bytes.data(), bytes.size());
+  EXPECT_EQ(DecodedImageCache::HashContents(*data),
+            DecodedImageCache::HashContents(*same_data));
+
+  // A single bit flip anywhere, including the unaligned tail, changes the
+  // hash.
+  for (size_t index : {size_t{0}, size_t{500}, bytes.size() - 1}) {
+    auto changed_bytes = bytes;
+    changed_bytes[index] ^= 1;
+    auto changed_data =
+        SkData::MakeWithCopy(changed_bytes.data(), changed_bytes.size());
+    EXPECT_NE(DecodedImageCache::HashContents(*data),
+              DecodedImageCache::HashContents(*changed_data));
+  }
+
+  auto prefix = SkData::MakeSubset(data.get(), 0, bytes.size() - 1);
+  EXPECT_NE(DecodedImageCache::HashContents(*data),
+            DecodedImageCache::HashContents(*prefix));
+}
+
+TEST(DecodedImageCacheTest, CoalescesPendingDecodesAndCachesResult) {
+  DecodedImageCache cache;
+  const auto key = MakeKey(1);
+  EXPECT_EQ(cache.Lookup(key), nullptr);
+
+  std::vector<sk_sp<DlImage>> results;
+  auto result = [&cache, &results](sk_sp<DlImage> image,
+                                   const std::string& error) {
+    EXPECT_TRUE(error.empty());
+    cache.Retain(image.get());
+    results.push_back(std::move(image));
+  };
+  EXPECT_TRUE(cache.AwaitDecode(key, result));
+  EXPECT_FALSE(cache.AwaitDecode(key, result));
+  // A different target size needs its own decode.
+  EXPECT_TRUE(cache.AwaitDecode(MakeKey(1, 5, 5), [](auto, auto) {}));
+
+  auto image = sk_make_sp<FakeDlImage>(100);
+  cache.Complete(key, image, {});
+  ASSERT_EQ(results.size(), 2u);
+  EXPECT_EQ(results[0], image);
+  EXPECT_EQ(results[1], image);
+
+  EXPECT_EQ(cache.Lookup(key), image);
+  EXPECT_EQ(cache.Lookup(MakeKey(1, 5, 5)), nullptr);
+
+  const auto stats = cache.GetStats();
+  EXPECT_EQ(stats.hit_count, 1u);
+  EXPECT_EQ(stats.coalesced_count, 1u);
+  EXPECT_EQ(stats.miss_count, 2u);
+  EXPECT_EQ(stats.resident_bytes, 100u);
+  EXPECT_DOUBLE_EQ(stats.GetHitRate(), 0.5);
+}
+
+TEST(DecodedImageCacheTest, ComparesContentsOfKeysWithEqualHashes) {
+  DecodedImageCache cache;
+  const auto key = MakeKey(1);
+  auto image = sk_make_sp<FakeDlImage>(100);
+  CompleteAndRetain(cache, key, image);
+
+  // A buffer with the same bytes is a hit.
+  auto same_key = MakeKey(1);
+  same_key.content = SkData::MakeWithCopy(key.content->data(),
+                                          key.content->size());
+  EXPECT_EQ(cache.Lookup(same_key), image);
+
+  // A buffer of the same size whose hash collides is a miss.
+  const uint64_t other_content = 2;
+  auto colliding_key = MakeKey(1);
+  colliding_key.content =
+      SkData::MakeWithCopy(&other_content, sizeof(other_content));
+  EXPECT_EQ(cache.Lookup(colliding_key), nullptr);
+}
+
+TEST(DecodedImageCacheTest, DoesNotCacheFailedDecodes) {
+  DecodedImageCache cache;
+  const auto key = MakeKey(1);
+
+  std::string decode_error;
+  EXPECT_TRUE(cache.AwaitDecode(
+      key, [&decode_error](auto image, const std::string& error) {
+        EXPECT_EQ(image, nullptr);
+        decode_error = error;
+      }));
+  cache.Complete(key, nullptr, "Failed");
+  EXPECT_EQ(decode_error, "Failed");
+
+  EXPECT_EQ(cache.Lookup(key), nullptr);
+  EXPECT_TRUE(cache.AwaitDecode(key, [](auto, auto) {}));
+}
+
+TEST(DecodedImageCacheTest, DropsImagesNoLongerHeld) {
+  DecodedImageCache cache;
+  auto image = sk_make_sp<FakeDlImage>(100);
+
+  // No result wrapped the image, so it is not kept.
+  EXPECT_TRUE(cache.AwaitDecode(MakeKey(1), [](auto, auto) {}));
+  cache.Complete(MakeKey(1), image, {});
+  EXPECT_EQ(cache.Lookup(MakeKey(1)), nullptr);
+  EXPECT_EQ(cache.GetStats().resident_bytes, 0u);
+
+  CompleteAndRetain(cache, MakeKey(2), image);
+  cache.Retain(image.get());
+  cache.Release(image.get());
+  EXPECT_EQ(cache.Lookup(MakeKey(2)), image);
+  EXPECT_EQ(cache.GetStats().resident_bytes, 100u);
+
+  // Disposing the last holder drops the image.
+  cache.Release(image.get());
+  EXPECT_EQ(cache.Lookup(MakeKey(2)), nullptr);
+  EXPECT_EQ(cache.GetStats().resident_bytes, 0u);
+}
+
+TEST(DecodedImageCacheTest, EvictsLeastRecentlyUsedImages) {
+  DecodedImageCache cache(/*budget_bytes=*/250);
+  auto first_image = sk_make_sp<FakeDlImage>(100);
+  CompleteAndRetain(cache, MakeKey(1), first_image);
+  CompleteAndRetain(cache, MakeKey(2), sk_make_sp<FakeDlImage>(100));
+
+  // The first image was used more recently, so the second one is evicted.
+  EXPECT_EQ(cache.Lookup(MakeKey(1)), first_image);
+  CompleteAndRetain(cache, MakeKey(3), sk_make_sp<FakeDlImage>(100));
+  EXPECT_EQ(cache.Lookup(MakeKey(1)), first_image);
+  EXPECT_EQ(cache.Lookup(MakeKey(2)), nullptr);
+  EXPECT_NE(cache.Lookup(MakeKey(3)), nullptr);
+  EXPECT_EQ(cache.GetStats().resident_bytes, 200u);
+
+  // Images larger than the budget are not cached.
+  CompleteAndRetain(cache, MakeKey(4), sk_make_sp<FakeDlImage>(300));
+  EXPECT_EQ(cache.Lookup(MakeKey(4)), nullptr);
+
+  cache.Purge();
+  EXPECT_EQ(cache.Lookup(MakeKey(1)), nullptr);
+  EXPECT_EQ(cache.GetStats().resident_bytes, 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
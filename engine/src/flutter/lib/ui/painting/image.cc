@@ -28,7 +28,9 @@ const tonic::DartWrapperInfo& Image::dart_wrapper_info_ =
 
 CanvasImage::CanvasImage() = default;
 
-CanvasImage::~CanvasImage() = default;
+CanvasImage::~CanvasImage() {
+  InvokeReleaseCallback();
+}
 
 Dart_Handle CanvasImage::CreateOuterWrapping() {
   Dart_Handle ui_lib = Dart_LookupLibrary(tonic::ToDart("dart:ui"));
@@ -41,9 +43,18 @@ Dart_Handle CanvasImage::toByteData(int format, Dart_Handle callback) {
 
 void CanvasImage::dispose() {
   image_.reset();
+  InvokeReleaseCallback();
   ClearDartWrapper();
 }
 
+void CanvasImage::InvokeReleaseCallback() {
+  if (release_callback_) {
+    fml::closure callback = std::move(release_callback_);
+    release_callback_ = nullptr;
+    callback();
+  }
+}
+
 int CanvasImage::colorSpace() {
   if (image_->skia_image()) {
     return ColorSpace::kSRGB;
@@ -6,6 +6,7 @@
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_H_
 
 #include "flutter/display_list/image/dl_image.h"
+#include "flutter/fml/closure.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/skia/include/core/SkImage.h"
@@ -44,6 +45,13 @@ class CanvasImage final : public RefCountedDartWrappable<CanvasImage> {
   void set_image(const sk_sp<DlImage>& image) {
     FML_DCHECK(image->isUIThreadSafe());
     image_ = image;
+    image->AccountForImageMemory();
+  }
+
+  // Sets a callback that is invoked once this wrapper lets go of its image,
+  // when it is disposed or collected.
+  void set_release_callback(fml::closure callback) {
+    release_callback_ = std::move(callback);
   }
 
   int colorSpace();
@@ -51,7 +59,10 @@ class CanvasImage final : public RefCountedDartWrappable<CanvasImage> {
  private:
   CanvasImage();
 
+  void InvokeReleaseCallback();
+
   sk_sp<DlImage> image_;
+  fml::closure release_callback_;
 };
 
 }  // namespace flutter
@@ -4,6 +4,8 @@
 
 #include "flutter/lib/ui/painting/image_decoder.h"
 
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/painting/image_decoder_skia.h"
 
 #if IMPELLER_SUPPORTS_RENDERING
@@ -47,6 +49,7 @@ ImageDecoder::ImageDecoder(
     : runners_(runners),
       concurrent_task_runner_(std::move(concurrent_task_runner)),
       io_manager_(std::move(io_manager)),
+      decoded_image_cache_(std::make_shared<DecodedImageCache>()),
       weak_factory_(this) {
   FML_DCHECK(runners_.IsValid());
   FML_DCHECK(runners_.GetUITaskRunner()->RunsTasksOnCurrentThread())
@@ -55,6 +58,78 @@ ImageDecoder::ImageDecoder(
 
 ImageDecoder::~ImageDecoder() = default;
 
+void ImageDecoder::DecodeWithCache(fml::RefPtr<ImageDescriptor> descriptor,
+                                   uint32_t target_width,
+                                   uint32_t target_height,
+                                   const ImageResult& result) {
+  TRACE_EVENT0("flutter", "ImageDecoder::DecodeWithCache");
+  sk_sp<SkData> data = descriptor->data();
+  if (!data || data->isEmpty()) {
+    Decode(std::move(descriptor), target_width, target_height, result);
+    return;
+  }
+
+  // Hashing reads the whole buffer, which can take milliseconds for large
+  // images, so it happens on a worker before the cache is consulted back on
+  // the UI thread.
+  concurrent_task_runner_->PostTask(fml::MakeCopyable(
+      [decoder = GetWeakPtr(),                     //
+       ui_runner = runners_.GetUITaskRunner(),     //
+       descriptor = std::move(descriptor),         //
+       data = std::move(data),                     //
+       target_width, target_height, result]() mutable {
+        TRACE_EVENT0("flutter", "DecodedImageCache::HashContents");
+        const uint64_t content_hash = DecodedImageCache::HashContents(*data);
+        ui_runner->PostTask(fml::MakeCopyable(
+            [decoder, descriptor = std::move(descriptor), content_hash,
+             target_width, target_height, result]() mutable {
+              if (!decoder) {
+                result(nullptr, "The image decoder was collected.");
+                return;
+              }
+              auto key = DecodedImageCache::Key::Make(
+                  *descriptor, content_hash, target_width, target_height);
+              decoder->DecodeWithKey(std::move(descriptor), key, result);
+            }));
+      }));
+}
+
+void ImageDecoder::DecodeWithKey(fml::RefPtr<ImageDescriptor> descriptor,
+                                 const DecodedImageCache::Key& key,
+                                 const ImageResult& result) {
+  if (auto image = decoded_image_cache_->Lookup(key)) {
+    result(std::move(image), {});
+    return;
+  }
+
+  if (!decoded_image_cache_->AwaitDecode(key, result)) {
+    // An identical decode is already in flight.
+    return;
+  }
+
+  Decode(std::move(descriptor), key.target_width, key.target_height,
+         [cache = decoded_image_cache_, key](sk_sp<DlImage> image,
+                                             std::string decode_error) {
+           cache->Complete(key, image, decode_error);
+         });
+}
+
+void ImageDecoder::PurgeDecodedImageCache() {
+  decoded_image_cache_->Purge();
+}
+
+void ImageDecoder::RetainDecodedImage(const DlImage* image) {
+  decoded_image_cache_->Retain(image);
+}
+
+void ImageDecoder::ReleaseDecodedImage(const DlImage* image) {
+  decoded_image_cache_->Release(image);
+}
+
+DecodedImageCache::Stats ImageDecoder::GetDecodedImageCacheStats() const {
+  return decoded_image_cache_->GetStats();
+}
+
 fml::WeakPtr<ImageDecoder> ImageDecoder::GetWeakPtr() const {
   return weak_factory_.GetWeakPtr();
 }
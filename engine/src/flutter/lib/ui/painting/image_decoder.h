@@ -12,6 +12,7 @@
 #include "flutter/display_list/image/dl_image.h"
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/lib/ui/io_manager.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "flutter/lib/ui/painting/image_descriptor.h"
 
 namespace flutter {
@@ -44,6 +45,25 @@ class ImageDecoder {
                       uint32_t target_height,
                       const ImageResult& result) = 0;
 
+  // Like |Decode|, but reuses images previously decoded from identical data at
+  // the same target size, and coalesces identical decodes that are in flight.
+  // The data is hashed on a worker thread, so the result is always invoked
+  // after this call returns.
+  void DecodeWithCache(fml::RefPtr<ImageDescriptor> descriptor,
+                       uint32_t target_width,
+                       uint32_t target_height,
+                       const ImageResult& result);
+
+  // Drops the decoded images retained for reuse by |DecodeWithCache|.
+  void PurgeDecodedImageCache();
+
+  // Records that a CanvasImage holds or let go of an image returned by
+  // |DecodeWithCache|. Images are only shared while they are held.
+  void RetainDecodedImage(const DlImage* image);
+  void ReleaseDecodedImage(const DlImage* image);
+
+  DecodedImageCache::Stats GetDecodedImageCacheStats() const;
+
   fml::WeakPtr<ImageDecoder> GetWeakPtr() const;
 
  protected:
@@ -57,6 +77,12 @@ class ImageDecoder {
       fml::WeakPtr<IOManager> io_manager);
 
  private:
+  void DecodeWithKey(fml::RefPtr<ImageDescriptor> descriptor,
+                     const DecodedImageCache::Key& key,
+                     const ImageResult& result);
+
+  // Shared with the decode callbacks, which may outlive the decoder.
+  std::shared_ptr<DecodedImageCache> decoded_image_cache_;
   fml::WeakPtrFactory<ImageDecoder> weak_factory_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoder);
@@ -4,7 +4,15 @@
 
 #include "flutter/lib/ui/painting/image_decoder_impeller.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <string_view>
+#include <tuple>
+#include <vector>
 
 #include "flutter/fml/closure.h"
 #include "flutter/fml/make_copyable.h"
@@ -14,11 +22,25 @@
 #include "flutter/impeller/renderer/command_buffer.h"
 #include "flutter/impeller/renderer/context.h"
 #include "impeller/base/strings.h"
+#include "impeller/core/buffer_view.h"
 #include "impeller/core/device_buffer.h"
 #include "impeller/core/formats.h"
+#include "impeller/core/platform.h"
+#include "impeller/core/sampler_descriptor.h"
 #include "impeller/core/texture_descriptor.h"
+#include "impeller/core/vertex_buffer.h"
 #include "impeller/display_list/skia_conversions.h"
+#include "impeller/entity/contents/filters/yuv_to_rgb_filter_contents.h"
+#include "impeller/entity/filter_position.vert.h"
+#include "impeller/entity/texture_fill.frag.h"
+#include "impeller/entity/texture_fill.vert.h"
+#include "impeller/entity/yuv_to_rgb_filter.frag.h"
 #include "impeller/geometry/size.h"
+#include "impeller/renderer/pipeline_builder.h"
+#include "impeller/renderer/pipeline_library.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/render_target.h"
+#include "impeller/renderer/sampler_library.h"
 #include "third_party/skia/include/core/SkAlphaType.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
@@ -29,6 +51,8 @@
 #include "third_party/skia/include/core/SkPixmap.h"
 #include "third_party/skia/include/core/SkPoint.h"
 #include "third_party/skia/include/core/SkSize.h"
+#include "third_party/skia/include/core/SkYUVAInfo.h"
+#include "third_party/skia/include/core/SkYUVAPixmaps.h"
 
 namespace flutter {
 
@@ -74,6 +98,314 @@ bool IsWideGamut(const SkColorSpace* color_space) {
   float area = CalculateArea(rgb);
   return area > kSrgbGamutArea;
 }
+
+/**
+ *  Runs the upload immediately if the GPU is available, or defers it until GPU
+ *  access is regained otherwise.
+ */
+void UploadWhenGPUAvailable(
+    ImageDecoder::ImageResult result,
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch,
+    const std::function<std::pair<sk_sp<DlImage>, std::string>()>& upload) {
+  gpu_disabled_switch->Execute(
+      fml::SyncSwitch::Handlers()
+          .SetIfFalse([&result, &upload] {
+            sk_sp<DlImage> image;
+            std::string decode_error;
+            std::tie(image, decode_error) = upload();
+            result(image, decode_error);
+          })
+          .SetIfTrue([&result, &upload, context] {
+            auto result_ptr =
+                std::make_shared<ImageDecoder::ImageResult>(std::move(result));
+            context->StoreTaskForGPU(
+                [result_ptr, upload]() {
+                  sk_sp<DlImage> image;
+                  std::string decode_error;
+                  std::tie(image, decode_error) = upload();
+                  (*result_ptr)(image, decode_error);
+                },
+                [result_ptr]() {
+                  (*result_ptr)(
+                      nullptr,
+                      "Image upload failed due to loss of GPU access.");
+                });
+          }));
+}
+
+impeller::PixelFormat ToPixelFormat(ImageGenerator::CompressedFormat format) {
+  switch (format) {
+    case ImageGenerator::CompressedFormat::kBC1RGBA:
+      return impeller::PixelFormat::kBC1RGBAUNorm;
+    case ImageGenerator::CompressedFormat::kBC3RGBA:
+      return impeller::PixelFormat::kBC3RGBAUNorm;
+    case ImageGenerator::CompressedFormat::kBC7RGBA:
+      return impeller::PixelFormat::kBC7RGBAUNorm;
+    case ImageGenerator::CompressedFormat::kETC2RGB8:
+      return impeller::PixelFormat::kETC2R8G8B8UNorm;
+    case ImageGenerator::CompressedFormat::kETC2RGBA8:
+      return impeller::PixelFormat::kETC2R8G8B8A8UNorm;
+    case ImageGenerator::CompressedFormat::kASTC4x4RGBA:
+      return impeller::PixelFormat::kASTC4x4UNorm;
+  }
+  FML_UNREACHABLE();
+}
+
+impeller::ISize MipLevelSize(impeller::ISize base_size, size_t level) {
+  return {std::max<int64_t>(1, base_size.width >> level),
+          std::max<int64_t>(1, base_size.height >> level)};
+}
+
+std::optional<impeller::YUVColorSpace> ToYUVColorSpace(
+    SkYUVColorSpace color_space) {
+  switch (color_space) {
+    case kJPEG_Full_SkYUVColorSpace:
+      return impeller::YUVColorSpace::kBT601FullRange;
+    case kRec601_Limited_SkYUVColorSpace:
+      return impeller::YUVColorSpace::kBT601LimitedRange;
+    default:
+      return std::nullopt;
+  }
+}
+
+bool IsSupportedPlaneConfig(SkYUVAInfo::PlaneConfig plane_config) {
+  switch (plane_config) {
+    case SkYUVAInfo::PlaneConfig::kY_U_V:
+    case SkYUVAInfo::PlaneConfig::kY_V_U:
+    case SkYUVAInfo::PlaneConfig::kY_UV:
+    case SkYUVAInfo::PlaneConfig::kY_VU:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ *  Copies the rows of a plane into a tightly packed destination.
+ */
+void CopyPlane(const SkPixmap& plane, size_t row_size, uint8_t* destination) {
+  for (int y = 0; y < plane.height(); y++) {
+    std::memcpy(destination + y * row_size, plane.addr(0, y), row_size);
+  }
+}
+
+/**
+ *  Packs the chroma planes into a single plane with interleaved U and V
+ *  samples, which is what the YUV to RGB conversion samples from.
+ */
+void PackUVPlane(const SkYUVAPixmaps& planes, uint8_t* destination) {
+  const SkYUVAInfo::PlaneConfig plane_config =
+      planes.yuvaInfo().planeConfig();
+  const SkPixmap& chroma = planes.plane(1);
+  if (plane_config == SkYUVAInfo::PlaneConfig::kY_UV) {
+    CopyPlane(chroma, chroma.width() * 2, destination);
+    return;
+  }
+  for (int y = 0; y < chroma.height(); y++) {
+    const auto* first = static_cast<const uint8_t*>(chroma.addr(0, y));
+    if (plane_config == SkYUVAInfo::PlaneConfig::kY_VU) {
+      for (int x = 0; x < chroma.width(); x++) {
+        *destination++ = first[2 * x + 1];
+        *destination++ = first[2 * x];
+      }
+      continue;
+    }
+    const auto* second =
+        static_cast<const uint8_t*>(planes.plane(2).addr(0, y));
+    const uint8_t* u = plane_config == SkYUVAInfo::PlaneConfig::kY_U_V
+                           ? first
+                           : second;
+    const uint8_t* v = u == first ? second : first;
+    for (int x = 0; x < chroma.width(); x++) {
+      *destination++ = u[x];
+      *destination++ = v[x];
+    }
+  }
+}
+
+std::shared_ptr<impeller::Texture> CreatePlaneTexture(
+    const impeller::Context& context,
+    impeller::PixelFormat format,
+    impeller::ISize size,
+    bool mipmapped) {
+  impeller::TextureDescriptor texture_descriptor;
+  texture_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  texture_descriptor.format = format;
+  texture_descriptor.size = size;
+  texture_descriptor.mip_count = mipmapped ? size.MipCount() : 1u;
+  return context.GetResourceAllocator()->CreateTexture(texture_descriptor);
+}
+
+/**
+ *  Gets a pipeline that draws into a single sampled texture with the given
+ *  color attachment. The pipeline library caches the pipeline after the first
+ *  image.
+ */
+template <class VertexShader, class FragmentShader>
+std::shared_ptr<impeller::Pipeline<impeller::PipelineDescriptor>>
+GetDecodePipeline(const impeller::Context& context,
+                  std::string_view label,
+                  const impeller::ColorAttachmentDescriptor& color0) {
+  using PipelineBuilder =
+      impeller::PipelineBuilder<VertexShader, FragmentShader>;
+  auto descriptor = PipelineBuilder::MakeDefaultPipelineDescriptor(context);
+  if (!descriptor.has_value()) {
+    return nullptr;
+  }
+  descriptor->SetLabel(label);
+  descriptor->SetSampleCount(impeller::SampleCount::kCount1);
+  descriptor->SetPrimitiveType(impeller::PrimitiveType::kTriangleStrip);
+  descriptor->ClearDepthAttachment();
+  descriptor->ClearStencilAttachments();
+  descriptor->SetColorAttachmentDescriptor(0u, color0);
+  return context.GetPipelineLibrary()->GetPipeline(descriptor).Get();
+}
+
+/**
+ *  Gets the pipeline that converts YUV planes to RGB.
+ */
+std::shared_ptr<impeller::Pipeline<impeller::PipelineDescriptor>>
+GetYUVToRGBPipeline(const impeller::Context& context,
+                    impeller::PixelFormat format) {
+  impeller::ColorAttachmentDescriptor color0;
+  color0.format = format;
+  color0.blending_enabled = false;
+  return GetDecodePipeline<impeller::FilterPositionVertexShader,
+                           impeller::YuvToRgbFilterFragmentShader>(
+      context, "YUV To RGB Decode Pipeline", color0);
+}
+
+/**
+ *  Gets the pipeline that premultiplies straight alpha texels. The blend
+ *  state multiplies the color by the alpha of the sampled texel and discards
+ *  the destination, so no dedicated shader is needed.
+ */
+std::shared_ptr<impeller::Pipeline<impeller::PipelineDescriptor>>
+GetPremultiplyPipeline(const impeller::Context& context,
+                       impeller::PixelFormat format) {
+  impeller::ColorAttachmentDescriptor color0;
+  color0.format = format;
+  color0.blending_enabled = true;
+  color0.src_color_blend_factor = impeller::BlendFactor::kSourceAlpha;
+  color0.dst_color_blend_factor = impeller::BlendFactor::kZero;
+  color0.src_alpha_blend_factor = impeller::BlendFactor::kOne;
+  color0.dst_alpha_blend_factor = impeller::BlendFactor::kZero;
+  return GetDecodePipeline<impeller::TextureFillVertexShader,
+                           impeller::TextureFillFragmentShader>(
+      context, "Premultiply Decode Pipeline", color0);
+}
+
+/**
+ *  Records a draw of the straight alpha `source` texture into a new RGBA
+ *  texture of the same size with premultiplied alpha, followed by mipmap
+ *  generation.
+ *
+ *  Returns the premultiplied texture, or nullptr if the commands could not be
+ *  recorded.
+ */
+std::shared_ptr<impeller::Texture> EncodePremultiply(
+    const impeller::Context& context,
+    impeller::CommandBuffer& command_buffer,
+    const std::shared_ptr<impeller::Texture>& source) {
+  using VS = impeller::TextureFillVertexShader;
+  using FS = impeller::TextureFillFragmentShader;
+
+  impeller::TextureDescriptor texture_descriptor;
+  texture_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  texture_descriptor.format =
+      context.GetCapabilities()->GetDefaultColorFormat();
+  texture_descriptor.size = source->GetSize();
+  texture_descriptor.mip_count = texture_descriptor.size.MipCount();
+  texture_descriptor.usage = impeller::TextureUsage::kRenderTarget |
+                             impeller::TextureUsage::kShaderRead;
+  auto dest_texture =
+      context.GetResourceAllocator()->CreateTexture(texture_descriptor);
+  auto pipeline = GetPremultiplyPipeline(context, texture_descriptor.format);
+  if (!dest_texture || !pipeline) {
+    return nullptr;
+  }
+
+  impeller::ColorAttachment color0;
+  color0.texture = dest_texture;
+  color0.load_action = impeller::LoadAction::kDontCare;
+  color0.store_action = impeller::StoreAction::kStore;
+  impeller::RenderTarget render_target;
+  render_target.SetColorAttachment(color0, 0u);
+  auto render_pass = command_buffer.CreateRenderPass(render_target);
+  if (!render_pass || !render_pass->IsValid()) {
+    return nullptr;
+  }
+  render_pass->SetLabel("Premultiply Render Pass");
+
+  // The quad and the uniforms share a single small buffer.
+  const std::array<VS::PerVertexData, 4> vertices = {
+      VS::PerVertexData{impeller::Point(0, 0), impeller::Point(0, 0)},
+      VS::PerVertexData{impeller::Point(1, 0), impeller::Point(1, 0)},
+      VS::PerVertexData{impeller::Point(0, 1), impeller::Point(0, 1)},
+      VS::PerVertexData{impeller::Point(1, 1), impeller::Point(1, 1)},
+  };
+  VS::FrameInfo frame_info;
+  frame_info.mvp =
+      render_pass->GetOrthographicTransform() *
+      impeller::Matrix::MakeScale(impeller::Vector2(texture_descriptor.size));
+  frame_info.texture_sampler_y_coord_scale = source->GetYCoordScale();
+  FS::FragInfo frag_info;
+  frag_info.alpha = 1.0;
+
+  auto align = [](size_t offset) {
+    const size_t alignment = impeller::DefaultUniformAlignment();
+    return (offset + alignment - 1) / alignment * alignment;
+  };
+  const size_t frame_info_offset = align(sizeof(vertices));
+  const size_t frag_info_offset = align(frame_info_offset + sizeof(frame_info));
+  std::vector<uint8_t> draw_data(frag_info_offset + sizeof(frag_info));
+  std::memcpy(draw_data.data(), vertices.data(), sizeof(vertices));
+  std::memcpy(draw_data.data() + frame_info_offset, &frame_info,
+              sizeof(frame_info));
+  std::memcpy(draw_data.data() + frag_info_offset, &frag_info,
+              sizeof(frag_info));
+  auto draw_buffer = context.GetResourceAllocator()->CreateBufferWithCopy(
+      draw_data.data(), draw_data.size());
+  if (!draw_buffer) {
+    return nullptr;
+  }
+
+  // Texels map one to one onto pixels, so they are not filtered.
+  auto sampler = context.GetSamplerLibrary()->GetSampler({});
+
+  render_pass->SetCommandLabel("Premultiply");
+  render_pass->SetPipeline(pipeline);
+  render_pass->SetVertexBuffer(impeller::VertexBuffer{
+      .vertex_buffer = impeller::BufferView(
+          draw_buffer, impeller::Range(0, sizeof(vertices))),
+      .vertex_count = vertices.size(),
+      .index_type = impeller::IndexType::kNone,
+  });
+  VS::BindFrameInfo(*render_pass,
+                    impeller::BufferView(draw_buffer,
+                                         impeller::Range(frame_info_offset,
+                                                         sizeof(frame_info))));
+  FS::BindFragInfo(*render_pass,
+                   impeller::BufferView(draw_buffer,
+                                        impeller::Range(frag_info_offset,
+                                                        sizeof(frag_info))));
+  FS::BindTextureSampler(*render_pass, source, sampler);
+  if (!render_pass->Draw().ok() || !render_pass->EncodeCommands()) {
+    return nullptr;
+  }
+
+  if (texture_descriptor.mip_count > 1) {
+    auto mipmap_pass = command_buffer.CreateBlitPass();
+    if (!mipmap_pass) {
+      return nullptr;
+    }
+    mipmap_pass->SetLabel("Mipmap Blit Pass");
+    mipmap_pass->GenerateMipmap(dest_texture);
+    mipmap_pass->EncodeCommands(context.GetResourceAllocator());
+  }
+  return dest_texture;
+}
 }  // namespace
 
 ImageDecoderImpeller::ImageDecoderImpeller(
@@ -84,7 +416,8 @@ ImageDecoderImpeller::ImageDecoderImpeller(
     const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch)
     : ImageDecoder(runners, std::move(concurrent_task_runner), io_manager),
       supports_wide_gamut_(supports_wide_gamut),
-      gpu_disabled_switch_(gpu_disabled_switch) {
+      gpu_disabled_switch_(gpu_disabled_switch),
+      staging_buffer_pool_(std::make_shared<StagingBufferPool>()) {
   std::promise<std::shared_ptr<impeller::Context>> context_promise;
   context_ = context_promise.get_future();
   runners_.GetIOTaskRunner()->PostTask(fml::MakeCopyable(
@@ -115,7 +448,8 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
     impeller::ISize max_texture_size,
     bool supports_wide_gamut,
     const std::shared_ptr<const impeller::Capabilities>& capabilities,
-    const std::shared_ptr<impeller::Allocator>& allocator) {
+    const std::shared_ptr<impeller::Allocator>& allocator,
+    const std::shared_ptr<StagingBufferPool>& staging_buffer_pool) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   if (!descriptor) {
     std::string decode_error("Invalid descriptor (should never happen)");
@@ -175,7 +509,8 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
 
   auto bitmap = std::make_shared<SkBitmap>();
   bitmap->setInfo(image_info);
-  auto bitmap_allocator = std::make_shared<ImpellerAllocator>(allocator);
+  auto bitmap_allocator =
+      std::make_shared<ImpellerAllocator>(allocator, staging_buffer_pool);
 
   if (descriptor->is_compressed()) {
     if (!bitmap->tryAllocPixels(bitmap_allocator.get())) {
@@ -210,7 +545,8 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
   // If the image is unpremultiplied, fix it.
   if (alpha_type == SkAlphaType::kUnpremul_SkAlphaType) {
     // Single copy of ImpellerAllocator crashes.
-    auto premul_allocator = std::make_shared<ImpellerAllocator>(allocator);
+    auto premul_allocator =
+        std::make_shared<ImpellerAllocator>(allocator, staging_buffer_pool);
     auto premul_bitmap = std::make_shared<SkBitmap>();
     premul_bitmap->setInfo(bitmap->info().makeAlphaType(kPremul_SkAlphaType));
     if (!premul_bitmap->tryAllocPixels(premul_allocator.get())) {
@@ -249,7 +585,8 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
     const auto scaled_image_info = image_info.makeDimensions(target_size);
 
     auto scaled_bitmap = std::make_shared<SkBitmap>();
-    auto scaled_allocator = std::make_shared<ImpellerAllocator>(allocator);
+    auto scaled_allocator =
+        std::make_shared<ImpellerAllocator>(allocator, staging_buffer_pool);
     scaled_bitmap->setInfo(scaled_image_info);
     if (!scaled_bitmap->tryAllocPixels(scaled_allocator.get())) {
       std::string decode_error(
@@ -339,8 +676,11 @@ ImageDecoderImpeller::UnsafeUploadTextureToPrivate(
     return std::make_pair(nullptr, decode_error);
   }
   blit_pass->SetLabel("Mipmap Blit Pass");
-  blit_pass->AddCopy(impeller::DeviceBuffer::AsBufferView(buffer),
-                     dest_texture);
+  // Pooled staging buffers may be larger than the image.
+  blit_pass->AddCopy(
+      impeller::BufferView(buffer,
+                           impeller::Range(0, image_info.computeMinByteSize())),
+      dest_texture);
   if (texture_descriptor.mip_count > 1) {
     blit_pass->GenerateMipmap(dest_texture);
   }
@@ -416,32 +756,495 @@ void ImageDecoderImpeller::UploadTextureToPrivate(
     return;
   }
 
-  gpu_disabled_switch->Execute(
-      fml::SyncSwitch::Handlers()
-          .SetIfFalse([&result, context, buffer, image_info, resize_info] {
-            sk_sp<DlImage> image;
-            std::string decode_error;
-            std::tie(image, decode_error) = std::tie(image, decode_error) =
-                UnsafeUploadTextureToPrivate(context, buffer, image_info,
-                                             resize_info);
-            result(image, decode_error);
-          })
-          .SetIfTrue([&result, context, buffer, image_info, resize_info] {
-            auto result_ptr = std::make_shared<ImageResult>(std::move(result));
-            context->StoreTaskForGPU(
-                [result_ptr, context, buffer, image_info, resize_info]() {
-                  sk_sp<DlImage> image;
-                  std::string decode_error;
-                  std::tie(image, decode_error) = UnsafeUploadTextureToPrivate(
-                      context, buffer, image_info, resize_info);
-                  (*result_ptr)(image, decode_error);
-                },
-                [result_ptr]() {
-                  (*result_ptr)(
-                      nullptr,
-                      "Image upload failed due to loss of GPU access.");
-                });
-          }));
+  UploadWhenGPUAvailable(std::move(result), context, gpu_disabled_switch,
+                         [context, buffer, image_info, resize_info]() {
+                           return UnsafeUploadTextureToPrivate(
+                               context, buffer, image_info, resize_info);
+                         });
+}
+
+std::optional<CompressedTexture> ImageDecoderImpeller::PrepareCompressedTexture(
+    ImageDescriptor* descriptor,
+    SkISize target_size,
+    impeller::ISize max_texture_size,
+    const std::shared_ptr<const impeller::Capabilities>& capabilities,
+    const std::shared_ptr<impeller::Allocator>& allocator) {
+  if (!descriptor) {
+    return std::nullopt;
+  }
+  auto compressed_data = descriptor->get_compressed_data();
+  if (!compressed_data.has_value() || compressed_data->mip_levels.empty()) {
+    return std::nullopt;
+  }
+  const auto pixel_format = ToPixelFormat(compressed_data->format);
+  if (!capabilities->SupportsCompressedPixelFormat(pixel_format)) {
+    return std::nullopt;
+  }
+  // Compressed textures cannot be resized on the GPU, so one of the mip levels
+  // has to match the target size exactly.
+  const impeller::ISize base_size(descriptor->image_info().width(),
+                                  descriptor->image_info().height());
+  const impeller::ISize target(target_size.width(), target_size.height());
+  std::optional<size_t> first_level;
+  for (size_t level = 0; level < compressed_data->mip_levels.size(); level++) {
+    if (MipLevelSize(base_size, level) == target) {
+      first_level = level;
+      break;
+    }
+  }
+  if (!first_level.has_value() || target.width > max_texture_size.width ||
+      target.height > max_texture_size.height) {
+    return std::nullopt;
+  }
+
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  // Straight alpha is premultiplied by drawing the first level into an RGBA
+  // texture, whose mipmaps are generated afterwards.
+  const bool premultiply =
+      descriptor->image_info().alphaType() == kUnpremul_SkAlphaType;
+  const size_t end_level = premultiply ? first_level.value() + 1
+                                       : compressed_data->mip_levels.size();
+  size_t buffer_size = 0;
+  for (size_t level = first_level.value(); level < end_level; level++) {
+    buffer_size += compressed_data->mip_levels[level]->size();
+  }
+  impeller::DeviceBufferDescriptor buffer_descriptor;
+  buffer_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+  buffer_descriptor.size = buffer_size;
+  auto buffer = allocator->CreateBuffer(buffer_descriptor);
+  if (!buffer) {
+    return std::nullopt;
+  }
+
+  CompressedTexture texture{.device_buffer = buffer,
+                            .format = pixel_format,
+                            .size = target,
+                            .premultiply = premultiply};
+  uint8_t* contents = buffer->OnGetContents();
+  size_t offset = 0;
+  for (size_t level = first_level.value(); level < end_level; level++) {
+    const auto& level_data = compressed_data->mip_levels[level];
+    std::memcpy(contents + offset, level_data->data(), level_data->size());
+    texture.mip_levels.emplace_back(offset, level_data->size());
+    offset += level_data->size();
+  }
+  buffer->Flush();
+  return texture;
+}
+
+// static
+std::pair<sk_sp<DlImage>, std::string>
+ImageDecoderImpeller::UnsafeUploadCompressedTextureToPrivate(
+    const std::shared_ptr<impeller::Context>& context,
+    const CompressedTexture& texture) {
+  impeller::TextureDescriptor texture_descriptor;
+  texture_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  texture_descriptor.format = texture.format;
+  texture_descriptor.size = texture.size;
+  texture_descriptor.mip_count = texture.mip_levels.size();
+
+  auto dest_texture =
+      context->GetResourceAllocator()->CreateTexture(texture_descriptor);
+  if (!dest_texture) {
+    std::string decode_error("Could not create compressed Impeller texture.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  dest_texture->SetLabel(
+      impeller::SPrintF("ui.Image(%p)", dest_texture.get()).c_str());
+
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    std::string decode_error(
+        "Could not create command buffer for compressed texture upload.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  command_buffer->SetLabel("Compressed Upload Command Buffer");
+
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!blit_pass) {
+    std::string decode_error(
+        "Could not create blit pass for compressed texture upload.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  blit_pass->SetLabel("Compressed Upload Blit Pass");
+  // Every mip level is provided by the image, so none are generated.
+  for (size_t level = 0; level < texture.mip_levels.size(); level++) {
+    if (!blit_pass->AddCopy(
+            impeller::BufferView(texture.device_buffer,
+                                 texture.mip_levels[level]),
+            dest_texture,
+            impeller::IRect::MakeSize(MipLevelSize(texture.size, level)),
+            /*label=*/"", /*mip_level=*/static_cast<uint32_t>(level))) {
+      std::string decode_error(
+          "Could not record compressed texture upload.");
+      FML_DLOG(ERROR) << decode_error;
+      return std::make_pair(nullptr, decode_error);
+    }
+  }
+  blit_pass->EncodeCommands(context->GetResourceAllocator());
+
+  std::shared_ptr<impeller::Texture> result_texture = dest_texture;
+  if (texture.premultiply) {
+    result_texture = EncodePremultiply(*context, *command_buffer, dest_texture);
+    if (!result_texture) {
+      std::string decode_error("Could not premultiply compressed texture.");
+      FML_DLOG(ERROR) << decode_error;
+      return std::make_pair(nullptr, decode_error);
+    }
+    result_texture->SetLabel(
+        impeller::SPrintF("ui.Image(%p)", result_texture.get()).c_str());
+  }
+
+  if (!context->GetCommandQueue()->Submit({command_buffer}).ok()) {
+    std::string decode_error(
+        "Failed to submit compressed texture upload command buffer.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  // Flush the pending command buffer to ensure that its output becomes visible
+  // to the raster thread.
+  if (context->AddTrackingFence(result_texture)) {
+    command_buffer->WaitUntilScheduled();
+  } else {
+    command_buffer->WaitUntilCompleted();
+  }
+
+  context->DisposeThreadLocalCachedResources();
+
+  return std::make_pair(
+      impeller::DlImageImpeller::Make(std::move(result_texture)),
+      std::string());
+}
+
+void ImageDecoderImpeller::UploadCompressedTextureToPrivate(
+    ImageResult result,
+    const std::shared_ptr<impeller::Context>& context,
+    const CompressedTexture& texture,
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  if (!context) {
+    result(nullptr, "No Impeller context is available");
+    return;
+  }
+  if (!texture.device_buffer) {
+    result(nullptr, "No Impeller device buffer is available");
+    return;
+  }
+
+  UploadWhenGPUAvailable(std::move(result), context, gpu_disabled_switch,
+                         [context, texture]() {
+                           return UnsafeUploadCompressedTextureToPrivate(
+                               context, texture);
+                         });
+}
+
+std::optional<YUVTexture> ImageDecoderImpeller::PrepareYUVTexture(
+    ImageDescriptor* descriptor,
+    SkISize target_size,
+    impeller::ISize max_texture_size,
+    const std::shared_ptr<impeller::Allocator>& allocator,
+    const std::shared_ptr<StagingBufferPool>& staging_buffer_pool) {
+  if (!descriptor || !descriptor->is_compressed() || target_size.isEmpty()) {
+    return std::nullopt;
+  }
+  // The planes are converted into an 8-bit RGB texture without any color
+  // space conversion, so only opaque sRGB images can take this path.
+  const SkImageInfo& image_info = descriptor->image_info();
+  if (image_info.alphaType() != kOpaque_SkAlphaType ||
+      (image_info.colorSpace() && !image_info.colorSpace()->isSRGB())) {
+    return std::nullopt;
+  }
+  if (image_info.width() > max_texture_size.width ||
+      image_info.height() > max_texture_size.height) {
+    return std::nullopt;
+  }
+
+  SkYUVAPixmapInfo pixmap_info;
+  if (!descriptor->query_yuva_info(&pixmap_info)) {
+    return std::nullopt;
+  }
+  const SkYUVAInfo& yuva_info = pixmap_info.yuvaInfo();
+  const auto color_space = ToYUVColorSpace(yuva_info.yuvColorSpace());
+  if (!color_space.has_value() ||
+      !IsSupportedPlaneConfig(yuva_info.planeConfig()) ||
+      yuva_info.dimensions() != image_info.dimensions()) {
+    return std::nullopt;
+  }
+
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  SkYUVAPixmaps planes = SkYUVAPixmaps::Allocate(pixmap_info);
+  if (!planes.isValid() || !descriptor->get_yuva_planes(planes)) {
+    FML_DLOG(ERROR) << "Could not decode YUV planes.";
+    return std::nullopt;
+  }
+
+  const SkISize uv_dimensions = planes.plane(1).dimensions();
+  YUVTexture texture;
+  texture.color_space = color_space.value();
+  texture.y_size = {image_info.width(), image_info.height()};
+  texture.uv_size = {uv_dimensions.width(), uv_dimensions.height()};
+  texture.y_plane = impeller::Range(0, texture.y_size.Area());
+  // Buffer to texture copies must start at a multiple of the texel size, and
+  // the luma plane has an odd length for images with odd dimensions.
+  const size_t uv_texel_size = impeller::BytesPerPixelForPixelFormat(
+      impeller::PixelFormat::kR8G8UNormInt);
+  const size_t uv_offset = (texture.y_plane.length + uv_texel_size - 1) /
+                           uv_texel_size * uv_texel_size;
+  texture.uv_plane =
+      impeller::Range(uv_offset, texture.uv_size.Area() * uv_texel_size);
+  // A target size larger than the maximum texture size is scaled down by the
+  // same factor on both axes, so that the image keeps its aspect ratio.
+  const double fit_scale = std::min(
+      {1.0,
+       static_cast<double>(max_texture_size.width) / target_size.width(),
+       static_cast<double>(max_texture_size.height) / target_size.height()});
+  texture.target_size = {
+      std::clamp<int64_t>(std::llround(target_size.width() * fit_scale), 1,
+                          max_texture_size.width),
+      std::clamp<int64_t>(std::llround(target_size.height() * fit_scale), 1,
+                          max_texture_size.height)};
+
+  const size_t buffer_size = texture.uv_plane.offset + texture.uv_plane.length;
+  std::shared_ptr<impeller::DeviceBuffer> buffer;
+  if (staging_buffer_pool) {
+    buffer = staging_buffer_pool->Acquire(allocator, buffer_size);
+  } else {
+    impeller::DeviceBufferDescriptor buffer_descriptor;
+    buffer_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+    buffer_descriptor.size = buffer_size;
+    buffer = allocator->CreateBuffer(buffer_descriptor);
+  }
+  if (!buffer) {
+    return std::nullopt;
+  }
+  uint8_t* contents = buffer->OnGetContents();
+  CopyPlane(planes.plane(0), texture.y_size.width, contents);
+  PackUVPlane(planes, contents + texture.uv_plane.offset);
+  buffer->Flush();
+  texture.device_buffer = std::move(buffer);
+  return texture;
+}
+
+// static
+std::pair<sk_sp<DlImage>, std::string>
+ImageDecoderImpeller::UnsafeUploadYUVTextureToPrivate(
+    const std::shared_ptr<impeller::Context>& context,
+    const YUVTexture& texture) {
+  using VS = impeller::FilterPositionVertexShader;
+  using FS = impeller::YuvToRgbFilterFragmentShader;
+
+  // Mipmapped planes keep large downscales from aliasing.
+  const bool is_downscale = texture.target_size.width < texture.y_size.width ||
+                            texture.target_size.height < texture.y_size.height;
+  auto y_texture =
+      CreatePlaneTexture(*context, impeller::PixelFormat::kR8UNormInt,
+                         texture.y_size, is_downscale);
+  auto uv_texture =
+      CreatePlaneTexture(*context, impeller::PixelFormat::kR8G8UNormInt,
+                         texture.uv_size, is_downscale);
+
+  impeller::TextureDescriptor texture_descriptor;
+  texture_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  texture_descriptor.format =
+      context->GetCapabilities()->GetDefaultColorFormat();
+  texture_descriptor.size = texture.target_size;
+  texture_descriptor.mip_count = texture_descriptor.size.MipCount();
+  texture_descriptor.usage = impeller::TextureUsage::kRenderTarget |
+                             impeller::TextureUsage::kShaderRead;
+  auto dest_texture =
+      context->GetResourceAllocator()->CreateTexture(texture_descriptor);
+  if (!y_texture || !uv_texture || !dest_texture) {
+    std::string decode_error("Could not create Impeller textures for YUV.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  dest_texture->SetLabel(
+      impeller::SPrintF("ui.Image(%p)", dest_texture.get()).c_str());
+
+  auto pipeline = GetYUVToRGBPipeline(*context, texture_descriptor.format);
+  if (!pipeline) {
+    std::string decode_error("Could not create YUV conversion pipeline.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    std::string decode_error(
+        "Could not create command buffer for YUV conversion.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  command_buffer->SetLabel("YUV Conversion Command Buffer");
+
+  //----------------------------------------------------------------------------
+  /// 1. Upload the planes.
+  ///
+  auto upload_pass = command_buffer->CreateBlitPass();
+  if (!upload_pass) {
+    std::string decode_error("Could not create blit pass for YUV planes.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  upload_pass->SetLabel("YUV Upload Blit Pass");
+  upload_pass->AddCopy(
+      impeller::BufferView(texture.device_buffer, texture.y_plane), y_texture);
+  upload_pass->AddCopy(
+      impeller::BufferView(texture.device_buffer, texture.uv_plane),
+      uv_texture);
+  if (is_downscale) {
+    upload_pass->GenerateMipmap(y_texture);
+    upload_pass->GenerateMipmap(uv_texture);
+  }
+  upload_pass->EncodeCommands(context->GetResourceAllocator());
+
+  //----------------------------------------------------------------------------
+  /// 2. Convert the planes to RGB at the target size.
+  ///
+  impeller::ColorAttachment color0;
+  color0.texture = dest_texture;
+  color0.load_action = impeller::LoadAction::kDontCare;
+  color0.store_action = impeller::StoreAction::kStore;
+  impeller::RenderTarget render_target;
+  render_target.SetColorAttachment(color0, 0u);
+  auto render_pass = command_buffer->CreateRenderPass(render_target);
+  if (!render_pass || !render_pass->IsValid()) {
+    std::string decode_error("Could not create render pass for YUV planes.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  render_pass->SetLabel("YUV Conversion Render Pass");
+
+  // The quad and the uniforms share a single small buffer.
+  const std::array<VS::PerVertexData, 4> vertices = {
+      VS::PerVertexData{impeller::Point(0, 0)},
+      VS::PerVertexData{impeller::Point(1, 0)},
+      VS::PerVertexData{impeller::Point(0, 1)},
+      VS::PerVertexData{impeller::Point(1, 1)},
+  };
+  VS::FrameInfo frame_info;
+  frame_info.mvp = render_pass->GetOrthographicTransform() *
+                   impeller::Matrix::MakeScale(
+                       impeller::Vector2(texture.target_size));
+  frame_info.texture_sampler_y_coord_scale = y_texture->GetYCoordScale();
+  FS::FragInfo frag_info;
+  frag_info.matrix =
+      impeller::YUVToRGBFilterContents::GetYUVToRGBMatrix(texture.color_space);
+  frag_info.yuv_color_space =
+      static_cast<impeller::Scalar>(texture.color_space);
+
+  auto align = [](size_t offset) {
+    const size_t alignment = impeller::DefaultUniformAlignment();
+    return (offset + alignment - 1) / alignment * alignment;
+  };
+  const size_t frame_info_offset = align(sizeof(vertices));
+  const size_t frag_info_offset = align(frame_info_offset + sizeof(frame_info));
+  std::vector<uint8_t> draw_data(frag_info_offset + sizeof(frag_info));
+  std::memcpy(draw_data.data(), vertices.data(), sizeof(vertices));
+  std::memcpy(draw_data.data() + frame_info_offset, &frame_info,
+              sizeof(frame_info));
+  std::memcpy(draw_data.data() + frag_info_offset, &frag_info,
+              sizeof(frag_info));
+  auto draw_buffer = context->GetResourceAllocator()->CreateBufferWithCopy(
+      draw_data.data(), draw_data.size());
+  if (!draw_buffer) {
+    std::string decode_error("Could not create YUV conversion buffer.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  impeller::SamplerDescriptor sampler_descriptor;
+  sampler_descriptor.min_filter = impeller::MinMagFilter::kLinear;
+  sampler_descriptor.mag_filter = impeller::MinMagFilter::kLinear;
+  sampler_descriptor.mip_filter = impeller::MipFilter::kLinear;
+  auto sampler = context->GetSamplerLibrary()->GetSampler(sampler_descriptor);
+
+  render_pass->SetCommandLabel("YUV to RGB");
+  render_pass->SetPipeline(pipeline);
+  render_pass->SetVertexBuffer(impeller::VertexBuffer{
+      .vertex_buffer = impeller::BufferView(
+          draw_buffer, impeller::Range(0, sizeof(vertices))),
+      .vertex_count = vertices.size(),
+      .index_type = impeller::IndexType::kNone,
+  });
+  VS::BindFrameInfo(*render_pass,
+                    impeller::BufferView(draw_buffer,
+                                         impeller::Range(frame_info_offset,
+                                                         sizeof(frame_info))));
+  FS::BindFragInfo(*render_pass,
+                   impeller::BufferView(draw_buffer,
+                                        impeller::Range(frag_info_offset,
+                                                        sizeof(frag_info))));
+  FS::BindYTexture(*render_pass, y_texture, sampler);
+  FS::BindUvTexture(*render_pass, uv_texture, sampler);
+  if (!render_pass->Draw().ok() || !render_pass->EncodeCommands()) {
+    std::string decode_error("Could not encode YUV conversion.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  //----------------------------------------------------------------------------
+  /// 3. Generate mipmaps for the converted image.
+  ///
+  if (texture_descriptor.mip_count > 1) {
+    auto mipmap_pass = command_buffer->CreateBlitPass();
+    if (!mipmap_pass) {
+      std::string decode_error(
+          "Could not create blit pass for mipmap generation.");
+      FML_DLOG(ERROR) << decode_error;
+      return std::make_pair(nullptr, decode_error);
+    }
+    mipmap_pass->SetLabel("Mipmap Blit Pass");
+    mipmap_pass->GenerateMipmap(dest_texture);
+    mipmap_pass->EncodeCommands(context->GetResourceAllocator());
+  }
+
+  if (!context->GetCommandQueue()->Submit({command_buffer}).ok()) {
+    std::string decode_error("Failed to submit YUV conversion command buffer.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  // Flush the pending command buffer to ensure that its output becomes visible
+  // to the raster thread.
+  if (context->AddTrackingFence(dest_texture)) {
+    command_buffer->WaitUntilScheduled();
+  } else {
+    command_buffer->WaitUntilCompleted();
+  }
+
+  context->DisposeThreadLocalCachedResources();
+
+  return std::make_pair(
+      impeller::DlImageImpeller::Make(std::move(dest_texture)), std::string());
+}
+
+void ImageDecoderImpeller::UploadYUVTextureToPrivate(
+    ImageResult result,
+    const std::shared_ptr<impeller::Context>& context,
+    const YUVTexture& texture,
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  if (!context) {
+    result(nullptr, "No Impeller context is available");
+    return;
+  }
+  if (!texture.device_buffer) {
+    result(nullptr, "No Impeller device buffer is available");
+    return;
+  }
+
+  UploadWhenGPUAvailable(std::move(result), context, gpu_disabled_switch,
+                         [context, texture]() {
+                           return UnsafeUploadYUVTextureToPrivate(context,
+                                                                  texture);
+                         });
 }
 
 std::pair<sk_sp<DlImage>, std::string>
@@ -527,7 +1330,8 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
        io_runner = runners_.GetIOTaskRunner(),                    //
        result,
        supports_wide_gamut = supports_wide_gamut_,  //
-       gpu_disabled_switch = gpu_disabled_switch_]() {
+       gpu_disabled_switch = gpu_disabled_switch_,  //
+       staging_buffer_pool = staging_buffer_pool_]() {
 #if FML_OS_IOS_SIMULATOR
         // No-op backend.
         if (!context) {
@@ -542,26 +1346,60 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
         auto max_size_supported =
             context->GetResourceAllocator()->GetMaxTextureSizeSupported();
 
-        // Always decompress on the concurrent runner.
-        auto bitmap_result = DecompressTexture(
-            raw_descriptor, target_size, max_size_supported,
-            /*supports_wide_gamut=*/supports_wide_gamut,
-            context->GetCapabilities(), context->GetResourceAllocator());
-        if (!bitmap_result.device_buffer) {
-          result(nullptr, bitmap_result.decode_error);
-          return;
+        // Two channel textures are not guaranteed to be available on GLES.
+        const bool supports_yuv_planes =
+            context->GetBackendType() !=
+            impeller::Context::BackendType::kOpenGLES;
+
+        fml::closure upload_texture_and_invoke_result;
+        if (auto compressed_texture = PrepareCompressedTexture(
+                raw_descriptor, target_size, max_size_supported,
+                context->GetCapabilities(), context->GetResourceAllocator())) {
+          // Block compressed images the device can sample from are uploaded
+          // as-is, and premultiplied on the GPU if they have straight alpha.
+          upload_texture_and_invoke_result =
+              [result, context, texture = std::move(compressed_texture.value()),
+               gpu_disabled_switch]() {
+                UploadCompressedTextureToPrivate(result, context, texture,
+                                                 gpu_disabled_switch);
+              };
+        } else if (auto yuv_texture =
+                       supports_yuv_planes
+                           ? PrepareYUVTexture(raw_descriptor, target_size,
+                                               max_size_supported,
+                                               context->GetResourceAllocator(),
+                                               staging_buffer_pool)
+                           : std::nullopt) {
+          // Planar images are converted to RGB and scaled on the GPU.
+          upload_texture_and_invoke_result =
+              [result, context, texture = std::move(yuv_texture.value()),
+               gpu_disabled_switch]() {
+                UploadYUVTextureToPrivate(result, context, texture,
+                                          gpu_disabled_switch);
+              };
+        } else {
+          // Always decompress on the concurrent runner.
+          auto bitmap_result = DecompressTexture(
+              raw_descriptor, target_size, max_size_supported,
+              /*supports_wide_gamut=*/supports_wide_gamut,
+              context->GetCapabilities(), context->GetResourceAllocator(),
+              staging_buffer_pool);
+          if (!bitmap_result.device_buffer) {
+            result(nullptr, bitmap_result.decode_error);
+            return;
+          }
+
+          upload_texture_and_invoke_result = [result, context, bitmap_result,
+                                              gpu_disabled_switch]() {
+            UploadTextureToPrivate(result, context,              //
+                                   bitmap_result.device_buffer,  //
+                                   bitmap_result.image_info,     //
+                                   bitmap_result.sk_bitmap,      //
+                                   bitmap_result.resize_info,    //
+                                   gpu_disabled_switch           //
+            );
+          };
         }
-
-        auto upload_texture_and_invoke_result = [result, context, bitmap_result,
-                                                 gpu_disabled_switch]() {
-          UploadTextureToPrivate(result, context,              //
-                                 bitmap_result.device_buffer,  //
-                                 bitmap_result.image_info,     //
-                                 bitmap_result.sk_bitmap,      //
-                                 bitmap_result.resize_info,    //
-                                 gpu_disabled_switch           //
-          );
-        };
         // The I/O image uploads are not threadsafe on GLES.
         if (context->GetBackendType() ==
             impeller::Context::BackendType::kOpenGLES) {
@@ -573,8 +1411,10 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
 }
 
 ImpellerAllocator::ImpellerAllocator(
-    std::shared_ptr<impeller::Allocator> allocator)
-    : allocator_(std::move(allocator)) {}
+    std::shared_ptr<impeller::Allocator> allocator,
+    std::shared_ptr<StagingBufferPool> staging_buffer_pool)
+    : allocator_(std::move(allocator)),
+      staging_buffer_pool_(std::move(staging_buffer_pool)) {}
 
 std::shared_ptr<impeller::DeviceBuffer> ImpellerAllocator::GetDeviceBuffer()
     const {
@@ -597,7 +1437,9 @@ bool ImpellerAllocator::allocPixelRef(SkBitmap* bitmap) {
                     (bitmap->width() * bitmap->bytesPerPixel());
 
   std::shared_ptr<impeller::DeviceBuffer> device_buffer =
-      allocator_->CreateBuffer(descriptor);
+      staging_buffer_pool_
+          ? staging_buffer_pool_->Acquire(allocator_, descriptor.size)
+          : allocator_->CreateBuffer(descriptor);
   if (!device_buffer) {
     return false;
   }
@@ -6,10 +6,15 @@
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_DECODER_IMPELLER_H_
 
 #include <future>
+#include <optional>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/image_decoder.h"
+#include "flutter/lib/ui/painting/staging_buffer_pool.h"
 #include "impeller/core/formats.h"
+#include "impeller/core/range.h"
+#include "impeller/geometry/color.h"
 #include "impeller/geometry/size.h"
 #include "impeller/renderer/capabilities.h"
 #include "include/core/SkImageInfo.h"
@@ -25,7 +30,9 @@ namespace flutter {
 
 class ImpellerAllocator : public SkBitmap::Allocator {
  public:
-  explicit ImpellerAllocator(std::shared_ptr<impeller::Allocator> allocator);
+  explicit ImpellerAllocator(
+      std::shared_ptr<impeller::Allocator> allocator,
+      std::shared_ptr<StagingBufferPool> staging_buffer_pool = nullptr);
 
   ~ImpellerAllocator() = default;
 
@@ -36,6 +43,7 @@ class ImpellerAllocator : public SkBitmap::Allocator {
 
  private:
   std::shared_ptr<impeller::Allocator> allocator_;
+  std::shared_ptr<StagingBufferPool> staging_buffer_pool_;
   std::shared_ptr<impeller::DeviceBuffer> buffer_;
 };
 
@@ -47,6 +55,38 @@ struct DecompressResult {
   std::string decode_error;
 };
 
+/// Block compressed mip levels of an image, packed into a single host visible
+/// buffer so that they can be uploaded without being decompressed.
+struct CompressedTexture {
+  std::shared_ptr<impeller::DeviceBuffer> device_buffer;
+  impeller::PixelFormat format = impeller::PixelFormat::kUnknown;
+  /// The size of the first mip level in `mip_levels`.
+  impeller::ISize size;
+  /// The range of each mip level in `device_buffer`, largest first.
+  std::vector<impeller::Range> mip_levels;
+  /// Whether the texels have straight alpha, in which case only the first mip
+  /// level is uploaded and it is premultiplied into an RGBA texture.
+  bool premultiply = false;
+};
+
+/// The planes of an image decoded into YUV, packed into a single host visible
+/// buffer so that they can be converted to RGB and scaled on the GPU.
+struct YUVTexture {
+  std::shared_ptr<impeller::DeviceBuffer> device_buffer;
+  impeller::YUVColorSpace color_space =
+      impeller::YUVColorSpace::kBT601FullRange;
+  /// The size of the luma plane, which is the size of the decoded image.
+  impeller::ISize y_size;
+  /// The size of the chroma plane, with interleaved U and V samples.
+  impeller::ISize uv_size;
+  /// The range of the luma plane in `device_buffer`.
+  impeller::Range y_plane;
+  /// The range of the chroma plane in `device_buffer`.
+  impeller::Range uv_plane;
+  /// The size of the RGB image to convert the planes into.
+  impeller::ISize target_size;
+};
+
 class ImageDecoderImpeller final : public ImageDecoder {
  public:
   ImageDecoderImpeller(
@@ -70,8 +110,66 @@ class ImageDecoderImpeller final : public ImageDecoder {
       impeller::ISize max_texture_size,
       bool supports_wide_gamut,
       const std::shared_ptr<const impeller::Capabilities>& capabilities,
+      const std::shared_ptr<impeller::Allocator>& allocator,
+      const std::shared_ptr<StagingBufferPool>& staging_buffer_pool = nullptr);
+
+  /// @brief Gather the block compressed mip levels of an image for a direct
+  ///        upload, if the device can sample from their format and one of
+  ///        them has exactly the target size.
+  ///
+  /// @return The compressed texture data, or no value if the image has to be
+  ///         decompressed with `DecompressTexture` instead.
+  static std::optional<CompressedTexture> PrepareCompressedTexture(
+      ImageDescriptor* descriptor,
+      SkISize target_size,
+      impeller::ISize max_texture_size,
+      const std::shared_ptr<const impeller::Capabilities>& capabilities,
       const std::shared_ptr<impeller::Allocator>& allocator);
 
+  /// @brief Decode an image into YUV planes for conversion on the GPU, if its
+  ///        decoder supports planar output. Planes take less space than the
+  ///        RGBA pixels they are converted to, and are scaled to the target
+  ///        size by the GPU instead of the CPU. Only opaque images in the
+  ///        sRGB color space are converted this way.
+  ///
+  /// @return The YUV planes, or no value if the image has to be decompressed
+  ///         with `DecompressTexture` instead.
+  static std::optional<YUVTexture> PrepareYUVTexture(
+      ImageDescriptor* descriptor,
+      SkISize target_size,
+      impeller::ISize max_texture_size,
+      const std::shared_ptr<impeller::Allocator>& allocator,
+      const std::shared_ptr<StagingBufferPool>& staging_buffer_pool = nullptr);
+
+  /// @brief Create a device private texture by converting the provided YUV
+  ///        planes to RGB at their target size.
+  ///
+  /// @param result     The image result closure that accepts the DlImage and
+  ///                   any encoding error messages.
+  /// @param context    The Impeller graphics context.
+  /// @param texture    The YUV planes to be uploaded and converted.
+  /// @param gpu_disabled_switch Whether the GPU is available command encoding.
+  static void UploadYUVTextureToPrivate(
+      ImageResult result,
+      const std::shared_ptr<impeller::Context>& context,
+      const YUVTexture& texture,
+      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
+
+  /// @brief Create a device private texture from the provided block
+  ///        compressed mip levels. Straight alpha levels are premultiplied on
+  ///        the GPU into an RGBA texture.
+  ///
+  /// @param result     The image result closure that accepts the DlImage and
+  ///                   any encoding error messages.
+  /// @param context    The Impeller graphics context.
+  /// @param texture    The compressed mip levels to be uploaded.
+  /// @param gpu_disabled_switch Whether the GPU is available command encoding.
+  static void UploadCompressedTextureToPrivate(
+      ImageResult result,
+      const std::shared_ptr<impeller::Context>& context,
+      const CompressedTexture& texture,
+      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
+
   /// @brief Create a device private texture from the provided host buffer.
   ///
   /// @param result     The image result closure that accepts the DlImage and
@@ -103,6 +201,7 @@ class ImageDecoderImpeller final : public ImageDecoder {
   FutureContext context_;
   const bool supports_wide_gamut_;
   std::shared_ptr<fml::SyncSwitch> gpu_disabled_switch_;
+  std::shared_ptr<StagingBufferPool> staging_buffer_pool_;
 
   /// Only call this method if the GPU is available.
   static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
@@ -111,6 +210,17 @@ class ImageDecoderImpeller final : public ImageDecoder {
       const SkImageInfo& image_info,
       const std::optional<SkImageInfo>& resize_info);
 
+  /// Only call this method if the GPU is available.
+  static std::pair<sk_sp<DlImage>, std::string>
+  UnsafeUploadCompressedTextureToPrivate(
+      const std::shared_ptr<impeller::Context>& context,
+      const CompressedTexture& texture);
+
+  /// Only call this method if the GPU is available.
+  static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadYUVTextureToPrivate(
+      const std::shared_ptr<impeller::Context>& context,
+      const YUVTexture& texture);
+
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoderImpeller);
 };
 
@@ -0,0 +1,244 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/synchronization/sync_switch.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/lib/ui/painting/image_decoder_impeller.h"
+#include "flutter/lib/ui/painting/image_descriptor.h"
+#include "flutter/lib/ui/painting/image_generator_ktx2.h"
+#include "flutter/testing/testing.h"
+#include "impeller/core/device_buffer.h"
+#include "impeller/playground/playground_test.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/command_queue.h"
+
+namespace flutter {
+namespace testing {
+
+using ImageDecoderImpellerTest = impeller::PlaygroundTest;
+INSTANTIATE_PLAYGROUND_SUITE(ImageDecoderImpellerTest);
+
+namespace {
+
+constexpr uint32_t kVkFormatETC2R8G8B8A8UNorm = 151;
+
+void AppendUint32(std::vector<uint8_t>& bytes, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    bytes.push_back((value >> (8 * i)) & 0xFF);
+  }
+}
+
+void AppendUint64(std::vector<uint8_t>& bytes, uint64_t value) {
+  for (int i = 0; i < 8; i++) {
+    bytes.push_back((value >> (8 * i)) & 0xFF);
+  }
+}
+
+// Builds a little-endian KTX2 container with a single mip level and no data
+// format descriptor, so the texels have straight alpha.
+sk_sp<SkData> MakeKTX2(uint32_t vk_format,
+                       uint32_t width,
+                       uint32_t height,
+                       const std::vector<uint8_t>& level) {
+  const uint8_t identifier[12] = {0xAB, 'K',  'T',  'X',  ' ',  '2',
+                                  '0',  0xBB, '\r', '\n', 0x1A, '\n'};
+  std::vector<uint8_t> bytes(identifier, identifier + sizeof(identifier));
+  AppendUint32(bytes, vk_format);
+  AppendUint32(bytes, 1);  // typeSize
+  AppendUint32(bytes, width);
+  AppendUint32(bytes, height);
+  AppendUint32(bytes, 0);  // pixelDepth
+  AppendUint32(bytes, 0);  // layerCount
+  AppendUint32(bytes, 1);  // faceCount
+  AppendUint32(bytes, 1);  // levelCount
+  AppendUint32(bytes, 0);  // supercompressionScheme
+  for (int i = 0; i < 4; i++) {
+    AppendUint32(bytes, 0);  // DFD and key/value data.
+  }
+  AppendUint64(bytes, 0);  // sgdByteOffset
+  AppendUint64(bytes, 0);  // sgdByteLength
+  AppendUint64(bytes, bytes.size() + 3 * sizeof(uint64_t));
+  AppendUint64(bytes, level.size());
+  AppendUint64(bytes, level.size());
+  bytes.insert(bytes.end(), level.begin(), level.end());
+  return SkData::MakeWithCopy(bytes.data(), bytes.size());
+}
+
+// Copies the base mip level of a texture into host memory.
+std::vector<uint8_t> ReadPixels(
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<impeller::Texture>& texture) {
+  impeller::DeviceBufferDescriptor buffer_descriptor;
+  buffer_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+  buffer_descriptor.size =
+      texture->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+  auto buffer =
+      context->GetResourceAllocator()->CreateBuffer(buffer_descriptor);
+  auto command_buffer = context->CreateCommandBuffer();
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!buffer || !blit_pass || !blit_pass->AddCopy(texture, buffer) ||
+      !blit_pass->EncodeCommands(context->GetResourceAllocator())) {
+    return {};
+  }
+  fml::AutoResetWaitableEvent latch;
+  if (!context->GetCommandQueue()
+           ->Submit({command_buffer},
+                    [&latch](impeller::CommandBuffer::Status) {
+                      latch.Signal();
+                    })
+           .ok()) {
+    return {};
+  }
+  latch.Wait();
+  buffer->Invalidate();
+  const uint8_t* contents = buffer->OnGetContents();
+  return std::vector<uint8_t>(contents, contents + buffer_descriptor.size);
+}
+
+}  // namespace
+
+TEST_P(ImageDecoderImpellerTest, PremultipliesStraightAlphaCompressedImages) {
+  auto context = GetContext();
+  ASSERT_TRUE(context);
+  if (!context->GetCapabilities()->SupportsCompressedPixelFormat(
+          impeller::PixelFormat::kETC2R8G8B8A8UNorm)) {
+    GTEST_SKIP() << "ETC2 textures are not supported on this device.";
+  }
+
+  // A half transparent EAC alpha block followed by an ETC2 block in individual
+  // mode with equal base colors, so every texel is the same gray.
+  const std::vector<uint8_t> block = {
+      0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+  };
+  auto data = MakeKTX2(kVkFormatETC2R8G8B8A8UNorm, 4, 4, block);
+  std::shared_ptr<ImageGenerator> generator =
+      KTX2ImageGenerator::MakeFromData(data);
+  ASSERT_TRUE(generator);
+  ASSERT_EQ(generator->GetInfo().alphaType(), kUnpremul_SkAlphaType);
+
+  // The CPU decoder provides the straight alpha reference color.
+  std::vector<uint32_t> straight_pixels(16);
+  ASSERT_TRUE(generator->GetPixels(generator->GetInfo(),
+                                   straight_pixels.data(),
+                                   4 * sizeof(uint32_t), 0, std::nullopt));
+  const auto* straight = reinterpret_cast<const uint8_t*>(&straight_pixels[0]);
+  ASSERT_EQ(straight[0], straight[1]);
+  ASSERT_EQ(straight[0], straight[2]);
+  ASSERT_EQ(straight[3], 0x80);
+  const int expected_color = (straight[0] * straight[3] + 127) / 255;
+
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+  std::optional<CompressedTexture> texture =
+      ImageDecoderImpeller::PrepareCompressedTexture(
+          descriptor.get(), SkISize::Make(4, 4), {2048, 2048},
+          context->GetCapabilities(), context->GetResourceAllocator());
+  ASSERT_TRUE(texture.has_value());
+  EXPECT_TRUE(texture->premultiply);
+
+  sk_sp<DlImage> image;
+  std::string decode_error;
+  ImageDecoderImpeller::UploadCompressedTextureToPrivate(
+      [&image, &decode_error](sk_sp<DlImage> result, std::string error) {
+        image = std::move(result);
+        decode_error = std::move(error);
+      },
+      context, texture.value(), std::make_shared<fml::SyncSwitch>());
+  ASSERT_TRUE(image) << decode_error;
+  auto result_texture = image->impeller_texture();
+  ASSERT_TRUE(result_texture);
+  EXPECT_NE(result_texture->GetTextureDescriptor().format,
+            impeller::PixelFormat::kETC2R8G8B8A8UNorm);
+
+  // Every channel is gray, so the check does not depend on the channel order
+  // of the default color format.
+  std::vector<uint8_t> pixels = ReadPixels(context, result_texture);
+  ASSERT_EQ(pixels.size(), 4u * 4u * 4u);
+  for (size_t i = 0; i < pixels.size(); i += 4) {
+    EXPECT_NEAR(pixels[i + 0], expected_color, 1);
+    EXPECT_NEAR(pixels[i + 1], expected_color, 1);
+    EXPECT_NEAR(pixels[i + 2], expected_color, 1);
+    EXPECT_EQ(pixels[i + 3], 0x80);
+  }
+}
+
+TEST_P(ImageDecoderImpellerTest, ConvertsOddSizedYUVPlanesToRGB) {
+  auto context = GetContext();
+  ASSERT_TRUE(context);
+
+  // A 5x3 image with a different luma in each column and the same chroma
+  // everywhere, laid out as PrepareYUVTexture does.
+  const uint8_t kU = 110;
+  const uint8_t kV = 150;
+  YUVTexture texture;
+  texture.color_space = impeller::YUVColorSpace::kBT601FullRange;
+  texture.y_size = {5, 3};
+  texture.uv_size = {3, 2};
+  texture.target_size = texture.y_size;
+  texture.y_plane = impeller::Range(0, 15);
+  texture.uv_plane = impeller::Range(16, 12);
+
+  impeller::DeviceBufferDescriptor buffer_descriptor;
+  buffer_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+  buffer_descriptor.size = texture.uv_plane.offset + texture.uv_plane.length;
+  texture.device_buffer =
+      context->GetResourceAllocator()->CreateBuffer(buffer_descriptor);
+  ASSERT_TRUE(texture.device_buffer);
+  uint8_t* contents = texture.device_buffer->OnGetContents();
+  for (int y = 0; y < 3; y++) {
+    for (int x = 0; x < 5; x++) {
+      contents[y * 5 + x] = 60 + 30 * x;
+    }
+  }
+  for (size_t i = 0; i < texture.uv_plane.length; i += 2) {
+    contents[texture.uv_plane.offset + i] = kU;
+    contents[texture.uv_plane.offset + i + 1] = kV;
+  }
+  texture.device_buffer->Flush();
+
+  sk_sp<DlImage> image;
+  std::string decode_error;
+  ImageDecoderImpeller::UploadYUVTextureToPrivate(
+      [&image, &decode_error](sk_sp<DlImage> result, std::string error) {
+        image = std::move(result);
+        decode_error = std::move(error);
+      },
+      context, texture, std::make_shared<fml::SyncSwitch>());
+  ASSERT_TRUE(image) << decode_error;
+  auto result_texture = image->impeller_texture();
+  ASSERT_TRUE(result_texture);
+  ASSERT_EQ(result_texture->GetSize(), texture.target_size);
+
+  const impeller::PixelFormat format =
+      result_texture->GetTextureDescriptor().format;
+  ASSERT_TRUE(format == impeller::PixelFormat::kR8G8B8A8UNormInt ||
+              format == impeller::PixelFormat::kB8G8R8A8UNormInt);
+  const bool bgra = format == impeller::PixelFormat::kB8G8R8A8UNormInt;
+  std::vector<uint8_t> pixels = ReadPixels(context, result_texture);
+  ASSERT_EQ(pixels.size(), 5u * 3u * 4u);
+  for (int y = 0; y < 3; y++) {
+    for (int x = 0; x < 5; x++) {
+      // The full range BT.601 conversion.
+      const double luma = 60 + 30 * x;
+      const double red = luma + 1.402 * (kV - 128);
+      const double green =
+          luma - 0.344136 * (kU - 128) - 0.714136 * (kV - 128);
+      const double blue = luma + 1.772 * (kU - 128);
+      const uint8_t* pixel = &pixels[(y * 5 + x) * 4];
+      EXPECT_NEAR(pixel[bgra ? 2 : 0], red, 2) << x << ", " << y;
+      EXPECT_NEAR(pixel[1], green, 2) << x << ", " << y;
+      EXPECT_NEAR(pixel[bgra ? 0 : 2], blue, 2) << x << ", " << y;
+      EXPECT_EQ(pixel[3], 255);
+    }
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -237,5 +237,97 @@ TEST(ImageDecoderNoGLTest, ImpellerUnmultipliedAlphaPng) {
 #endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
+TEST(ImageDecoderNoGLTest, StagingBufferPoolReusesReleasedBuffers) {
+#if IMPELLER_SUPPORTS_RENDERING
+  std::shared_ptr<impeller::Allocator> allocator =
+      std::make_shared<impeller::TestImpellerAllocator>();
+  auto pool = std::make_shared<StagingBufferPool>();
+
+  auto buffer = pool->Acquire(allocator, 100 * 1024);
+  ASSERT_TRUE(buffer);
+  EXPECT_GE(buffer->GetDeviceBufferDescriptor().size, 100u * 1024);
+  auto* contents = buffer->OnGetContents();
+
+  // A buffer that is still in use is never handed out again.
+  auto other_buffer = pool->Acquire(allocator, 100 * 1024);
+  ASSERT_TRUE(other_buffer);
+  EXPECT_NE(other_buffer->OnGetContents(), contents);
+
+  buffer.reset();
+  EXPECT_GT(pool->GetStats().idle_bytes, 0u);
+
+  auto reused_buffer = pool->Acquire(allocator, 90 * 1024);
+  ASSERT_TRUE(reused_buffer);
+  EXPECT_EQ(reused_buffer->OnGetContents(), contents);
+
+  const auto stats = pool->GetStats();
+  EXPECT_EQ(stats.reused_count, 1u);
+  EXPECT_EQ(stats.allocated_count, 2u);
+  EXPECT_EQ(stats.one_off_count, 0u);
+  EXPECT_EQ(stats.idle_bytes, 0u);
+  EXPECT_DOUBLE_EQ(stats.GetReuseRate(), 1.0 / 3.0);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+TEST(ImageDecoderNoGLTest, StagingBufferPoolRespectsBudget) {
+#if IMPELLER_SUPPORTS_RENDERING
+  std::shared_ptr<impeller::Allocator> allocator =
+      std::make_shared<impeller::TestImpellerAllocator>();
+  auto pool = std::make_shared<StagingBufferPool>(
+      /*budget_bytes=*/100 * 1024, /*max_pooled_buffer_bytes=*/64 * 1024);
+
+  // Requests above the maximum pooled size are served by one-off buffers.
+  pool->Acquire(allocator, 128 * 1024).reset();
+  EXPECT_EQ(pool->GetStats().one_off_count, 1u);
+  EXPECT_EQ(pool->GetStats().idle_bytes, 0u);
+
+  // Only one of the released buffers fits within the budget.
+  auto first = pool->Acquire(allocator, 64 * 1024);
+  auto second = pool->Acquire(allocator, 64 * 1024);
+  first.reset();
+  second.reset();
+  EXPECT_EQ(pool->GetStats().idle_bytes, 64u * 1024);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+TEST(ImageDecoderNoGLTest, ImpellerDecompressTextureUsesStagingBufferPool) {
+#if defined(OS_FUCHSIA)
+  GTEST_SKIP() << "Fuchsia can't load the test fixtures.";
+#endif
+  auto data = flutter::testing::OpenFixtureAsSkData("unmultiplied_alpha.png");
+  std::shared_ptr<impeller::Capabilities> capabilities =
+      impeller::CapabilitiesBuilder()
+          .SetSupportsTextureToTextureBlits(true)
+          .Build();
+
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+
+#if IMPELLER_SUPPORTS_RENDERING
+  std::shared_ptr<impeller::Allocator> allocator =
+      std::make_shared<impeller::TestImpellerAllocator>();
+  auto pool = std::make_shared<StagingBufferPool>();
+  for (int i = 0; i < 2; i++) {
+    DecompressResult result = ImageDecoderImpeller::DecompressTexture(
+        descriptor.get(), SkISize::Make(11, 11), {11, 11},
+        /*supports_wide_gamut=*/true, capabilities, allocator, pool);
+    ASSERT_TRUE(result.device_buffer);
+    const uint32_t* pixel_ptr =
+        static_cast<const uint32_t*>(result.sk_bitmap->pixmap().addr());
+    ASSERT_EQ(*pixel_ptr, (uint32_t)0x1000001);
+  }
+
+  // The second decode reuses the intermediates released by the first one.
+  const auto stats = pool->GetStats();
+  EXPECT_EQ(stats.allocated_count, 2u);
+  EXPECT_EQ(stats.reused_count, 2u);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -4,6 +4,7 @@
 
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/impeller/core/allocator.h"
 #include "flutter/impeller/core/device_buffer.h"
@@ -350,6 +351,62 @@ TEST_F(ImageDecoderFixtureTest, ValidImageResultsInSuccess) {
   latch.Wait();
 }
 
+TEST_F(ImageDecoderFixtureTest, DecodeWithCacheHashesOffTheUIThread) {
+  auto loop = fml::ConcurrentMessageLoop::Create();
+  TaskRunners runners(GetCurrentTestName(),         // label
+                      CreateNewThread("platform"),  // platform
+                      CreateNewThread("raster"),    // raster
+                      CreateNewThread("ui"),        // ui
+                      CreateNewThread("io")         // io
+  );
+
+  std::unique_ptr<TestIOManager> io_manager;
+  PostTaskSync(runners.GetIOTaskRunner(), [&]() {
+    io_manager = std::make_unique<TestIOManager>(runners.GetIOTaskRunner());
+  });
+
+  std::unique_ptr<ImageDecoder> image_decoder;
+  fml::CountDownLatch latch(2);
+  std::vector<sk_sp<DlImage>> images;
+  PostTaskSync(runners.GetUITaskRunner(), [&]() {
+    Settings settings;
+    image_decoder = ImageDecoder::Make(settings, runners, loop->GetTaskRunner(),
+                                       io_manager->GetWeakIOManager(),
+                                       std::make_shared<fml::SyncSwitch>());
+
+    ImageGeneratorRegistry registry;
+    auto data = flutter::testing::OpenFixtureAsSkData("DashInNooglerHat.jpg");
+    ASSERT_TRUE(data);
+    for (int i = 0; i < 2; i++) {
+      auto descriptor = fml::MakeRefCounted<ImageDescriptor>(
+          data, registry.CreateCompatibleGenerator(data));
+      image_decoder->DecodeWithCache(
+          descriptor, descriptor->width(), descriptor->height(),
+          [&](const sk_sp<DlImage>& image, const std::string& decode_error) {
+            EXPECT_TRUE(
+                runners.GetUITaskRunner()->RunsTasksOnCurrentThread());
+            images.push_back(image);
+            latch.CountDown();
+          });
+      // The data is hashed on a worker, so the result is never invoked
+      // before the request returns.
+      EXPECT_TRUE(images.empty());
+    }
+  });
+  latch.Wait();
+
+  PostTaskSync(runners.GetUITaskRunner(), [&]() {
+    ASSERT_EQ(images.size(), 2u);
+    EXPECT_TRUE(images[0]);
+    EXPECT_EQ(images[0], images[1]);
+    // Both requests have the same key, so only one of them decoded.
+    EXPECT_EQ(image_decoder->GetDecodedImageCacheStats().miss_count, 1u);
+    images.clear();
+    image_decoder.reset();
+  });
+  PostTaskSync(runners.GetIOTaskRunner(), [&]() { io_manager.reset(); });
+}
+
 TEST_F(ImageDecoderFixtureTest, ImpellerUploadToSharedNoGpu) {
 #if !IMPELLER_SUPPORTS_RENDERING
   GTEST_SKIP() << "Impeller only test.";
@@ -581,6 +638,116 @@ TEST_F(ImageDecoderFixtureTest, ImpellerNonWideGamut) {
 #endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
+TEST_F(ImageDecoderFixtureTest, ImpellerPreparesYUVPlanes) {
+#if IMPELLER_SUPPORTS_RENDERING
+  std::shared_ptr<impeller::Allocator> allocator =
+      std::make_shared<impeller::TestImpellerAllocator>();
+  ImageGeneratorRegistry registry;
+  auto make_descriptor = [&registry](const char* fixture_name) {
+    auto data = flutter::testing::OpenFixtureAsSkData(fixture_name);
+    std::shared_ptr<ImageGenerator> generator =
+        registry.CreateCompatibleGenerator(data);
+    FML_CHECK(generator);
+    return fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                std::move(generator));
+  };
+
+  auto descriptor = make_descriptor("DashInNooglerHat.jpg");
+  const SkISize size = descriptor->image_info().dimensions();
+  std::optional<YUVTexture> texture = ImageDecoderImpeller::PrepareYUVTexture(
+      descriptor.get(), SkISize::Make(size.width() / 2, size.height() / 2),
+      {2048, 2048}, allocator);
+  ASSERT_TRUE(texture.has_value());
+  EXPECT_EQ(texture->color_space, impeller::YUVColorSpace::kBT601FullRange);
+  EXPECT_EQ(texture->y_size, impeller::ISize(size.width(), size.height()));
+  EXPECT_EQ(texture->target_size,
+            impeller::ISize(size.width() / 2, size.height() / 2));
+  EXPECT_EQ(texture->y_plane.length,
+            static_cast<size_t>(size.width() * size.height()));
+  EXPECT_EQ(texture->uv_plane.offset, texture->y_plane.length);
+  EXPECT_EQ(texture->uv_plane.length,
+            static_cast<size_t>(texture->uv_size.Area() * 2));
+  // The planes take less space than the RGBA pixels they are converted to.
+  EXPECT_LT(texture->y_plane.length + texture->uv_plane.length,
+            static_cast<size_t>(size.width() * size.height() * 4));
+
+  // A target size larger than the maximum texture size is scaled down without
+  // changing its aspect ratio.
+  std::optional<YUVTexture> clamped_texture =
+      ImageDecoderImpeller::PrepareYUVTexture(descriptor.get(), size,
+                                              {size.width() / 4, size.height()},
+                                              allocator);
+  ASSERT_TRUE(clamped_texture.has_value());
+  EXPECT_EQ(clamped_texture->target_size.width, size.width() / 4);
+  EXPECT_NEAR(clamped_texture->target_size.height, size.height() / 4, 1);
+
+  // Images with EXIF orientations or alpha are decoded on the CPU.
+  auto rotated_descriptor = make_descriptor("Horizontal.jpg");
+  EXPECT_FALSE(ImageDecoderImpeller::PrepareYUVTexture(
+                   rotated_descriptor.get(), SkISize::Make(600, 200),
+                   {2048, 2048}, allocator)
+                   .has_value());
+  auto png_descriptor = make_descriptor("unmultiplied_alpha.png");
+  EXPECT_FALSE(ImageDecoderImpeller::PrepareYUVTexture(
+                   png_descriptor.get(),
+                   png_descriptor->image_info().dimensions(), {2048, 2048},
+                   allocator)
+                   .has_value());
+
+  // The planes are converted without any color space conversion, so images
+  // in other color spaces are decoded on the CPU even if the device does not
+  // support wide gamut colors.
+  auto display_p3_descriptor = make_descriptor("DisplayP3Logo.jpg");
+  ASSERT_TRUE(display_p3_descriptor->image_info().colorSpace());
+  ASSERT_FALSE(display_p3_descriptor->image_info().colorSpace()->isSRGB());
+  EXPECT_FALSE(ImageDecoderImpeller::PrepareYUVTexture(
+                   display_p3_descriptor.get(), SkISize::Make(100, 100),
+                   {2048, 2048}, allocator)
+                   .has_value());
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
+TEST_F(ImageDecoderFixtureTest, ImpellerAlignsYUVPlanesOfOddSizedImages) {
+#if IMPELLER_SUPPORTS_RENDERING
+  std::shared_ptr<impeller::Allocator> allocator =
+      std::make_shared<impeller::TestImpellerAllocator>();
+  // A 4:2:0 image made of flat 8x8 blocks, where the luma of each block is
+  // 40 + 12 * column + 30 * row and the chroma is the same everywhere.
+  auto data = flutter::testing::OpenFixtureAsSkData("OddDimensions.jpg");
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+  ASSERT_EQ(descriptor->image_info().dimensions(), SkISize::Make(33, 17));
+
+  std::optional<YUVTexture> texture = ImageDecoderImpeller::PrepareYUVTexture(
+      descriptor.get(), SkISize::Make(33, 17), {2048, 2048}, allocator);
+  ASSERT_TRUE(texture.has_value());
+  EXPECT_EQ(texture->y_size, impeller::ISize(33, 17));
+  EXPECT_EQ(texture->uv_size, impeller::ISize(17, 9));
+  EXPECT_EQ(texture->y_plane.length, 33u * 17u);
+  // The chroma plane starts at the next two byte texel after the luma plane.
+  EXPECT_EQ(texture->uv_plane.offset, 33u * 17u + 1u);
+  EXPECT_EQ(texture->uv_plane.length, 17u * 9u * 2u);
+  EXPECT_GE(texture->device_buffer->GetDeviceBufferDescriptor().size,
+            texture->uv_plane.offset + texture->uv_plane.length);
+
+  const uint8_t* contents = texture->device_buffer->OnGetContents();
+  for (int y = 0; y < 17; y++) {
+    for (int x = 0; x < 33; x++) {
+      EXPECT_EQ(contents[y * 33 + x], 40 + 12 * (x / 8) + 30 * (y / 8));
+    }
+  }
+  const uint8_t* uv = contents + texture->uv_plane.offset;
+  for (size_t i = 0; i < texture->uv_plane.length; i += 2) {
+    EXPECT_EQ(uv[i], 90);
+    EXPECT_EQ(uv[i + 1], 170);
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+}
+
 TEST_F(ImageDecoderFixtureTest, ExifDataIsRespectedOnDecode) {
   auto loop = fml::ConcurrentMessageLoop::Create();
   TaskRunners runners(GetCurrentTestName(),         // label
@@ -131,4 +131,9 @@ bool ImageDescriptor::get_pixels(const SkPixmap& pixmap) const {
                                pixmap.rowBytes());
 }
 
+bool ImageDescriptor::get_yuva_planes(const SkYUVAPixmaps& pixmaps) const {
+  FML_DCHECK(generator_);
+  return generator_->GetYUVAPlanes(pixmaps);
+}
+
 }  // namespace flutter
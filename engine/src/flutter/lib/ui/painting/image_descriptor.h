@@ -106,6 +106,30 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
     return image_info_.dimensions();
   }
 
+  /// @brief  Gets the block compressed data of this image, if backed by an
+  ///         `ImageGenerator` that stores it in a GPU compatible format.
+  /// @see    `ImageGenerator::GetCompressedData`
+  std::optional<ImageGenerator::CompressedData> get_compressed_data() const {
+    if (generator_) {
+      return generator_->GetCompressedData();
+    }
+    return std::nullopt;
+  }
+
+  /// @brief  Gets the layout of the YUV planes this image can be decoded into,
+  ///         if backed by an `ImageGenerator` that can output planar data.
+  /// @see    `ImageGenerator::QueryYUVAInfo`
+  bool query_yuva_info(SkYUVAPixmapInfo* info) const {
+    if (generator_) {
+      return generator_->QueryYUVAInfo(info);
+    }
+    return false;
+  }
+
+  /// @brief  Decodes this image into the YUV planes reported by
+  ///         `query_yuva_info`.
+  bool get_yuva_planes(const SkYUVAPixmaps& pixmaps) const;
+
   /// @brief  Gets pixels for this image transformed based on the EXIF
   ///         orientation tag, if applicable.
   bool get_pixels(const SkPixmap& pixmap) const;
@@ -16,6 +16,19 @@ namespace flutter {
 
 ImageGenerator::~ImageGenerator() = default;
 
+std::optional<ImageGenerator::CompressedData>
+ImageGenerator::GetCompressedData() const {
+  return std::nullopt;
+}
+
+bool ImageGenerator::QueryYUVAInfo(SkYUVAPixmapInfo* info) const {
+  return false;
+}
+
+bool ImageGenerator::GetYUVAPlanes(const SkYUVAPixmaps& pixmaps) {
+  return false;
+}
+
 sk_sp<SkImage> ImageGenerator::GetImage() {
   SkImageInfo info = GetInfo();
 
@@ -188,6 +201,30 @@ bool BuiltinSkiaCodecImageGenerator::GetPixels(
   return SkPixmapUtils::Orient(output_pixmap, temp_pixmap, origin);
 }
 
+bool BuiltinSkiaCodecImageGenerator::QueryYUVAInfo(
+    SkYUVAPixmapInfo* info) const {
+  // The planes are decoded in the encoded orientation, which only matches the
+  // reported image info for top-left origins.
+  if (codec_->getOrigin() != kTopLeft_SkEncodedOrigin) {
+    return false;
+  }
+  SkYUVAPixmapInfo::SupportedDataTypes data_types;
+  data_types.enableDataType(SkYUVAPixmapInfo::DataType::kUnorm8, 1);
+  data_types.enableDataType(SkYUVAPixmapInfo::DataType::kUnorm8, 2);
+  return codec_->queryYUVAInfo(data_types, info);
+}
+
+bool BuiltinSkiaCodecImageGenerator::GetYUVAPlanes(
+    const SkYUVAPixmaps& pixmaps) {
+  SkCodec::Result result = codec_->getYUVAPlanes(pixmaps);
+  if (result != SkCodec::kSuccess) {
+    FML_DLOG(WARNING) << "codec could not get YUVA planes. "
+                      << SkCodec::ResultToString(result);
+    return false;
+  }
+  return true;
+}
+
 std::unique_ptr<ImageGenerator> BuiltinSkiaCodecImageGenerator::MakeFromData(
     sk_sp<SkData> data) {
   auto codec = SkCodec::MakeFromData(std::move(data));
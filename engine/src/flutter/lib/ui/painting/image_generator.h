@@ -6,6 +6,7 @@
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_H_
 
 #include <optional>
+#include <vector>
 #include "flutter/fml/macros.h"
 #include "third_party/skia/include/codec/SkCodec.h"
 #include "third_party/skia/include/codec/SkCodecAnimation.h"
@@ -14,6 +15,7 @@
 #include "third_party/skia/include/core/SkImageGenerator.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkSize.h"
+#include "third_party/skia/include/core/SkYUVAPixmaps.h"
 
 namespace flutter {
 
@@ -51,6 +53,28 @@ class ImageGenerator {
     SkCodecAnimation::Blend blend_mode;
   };
 
+  /// @brief  GPU block compressed formats that an image generator may expose
+  ///         its encoded data in.
+  enum class CompressedFormat {
+    kBC1RGBA,
+    kBC3RGBA,
+    kBC7RGBA,
+    kETC2RGB8,
+    kETC2RGBA8,
+    kASTC4x4RGBA,
+  };
+
+  /// @brief  Block compressed image data that a GPU can sample from directly,
+  ///         without being decoded first.
+  struct CompressedData {
+    /// The block compression format of every mip level.
+    CompressedFormat format;
+    /// The compressed blocks of each mip level. The first level has the size
+    /// reported by `GetInfo`, and each following level is half the size of the
+    /// previous one.
+    std::vector<sk_sp<SkData>> mip_levels;
+  };
+
   virtual ~ImageGenerator();
 
   /// @brief   Returns basic information about the contents of the encoded
@@ -135,6 +159,33 @@ class ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) = 0;
 
+  /// @brief      Get the encoded image data in a block compressed format that
+  ///             can be uploaded to a GPU texture as-is. Images that are not
+  ///             stored in such a format return no data and must be decoded
+  ///             with `GetPixels`.
+  /// @return     The compressed mip levels of the image, if available.
+  /// @note       Callers must still be able to fall back to `GetPixels` when
+  ///             the device cannot sample from the returned format.
+  virtual std::optional<CompressedData> GetCompressedData() const;
+
+  /// @brief      Get the layout of the planes that the image can be decoded
+  ///             into with `GetYUVAPlanes`, if the decoder can output planar
+  ///             YUV data without converting it to RGB first. The planes are
+  ///             always decoded at the size and orientation reported by
+  ///             `GetInfo`.
+  /// @param[out] info  The plane layout, if available.
+  /// @return     True if the image can be decoded into YUV planes.
+  virtual bool QueryYUVAInfo(SkYUVAPixmapInfo* info) const;
+
+  /// @brief      Decode the image into planes laid out as reported by
+  ///             `QueryYUVAInfo`.
+  /// @param[in]  pixmaps  The planes to decode into.
+  /// @return     True if the planes were successfully decoded.
+  /// @note       Like `GetPixels`, this method performs potentially long
+  ///             synchronous work and should never be executed on the UI
+  ///             thread.
+  virtual bool GetYUVAPlanes(const SkYUVAPixmaps& pixmaps);
+
   /// @brief   Creates an `SkImage` based on the current `ImageInfo` of this
   ///          `ImageGenerator`.
   /// @return  A new `SkImage` containing the decoded image data.
@@ -212,6 +263,12 @@ class BuiltinSkiaCodecImageGenerator : public ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) override;
 
+  // |ImageGenerator|
+  bool QueryYUVAInfo(SkYUVAPixmapInfo* info) const override;
+
+  // |ImageGenerator|
+  bool GetYUVAPlanes(const SkYUVAPixmaps& pixmaps) override;
+
   static std::unique_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
 
  private:
@@ -0,0 +1,633 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "image_generator_ktx2.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "flutter/fml/endianness.h"
+#include "flutter/fml/logging.h"
+#include "third_party/skia/include/core/SkAlphaType.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkColorSpace.h"
+#include "third_party/skia/include/core/SkColorType.h"
+
+namespace flutter {
+
+namespace {
+
+// https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+constexpr uint8_t kKTX2Identifier[12] = {0xAB, 'K',  'T',  'X', ' ',  '2',
+                                         '0',  0xBB, '\r', '\n', 0x1A, '\n'};
+
+struct __attribute__((packed, aligned(1))) KTX2Header {
+  uint8_t identifier[12];
+  uint32_t vk_format;
+  uint32_t type_size;
+  uint32_t pixel_width;
+  uint32_t pixel_height;
+  uint32_t pixel_depth;
+  uint32_t layer_count;
+  uint32_t face_count;
+  uint32_t level_count;
+  uint32_t supercompression_scheme;
+  uint32_t dfd_byte_offset;
+  uint32_t dfd_byte_length;
+  uint32_t kvd_byte_offset;
+  uint32_t kvd_byte_length;
+  uint64_t sgd_byte_offset;
+  uint64_t sgd_byte_length;
+};
+
+struct __attribute__((packed, aligned(1))) KTX2LevelIndex {
+  uint64_t byte_offset;
+  uint64_t byte_length;
+  uint64_t uncompressed_byte_length;
+};
+
+// The offset of the flags byte of the basic descriptor block within the data
+// format descriptor, and the flag marking premultiplied alpha.
+constexpr size_t kDFDFlagsOffset = 15;
+constexpr uint8_t kDFDFlagAlphaPremultiplied = 1;
+
+// A mip chain can never be longer than this for 32-bit image dimensions.
+constexpr uint32_t kMaxLevelCount = 32;
+
+constexpr int kBlockDimension = 4;
+
+// The subset of `VkFormat` values that can be exposed as compressed data. The
+// sRGB variants are sampled like the UNORM ones, which matches how the engine
+// treats the sRGB encoded pixels of every other image format.
+std::optional<ImageGenerator::CompressedFormat> ToCompressedFormat(
+    uint32_t vk_format) {
+  switch (vk_format) {
+    case 133:  // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+    case 134:  // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+      return ImageGenerator::CompressedFormat::kBC1RGBA;
+    case 137:  // VK_FORMAT_BC3_UNORM_BLOCK
+    case 138:  // VK_FORMAT_BC3_SRGB_BLOCK
+      return ImageGenerator::CompressedFormat::kBC3RGBA;
+    case 145:  // VK_FORMAT_BC7_UNORM_BLOCK
+    case 146:  // VK_FORMAT_BC7_SRGB_BLOCK
+      return ImageGenerator::CompressedFormat::kBC7RGBA;
+    case 147:  // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+    case 148:  // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+      return ImageGenerator::CompressedFormat::kETC2RGB8;
+    case 151:  // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+    case 152:  // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+      return ImageGenerator::CompressedFormat::kETC2RGBA8;
+    case 157:  // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+    case 158:  // VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+      return ImageGenerator::CompressedFormat::kASTC4x4RGBA;
+    default:
+      return std::nullopt;
+  }
+}
+
+size_t BytesPerBlock(ImageGenerator::CompressedFormat format) {
+  switch (format) {
+    case ImageGenerator::CompressedFormat::kBC1RGBA:
+    case ImageGenerator::CompressedFormat::kETC2RGB8:
+      return 8;
+    case ImageGenerator::CompressedFormat::kBC3RGBA:
+    case ImageGenerator::CompressedFormat::kBC7RGBA:
+    case ImageGenerator::CompressedFormat::kETC2RGBA8:
+    case ImageGenerator::CompressedFormat::kASTC4x4RGBA:
+      return 16;
+  }
+  FML_UNREACHABLE();
+}
+
+SkISize MipLevelSize(SkISize base_size, size_t level) {
+  return SkISize::Make(std::max(1, base_size.width() >> level),
+                       std::max(1, base_size.height() >> level));
+}
+
+size_t BlockCount(int dimension) {
+  return (dimension + kBlockDimension - 1) / kBlockDimension;
+}
+
+uint8_t Clamp255(int value) {
+  return static_cast<uint8_t>(std::clamp(value, 0, 255));
+}
+
+/// Texels of a decoded 4x4 block in row-major order.
+using BlockTexels = uint8_t[16][4];
+
+//------------------------------------------------------------------------------
+/// BC1 and BC3.
+///
+
+void ExpandRGB565(uint16_t color, uint8_t rgba[4]) {
+  const int r = (color >> 11) & 0x1F;
+  const int g = (color >> 5) & 0x3F;
+  const int b = color & 0x1F;
+  rgba[0] = (r << 3) | (r >> 2);
+  rgba[1] = (g << 2) | (g >> 4);
+  rgba[2] = (b << 3) | (b >> 2);
+  rgba[3] = 255;
+}
+
+void DecodeBC1ColorBlock(const uint8_t* block,
+                         bool allow_punch_through,
+                         BlockTexels texels) {
+  const uint16_t c0 = block[0] | (block[1] << 8);
+  const uint16_t c1 = block[2] | (block[3] << 8);
+  uint8_t palette[4][4];
+  ExpandRGB565(c0, palette[0]);
+  ExpandRGB565(c1, palette[1]);
+  if (c0 > c1 || !allow_punch_through) {
+    for (int i = 0; i < 3; i++) {
+      palette[2][i] = (2 * palette[0][i] + palette[1][i]) / 3;
+      palette[3][i] = (palette[0][i] + 2 * palette[1][i]) / 3;
+    }
+    palette[2][3] = 255;
+    palette[3][3] = 255;
+  } else {
+    for (int i = 0; i < 3; i++) {
+      palette[2][i] = (palette[0][i] + palette[1][i]) / 2;
+      palette[3][i] = 0;
+    }
+    palette[2][3] = 255;
+    palette[3][3] = 0;
+  }
+  const uint32_t indices = block[4] | (block[5] << 8) | (block[6] << 16) |
+                           (static_cast<uint32_t>(block[7]) << 24);
+  for (int i = 0; i < 16; i++) {
+    std::memcpy(texels[i], palette[(indices >> (2 * i)) & 0x3], 4);
+  }
+}
+
+void DecodeBC3AlphaBlock(const uint8_t* block, BlockTexels texels) {
+  const int a0 = block[0];
+  const int a1 = block[1];
+  uint8_t palette[8] = {static_cast<uint8_t>(a0), static_cast<uint8_t>(a1)};
+  if (a0 > a1) {
+    for (int i = 1; i <= 6; i++) {
+      palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+    }
+  } else {
+    for (int i = 1; i <= 4; i++) {
+      palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+    }
+    palette[6] = 0;
+    palette[7] = 255;
+  }
+  uint64_t indices = 0;
+  for (int i = 0; i < 6; i++) {
+    indices |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+  }
+  for (int i = 0; i < 16; i++) {
+    texels[i][3] = palette[(indices >> (3 * i)) & 0x7];
+  }
+}
+
+//------------------------------------------------------------------------------
+/// ETC2 and EAC. Blocks are big-endian and their texel indices are stored in
+/// column-major order.
+///
+
+constexpr int kETC1ModifierTable[8][2] = {
+    {2, 8},   {5, 17},  {9, 29},  {13, 42},
+    {18, 60}, {24, 80}, {33, 106}, {47, 183},
+};
+
+constexpr int kETC2DistanceTable[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+
+constexpr int kEACModifierTable[16][8] = {
+    {-3, -6, -9, -15, 2, 5, 8, 14},  {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},  {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},  {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},  {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},   {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},   {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},   {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},    {-3, -5, -7, -9, 2, 4, 6, 8},
+};
+
+uint64_t ReadBigEndian64(const uint8_t* data) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; i++) {
+    value = (value << 8) | data[i];
+  }
+  return value;
+}
+
+/// Reads `count` bits of `block` ending at the bit position `msb`.
+int Bits(uint64_t block, int count, int msb) {
+  return static_cast<int>((block >> (msb - count + 1)) & ((1u << count) - 1));
+}
+
+int Extend4(int value) {
+  return value * 17;
+}
+
+int Extend5(int value) {
+  return (value << 3) | (value >> 2);
+}
+
+int Extend6(int value) {
+  return (value << 2) | (value >> 4);
+}
+
+int Extend7(int value) {
+  return (value << 1) | (value >> 6);
+}
+
+int SignExtend3(int value) {
+  return value >= 4 ? value - 8 : value;
+}
+
+void SetTexel(BlockTexels texels, int x, int y, int r, int g, int b) {
+  uint8_t* texel = texels[y * kBlockDimension + x];
+  texel[0] = Clamp255(r);
+  texel[1] = Clamp255(g);
+  texel[2] = Clamp255(b);
+  texel[3] = 255;
+}
+
+void DecodeETC2PaintColors(uint64_t block,
+                           const int paint[4][3],
+                           BlockTexels texels) {
+  for (int x = 0; x < kBlockDimension; x++) {
+    for (int y = 0; y < kBlockDimension; y++) {
+      const int i = x * kBlockDimension + y;
+      const int index = (Bits(block, 1, i + 16) << 1) | Bits(block, 1, i);
+      SetTexel(texels, x, y, paint[index][0], paint[index][1], paint[index][2]);
+    }
+  }
+}
+
+void DecodeETC2TMode(uint64_t block, BlockTexels texels) {
+  const int base0[3] = {
+      Extend4((Bits(block, 2, 60) << 2) | Bits(block, 2, 57)),
+      Extend4(Bits(block, 4, 55)),
+      Extend4(Bits(block, 4, 51)),
+  };
+  const int base1[3] = {
+      Extend4(Bits(block, 4, 47)),
+      Extend4(Bits(block, 4, 43)),
+      Extend4(Bits(block, 4, 39)),
+  };
+  const int d =
+      kETC2DistanceTable[(Bits(block, 2, 35) << 1) | Bits(block, 1, 32)];
+  int paint[4][3];
+  for (int c = 0; c < 3; c++) {
+    paint[0][c] = base0[c];
+    paint[1][c] = base1[c] + d;
+    paint[2][c] = base1[c];
+    paint[3][c] = base1[c] - d;
+  }
+  DecodeETC2PaintColors(block, paint, texels);
+}
+
+void DecodeETC2HMode(uint64_t block, BlockTexels texels) {
+  const int base0[3] = {
+      Bits(block, 4, 62),
+      (Bits(block, 3, 58) << 1) | Bits(block, 1, 52),
+      (Bits(block, 1, 51) << 3) | Bits(block, 3, 49),
+  };
+  const int base1[3] = {
+      Bits(block, 4, 46),
+      Bits(block, 4, 42),
+      Bits(block, 4, 38),
+  };
+  const int order0 = (base0[0] << 8) | (base0[1] << 4) | base0[2];
+  const int order1 = (base1[0] << 8) | (base1[1] << 4) | base1[2];
+  const int d =
+      kETC2DistanceTable[(Bits(block, 1, 34) << 2) |
+                         (Bits(block, 1, 32) << 1) | (order0 >= order1)];
+  int paint[4][3];
+  for (int c = 0; c < 3; c++) {
+    paint[0][c] = Extend4(base0[c]) + d;
+    paint[1][c] = Extend4(base0[c]) - d;
+    paint[2][c] = Extend4(base1[c]) + d;
+    paint[3][c] = Extend4(base1[c]) - d;
+  }
+  DecodeETC2PaintColors(block, paint, texels);
+}
+
+void DecodeETC2PlanarMode(uint64_t block, BlockTexels texels) {
+  const int origin[3] = {
+      Extend6(Bits(block, 6, 62)),
+      Extend7((Bits(block, 1, 56) << 6) | Bits(block, 6, 54)),
+      Extend6((Bits(block, 1, 48) << 5) | (Bits(block, 2, 44) << 3) |
+              Bits(block, 3, 41)),
+  };
+  const int horizontal[3] = {
+      Extend6((Bits(block, 5, 38) << 1) | Bits(block, 1, 32)),
+      Extend7(Bits(block, 7, 31)),
+      Extend6(Bits(block, 6, 24)),
+  };
+  const int vertical[3] = {
+      Extend6(Bits(block, 6, 18)),
+      Extend7(Bits(block, 7, 12)),
+      Extend6(Bits(block, 6, 5)),
+  };
+  for (int y = 0; y < kBlockDimension; y++) {
+    for (int x = 0; x < kBlockDimension; x++) {
+      int color[3];
+      for (int c = 0; c < 3; c++) {
+        color[c] = (x * (horizontal[c] - origin[c]) +
+                    y * (vertical[c] - origin[c]) + 4 * origin[c] + 2) >>
+                   2;
+      }
+      SetTexel(texels, x, y, color[0], color[1], color[2]);
+    }
+  }
+}
+
+void DecodeETC2ColorBlock(const uint8_t* data, BlockTexels texels) {
+  const uint64_t block = ReadBigEndian64(data);
+  const bool differential = Bits(block, 1, 33);
+
+  int base[2][3];
+  if (differential) {
+    for (int c = 0; c < 3; c++) {
+      const int value = Bits(block, 5, 63 - 8 * c);
+      const int delta = SignExtend3(Bits(block, 3, 58 - 8 * c));
+      if (value + delta < 0 || value + delta > 31) {
+        // An overflowing channel selects one of the modes added by ETC2.
+        switch (c) {
+          case 0:
+            return DecodeETC2TMode(block, texels);
+          case 1:
+            return DecodeETC2HMode(block, texels);
+          default:
+            return DecodeETC2PlanarMode(block, texels);
+        }
+      }
+      base[0][c] = Extend5(value);
+      base[1][c] = Extend5(value + delta);
+    }
+  } else {
+    for (int c = 0; c < 3; c++) {
+      base[0][c] = Extend4(Bits(block, 4, 63 - 8 * c));
+      base[1][c] = Extend4(Bits(block, 4, 59 - 8 * c));
+    }
+  }
+
+  const int tables[2] = {Bits(block, 3, 39), Bits(block, 3, 36)};
+  const bool flip = Bits(block, 1, 32);
+  for (int x = 0; x < kBlockDimension; x++) {
+    for (int y = 0; y < kBlockDimension; y++) {
+      const int subblock = flip ? (y >= 2) : (x >= 2);
+      const int i = x * kBlockDimension + y;
+      const int* modifiers = kETC1ModifierTable[tables[subblock]];
+      int modifier = modifiers[Bits(block, 1, i)];
+      if (Bits(block, 1, i + 16)) {
+        modifier = -modifier;
+      }
+      SetTexel(texels, x, y, base[subblock][0] + modifier,
+               base[subblock][1] + modifier, base[subblock][2] + modifier);
+    }
+  }
+}
+
+void DecodeEACAlphaBlock(const uint8_t* data, BlockTexels texels) {
+  const uint64_t block = ReadBigEndian64(data);
+  const int base = Bits(block, 8, 63);
+  const int multiplier = Bits(block, 4, 55);
+  const int* modifiers = kEACModifierTable[Bits(block, 4, 51)];
+  for (int x = 0; x < kBlockDimension; x++) {
+    for (int y = 0; y < kBlockDimension; y++) {
+      const int i = x * kBlockDimension + y;
+      const int index = Bits(block, 3, 47 - 3 * i);
+      texels[y * kBlockDimension + x][3] =
+          Clamp255(base + modifiers[index] * multiplier);
+    }
+  }
+}
+
+}  // namespace
+
+KTX2ImageGenerator::~KTX2ImageGenerator() = default;
+
+KTX2ImageGenerator::KTX2ImageGenerator(SkImageInfo image_info,
+                                       CompressedData compressed_data)
+    : image_info_(std::move(image_info)),
+      compressed_data_(std::move(compressed_data)) {}
+
+const SkImageInfo& KTX2ImageGenerator::GetInfo() {
+  return image_info_;
+}
+
+unsigned int KTX2ImageGenerator::GetFrameCount() const {
+  return 1;
+}
+
+unsigned int KTX2ImageGenerator::GetPlayCount() const {
+  return 1;
+}
+
+const ImageGenerator::FrameInfo KTX2ImageGenerator::GetFrameInfo(
+    unsigned int frame_index) {
+  return {.required_frame = std::nullopt,
+          .duration = 0,
+          .disposal_method = SkCodecAnimation::DisposalMethod::kKeep};
+}
+
+SkISize KTX2ImageGenerator::GetScaledDimensions(float desired_scale) {
+  // Pick the smallest mip level that is still at least as large as the
+  // requested size, so that decoding it never requires upscaling.
+  const SkISize base_size = image_info_.dimensions();
+  const SkISize desired_size = SkISize::Make(
+      static_cast<int32_t>(std::lround(base_size.width() * desired_scale)),
+      static_cast<int32_t>(std::lround(base_size.height() * desired_scale)));
+  SkISize result = base_size;
+  for (size_t level = 1; level < compressed_data_.mip_levels.size(); level++) {
+    const SkISize level_size = MipLevelSize(base_size, level);
+    if (level_size.width() < desired_size.width() ||
+        level_size.height() < desired_size.height()) {
+      break;
+    }
+    result = level_size;
+  }
+  return result;
+}
+
+bool KTX2ImageGenerator::GetPixels(const SkImageInfo& info,
+                                   void* pixels,
+                                   size_t row_bytes,
+                                   unsigned int frame_index,
+                                   std::optional<unsigned int> prior_frame) {
+  std::optional<size_t> level;
+  for (size_t i = 0; i < compressed_data_.mip_levels.size(); i++) {
+    if (MipLevelSize(image_info_.dimensions(), i) == info.dimensions()) {
+      level = i;
+      break;
+    }
+  }
+  if (!level.has_value()) {
+    FML_DLOG(ERROR) << "No mip level of the KTX2 image has the requested size "
+                    << info.width() << "x" << info.height() << ".";
+    return false;
+  }
+
+  if (info.colorType() == kRGBA_8888_SkColorType &&
+      info.alphaType() == image_info_.alphaType()) {
+    return DecodeMipLevel(level.value(), pixels, row_bytes);
+  }
+
+  // Decode into an intermediate and let Skia convert the pixels.
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocPixels(image_info_.makeDimensions(info.dimensions()))) {
+    FML_DLOG(ERROR) << "Failed to allocate memory for KTX2 decoding.";
+    return false;
+  }
+  if (!DecodeMipLevel(level.value(), bitmap.getPixels(), bitmap.rowBytes())) {
+    return false;
+  }
+  return bitmap.readPixels(info, pixels, row_bytes, 0, 0);
+}
+
+std::optional<ImageGenerator::CompressedData>
+KTX2ImageGenerator::GetCompressedData() const {
+  return compressed_data_;
+}
+
+bool KTX2ImageGenerator::DecodeMipLevel(size_t level,
+                                        void* pixels,
+                                        size_t row_bytes) const {
+  const auto format = compressed_data_.format;
+  if (format == CompressedFormat::kBC7RGBA ||
+      format == CompressedFormat::kASTC4x4RGBA) {
+    FML_DLOG(ERROR) << "Decoding BC7 and ASTC images on the CPU is not "
+                       "supported.";
+    return false;
+  }
+
+  const SkISize size = MipLevelSize(image_info_.dimensions(), level);
+  const size_t bytes_per_block = BytesPerBlock(format);
+  const uint8_t* block = compressed_data_.mip_levels[level]->bytes();
+  uint8_t* destination = static_cast<uint8_t*>(pixels);
+  BlockTexels texels;
+
+  for (int block_y = 0; block_y < size.height(); block_y += kBlockDimension) {
+    for (int block_x = 0; block_x < size.width(); block_x += kBlockDimension) {
+      switch (format) {
+        case CompressedFormat::kBC1RGBA:
+          DecodeBC1ColorBlock(block, /*allow_punch_through=*/true, texels);
+          break;
+        case CompressedFormat::kBC3RGBA:
+          DecodeBC1ColorBlock(block + 8, /*allow_punch_through=*/false,
+                              texels);
+          DecodeBC3AlphaBlock(block, texels);
+          break;
+        case CompressedFormat::kETC2RGB8:
+          DecodeETC2ColorBlock(block, texels);
+          break;
+        case CompressedFormat::kETC2RGBA8:
+          DecodeETC2ColorBlock(block + 8, texels);
+          DecodeEACAlphaBlock(block, texels);
+          break;
+        case CompressedFormat::kBC7RGBA:
+        case CompressedFormat::kASTC4x4RGBA:
+          FML_UNREACHABLE();
+      }
+      block += bytes_per_block;
+
+      // Blocks at the right and bottom edges may extend past the image.
+      const int columns = std::min(kBlockDimension, size.width() - block_x);
+      const int rows = std::min(kBlockDimension, size.height() - block_y);
+      for (int y = 0; y < rows; y++) {
+        std::memcpy(destination + (block_y + y) * row_bytes + block_x * 4,
+                    texels[y * kBlockDimension], columns * 4);
+      }
+    }
+  }
+  return true;
+}
+
+std::unique_ptr<ImageGenerator> KTX2ImageGenerator::MakeFromData(
+    sk_sp<SkData> data) {
+  if (!data || data->size() < sizeof(KTX2Header) ||
+      std::memcmp(data->bytes(), kKTX2Identifier, sizeof(kKTX2Identifier)) !=
+          0) {
+    return nullptr;
+  }
+
+  KTX2Header header;
+  std::memcpy(&header, data->bytes(), sizeof(KTX2Header));
+  const uint32_t vk_format = fml::LittleEndianToArch(header.vk_format);
+  const uint32_t width = fml::LittleEndianToArch(header.pixel_width);
+  const uint32_t height = fml::LittleEndianToArch(header.pixel_height);
+  const uint32_t level_count =
+      std::max(1u, fml::LittleEndianToArch(header.level_count));
+
+  if (fml::LittleEndianToArch(header.supercompression_scheme) != 0) {
+    FML_DLOG(ERROR) << "Supercompressed KTX2 images are not supported.";
+    return nullptr;
+  }
+  const auto format = ToCompressedFormat(vk_format);
+  if (!format.has_value()) {
+    FML_DLOG(ERROR) << "Unsupported KTX2 image format (VkFormat=" << vk_format
+                    << ").";
+    return nullptr;
+  }
+  if (width == 0 || height == 0 ||
+      width > static_cast<uint32_t>(std::numeric_limits<int32_t>::max()) ||
+      height > static_cast<uint32_t>(std::numeric_limits<int32_t>::max()) ||
+      fml::LittleEndianToArch(header.pixel_depth) != 0 ||
+      fml::LittleEndianToArch(header.layer_count) > 1 ||
+      fml::LittleEndianToArch(header.face_count) != 1 ||
+      level_count > kMaxLevelCount) {
+    FML_DLOG(ERROR) << "Only single 2D KTX2 textures are supported.";
+    return nullptr;
+  }
+
+  const uint8_t* bytes = data->bytes();
+  const size_t size = data->size();
+  if (sizeof(KTX2Header) + level_count * sizeof(KTX2LevelIndex) > size) {
+    FML_DLOG(ERROR) << "KTX2 level index is out of bounds.";
+    return nullptr;
+  }
+
+  const SkISize base_size =
+      SkISize::Make(static_cast<int32_t>(width), static_cast<int32_t>(height));
+  CompressedData compressed_data{.format = format.value()};
+  for (uint32_t level = 0; level < level_count; level++) {
+    KTX2LevelIndex index;
+    std::memcpy(&index,
+                bytes + sizeof(KTX2Header) + level * sizeof(KTX2LevelIndex),
+                sizeof(KTX2LevelIndex));
+    const uint64_t offset = fml::LittleEndianToArch(index.byte_offset);
+    const uint64_t length = fml::LittleEndianToArch(index.byte_length);
+    const SkISize level_size = MipLevelSize(base_size, level);
+    const uint64_t expected_length = BlockCount(level_size.width()) *
+                                     BlockCount(level_size.height()) *
+                                     BytesPerBlock(format.value());
+    if (length != expected_length || offset > size || length > size - offset) {
+      FML_DLOG(ERROR) << "KTX2 mip level " << level << " is invalid.";
+      return nullptr;
+    }
+    compressed_data.mip_levels.push_back(
+        SkData::MakeSubset(data.get(), offset, length));
+  }
+
+  SkAlphaType alpha_type = kUnpremul_SkAlphaType;
+  if (format == CompressedFormat::kETC2RGB8) {
+    alpha_type = kOpaque_SkAlphaType;
+  } else if (format == CompressedFormat::kBC1RGBA) {
+    // Punch-through texels decode to transparent black.
+    alpha_type = kPremul_SkAlphaType;
+  } else {
+    const uint64_t dfd_offset = fml::LittleEndianToArch(header.dfd_byte_offset);
+    const uint64_t dfd_length = fml::LittleEndianToArch(header.dfd_byte_length);
+    if (dfd_length > kDFDFlagsOffset && dfd_offset + kDFDFlagsOffset < size &&
+        (bytes[dfd_offset + kDFDFlagsOffset] & kDFDFlagAlphaPremultiplied)) {
+      alpha_type = kPremul_SkAlphaType;
+    }
+  }
+
+  return std::unique_ptr<KTX2ImageGenerator>(new KTX2ImageGenerator(
+      SkImageInfo::Make(base_size, kRGBA_8888_SkColorType, alpha_type,
+                        SkColorSpace::MakeSRGB()),
+      std::move(compressed_data)));
+}
+
+}  // namespace flutter
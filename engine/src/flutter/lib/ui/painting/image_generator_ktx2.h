@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_KTX2_H_
+#define FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_KTX2_H_
+
+#include "image_generator.h"
+
+#include <vector>
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      An image generator for KTX2 containers holding block compressed
+///             2D textures.
+///
+///             The compressed mip levels are exposed through
+///             `GetCompressedData` so that they can be uploaded to the GPU
+///             without being decoded. For devices that cannot sample from the
+///             format, `GetPixels` decodes BC1, BC3 and ETC2 data on the CPU.
+///
+///             Supercompressed containers (including Basis Universal) are
+///             rejected, as no transcoder is available.
+///
+class KTX2ImageGenerator : public ImageGenerator {
+ public:
+  ~KTX2ImageGenerator();
+
+  // |ImageGenerator|
+  const SkImageInfo& GetInfo() override;
+
+  // |ImageGenerator|
+  unsigned int GetFrameCount() const override;
+
+  // |ImageGenerator|
+  unsigned int GetPlayCount() const override;
+
+  // |ImageGenerator|
+  const ImageGenerator::FrameInfo GetFrameInfo(
+      unsigned int frame_index) override;
+
+  // |ImageGenerator|
+  SkISize GetScaledDimensions(float desired_scale) override;
+
+  // |ImageGenerator|
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) override;
+
+  // |ImageGenerator|
+  std::optional<CompressedData> GetCompressedData() const override;
+
+  static std::unique_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
+
+ private:
+  KTX2ImageGenerator(SkImageInfo image_info, CompressedData compressed_data);
+
+  /// @brief  Decodes a mip level into RGBA8888 pixels with the alpha type of
+  ///         `image_info_`. Fails for formats without a CPU decoder.
+  bool DecodeMipLevel(size_t level, void* pixels, size_t row_bytes) const;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(KTX2ImageGenerator);
+  SkImageInfo image_info_;
+  CompressedData compressed_data_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_IMAGE_GENERATOR_KTX2_H_
@@ -0,0 +1,194 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/image_generator_ktx2.h"
+
+#include <cstring>
+#include <vector>
+
+#include "flutter/lib/ui/painting/image_generator_registry.h"
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr uint32_t kVkFormatBC1RGBAUNorm = 133;
+constexpr uint32_t kVkFormatETC2R8G8B8A8UNorm = 151;
+
+void AppendUint32(std::vector<uint8_t>& bytes, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    bytes.push_back((value >> (8 * i)) & 0xFF);
+  }
+}
+
+void AppendUint64(std::vector<uint8_t>& bytes, uint64_t value) {
+  for (int i = 0; i < 8; i++) {
+    bytes.push_back((value >> (8 * i)) & 0xFF);
+  }
+}
+
+// Builds a little-endian KTX2 container with the given mip levels, largest
+// first.
+sk_sp<SkData> MakeKTX2(uint32_t vk_format,
+                       uint32_t width,
+                       uint32_t height,
+                       const std::vector<std::vector<uint8_t>>& levels,
+                       uint32_t supercompression_scheme = 0) {
+  const uint8_t identifier[12] = {0xAB, 'K',  'T',  'X',  ' ',  '2',
+                                  '0',  0xBB, '\r', '\n', 0x1A, '\n'};
+  std::vector<uint8_t> bytes(identifier, identifier + sizeof(identifier));
+  AppendUint32(bytes, vk_format);
+  AppendUint32(bytes, 1);  // typeSize
+  AppendUint32(bytes, width);
+  AppendUint32(bytes, height);
+  AppendUint32(bytes, 0);  // pixelDepth
+  AppendUint32(bytes, 0);  // layerCount
+  AppendUint32(bytes, 1);  // faceCount
+  AppendUint32(bytes, levels.size());
+  AppendUint32(bytes, supercompression_scheme);
+  for (int i = 0; i < 4; i++) {
+    AppendUint32(bytes, 0);  // DFD and key/value data.
+  }
+  AppendUint64(bytes, 0);  // sgdByteOffset
+  AppendUint64(bytes, 0);  // sgdByteLength
+
+  uint64_t offset = bytes.size() + levels.size() * 24;
+  for (const auto& level : levels) {
+    AppendUint64(bytes, offset);
+    AppendUint64(bytes, level.size());
+    AppendUint64(bytes, level.size());
+    offset += level.size();
+  }
+  for (const auto& level : levels) {
+    bytes.insert(bytes.end(), level.begin(), level.end());
+  }
+  return SkData::MakeWithCopy(bytes.data(), bytes.size());
+}
+
+// A BC1 block where every texel has the first endpoint color, pure red.
+const std::vector<uint8_t> kRedBC1Block = {0x00, 0xF8, 0x1F, 0x00,
+                                           0x00, 0x00, 0x00, 0x00};
+
+// An opaque EAC alpha block followed by an ETC2 block in individual mode with
+// zero base colors, which decodes to (2, 2, 2).
+const std::vector<uint8_t> kGrayETC2RGBA8Block = {
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+}  // namespace
+
+TEST(KTX2ImageGeneratorTest, ParsesBC1Image) {
+  auto generator = KTX2ImageGenerator::MakeFromData(
+      MakeKTX2(kVkFormatBC1RGBAUNorm, 4, 4, {kRedBC1Block}));
+  ASSERT_NE(generator, nullptr);
+
+  const auto& info = generator->GetInfo();
+  EXPECT_EQ(info.width(), 4);
+  EXPECT_EQ(info.height(), 4);
+  EXPECT_EQ(info.alphaType(), kPremul_SkAlphaType);
+  EXPECT_EQ(generator->GetFrameCount(), 1u);
+
+  auto compressed_data = generator->GetCompressedData();
+  ASSERT_TRUE(compressed_data.has_value());
+  EXPECT_EQ(compressed_data->format,
+            ImageGenerator::CompressedFormat::kBC1RGBA);
+  ASSERT_EQ(compressed_data->mip_levels.size(), 1u);
+  EXPECT_EQ(compressed_data->mip_levels[0]->size(), kRedBC1Block.size());
+}
+
+TEST(KTX2ImageGeneratorTest, DecodesBC1OnCPU) {
+  // A 6x6 image spans partial blocks at the right and bottom edges.
+  std::vector<uint8_t> level;
+  for (int i = 0; i < 4; i++) {
+    level.insert(level.end(), kRedBC1Block.begin(), kRedBC1Block.end());
+  }
+  auto generator = KTX2ImageGenerator::MakeFromData(
+      MakeKTX2(kVkFormatBC1RGBAUNorm, 6, 6, {level}));
+  ASSERT_NE(generator, nullptr);
+
+  const auto info = generator->GetInfo();
+  std::vector<uint32_t> pixels(info.width() * info.height());
+  ASSERT_TRUE(generator->GetPixels(info, pixels.data(), info.minRowBytes(), 0,
+                                   std::nullopt));
+  for (uint32_t pixel : pixels) {
+    const auto* rgba = reinterpret_cast<const uint8_t*>(&pixel);
+    EXPECT_EQ(rgba[0], 255);
+    EXPECT_EQ(rgba[1], 0);
+    EXPECT_EQ(rgba[2], 0);
+    EXPECT_EQ(rgba[3], 255);
+  }
+}
+
+TEST(KTX2ImageGeneratorTest, SelectsMipLevelsForScaledDecodes) {
+  std::vector<uint8_t> base_level;
+  for (int i = 0; i < 4; i++) {
+    base_level.insert(base_level.end(), kGrayETC2RGBA8Block.begin(),
+                      kGrayETC2RGBA8Block.end());
+  }
+  auto generator = KTX2ImageGenerator::MakeFromData(
+      MakeKTX2(kVkFormatETC2R8G8B8A8UNorm, 8, 8,
+               {base_level, kGrayETC2RGBA8Block, kGrayETC2RGBA8Block,
+                kGrayETC2RGBA8Block}));
+  ASSERT_NE(generator, nullptr);
+  EXPECT_EQ(generator->GetCompressedData()->mip_levels.size(), 4u);
+
+  EXPECT_EQ(generator->GetScaledDimensions(1.0), SkISize::Make(8, 8));
+  EXPECT_EQ(generator->GetScaledDimensions(0.5), SkISize::Make(4, 4));
+  EXPECT_EQ(generator->GetScaledDimensions(0.4), SkISize::Make(4, 4));
+  EXPECT_EQ(generator->GetScaledDimensions(0.1), SkISize::Make(1, 1));
+
+  const auto info = generator->GetInfo().makeWH(2, 2);
+  std::vector<uint32_t> pixels(info.width() * info.height());
+  ASSERT_TRUE(generator->GetPixels(info, pixels.data(), info.minRowBytes(), 0,
+                                   std::nullopt));
+  for (uint32_t pixel : pixels) {
+    const auto* rgba = reinterpret_cast<const uint8_t*>(&pixel);
+    EXPECT_EQ(rgba[0], 2);
+    EXPECT_EQ(rgba[1], 2);
+    EXPECT_EQ(rgba[2], 2);
+    EXPECT_EQ(rgba[3], 255);
+  }
+
+  // Sizes that do not match a mip level cannot be decoded.
+  const auto unsupported_info = generator->GetInfo().makeWH(3, 3);
+  pixels.resize(unsupported_info.width() * unsupported_info.height());
+  EXPECT_FALSE(generator->GetPixels(unsupported_info, pixels.data(),
+                                    unsupported_info.minRowBytes(), 0,
+                                    std::nullopt));
+}
+
+TEST(KTX2ImageGeneratorTest, RejectsInvalidImages) {
+  // Supercompressed data requires a transcoder.
+  EXPECT_EQ(KTX2ImageGenerator::MakeFromData(
+                MakeKTX2(kVkFormatBC1RGBAUNorm, 4, 4, {kRedBC1Block},
+                         /*supercompression_scheme=*/2)),
+            nullptr);
+  // Basis Universal images have an undefined format.
+  EXPECT_EQ(KTX2ImageGenerator::MakeFromData(
+                MakeKTX2(/*VK_FORMAT_UNDEFINED*/ 0, 4, 4, {kRedBC1Block})),
+            nullptr);
+  // The level is too small for the image size.
+  EXPECT_EQ(KTX2ImageGenerator::MakeFromData(
+                MakeKTX2(kVkFormatBC1RGBAUNorm, 8, 8, {kRedBC1Block})),
+            nullptr);
+  // Truncated data.
+  auto data = MakeKTX2(kVkFormatBC1RGBAUNorm, 4, 4, {kRedBC1Block});
+  EXPECT_EQ(KTX2ImageGenerator::MakeFromData(
+                SkData::MakeSubset(data.get(), 0, data->size() - 1)),
+            nullptr);
+}
+
+TEST(KTX2ImageGeneratorTest, RegistryCreatesKTX2Generator) {
+  ImageGeneratorRegistry registry;
+  auto generator = registry.CreateCompatibleGenerator(
+      MakeKTX2(kVkFormatBC1RGBAUNorm, 4, 4, {kRedBC1Block}));
+  ASSERT_NE(generator, nullptr);
+  EXPECT_TRUE(generator->GetCompressedData().has_value());
+}
+
+}  // namespace testing
+}  // namespace flutter
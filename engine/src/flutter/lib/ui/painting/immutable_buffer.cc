@@ -6,6 +6,7 @@
 
 #include <cstring>
 
+#include "flutter/assets/asset_manager.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/lib/ui/ui_dart_state.h"
@@ -23,6 +24,17 @@ namespace flutter {
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, ImmutableBuffer);
 
+// Whether the assets of a resolver stay unchanged while they are mapped. In
+// debug builds the tool rewrites the files of asset directories in place for
+// hot reload and restart, so only the assets of the APK are immutable.
+static bool IsImmutableAsset(AssetResolver::AssetResolverType resolver_type) {
+#if (FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG)
+  return resolver_type == AssetResolver::AssetResolverType::kApkAssetProvider;
+#else
+  return true;
+#endif  // (FLUTTER_RUNTIME_MODE == FLUTTER_RUNTIME_MODE_DEBUG)
+}
+
 ImmutableBuffer::~ImmutableBuffer() {}
 
 Dart_Handle ImmutableBuffer::init(Dart_Handle buffer_handle,
@@ -101,16 +113,18 @@ Dart_Handle ImmutableBuffer::initFromAsset(Dart_Handle raw_buffer_handle,
       [asset_name = std::move(asset_name),
        asset_manager = std::move(asset_manager),
        ui_task_runner = std::move(ui_task_runner), ui_task] {
+        AssetResolver::AssetResolverType resolver_type;
         std::unique_ptr<fml::Mapping> mapping =
-            asset_manager->GetAsMapping(asset_name);
-
+            asset_manager->GetAsMappingWithResolverType(asset_name,
+                                                        &resolver_type);
         sk_sp<SkData> sk_data;
-        size_t buffer_size = 0;
-        if (mapping != nullptr) {
-          buffer_size = mapping->GetSize();
-          const void* bytes = static_cast<const void*>(mapping->GetMapping());
-          sk_data = MakeSkDataWithCopy(bytes, buffer_size);
+        if (mapping != nullptr && IsImmutableAsset(resolver_type)) {
+          sk_data = MakeSkDataFromMapping(std::move(mapping));
+        } else if (mapping != nullptr) {
+          sk_data =
+              MakeSkDataWithCopy(mapping->GetMapping(), mapping->GetSize());
         }
+        size_t buffer_size = sk_data ? sk_data->size() : 0;
         ui_task_runner->PostTask(
             [sk_data = std::move(sk_data), ui_task = ui_task, buffer_size]() {
               ui_task(sk_data, buffer_size);
@@ -174,12 +188,14 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
         auto mapping = std::make_unique<fml::FileMapping>(fml::OpenFile(
             file_path.c_str(), false, fml::FilePermission::kRead));
 
+        // Unlike bundled assets, user files can be modified or truncated by
+        // other processes while mapped, which would change the buffer or
+        // fault on access. They are copied so that the buffer is immutable.
         sk_sp<SkData> sk_data;
         size_t buffer_size = 0;
         if (mapping->IsValid()) {
           buffer_size = mapping->GetSize();
-          const void* bytes = static_cast<const void*>(mapping->GetMapping());
-          sk_data = MakeSkDataWithCopy(bytes, buffer_size);
+          sk_data = MakeSkDataWithCopy(mapping->GetMapping(), buffer_size);
         }
         ui_task_runner->PostTask(
             [sk_data = std::move(sk_data), ui_task = ui_task, buffer_size]() {
@@ -189,6 +205,25 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
   return Dart_Null();
 }
 
+sk_sp<SkData> ImmutableBuffer::MakeSkDataFromMapping(
+    std::unique_ptr<fml::Mapping> mapping) {
+  if (!mapping) {
+    return nullptr;
+  }
+  const size_t size = mapping->GetSize();
+  const uint8_t* bytes = mapping->GetMapping();
+  if (size == 0 || bytes == nullptr) {
+    return SkData::MakeEmpty();
+  }
+
+  // Memory mapped assets are read straight from their pages instead of being
+  // copied to the heap, and the mapping lives as long as the data.
+  SkData::ReleaseProc proc = [](const void* ptr, void* context) {
+    delete reinterpret_cast<fml::Mapping*>(context);
+  };
+  return SkData::MakeWithProc(bytes, size, proc, mapping.release());
+}
+
 #if FML_OS_ANDROID
 
 // Compressed image buffers are allocated on the UI thread but are deleted on a
@@ -6,8 +6,10 @@
 #define FLUTTER_LIB_UI_PAINTING_IMMUTABLE_BUFFER_H_
 
 #include <cstdint>
+#include <memory>
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/tonic/dart_library_natives.h"
@@ -79,6 +81,16 @@ class ImmutableBuffer : public RefCountedDartWrappable<ImmutableBuffer> {
   /// Callers should not modify the returned data. This is not exposed to Dart.
   sk_sp<SkData> data() const { return data_; }
 
+  /// Wraps the bytes of a mapping without copying them. The mapping is
+  /// released once the returned data is no longer referenced. A file mapping
+  /// still shows changes that are made to its file, so only use this for
+  /// files that are not modified while the engine runs, such as the assets of
+  /// an APK or of a release build.
+  ///
+  /// Returns nullptr if the mapping is null.
+  static sk_sp<SkData> MakeSkDataFromMapping(
+      std::unique_ptr<fml::Mapping> mapping);
+
   /// Clears the Dart native fields and removes the reference to the underlying
   /// byte buffer.
   ///
@@ -0,0 +1,41 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/immutable_buffer.h"
+
+#include <vector>
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(ImmutableBufferTest, WrapsMappingWithoutCopying) {
+  std::vector<uint8_t> bytes = {1, 2, 3, 4};
+  bool released = false;
+  auto mapping = std::make_unique<fml::NonOwnedMapping>(
+      bytes.data(), bytes.size(),
+      [&released](const uint8_t* data, size_t size) { released = true; });
+
+  auto data = ImmutableBuffer::MakeSkDataFromMapping(std::move(mapping));
+  ASSERT_NE(data, nullptr);
+  EXPECT_EQ(data->bytes(), bytes.data());
+  EXPECT_EQ(data->size(), bytes.size());
+  EXPECT_FALSE(released);
+
+  data.reset();
+  EXPECT_TRUE(released);
+}
+
+TEST(ImmutableBufferTest, WrapsEmptyAndNullMappings) {
+  EXPECT_EQ(ImmutableBuffer::MakeSkDataFromMapping(nullptr), nullptr);
+
+  auto data = ImmutableBuffer::MakeSkDataFromMapping(
+      std::make_unique<fml::DataMapping>(std::vector<uint8_t>{}));
+  ASSERT_NE(data, nullptr);
+  EXPECT_EQ(data->size(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -191,9 +191,11 @@ void CanvasPath::addArc(double left,
   resetVolatility();
 }
 
-void CanvasPath::addPolygon(const tonic::Float32List& points, bool close) {
-  sk_path_.addPoly(reinterpret_cast<const SkPoint*>(points.data()),
-                   points.num_elements() / 2, close);
+void CanvasPath::addPolygon(const float* points,
+                            int point_count,
+                            bool close) {
+  sk_path_.addPoly(reinterpret_cast<const SkPoint*>(points), point_count,
+                   close);
   resetVolatility();
 }
 
@@ -86,7 +86,7 @@ class CanvasPath : public RefCountedDartWrappable<CanvasPath> {
               double bottom,
               double startAngle,
               double sweepAngle);
-  void addPolygon(const tonic::Float32List& points, bool close);
+  void addPolygon(const float* points, int point_count, bool close);
   void addRRect(const RRect& rrect);
   void addPath(CanvasPath* path, double dx, double dy);
 
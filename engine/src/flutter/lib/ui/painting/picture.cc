@@ -4,6 +4,7 @@
 
 #include "flutter/lib/ui/painting/picture.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -21,6 +22,7 @@
 #include "third_party/tonic/dart_library_natives.h"
 #include "third_party/tonic/dart_persistent_value.h"
 #include "third_party/tonic/logging/dart_invoke.h"
+#include "third_party/tonic/typed_data/typed_list.h"
 
 namespace flutter {
 
@@ -118,6 +120,20 @@ size_t Picture::GetAllocationSize() const {
   }
 }
 
+// Wraps a snapshot for use on the UI thread.
+static fml::RefPtr<CanvasImage> CreateCanvasImage(
+    sk_sp<DlImage> image,
+    fml::RefPtr<SkiaUnrefQueue> unref_queue) {
+  if (!image->isUIThreadSafe()) {
+    // All images with impeller textures should already be safe.
+    FML_DCHECK(image->impeller_texture() == nullptr);
+    image = DlImageGPU::Make({image->skia_image(), std::move(unref_queue)});
+  }
+  auto dart_image = CanvasImage::Create();
+  dart_image->set_image(image);
+  return dart_image;
+}
+
 Dart_Handle Picture::RasterizeToImage(const sk_sp<DisplayList>& display_list,
                                       uint32_t width,
                                       uint32_t height,
@@ -181,15 +197,7 @@ Dart_Handle Picture::DoRasterizeToImage(const sk_sp<DisplayList>& display_list,
           return;
         }
 
-        if (!image->isUIThreadSafe()) {
-          // All images with impeller textures should already be safe.
-          FML_DCHECK(image->impeller_texture() == nullptr);
-          image =
-              DlImageGPU::Make({image->skia_image(), std::move(unref_queue)});
-        }
-
-        auto dart_image = CanvasImage::Create();
-        dart_image->set_image(image);
+        auto dart_image = CreateCanvasImage(image, std::move(unref_queue));
         auto* raw_dart_image = tonic::ToDart(dart_image);
 
         // All done!
@@ -226,4 +234,103 @@ Dart_Handle Picture::DoRasterizeToImage(const sk_sp<DisplayList>& display_list,
   return Dart_Null();
 }
 
+Dart_Handle Picture::toImages(Dart_Handle pictures_handle,
+                              Dart_Handle widths_handle,
+                              Dart_Handle heights_handle,
+                              Dart_Handle raw_images_callback) {
+  if (Dart_IsNull(raw_images_callback) ||
+      !Dart_IsClosure(raw_images_callback)) {
+    return tonic::ToDart("Image callback was invalid");
+  }
+
+  std::vector<SkISize> picture_sizes;
+  {
+    tonic::Uint32List widths(widths_handle);
+    tonic::Uint32List heights(heights_handle);
+    if (widths.num_elements() != heights.num_elements()) {
+      return tonic::ToDart("Image dimensions for pictures were invalid.");
+    }
+    for (intptr_t i = 0; i < widths.num_elements(); i++) {
+      if (widths[i] == 0 || heights[i] == 0) {
+        return tonic::ToDart("Image dimensions for pictures were invalid.");
+      }
+      picture_sizes.push_back(SkISize::Make(widths[i], heights[i]));
+    }
+  }
+
+  intptr_t count = 0;
+  if (Dart_IsError(Dart_ListLength(pictures_handle, &count)) ||
+      count != static_cast<intptr_t>(picture_sizes.size())) {
+    return tonic::ToDart("Invalid picture batch.");
+  }
+  std::vector<sk_sp<DisplayList>> display_lists;
+  display_lists.reserve(count);
+  for (intptr_t i = 0; i < count; i++) {
+    Picture* picture = tonic::DartConverter<Picture*>::FromDart(
+        Dart_ListGetAt(pictures_handle, i));
+    if (!picture || !picture->display_list_) {
+      return tonic::ToDart("Picture is null");
+    }
+    display_lists.push_back(picture->display_list_);
+  }
+
+  auto* dart_state = UIDartState::Current();
+  auto images_callback = std::make_unique<tonic::DartPersistentValue>(
+      dart_state, raw_images_callback);
+  auto unref_queue = dart_state->GetSkiaUnrefQueue();
+  auto ui_task_runner = dart_state->GetTaskRunners().GetUITaskRunner();
+  auto raster_task_runner = dart_state->GetTaskRunners().GetRasterTaskRunner();
+  auto snapshot_delegate = dart_state->GetSnapshotDelegate();
+
+  auto ui_task =
+      // The static leak checker gets confused by the use of fml::MakeCopyable.
+      // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
+      fml::MakeCopyable([images_callback = std::move(images_callback),
+                         unref_queue](
+                            const std::vector<sk_sp<DlImage>>& images) mutable {
+        auto dart_state = images_callback->dart_state().lock();
+        if (!dart_state) {
+          // The root isolate could have died in the meantime.
+          return;
+        }
+        tonic::DartState::Scope scope(dart_state);
+
+        // Like toImage, the whole batch fails if any picture could not be
+        // rendered.
+        Dart_Handle dart_images = Dart_Null();
+        if (std::all_of(images.begin(), images.end(),
+                        [](const sk_sp<DlImage>& image) { return !!image; })) {
+          dart_images = Dart_NewList(images.size());
+          for (size_t i = 0; i < images.size(); i++) {
+            auto dart_image = CreateCanvasImage(images[i], unref_queue);
+            Dart_ListSetAt(dart_images, i, tonic::ToDart(dart_image));
+          }
+        }
+        tonic::DartInvoke(images_callback->Get(), {dart_images});
+
+        // images_callback is associated with the Dart isolate and must be
+        // deleted on the UI thread.
+        images_callback.reset();
+      });
+
+  // All of the pictures are rendered by a single call so that backends that
+  // support it can submit the work for the whole batch at once.
+  fml::TaskRunner::RunNowOrPostTask(
+      raster_task_runner,
+      fml::MakeCopyable([ui_task_runner, snapshot_delegate, ui_task,
+                         display_lists = std::move(display_lists),
+                         picture_sizes =
+                             std::move(picture_sizes)]() mutable {
+        snapshot_delegate->MakeRasterSnapshots(
+            std::move(display_lists), std::move(picture_sizes),
+            [ui_task_runner,
+             ui_task](const std::vector<sk_sp<DlImage>>& images) {
+              fml::TaskRunner::RunNowOrPostTask(
+                  ui_task_runner, [ui_task, images]() { ui_task(images); });
+            });
+      }));
+
+  return Dart_Null();
+}
+
 }  // namespace flutter
@@ -48,6 +48,14 @@ class Picture : public RefCountedDartWrappable<Picture> {
                                       uint32_t height,
                                       Dart_Handle raw_image_callback);
 
+  // Rasterizes each picture in the `pictures` list at the size at the same
+  // index of `widths` and `heights`, and invokes the callback once with a list
+  // of all of the images, or with null if any of them could not be rendered.
+  static Dart_Handle toImages(Dart_Handle pictures,
+                              Dart_Handle widths,
+                              Dart_Handle heights,
+                              Dart_Handle raw_images_callback);
+
   static Dart_Handle RasterizeLayerTreeToImage(
       std::unique_ptr<LayerTree> layer_tree,
       Dart_Handle raw_image_callback);
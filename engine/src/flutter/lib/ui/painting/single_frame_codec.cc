@@ -68,8 +68,14 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
   fml::RefPtr<SingleFrameCodec>* raw_codec_ref =
       new fml::RefPtr<SingleFrameCodec>(this);
 
-  decoder->Decode(
-      descriptor_, target_width_, target_height_,
+  // The encoded data is no longer needed once it has been handed off to the
+  // decoder. Cached images complete synchronously, so the codec must already
+  // be in progress when the decode is requested.
+  auto descriptor = std::move(descriptor_);
+  status_ = Status::kInProgress;
+
+  decoder->DecodeWithCache(
+      std::move(descriptor), target_width_, target_height_,
       [raw_codec_ref](auto image, auto decode_error) {
         std::unique_ptr<fml::RefPtr<SingleFrameCodec>> codec_ref(raw_codec_ref);
         fml::RefPtr<SingleFrameCodec> codec(std::move(*codec_ref));
@@ -87,7 +93,25 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
 
         if (image) {
           auto canvas_image = fml::MakeRefCounted<CanvasImage>();
-          canvas_image->set_image(std::move(image));
+          canvas_image->set_image(image);
+
+          // The decoder shares the image with other codecs only until the
+          // application disposes of it. The wrapper may be collected on
+          // another thread, so the release is posted to the UI thread.
+          if (auto decoder = UIDartState::Current()->GetImageDecoder()) {
+            decoder->RetainDecodedImage(image.get());
+            canvas_image->set_release_callback(
+                [decoder, image = std::move(image),
+                 ui_runner = UIDartState::Current()
+                                 ->GetTaskRunners()
+                                 .GetUITaskRunner()]() {
+                  ui_runner->PostTask([decoder, image]() {
+                    if (decoder) {
+                      decoder->ReleaseDecodedImage(image.get());
+                    }
+                  });
+                });
+          }
 
           codec->cached_image_ = std::move(canvas_image);
         }
@@ -106,12 +130,6 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
         codec->pending_callbacks_.clear();
       });
 
-  // The encoded data is no longer needed now that it has been handed off
-  // to the decoder.
-  descriptor_ = nullptr;
-
-  status_ = Status::kInProgress;
-
   return Dart_Null();
 }
 
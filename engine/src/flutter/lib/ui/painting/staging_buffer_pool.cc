@@ -0,0 +1,135 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/staging_buffer_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "flutter/fml/trace_event.h"
+#include "impeller/core/device_buffer_descriptor.h"
+
+namespace flutter {
+
+namespace {
+
+// Sizes are rounded up so that images with similar dimensions share buffers.
+constexpr size_t kSizeGranularity = 64 * 1024;
+
+// Idle buffers are only reused if they waste at most half of the requested
+// size, or a single granule for small requests.
+bool IsGoodFit(size_t buffer_size, size_t size) {
+  return buffer_size >= size &&
+         buffer_size - size <= std::max(size / 2, kSizeGranularity);
+}
+
+}  // namespace
+
+double StagingBufferPool::Stats::GetReuseRate() const {
+  const size_t total = reused_count + allocated_count + one_off_count;
+  return total == 0 ? 0.0 : static_cast<double>(reused_count) / total;
+}
+
+StagingBufferPool::StagingBufferPool(size_t budget_bytes,
+                                     size_t max_pooled_buffer_bytes)
+    : budget_bytes_(budget_bytes),
+      max_pooled_buffer_bytes_(max_pooled_buffer_bytes) {}
+
+StagingBufferPool::~StagingBufferPool() = default;
+
+std::shared_ptr<impeller::DeviceBuffer> StagingBufferPool::Acquire(
+    const std::shared_ptr<impeller::Allocator>& allocator,
+    size_t size) {
+  impeller::DeviceBufferDescriptor descriptor;
+  descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+  descriptor.size = size;
+
+  if (size > max_pooled_buffer_bytes_) {
+    {
+      std::scoped_lock lock(mutex_);
+      stats_.one_off_count++;
+    }
+    return allocator->CreateBuffer(descriptor);
+  }
+
+  {
+    std::scoped_lock lock(mutex_);
+    auto best = idle_buffers_.end();
+    for (auto it = idle_buffers_.begin(); it != idle_buffers_.end(); ++it) {
+      const size_t buffer_size = (*it)->GetDeviceBufferDescriptor().size;
+      if (IsGoodFit(buffer_size, size) &&
+          (best == idle_buffers_.end() ||
+           buffer_size < (*best)->GetDeviceBufferDescriptor().size)) {
+        best = it;
+      }
+    }
+    if (best != idle_buffers_.end()) {
+      auto buffer = std::move(*best);
+      idle_buffers_.erase(best);
+      stats_.idle_bytes -= buffer->GetDeviceBufferDescriptor().size;
+      stats_.reused_count++;
+      TraceStatsToTimeline();
+      return WrapForRecycling(std::move(buffer));
+    }
+    stats_.allocated_count++;
+    TraceStatsToTimeline();
+  }
+
+  descriptor.size = (size + kSizeGranularity - 1) / kSizeGranularity *
+                    kSizeGranularity;
+  auto buffer = allocator->CreateBuffer(descriptor);
+  if (!buffer) {
+    return nullptr;
+  }
+  return WrapForRecycling(std::move(buffer));
+}
+
+StagingBufferPool::Stats StagingBufferPool::GetStats() const {
+  std::scoped_lock lock(mutex_);
+  return stats_;
+}
+
+std::shared_ptr<impeller::DeviceBuffer> StagingBufferPool::WrapForRecycling(
+    std::shared_ptr<impeller::DeviceBuffer> buffer) {
+  // The returned reference shares the buffer, and hands the owning reference
+  // back to the pool once it is released.
+  impeller::DeviceBuffer* raw_buffer = buffer.get();
+  auto recycle = [weak_pool = weak_from_this(),
+                  buffer = std::move(buffer)](impeller::DeviceBuffer*) mutable {
+    if (auto pool = weak_pool.lock()) {
+      pool->Recycle(std::move(buffer));
+    }
+  };
+  return std::shared_ptr<impeller::DeviceBuffer>(raw_buffer,
+                                                 std::move(recycle));
+}
+
+void StagingBufferPool::Recycle(
+    std::shared_ptr<impeller::DeviceBuffer> buffer) {
+  const size_t size = buffer->GetDeviceBufferDescriptor().size;
+  if (size > budget_bytes_) {
+    return;
+  }
+  std::scoped_lock lock(mutex_);
+  // Evict the least recently released buffers to stay within budget.
+  while (stats_.idle_bytes + size > budget_bytes_) {
+    stats_.idle_bytes -=
+        idle_buffers_.front()->GetDeviceBufferDescriptor().size;
+    idle_buffers_.pop_front();
+  }
+  stats_.idle_bytes += size;
+  idle_buffers_.push_back(std::move(buffer));
+}
+
+void StagingBufferPool::TraceStatsToTimeline() const {
+#if !FLUTTER_RELEASE
+  FML_TRACE_COUNTER("flutter", "StagingBufferPool",
+                    reinterpret_cast<int64_t>(this),  //
+                    "ReusePercent",
+                    static_cast<int64_t>(stats_.GetReuseRate() * 100),  //
+                    "IdleKBytes", stats_.idle_bytes / 1024);
+#endif  // !FLUTTER_RELEASE
+}
+
+}  // namespace flutter
@@ -0,0 +1,95 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_STAGING_BUFFER_POOL_H_
+#define FLUTTER_LIB_UI_PAINTING_STAGING_BUFFER_POOL_H_
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include "flutter/fml/macros.h"
+#include "impeller/core/allocator.h"
+#include "impeller/core/device_buffer.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A pool of host visible device buffers that decoded images are
+///             written into before being uploaded to device private textures.
+///
+///             Buffers handed out by the pool return to it once every
+///             reference is released, including the references held by
+///             command buffers until the upload has completed on the GPU. Idle
+///             buffers are kept up to a byte budget, and requests larger than
+///             the maximum pooled size are always served by one-off buffers.
+///
+///             This class is thread safe.
+///
+class StagingBufferPool
+    : public std::enable_shared_from_this<StagingBufferPool> {
+ public:
+  /// The default limit on the total size of idle buffers.
+  static constexpr size_t kDefaultBudgetBytes = 32 * 1024 * 1024;
+
+  /// The default size above which buffers are not pooled.
+  static constexpr size_t kDefaultMaxPooledBufferBytes = 16 * 1024 * 1024;
+
+  struct Stats {
+    /// Requests served by an idle buffer.
+    size_t reused_count = 0;
+    /// Requests that allocated a new buffer that will be pooled.
+    size_t allocated_count = 0;
+    /// Requests too large to be pooled.
+    size_t one_off_count = 0;
+    /// The total size of the idle buffers in the pool.
+    size_t idle_bytes = 0;
+
+    /// @brief  The fraction of requests served without allocating.
+    double GetReuseRate() const;
+  };
+
+  explicit StagingBufferPool(
+      size_t budget_bytes = kDefaultBudgetBytes,
+      size_t max_pooled_buffer_bytes = kDefaultMaxPooledBufferBytes);
+
+  ~StagingBufferPool();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get a host visible buffer of at least `size` bytes.
+  ///
+  /// @param[in]  allocator  The allocator used if no idle buffer fits.
+  /// @param[in]  size       The minimum size of the buffer.
+  ///
+  /// @return     The buffer, or nullptr if the allocation failed. The size in
+  ///             its descriptor may be larger than requested.
+  ///
+  std::shared_ptr<impeller::DeviceBuffer> Acquire(
+      const std::shared_ptr<impeller::Allocator>& allocator,
+      size_t size);
+
+  Stats GetStats() const;
+
+ private:
+  const size_t budget_bytes_;
+  const size_t max_pooled_buffer_bytes_;
+  mutable std::mutex mutex_;
+  // Idle buffers, least recently released first.
+  std::list<std::shared_ptr<impeller::DeviceBuffer>> idle_buffers_;
+  Stats stats_;
+
+  void Recycle(std::shared_ptr<impeller::DeviceBuffer> buffer);
+
+  std::shared_ptr<impeller::DeviceBuffer> WrapForRecycling(
+      std::shared_ptr<impeller::DeviceBuffer> buffer);
+
+  void TraceStatsToTimeline() const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(StagingBufferPool);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_STAGING_BUFFER_POOL_H_
@@ -70,23 +70,7 @@ Future<SendPort> _spawnPlatformIsolate() {
       _platformRunnerSendPort = message.computationPort;
       sendPortCompleter.complete(message.computationPort);
     } else if (message is _ComputationResult) {
-      final Completer<Object?> resultCompleter = _pending.remove(message.id)!;
-      final Object? remoteStack = message.remoteStack;
-      final Object? remoteError = message.remoteError;
-      if (remoteStack != null) {
-        if (remoteStack is StackTrace) {
-          // Typed error.
-          resultCompleter.completeError(remoteError!, remoteStack);
-        } else {
-          // onError handler message, uncaught async error.
-          // Both values are strings, so calling `toString` is efficient.
-          final RemoteError error =
-              RemoteError(remoteError!.toString(), remoteStack.toString());
-          resultCompleter.completeError(error, error.stackTrace);
-        }
-      } else {
-        resultCompleter.complete(message.result);
-      }
+      _completeComputation(_pending.remove(message.id)!, message);
     } else {
       // We encountered an error while starting the new isolate.
       if (!sendPortCompleter.isCompleted) {
@@ -119,6 +103,26 @@ Future<R> _sendComputation<R>(
   return resultCompleter.future;
 }
 
+void _completeComputation(
+    Completer<Object?> resultCompleter, _ComputationResult message) {
+  final Object? remoteStack = message.remoteStack;
+  final Object? remoteError = message.remoteError;
+  if (remoteStack != null) {
+    if (remoteStack is StackTrace) {
+      // Typed error.
+      resultCompleter.completeError(remoteError!, remoteStack);
+    } else {
+      // onError handler message, uncaught async error.
+      // Both values are strings, so calling `toString` is efficient.
+      final RemoteError error =
+          RemoteError(remoteError!.toString(), remoteStack.toString());
+      resultCompleter.completeError(error, error.stackTrace);
+    }
+  } else {
+    resultCompleter.complete(message.result);
+  }
+}
+
 void _safeSend(SendPort sendPort, int id, Object? result, Object? error,
     Object? stackTrace) {
   try {
@@ -128,6 +132,26 @@ void _safeSend(SendPort sendPort, int id, Object? result, Object? error,
   }
 }
 
+void _runComputation(SendPort sendPort, _ComputationRequest message) {
+  late final FutureOr<Object?> potentiallyAsyncResult;
+  try {
+    potentiallyAsyncResult = message.computation();
+  } catch (e, s) {
+    _safeSend(sendPort, message.id, null, e, s);
+    return;
+  }
+
+  if (potentiallyAsyncResult is Future<Object?>) {
+    potentiallyAsyncResult.then((Object? result) {
+      _safeSend(sendPort, message.id, result, null, null);
+    }, onError: (Object? e, Object? s) {
+      _safeSend(sendPort, message.id, null, e, s ?? StackTrace.empty);
+    });
+  } else {
+    _safeSend(sendPort, message.id, potentiallyAsyncResult, null, null);
+  }
+}
+
 void _platformIsolateMain(Isolate parentIsolate, SendPort sendPort) {
   final RawReceivePort computationPort = RawReceivePort();
   computationPort.handler = (_ComputationRequest? message) {
@@ -137,23 +161,7 @@ void _platformIsolateMain(Isolate parentIsolate, SendPort sendPort) {
       return;
     }
 
-    late final FutureOr<Object?> potentiallyAsyncResult;
-    try {
-      potentiallyAsyncResult = message.computation();
-    } catch (e, s) {
-      _safeSend(sendPort, message.id, null, e, s);
-      return;
-    }
-
-    if (potentiallyAsyncResult is Future<Object?>) {
-      potentiallyAsyncResult.then((Object? result) {
-        _safeSend(sendPort, message.id, result, null, null);
-      }, onError: (Object? e, Object? s) {
-        _safeSend(sendPort, message.id, null, e, s ?? StackTrace.empty);
-      });
-    } else {
-      _safeSend(sendPort, message.id, potentiallyAsyncResult, null, null);
-    }
+    _runComputation(sendPort, message);
   };
   Isolate.current.addOnExitListener(sendPort);
   parentIsolate.addOnExitListener(computationPort.sendPort);
@@ -5,7 +5,9 @@
 #ifndef FLUTTER_LIB_UI_SNAPSHOT_DELEGATE_H_
 #define FLUTTER_LIB_UI_SNAPSHOT_DELEGATE_H_
 
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "flutter/common/graphics/texture.h"
 #include "flutter/display_list/display_list.h"
@@ -84,6 +86,19 @@ class SnapshotDelegate {
   virtual sk_sp<DlImage> MakeRasterSnapshotSync(sk_sp<DisplayList> display_list,
                                                 SkISize picture_size) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Renders each display list at the corresponding size, and
+  ///             invokes the callback with the images in the same order.
+  ///             Images that could not be rendered are null.
+  ///
+  ///             Backends that support it submit the rendering work for all
+  ///             of the display lists at once, which is considerably cheaper
+  ///             than making each snapshot separately.
+  virtual void MakeRasterSnapshots(
+      std::vector<sk_sp<DisplayList>> display_lists,
+      std::vector<SkISize> picture_sizes,
+      std::function<void(const std::vector<sk_sp<DlImage>>&)> callback) = 0;
+
   virtual sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) = 0;
 
   /// Load and compile and initial PSO for the provided [runtime_stage].
@@ -3009,6 +3009,38 @@ abstract class Paragraph {
   /// The [ParagraphConstraints] control how wide the text is allowed to be.
   void layout(ParagraphConstraints constraints);
 
+  /// Computes the layout of each of the `paragraphs` with the constraints at
+  /// the same index of `constraints`, as if [layout] was called on each of
+  /// them in order.
+  ///
+  /// The engine may lay out the paragraphs concurrently on several threads,
+  /// which takes less time than laying them out one after another when there
+  /// are many of them.
+  static void layoutAll(List<Paragraph> paragraphs, List<ParagraphConstraints> constraints) {
+    assert(paragraphs.length == constraints.length);
+    final List<_NativeParagraph> nativeParagraphs = <_NativeParagraph>[];
+    final List<double> widths = <double>[];
+    for (int index = 0; index < paragraphs.length; index += 1) {
+      final Paragraph paragraph = paragraphs[index];
+      if (paragraph is _NativeParagraph) {
+        nativeParagraphs.add(paragraph);
+        widths.add(constraints[index].width);
+      } else {
+        paragraph.layout(constraints[index]);
+      }
+    }
+    if (nativeParagraphs.isEmpty) {
+      return;
+    }
+    _NativeParagraph._layoutAll(nativeParagraphs, Float64List.fromList(widths));
+    assert(() {
+      for (final _NativeParagraph paragraph in nativeParagraphs) {
+        paragraph._needsLayout = false;
+      }
+      return true;
+    }());
+  }
+
   /// Returns a list of text boxes that enclose the given text range.
   ///
   /// The [boxHeightStyle] and [boxWidthStyle] parameters allow customization
@@ -3181,6 +3213,9 @@ base class _NativeParagraph extends NativeFieldWrapperClass1 implements Paragrap
   @Native<Void Function(Pointer<Void>, Double)>(symbol: 'Paragraph::layout', isLeaf: true)
   external void _layout(double width);
 
+  @Native<Void Function(Handle, Handle)>(symbol: 'Paragraph::layoutAll')
+  external static void _layoutAll(List<_NativeParagraph> paragraphs, Float64List widths);
+
   List<TextBox> _decodeTextBoxes(Float32List encoded) {
     final int count = encoded.length ~/ 5;
     final List<TextBox> boxes = <TextBox>[];
@@ -3473,6 +3508,27 @@ abstract class ParagraphBuilder {
   /// After calling this function, the paragraph builder object is invalid and
   /// cannot be used further.
   Paragraph build();
+
+  /// Applies the given paragraph style and returns a [Paragraph] containing the
+  /// added text and associated styling, like [build].
+  ///
+  /// The returned paragraph lays out the text between each pair of hard line
+  /// breaks separately, and takes over the layout of the lines of `previous`
+  /// whose text and styles did not change instead of shaping them again. This
+  /// makes laying out a large text after an edit, such as the text of a text
+  /// field after a keystroke, cost about as much as laying out the lines that
+  /// the edit changed.
+  ///
+  /// The `previous` paragraph is usually the paragraph of the text before the
+  /// edit, or null for the first paragraph of a text. It can still be used,
+  /// but may need to shape the lines that it gave away again.
+  ///
+  /// Paragraphs with a [ParagraphStyle.maxLines] or a
+  /// [ParagraphStyle.ellipsis] are built like with [build].
+  ///
+  /// After calling this function, the paragraph builder object is invalid and
+  /// cannot be used further.
+  Paragraph buildIncremental(Paragraph? previous);
 }
 
 base class _NativeParagraphBuilder extends NativeFieldWrapperClass1 implements ParagraphBuilder {
@@ -3675,6 +3731,16 @@ base class _NativeParagraphBuilder extends NativeFieldWrapperClass1 implements P
   @Native<Void Function(Pointer<Void>, Handle)>(symbol: 'ParagraphBuilder::build')
   external void _build(_NativeParagraph outParagraph);
 
+  @override
+  Paragraph buildIncremental(Paragraph? previous) {
+    final _NativeParagraph paragraph = _NativeParagraph._();
+    _buildIncremental(paragraph, previous as _NativeParagraph?);
+    return paragraph;
+  }
+
+  @Native<Void Function(Pointer<Void>, Handle, Handle)>(symbol: 'ParagraphBuilder::buildIncremental')
+  external void _buildIncremental(_NativeParagraph outParagraph, _NativeParagraph? previous);
+
   @override
   String toString() => 'ParagraphBuilder';
 }
@@ -4,10 +4,16 @@
 
 #include "flutter/lib/ui/text/paragraph.h"
 
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/lib/ui/ui_dart_state.h"
+#include "flutter/third_party/txt/src/txt/paragraph_batch_layout.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 #include "third_party/skia/modules/skparagraph/include/DartTypes.h"
 #include "third_party/skia/modules/skparagraph/include/Paragraph.h"
@@ -62,6 +68,47 @@ void Paragraph::layout(double width) {
   m_paragraph_->Layout(width);
 }
 
+void Paragraph::layoutAll(Dart_Handle paragraphs_handle,
+                          Dart_Handle widths_handle) {
+  std::vector<double> list_widths;
+  {
+    tonic::Float64List widths(widths_handle);
+    list_widths.assign(widths.data(), widths.data() + widths.num_elements());
+  }
+  intptr_t count = 0;
+  if (Dart_IsError(Dart_ListLength(paragraphs_handle, &count)) ||
+      count != static_cast<intptr_t>(list_widths.size())) {
+    Dart_ThrowException(tonic::ToDart("Invalid paragraph layout batch."));
+    return;
+  }
+
+  // A paragraph that is in the batch more than once ends up laid out to its
+  // last width, as if the paragraphs were laid out one after another.
+  std::vector<txt::Paragraph*> paragraphs;
+  std::vector<double> widths;
+  std::unordered_map<txt::Paragraph*, size_t> indices;
+  for (intptr_t i = 0; i < count; i++) {
+    Paragraph* paragraph = tonic::DartConverter<Paragraph*>::FromDart(
+        Dart_ListGetAt(paragraphs_handle, i));
+    if (!paragraph || !paragraph->m_paragraph_) {
+      // disposed.
+      continue;
+    }
+    auto [it, inserted] =
+        indices.try_emplace(paragraph->m_paragraph_.get(), paragraphs.size());
+    if (inserted) {
+      paragraphs.push_back(paragraph->m_paragraph_.get());
+      widths.push_back(list_widths[i]);
+    } else {
+      widths[it->second] = list_widths[i];
+    }
+  }
+
+  auto task_runner = UIDartState::Current()->GetConcurrentTaskRunner();
+  txt::LayoutParagraphs(paragraphs, widths, task_runner.get(),
+                        std::max(std::thread::hardware_concurrency(), 1u));
+}
+
 void Paragraph::paint(Canvas* canvas, double x, double y) {
   if (!m_paragraph_ || !canvas) {
     // disposed.
@@ -25,6 +25,8 @@ class Paragraph : public RefCountedDartWrappable<Paragraph> {
 
   ~Paragraph() override;
 
+  static void layoutAll(Dart_Handle paragraphs, Dart_Handle widths);
+
   double width();
   double height();
   double longestLine();
@@ -58,6 +60,8 @@ class Paragraph : public RefCountedDartWrappable<Paragraph> {
   void dispose();
 
  private:
+  friend class ParagraphBuilder;
+
   std::unique_ptr<txt::Paragraph> m_paragraph_;
 
   explicit Paragraph(std::unique_ptr<txt::Paragraph> paragraph);
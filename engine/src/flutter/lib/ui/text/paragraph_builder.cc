@@ -536,4 +536,17 @@ void ParagraphBuilder::build(Dart_Handle paragraph_handle) {
   ClearDartWrapper();
 }
 
+void ParagraphBuilder::buildIncremental(Dart_Handle paragraph_handle,
+                                        Dart_Handle previous_handle) {
+  Paragraph* previous =
+      tonic::DartConverter<Paragraph*>::FromDart(previous_handle);
+  // A disposed previous paragraph has no layout to take over.
+  txt::Paragraph* previous_paragraph =
+      previous ? previous->m_paragraph_.get() : nullptr;
+  Paragraph::Create(paragraph_handle,
+                    m_paragraph_builder_->BuildIncremental(previous_paragraph));
+  m_paragraph_builder_.reset();
+  ClearDartWrapper();
+}
+
 }  // namespace flutter
@@ -68,6 +68,11 @@ class ParagraphBuilder : public RefCountedDartWrappable<ParagraphBuilder> {
 
   void build(Dart_Handle paragraph_handle);
 
+  // Builds a paragraph that takes over the layout of the lines of the previous
+  // paragraph, which may be null, whose text and styles did not change.
+  void buildIncremental(Dart_Handle paragraph_handle,
+                        Dart_Handle previous_handle);
+
  private:
   explicit ParagraphBuilder(Dart_Handle encoded,
                             Dart_Handle strutData,
@@ -31,6 +31,7 @@ import 'dart:typed_data';
 part 'annotations.dart';
 part 'channel_buffers.dart';
 part 'compositing.dart';
+part 'compute_isolate.dart';
 part 'geometry.dart';
 part 'hooks.dart';
 part 'isolate_name_server.dart';
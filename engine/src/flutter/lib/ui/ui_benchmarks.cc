@@ -4,11 +4,14 @@
 
 #include "flutter/benchmarking/benchmarking.h"
 #include "flutter/common/settings.h"
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/lib/ui/window/platform_message_response_dart.h"
+#include "flutter/runtime/dart_isolate.h"
 #include "flutter/runtime/dart_vm_lifecycle.h"
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/testing/dart_isolate_runner.h"
 #include "flutter/testing/fixture_test.h"
+#include "flutter/testing/test_dart_native_resolver.h"
 
 #include <future>
 
@@ -69,4 +72,131 @@ static void BM_PlatformMessageResponseDartComplete(benchmark::State& state) {
 BENCHMARK(BM_PlatformMessageResponseDartComplete)
     ->Unit(benchmark::kMicrosecond);
 
+static void RecordCanvas(benchmark::State& state,
+                         const char* entrypoint,
+                         bool batched) {
+  ThreadHost thread_host(ThreadHost::ThreadHostConfig(
+      "test", ThreadHost::Type::kPlatform | ThreadHost::Type::kRaster |
+                  ThreadHost::Type::kIo | ThreadHost::Type::kUi));
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  Fixture fixture;
+  auto settings = fixture.CreateSettingsForFixture();
+  auto vm_ref = DartVMRef::Create(settings);
+  auto isolate =
+      testing::RunDartCodeInIsolate(vm_ref, settings, task_runners, "main", {},
+                                    testing::GetDefaultKernelFilePath(), {});
+
+  bool successful = isolate->RunInIsolateScope([&]() -> bool {
+    Dart_Handle ui_library =
+        Dart_LookupLibrary(Dart_NewStringFromCString("dart:ui"));
+    return !Dart_IsError(Dart_SetField(
+        ui_library,
+        Dart_NewStringFromCString("_canvasCommandBatchingEnabled"),
+        Dart_NewBoolean(batched)));
+  });
+  FML_CHECK(successful);
+
+  const int64_t count = state.range(0);
+  while (state.KeepRunning()) {
+    successful = isolate->RunInIsolateScope([&]() -> bool {
+      Dart_Handle args[] = {Dart_NewInteger(count)};
+      return !Dart_IsError(Dart_Invoke(
+          Dart_RootLibrary(),
+          Dart_NewStringFromCString(entrypoint), 1, args));
+    });
+    FML_CHECK(successful);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_CanvasRecordPrimitivesPerCall(benchmark::State& state) {
+  RecordCanvas(state, "recordCanvasPrimitives", /*batched=*/false);
+}
+
+static void BM_CanvasRecordPrimitivesBatched(benchmark::State& state) {
+  RecordCanvas(state, "recordCanvasPrimitives", /*batched=*/true);
+}
+
+BENCHMARK(BM_CanvasRecordPrimitivesPerCall)
+    ->Arg(1000)
+    ->Arg(20000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CanvasRecordPrimitivesBatched)
+    ->Arg(1000)
+    ->Arg(20000)
+    ->Unit(benchmark::kMicrosecond);
+
+// Measures the overhead of the calls that pass typed data to the engine.
+static void BM_CanvasRecordTypedDataCalls(benchmark::State& state) {
+  RecordCanvas(state, "recordCanvasTypedDataCalls", /*batched=*/false);
+}
+
+BENCHMARK(BM_CanvasRecordTypedDataCalls)
+    ->Arg(1000)
+    ->Arg(20000)
+    ->Unit(benchmark::kMicrosecond);
+
+// Measures the time from requesting a compute isolate until its entry point
+// ran, with the given number of compute isolates created ahead of time.
+static void BM_ComputeIsolateSpawn(benchmark::State& state) {
+  ThreadHost thread_host(ThreadHost::ThreadHostConfig(
+      "test", ThreadHost::Type::kPlatform | ThreadHost::Type::kRaster |
+                  ThreadHost::Type::kIo | ThreadHost::Type::kUi));
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  Fixture fixture;
+  fml::AutoResetWaitableEvent ready_latch;
+  fixture.AddNativeCallback(
+      "ComputeIsolateReady",
+      CREATE_NATIVE_ENTRY(
+          [&ready_latch](Dart_NativeArguments args) { ready_latch.Signal(); }));
+  auto settings = fixture.CreateSettingsForFixture();
+  settings.compute_isolate_pool_size = static_cast<size_t>(state.range(0));
+  auto vm_ref = DartVMRef::Create(settings);
+  auto isolate =
+      testing::RunDartCodeInIsolate(vm_ref, settings, task_runners, "main", {},
+                                    testing::GetDefaultKernelFilePath(), {});
+
+  // Waits until the pool of compute isolates is filled, which happens in tasks
+  // of the UI task runner.
+  auto wait_for_pool = [&]() {
+    size_t ready_count = 0;
+    while (ready_count < settings.compute_isolate_pool_size) {
+      std::promise<size_t> count;
+      task_runners.GetUITaskRunner()->PostTask([&count, &isolate] {
+        count.set_value(isolate->get()->GetReadyComputeIsolateCount());
+      });
+      ready_count = count.get_future().get();
+    }
+  };
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    wait_for_pool();
+    state.ResumeTiming();
+
+    bool successful = isolate->RunInIsolateScope([&]() -> bool {
+      Dart_Handle entry_point = Dart_GetField(
+          Dart_RootLibrary(), Dart_NewStringFromCString("computeIsolateMain"));
+      char* error = nullptr;
+      Dart_Isolate compute_isolate =
+          isolate->get()->CreateComputeIsolate(entry_point, &error);
+      ::free(error);
+      return compute_isolate != nullptr;
+    });
+    FML_CHECK(successful);
+    ready_latch.Wait();
+  }
+}
+
+BENCHMARK(BM_ComputeIsolateSpawn)
+    ->Arg(0)
+    ->Arg(2)
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace flutter
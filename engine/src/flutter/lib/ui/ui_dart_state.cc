@@ -271,4 +271,10 @@ Dart_Isolate UIDartState::CreatePlatformIsolate(Dart_Handle entry_point,
   return nullptr;
 }
 
+Dart_Isolate UIDartState::CreateComputeIsolate(Dart_Handle entry_point,
+                                               char** error) {
+  FML_UNREACHABLE();
+  return nullptr;
+}
+
 }  // namespace flutter
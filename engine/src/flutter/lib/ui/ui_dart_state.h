@@ -176,6 +176,9 @@ class UIDartState : public tonic::DartState {
   virtual Dart_Isolate CreatePlatformIsolate(Dart_Handle entry_point,
                                              char** error);
 
+  virtual Dart_Isolate CreateComputeIsolate(Dart_Handle entry_point,
+                                            char** error);
+
  protected:
   UIDartState(TaskObserverAdd add_callback,
               TaskObserverRemove remove_callback,
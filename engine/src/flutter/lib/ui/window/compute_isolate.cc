@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/window/compute_isolate.h"
+
+#include "flutter/fml/logging.h"
+#include "flutter/lib/ui/ui_dart_state.h"
+#include "third_party/tonic/converter/dart_converter.h"
+
+namespace flutter {
+
+bool ComputeIsolateNativeApi::Spawn(Dart_Handle entry_point) {
+  UIDartState* current_state = UIDartState::Current();
+  FML_DCHECK(current_state != nullptr);
+  if (!current_state->IsRootIsolate()) {
+    return false;
+  }
+
+  char* error = nullptr;
+  current_state->CreateComputeIsolate(entry_point, &error);
+  if (error) {
+    Dart_EnterScope();
+    Dart_Handle error_handle = tonic::ToDart<const char*>(error);
+    ::free(error);
+    Dart_ThrowException(error_handle);
+  }
+  return true;
+}
+
+}  // namespace flutter
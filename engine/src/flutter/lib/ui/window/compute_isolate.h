@@ -0,0 +1,21 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_WINDOW_COMPUTE_ISOLATE_H_
+#define FLUTTER_LIB_UI_WINDOW_COMPUTE_ISOLATE_H_
+
+#include "third_party/dart/runtime/include/dart_api.h"
+
+namespace flutter {
+
+class ComputeIsolateNativeApi {
+ public:
+  // Returns false if the current isolate can't spawn compute isolates, in
+  // which case the caller should spawn an isolate with Isolate.spawn instead.
+  static bool Spawn(Dart_Handle entry_point);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_WINDOW_COMPUTE_ISOLATE_H_
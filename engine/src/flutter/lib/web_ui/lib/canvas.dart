@@ -131,6 +131,13 @@ abstract class Picture {
   static PictureEventCallback? onCreate;
   static PictureEventCallback? onDispose;
   Future<Image> toImage(int width, int height);
+  static Future<List<Image>> toImages(List<Picture> pictures, List<int> widths, List<int> heights) {
+    assert(pictures.length == widths.length && pictures.length == heights.length);
+    return Future.wait(<Future<Image>>[
+      for (int index = 0; index < pictures.length; index += 1)
+        pictures[index].toImage(widths[index], heights[index]),
+    ]);
+  }
   Image toImageSync(int width, int height);
   void dispose();
   bool get debugDisposed;
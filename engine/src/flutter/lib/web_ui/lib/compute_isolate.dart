@@ -0,0 +1,33 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+part of ui;
+
+/// Runs [computation] in a new background isolate and returns the result.
+///
+/// This behaves like [Isolate.run], except that the isolate is taken from a
+/// small pool of isolates that the engine creates ahead of time in the
+/// isolate group of the main isolate. These isolates skip the setup of the
+/// `dart:ui` APIs that are only available to the main isolate, so the
+/// computation starts sooner than in an isolate spawned by [Isolate.spawn].
+///
+/// Each computation runs in its own isolate, which exits once the
+/// computation completed. No global state is shared between computations.
+///
+/// The [computation] and any state it captures are sent to that isolate.
+/// See [SendPort.send] for information about what types can be sent.
+///
+/// If [computation] is asynchronous (returns a `Future<R>`) then
+/// that future is awaited in the new isolate, completing the entire
+/// asynchronous computation, before returning the result.
+///
+/// If [computation] throws, the `Future` returned by this function completes
+/// with that error.
+///
+/// If this method is invoked from an isolate other than the main isolate, it
+/// uses [Isolate.run] instead.
+///
+/// This API is currently experimental.
+Future<R> runInComputeIsolate<R>(FutureOr<R> Function() computation) =>
+    Future<R>(computation);
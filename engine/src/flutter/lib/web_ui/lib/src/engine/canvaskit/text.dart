@@ -1131,6 +1131,9 @@ class CkParagraphBuilder implements ui.ParagraphBuilder {
     return CkParagraph(builtParagraph, _style);
   }
 
+  @override
+  CkParagraph buildIncremental(ui.Paragraph? previous) => build();
+
   /// Builds the CkParagraph with the builder and deletes the builder.
   SkParagraph _buildSkParagraph() {
     if (_ckRequiresClientICU) {
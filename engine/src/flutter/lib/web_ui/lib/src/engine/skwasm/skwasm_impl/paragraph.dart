@@ -1059,6 +1059,9 @@ class SkwasmParagraphBuilder extends SkwasmObjectWrapper<RawParagraphBuilder> im
     return SkwasmParagraph(paragraphBuilderBuild(handle));
   }
 
+  @override
+  ui.Paragraph buildIncremental(ui.Paragraph? previous) => build();
+
   @override
   int get placeholderCount => placeholderScales.length;
 
@@ -744,4 +744,7 @@ class CanvasParagraphBuilder implements ui.ParagraphBuilder {
       canDrawOnCanvas: _canDrawOnCanvas,
     );
   }
+
+  @override
+  CanvasParagraph buildIncremental(ui.Paragraph? previous) => build();
 }
@@ -717,6 +717,12 @@ abstract class Paragraph {
   double get ideographicBaseline;
   bool get didExceedMaxLines;
   void layout(ParagraphConstraints constraints);
+  static void layoutAll(List<Paragraph> paragraphs, List<ParagraphConstraints> constraints) {
+    assert(paragraphs.length == constraints.length);
+    for (int index = 0; index < paragraphs.length; index += 1) {
+      paragraphs[index].layout(constraints[index]);
+    }
+  }
   List<TextBox> getBoxesForRange(int start, int end,
       {BoxHeightStyle boxHeightStyle = BoxHeightStyle.tight,
       BoxWidthStyle boxWidthStyle = BoxWidthStyle.tight});
@@ -742,6 +748,7 @@ abstract class ParagraphBuilder {
   void pop();
   void addText(String text);
   Paragraph build();
+  Paragraph buildIncremental(Paragraph? previous);
   int get placeholderCount;
   List<double> get placeholderScales;
   void addPlaceholder(
@@ -20,6 +20,7 @@ part 'annotations.dart';
 part 'canvas.dart';
 part 'channel_buffers.dart';
 part 'compositing.dart';
+part 'compute_isolate.dart';
 part 'geometry.dart';
 part 'initialization.dart';
 part 'key.dart';
@@ -5,6 +5,7 @@
 #include "flutter/runtime/dart_isolate.h"
 
 #include <cstdlib>
+#include <thread>
 #include <utility>
 
 #include "flutter/fml/logging.h"
@@ -428,6 +429,171 @@ Dart_Isolate DartIsolate::CreatePlatformIsolate(Dart_Handle entry_point,
   return platform_isolate;
 }
 
+Dart_Isolate DartIsolate::CreateComputeIsolate(Dart_Handle entry_point,
+                                               char** error) {
+  TRACE_EVENT0("flutter", "DartIsolate::CreateComputeIsolate");
+  *error = nullptr;
+  FML_DCHECK(IsRootIsolate());
+
+  Dart_Isolate parent_isolate = isolate();
+  Dart_PersistentHandle entry_point_handle =
+      Dart_NewPersistentHandle(entry_point);
+  Dart_ExitIsolate();  // Exit parent_isolate.
+
+  Dart_Isolate compute_isolate = nullptr;
+  if (!ready_compute_isolates_.empty()) {
+    compute_isolate = ready_compute_isolates_.back();
+    ready_compute_isolates_.pop_back();
+  } else {
+    compute_isolate = MakeComputeIsolate(error);
+  }
+
+  if (compute_isolate != nullptr) {
+    Dart_EnterIsolate(compute_isolate);
+    {
+      tonic::DartApiScope api_scope;
+      Dart_Handle entry_point = Dart_HandleFromPersistent(entry_point_handle);
+      Dart_DeletePersistentHandle(entry_point_handle);
+      entry_point_handle = nullptr;
+      tonic::DartInvokeVoid(entry_point);
+    }
+    // From here on the VM handles the messages of the isolate on its thread
+    // pool, and shuts the isolate down once it has no open ports left, as it
+    // does for the isolates spawned by Isolate.spawn.
+    if (!Dart_RunLoopAsync(/*errors_are_fatal=*/false,
+                           /*on_error_port=*/ILLEGAL_PORT,
+                           /*on_exit_port=*/ILLEGAL_PORT, error)) {
+      Dart_ShutdownIsolate();
+      compute_isolate = nullptr;
+    }
+  }
+
+  Dart_EnterIsolate(parent_isolate);
+  if (entry_point_handle != nullptr) {
+    Dart_DeletePersistentHandle(entry_point_handle);
+  }
+
+  ScheduleComputeIsolatePoolFill();
+  return compute_isolate;
+}
+
+size_t DartIsolate::GetReadyComputeIsolateCount() const {
+  return ready_compute_isolates_.size();
+}
+
+Dart_Isolate DartIsolate::MakeComputeIsolate(char** error) {
+  TRACE_EVENT0("flutter", "DartIsolate::MakeComputeIsolate");
+  FML_DCHECK(Dart_CurrentIsolate() == nullptr);
+
+  const DartIsolateGroupData& isolate_group_data = GetIsolateGroupData();
+
+  // Like the isolates spawned by the VM, compute isolates do not have task
+  // runners, as their messages are handled by the VM.
+  TaskRunners null_task_runners(isolate_group_data.GetAdvisoryScriptURI(),
+                                /* platform= */ nullptr,
+                                /* raster= */ nullptr,
+                                /* ui= */ nullptr,
+                                /* io= */ nullptr);
+
+  UIDartState::Context context(null_task_runners);
+  context.advisory_script_uri = isolate_group_data.GetAdvisoryScriptURI();
+  context.advisory_script_entrypoint =
+      isolate_group_data.GetAdvisoryScriptEntrypoint();
+  auto isolate_data = std::make_unique<std::shared_ptr<DartIsolate>>(
+      std::shared_ptr<DartIsolate>(
+          new DartIsolate(isolate_group_data.GetSettings(),  // settings
+                          false,       // is_root_isolate
+                          context)));  // context
+  (*isolate_data)->is_compute_isolate_ = true;
+
+  IsolateMaker isolate_maker =
+      [group_member = isolate()](
+          std::shared_ptr<DartIsolateGroupData>* unused_isolate_group_data,
+          std::shared_ptr<DartIsolate>* isolate_data, Dart_IsolateFlags* flags,
+          char** error) {
+        return Dart_CreateIsolateInGroup(
+            /*group_member=*/group_member,
+            /*name=*/"ComputeIsolate",
+            /*shutdown_callback=*/
+            reinterpret_cast<Dart_IsolateShutdownCallback>(
+                DartIsolate::SpawnIsolateShutdownCallback),
+            /*cleanup_callback=*/
+            reinterpret_cast<Dart_IsolateCleanupCallback>(
+                DartIsolateCleanupCallback),
+            /*child_isolate_data=*/isolate_data,
+            /*error=*/error);
+      };
+  return CreateDartIsolateGroup(nullptr, std::move(isolate_data), nullptr,
+                                error, isolate_maker);
+}
+
+void DartIsolate::ShutdownComputeIsolates() {
+  compute_isolates_shut_down_ = true;
+  if (ready_compute_isolates_.empty()) {
+    return;
+  }
+  // The compute isolates that were created ahead of time never ran, so the VM
+  // does not shut them down.
+  auto shutdown = [ready_compute_isolates =
+                       std::move(ready_compute_isolates_)]() {
+    for (Dart_Isolate compute_isolate : ready_compute_isolates) {
+      FML_DCHECK(Dart_CurrentIsolate() == nullptr);
+      Dart_EnterIsolate(compute_isolate);
+      Dart_ShutdownIsolate();
+    }
+  };
+  ready_compute_isolates_.clear();
+  if (Dart_CurrentIsolate() == nullptr) {
+    shutdown();
+  } else {
+    // This isolate is being shut down by the VM and can't be exited, so the
+    // compute isolates are entered on a thread of their own.
+    std::thread(shutdown).join();
+  }
+}
+
+void DartIsolate::ScheduleComputeIsolatePoolFill() {
+  fml::RefPtr<fml::TaskRunner> task_runner = GetMessageHandlingTaskRunner();
+  if (!task_runner || compute_isolates_shut_down_ ||
+      compute_isolate_pool_fill_pending_ ||
+      ready_compute_isolates_.size() >=
+          GetIsolateGroupData().GetSettings().compute_isolate_pool_size) {
+    return;
+  }
+  compute_isolate_pool_fill_pending_ = true;
+  // Compute isolates are created one per task, so that filling the pool does
+  // not delay the tasks of the UI task runner by more than the creation of a
+  // single isolate.
+  task_runner->PostTask([weak_isolate = GetWeakIsolatePtr()]() {
+    std::shared_ptr<DartIsolate> isolate = weak_isolate.lock();
+    if (!isolate || isolate->GetPhase() == Phase::Shutdown ||
+        isolate->compute_isolates_shut_down_) {
+      return;
+    }
+    isolate->compute_isolate_pool_fill_pending_ = false;
+    // No thread may have the group member entered while an isolate is created
+    // in its group. The root isolate is only entered on this task runner, so
+    // it is enough that it is not the current isolate here.
+    Dart_Isolate current_isolate = Dart_CurrentIsolate();
+    if (current_isolate != nullptr) {
+      Dart_ExitIsolate();
+    }
+    char* error = nullptr;
+    Dart_Isolate compute_isolate = isolate->MakeComputeIsolate(&error);
+    if (current_isolate != nullptr) {
+      Dart_EnterIsolate(current_isolate);
+    }
+    if (compute_isolate == nullptr) {
+      FML_LOG(ERROR) << "Could not create a compute isolate: "
+                     << (error ? error : "unknown error");
+      ::free(error);
+      return;
+    }
+    isolate->ready_compute_isolates_.push_back(compute_isolate);
+    isolate->ScheduleComputeIsolatePoolFill();
+  });
+}
+
 DartIsolate::DartIsolate(const Settings& settings,
                          bool is_root_isolate,
                          const UIDartState::Context& context,
@@ -507,8 +673,8 @@ bool DartIsolate::Initialize(Dart_Isolate dart_isolate) {
   }
 
   if (is_platform_isolate_) {
-    SetMessageHandlingTaskRunner(GetTaskRunners().GetPlatformTaskRunner(),
-                                 true);
+    SetBatchedMessageHandlingTaskRunner(
+        GetTaskRunners().GetPlatformTaskRunner());
   } else {
     SetMessageHandlingTaskRunner(GetTaskRunners().GetUITaskRunner(), false);
   }
@@ -604,6 +770,38 @@ void DartIsolate::SetMessageHandlingTaskRunner(
   message_handler().Initialize(dispatcher);
 }
 
+void DartIsolate::SetBatchedMessageHandlingTaskRunner(
+    const fml::RefPtr<fml::TaskRunner>& runner) {
+  if (!runner) {
+    return;
+  }
+
+  message_handling_task_runner_ = runner;
+
+  auto queue = std::make_shared<PlatformIsolateMessageQueue>(
+      runner,
+      fml::TimeDelta::FromMicroseconds(
+          GetIsolateGroupData()
+              .GetSettings()
+              .platform_isolate_message_drain_budget_us),
+      platform_isolate_manager_);
+  std::weak_ptr<DartIsolate> weak_isolate = GetWeakIsolatePtr();
+  message_handler().Initialize(
+      [queue, weak_isolate](std::function<void()> task) {
+        queue->Push([task = std::move(task), weak_isolate]() {
+          TRACE_EVENT0("flutter", "DartIsolate::HandleMessage");
+          task();
+          // Task observers only flush microtasks after the whole batch, but
+          // the microtasks scheduled by a message must run before the next
+          // message is handled.
+          auto isolate = weak_isolate.lock();
+          if (isolate && !isolate->IsShuttingDown()) {
+            isolate->FlushMicrotasksNow();
+          }
+        });
+      });
+}
+
 // Updating thread names here does not change the underlying OS thread names.
 // Instead, this is just additional metadata for the Dart VM Service to show the
 // thread name of the isolate.
@@ -660,14 +858,19 @@ bool DartIsolate::LoadLibraries() {
   DartIO::InitForIsolate(may_insecurely_connect_to_all_domains_,
                          domain_network_policy_);
 
-  DartUI::InitForIsolate(GetIsolateGroupData().GetSettings());
+  // Compute isolates can't render, so they skip the setup of dart:ui. The FFI
+  // resolver of dart:ui was already installed by the root isolate of the
+  // group.
+  if (!is_compute_isolate_) {
+    DartUI::InitForIsolate(GetIsolateGroupData().GetSettings());
+  }
 
   const bool is_service_isolate = Dart_IsServiceIsolate(isolate());
 
   DartRuntimeHooks::Install(IsRootIsolate() && !is_service_isolate,
                             GetAdvisoryScriptURI());
 
-  if (!is_service_isolate) {
+  if (!is_service_isolate && !is_compute_isolate_) {
     class_library().add_provider(
         "ui", std::make_unique<tonic::DartClassProvider>(this, "dart:ui"));
   }
@@ -937,6 +1140,7 @@ bool DartIsolate::Shutdown() {
     return false;
   }
   phase_ = Phase::Shutdown;
+  ShutdownComputeIsolates();
   Dart_Isolate vm_isolate = isolate();
   // The isolate can be nullptr if this instance is the stub isolate data used
   // during root isolate creation.
@@ -1386,6 +1590,10 @@ void DartIsolate::OnShutdownCallback() {
     platform_isolate_manager_->RemovePlatformIsolate(isolate());
   }
 
+  // The VM may shut the root isolate down without a call to Shutdown(), for
+  // example when it is killed while the VM shuts down.
+  ShutdownComputeIsolates();
+
   shutdown_callbacks_.clear();
 
   const fml::closure& isolate_shutdown_callback =
@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "assets/native_assets.h"
 #include "flutter/fml/macros.h"
@@ -393,6 +394,35 @@ class DartIsolate : public UIDartState {
   Dart_Isolate CreatePlatformIsolate(Dart_Handle entry_point,
                                      char** error) override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a new isolate in the same group as this isolate,
+  ///             whose messages are handled by the Dart VM like those of the
+  ///             isolates spawned by `Isolate.spawn`. This method can only be
+  ///             invoked on the root isolate.
+  ///
+  ///             Compute isolates skip the setup of `dart:ui` that is only
+  ///             needed to render. The root isolate keeps
+  ///             `Settings::compute_isolate_pool_size` of them created ahead
+  ///             of time, so that a compute isolate is usually ready to run
+  ///             its entrypoint when it is requested.
+  ///
+  /// @param[in]  entry_point   The entrypoint to invoke once the isolate is
+  ///                           spawned. Will be run on the current thread.
+  /// @param[out] error         If spawning fails inside the Dart VM, this is
+  ///                           set to the error string. Otherwise it is set to
+  ///                           null.
+  ///
+  /// @return     The newly created isolate, or null if spawning failed.
+  ///
+  Dart_Isolate CreateComputeIsolate(Dart_Handle entry_point,
+                                    char** error) override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of compute isolates that were created ahead of
+  ///             time and are ready to run an entrypoint.
+  ///
+  size_t GetReadyComputeIsolateCount() const;
+
   bool LoadLoadingUnit(
       intptr_t loading_unit_id,
       std::unique_ptr<const fml::Mapping> snapshot_data,
@@ -432,8 +462,14 @@ class DartIsolate : public UIDartState {
   const bool may_insecurely_connect_to_all_domains_;
   const bool is_platform_isolate_;
   const bool is_spawning_in_group_;
+  bool is_compute_isolate_ = false;
   std::string domain_network_policy_;
   std::shared_ptr<PlatformIsolateManager> platform_isolate_manager_;
+  // The compute isolates of the root isolate that are ready to run an
+  // entrypoint. Only accessed on the message handling task runner.
+  std::vector<Dart_Isolate> ready_compute_isolates_;
+  bool compute_isolate_pool_fill_pending_ = false;
+  bool compute_isolates_shut_down_ = false;
 
   static std::weak_ptr<DartIsolate> CreateRootIsolate(
       const Settings& settings,
@@ -466,9 +502,36 @@ class DartIsolate : public UIDartState {
   ///
   [[nodiscard]] bool Initialize(Dart_Isolate dart_isolate);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a compute isolate in the group of this isolate. There
+  ///             must be no current isolate, and this isolate must not be
+  ///             entered on any other thread.
+  ///
+  Dart_Isolate MakeComputeIsolate(char** error);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Posts a task that creates a compute isolate if there are
+  ///             fewer ready compute isolates than the size of the pool.
+  ///
+  void ScheduleComputeIsolatePoolFill();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Shuts down the ready compute isolates and stops filling the
+  ///             pool, so that no compute isolate is created in the group
+  ///             once this isolate is shut down.
+  ///
+  void ShutdownComputeIsolates();
+
   void SetMessageHandlingTaskRunner(const fml::RefPtr<fml::TaskRunner>& runner,
                                     bool post_directly_to_runner);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Handles the messages of this platform isolate in batches on
+  ///             `runner`, using a `PlatformIsolateMessageQueue`.
+  ///
+  void SetBatchedMessageHandlingTaskRunner(
+      const fml::RefPtr<fml::TaskRunner>& runner);
+
   bool LoadKernel(const std::shared_ptr<const fml::Mapping>& mapping,
                   bool last_piece);
 
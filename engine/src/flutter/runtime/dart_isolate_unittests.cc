@@ -1112,6 +1112,79 @@ TEST_F(DartIsolateTest, PlatformIsolateMainThrowsError) {
   // root isolate will be auto-shutdown
 }
 
+TEST_F(DartIsolateTest, ComputeIsolateCreationFillsPool) {
+  fml::AutoResetWaitableEvent message_latch;
+  AddNativeCallback(
+      "PassMessage",
+      CREATE_NATIVE_ENTRY(([&message_latch](Dart_NativeArguments args) {
+        auto message = tonic::DartConverter<std::string>::FromDart(
+            Dart_GetNativeArgument(args, 0));
+        ASSERT_EQ("Compute isolate is ready", message);
+        message_latch.Signal();
+      })));
+
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+  auto settings = CreateSettingsForFixture();
+  settings.compute_isolate_pool_size = 1;
+  auto vm_ref = DartVMRef::Create(settings);
+  ASSERT_TRUE(vm_ref);
+  auto vm_data = vm_ref.GetVMData();
+  ASSERT_TRUE(vm_data);
+
+  auto ui_thread = CreateNewThread();
+  TaskRunners task_runners(GetCurrentTestName(),  // label
+                           ui_thread,             // platform
+                           ui_thread,             // raster
+                           ui_thread,             // ui
+                           ui_thread              // io
+  );
+  auto isolate =
+      RunDartCodeInIsolate(vm_ref, settings, task_runners, "emptyMain", {},
+                           GetDefaultKernelFilePath());
+  ASSERT_TRUE(isolate);
+  auto root_isolate = isolate->get();
+  ASSERT_EQ(root_isolate->GetPhase(), DartIsolate::Phase::Running);
+
+  fml::AutoResetWaitableEvent ui_thread_latch;
+  Dart_Isolate compute_isolate = nullptr;
+  fml::TaskRunner::RunNowOrPostTask(
+      ui_thread, fml::MakeCopyable([&]() mutable {
+        EXPECT_EQ(root_isolate->GetReadyComputeIsolateCount(), 0u);
+        ASSERT_TRUE(
+            isolate->RunInIsolateScope([root_isolate, &compute_isolate]() {
+              Dart_Handle lib = Dart_RootLibrary();
+              Dart_Handle entry_point = Dart_GetField(
+                  lib, tonic::ToDart("mainForComputeIsolates"));
+              char* error = nullptr;
+              compute_isolate =
+                  root_isolate->CreateComputeIsolate(entry_point, &error);
+
+              EXPECT_FALSE(error);
+              EXPECT_TRUE(compute_isolate);
+              EXPECT_EQ(Dart_CurrentIsolate(), root_isolate->isolate());
+              return true;
+            }));
+        ui_thread_latch.Signal();
+      }));
+  ui_thread_latch.Wait();
+  ASSERT_TRUE(compute_isolate);
+
+  // Wait for a message from the compute isolate.
+  message_latch.Wait();
+
+  // The pool is filled by a task that was posted when the compute isolate was
+  // taken.
+  fml::AutoResetWaitableEvent pool_latch;
+  fml::TaskRunner::RunNowOrPostTask(
+      ui_thread, fml::MakeCopyable([&]() mutable {
+        EXPECT_EQ(root_isolate->GetReadyComputeIsolateCount(), 1u);
+        pool_latch.Signal();
+      }));
+  pool_latch.Wait();
+
+  // root isolate will be auto-shutdown, along with the ready compute isolate.
+}
+
 }  // namespace testing
 }  // namespace flutter
 
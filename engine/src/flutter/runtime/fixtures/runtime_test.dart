@@ -194,6 +194,11 @@ void mainForPlatformIsolates() {
   passMessage('Platform isolate is ready');
 }
 
+@pragma('vm:entry-point')
+void mainForComputeIsolates() {
+  passMessage('Compute isolate is ready');
+}
+
 @pragma('vm:entry-point')
 void emptyMain(List<Object?> args) {}
 
@@ -4,6 +4,11 @@
 
 #include "flutter/runtime/platform_isolate_manager.h"
 
+#include <algorithm>
+#include <utility>
+
+#include "flutter/fml/time/time_point.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/runtime/dart_isolate.h"
 
 namespace flutter {
@@ -67,4 +72,111 @@ bool PlatformIsolateManager::IsRegisteredForTestingOnly(Dart_Isolate isolate) {
   return platform_isolates_.find(isolate) != platform_isolates_.end();
 }
 
+PlatformIsolateManager::MessageQueueStats
+PlatformIsolateManager::GetMessageQueueStats() {
+  std::scoped_lock lock(stats_lock_);
+  return stats_;
+}
+
+void PlatformIsolateManager::OnMessageQueued() {
+  std::scoped_lock lock(stats_lock_);
+  stats_.queue_depth++;
+  stats_.max_queue_depth =
+      std::max(stats_.max_queue_depth, stats_.queue_depth);
+}
+
+void PlatformIsolateManager::OnMessagesHandled(size_t count,
+                                               fml::TimeDelta drain_time) {
+  std::scoped_lock lock(stats_lock_);
+  FML_DCHECK(stats_.queue_depth >= count);
+  stats_.queue_depth -= count;
+  stats_.drain_count++;
+  stats_.handled_message_count += count;
+  stats_.total_drain_time = stats_.total_drain_time + drain_time;
+  stats_.max_drain_time = std::max(stats_.max_drain_time, drain_time);
+}
+
+PlatformIsolateMessageQueue::PlatformIsolateMessageQueue(
+    fml::RefPtr<fml::TaskRunner> task_runner,
+    fml::TimeDelta drain_budget,
+    std::weak_ptr<PlatformIsolateManager> platform_isolate_manager)
+    : task_runner_(std::move(task_runner)),
+      drain_budget_(drain_budget),
+      platform_isolate_manager_(std::move(platform_isolate_manager)) {}
+
+PlatformIsolateMessageQueue::~PlatformIsolateMessageQueue() = default;
+
+void PlatformIsolateMessageQueue::Push(fml::closure task) {
+  size_t queue_depth = 0;
+  bool post_drain = false;
+  {
+    std::scoped_lock lock(lock_);
+    tasks_.push_back(std::move(task));
+    queue_depth = tasks_.size();
+    post_drain = !drain_pending_;
+    drain_pending_ = true;
+    // Recorded while holding the lock, so that the message is not handled
+    // before it was counted.
+    if (auto platform_isolate_manager = platform_isolate_manager_.lock()) {
+      platform_isolate_manager->OnMessageQueued();
+    }
+  }
+  FML_TRACE_COUNTER("flutter", "PlatformIsolateMessageQueue",
+                    reinterpret_cast<int64_t>(this), "QueueDepth",
+                    queue_depth);
+  if (post_drain) {
+    PostDrain();
+  }
+}
+
+size_t PlatformIsolateMessageQueue::GetQueueDepth() {
+  std::scoped_lock lock(lock_);
+  return tasks_.size();
+}
+
+void PlatformIsolateMessageQueue::PostDrain() {
+  task_runner_->PostTask([queue = shared_from_this()]() { queue->Drain(); });
+}
+
+void PlatformIsolateMessageQueue::Drain() {
+  TRACE_EVENT0("flutter", "PlatformIsolateMessageQueue::Drain");
+  const fml::TimePoint start = fml::TimePoint::Now();
+  size_t handled_count = 0;
+  size_t queue_depth = 0;
+  bool post_drain = false;
+  while (true) {
+    fml::closure task;
+    {
+      std::scoped_lock lock(lock_);
+      queue_depth = tasks_.size();
+      if (tasks_.empty()) {
+        drain_pending_ = false;
+        break;
+      }
+      // At least one message is handled per task, so that the queue makes
+      // progress even if a single message takes longer than the budget.
+      if (handled_count > 0 &&
+          fml::TimePoint::Now() - start >= drain_budget_) {
+        post_drain = true;
+        break;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+    handled_count++;
+  }
+
+  if (auto platform_isolate_manager = platform_isolate_manager_.lock()) {
+    platform_isolate_manager->OnMessagesHandled(handled_count,
+                                                fml::TimePoint::Now() - start);
+  }
+  FML_TRACE_COUNTER("flutter", "PlatformIsolateMessageQueue",
+                    reinterpret_cast<int64_t>(this), "QueueDepth",
+                    queue_depth);
+  if (post_drain) {
+    PostDrain();
+  }
+}
+
 }  // namespace flutter
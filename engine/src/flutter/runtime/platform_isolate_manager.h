@@ -6,9 +6,14 @@
 #define FLUTTER_RUNTIME_PLATFORM_ISOLATE_MANAGER_H_
 
 #include <atomic>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <unordered_set>
 
+#include "flutter/fml/closure.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_delta.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 
 namespace flutter {
@@ -43,12 +48,80 @@ class PlatformIsolateManager {
   /// any thread.
   bool IsRegisteredForTestingOnly(Dart_Isolate isolate);
 
+  /// Counters of the message queues of the platform isolates.
+  struct MessageQueueStats {
+    /// The number of messages that are queued and not yet handled.
+    size_t queue_depth = 0;
+    /// The largest number of messages that were queued at the same time.
+    size_t max_queue_depth = 0;
+    /// The number of platform thread tasks that handled queued messages.
+    size_t drain_count = 0;
+    /// The number of messages that these tasks handled.
+    size_t handled_message_count = 0;
+    /// The total time that these tasks spent handling messages.
+    fml::TimeDelta total_drain_time;
+    /// The longest time that one of these tasks spent handling messages.
+    fml::TimeDelta max_drain_time;
+  };
+
+  /// Returns the counters of the message queues of the platform isolates.
+  /// Callable from any thread.
+  MessageQueueStats GetMessageQueueStats();
+
+  /// Records that a message was added to the queue of a platform isolate.
+  /// Callable from any thread.
+  void OnMessageQueued();
+
+  /// Records that a task handled `count` queued messages in `drain_time`.
+  /// Must be called from the platform thread.
+  void OnMessagesHandled(size_t count, fml::TimeDelta drain_time);
+
  private:
   // This lock must be recursive because ShutdownPlatformIsolates indirectly
   // calls RemovePlatformIsolate.
   std::recursive_mutex lock_;
   std::unordered_set<Dart_Isolate> platform_isolates_;
   bool is_shutdown_ = false;
+  std::mutex stats_lock_;
+  MessageQueueStats stats_;
+};
+
+/// Queues the messages of a platform isolate, and handles them in batches on
+/// the platform thread.
+///
+/// Without the queue, every message sent to a platform isolate posts its own
+/// task to the platform thread, so isolates that receive messages at high
+/// rates flood the platform task queue. The queue instead posts a single task
+/// that handles the messages queued until then, for at most the given time
+/// budget per turn of the platform message loop. The remaining messages are
+/// handled by a task that is posted again.
+class PlatformIsolateMessageQueue
+    : public std::enable_shared_from_this<PlatformIsolateMessageQueue> {
+ public:
+  PlatformIsolateMessageQueue(
+      fml::RefPtr<fml::TaskRunner> task_runner,
+      fml::TimeDelta drain_budget,
+      std::weak_ptr<PlatformIsolateManager> platform_isolate_manager);
+
+  ~PlatformIsolateMessageQueue();
+
+  /// Queues the task that handles a message. Callable from any thread.
+  void Push(fml::closure task);
+
+  /// Returns the number of queued tasks. Callable from any thread.
+  size_t GetQueueDepth();
+
+ private:
+  const fml::RefPtr<fml::TaskRunner> task_runner_;
+  const fml::TimeDelta drain_budget_;
+  const std::weak_ptr<PlatformIsolateManager> platform_isolate_manager_;
+  std::mutex lock_;
+  std::deque<fml::closure> tasks_;
+  bool drain_pending_ = false;
+
+  void PostDrain();
+
+  void Drain();
 };
 
 }  // namespace flutter
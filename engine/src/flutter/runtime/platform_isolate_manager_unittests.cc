@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/runtime/dart_vm.h"
 #include "flutter/runtime/dart_vm_lifecycle.h"
 #include "flutter/runtime/isolate_configuration.h"
@@ -265,5 +266,81 @@ TEST_F(PlatformIsolateManagerTest, MultithreadedCreation) {
   });
 }
 
+TEST_F(PlatformIsolateManagerTest, MessageQueueHandlesMessagesInBatches) {
+  auto mgr = std::make_shared<PlatformIsolateManager>();
+  auto platform_thread = CreateNewThread();
+  auto queue = std::make_shared<PlatformIsolateMessageQueue>(
+      platform_thread, fml::TimeDelta::FromSeconds(10), mgr);
+
+  // Block the platform thread until all messages are queued.
+  fml::AutoResetWaitableEvent queued_latch;
+  platform_thread->PostTask([&queued_latch]() { queued_latch.Wait(); });
+
+  std::vector<int> handled;
+  for (int i = 0; i < 10; ++i) {
+    queue->Push([&handled, i]() { handled.push_back(i); });
+  }
+  EXPECT_EQ(queue->GetQueueDepth(), 10u);
+  EXPECT_EQ(mgr->GetMessageQueueStats().queue_depth, 10u);
+  queued_latch.Signal();
+
+  fml::AutoResetWaitableEvent handled_latch;
+  platform_thread->PostTask([&handled_latch]() { handled_latch.Signal(); });
+  handled_latch.Wait();
+
+  EXPECT_EQ(handled, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  EXPECT_EQ(queue->GetQueueDepth(), 0u);
+  PlatformIsolateManager::MessageQueueStats stats =
+      mgr->GetMessageQueueStats();
+  EXPECT_EQ(stats.queue_depth, 0u);
+  EXPECT_EQ(stats.max_queue_depth, 10u);
+  EXPECT_EQ(stats.drain_count, 1u);
+  EXPECT_EQ(stats.handled_message_count, 10u);
+  EXPECT_GE(stats.total_drain_time, stats.max_drain_time);
+}
+
+TEST_F(PlatformIsolateManagerTest, MessageQueueDrainYieldsAfterBudget) {
+  auto mgr = std::make_shared<PlatformIsolateManager>();
+  auto platform_thread = CreateNewThread();
+  auto queue = std::make_shared<PlatformIsolateMessageQueue>(
+      platform_thread, fml::TimeDelta::Zero(), mgr);
+
+  fml::AutoResetWaitableEvent queued_latch;
+  platform_thread->PostTask([&queued_latch]() { queued_latch.Wait(); });
+
+  std::vector<int> handled;
+  for (int i = 0; i < 3; ++i) {
+    queue->Push([&handled, i]() { handled.push_back(i); });
+  }
+  queued_latch.Signal();
+
+  // A task posted after the messages runs before the messages that were left
+  // for later turns of the platform message loop.
+  fml::AutoResetWaitableEvent posted_latch;
+  size_t handled_before_posted_task = 0;
+  platform_thread->PostTask([&]() {
+    handled_before_posted_task = handled.size();
+    posted_latch.Signal();
+  });
+  posted_latch.Wait();
+  EXPECT_EQ(handled_before_posted_task, 1u);
+
+  // Every task handles at least one message.
+  while (queue->GetQueueDepth() > 0) {
+    fml::AutoResetWaitableEvent latch;
+    platform_thread->PostTask([&latch]() { latch.Signal(); });
+    latch.Wait();
+  }
+  fml::AutoResetWaitableEvent handled_latch;
+  platform_thread->PostTask([&handled_latch]() { handled_latch.Signal(); });
+  handled_latch.Wait();
+
+  EXPECT_EQ(handled, std::vector<int>({0, 1, 2}));
+  PlatformIsolateManager::MessageQueueStats stats =
+      mgr->GetMessageQueueStats();
+  EXPECT_EQ(stats.drain_count, 3u);
+  EXPECT_EQ(stats.handled_message_count, 3u);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -28,6 +28,7 @@ class ServiceProtocol {
   static const std::string_view kGetDisplayRefreshRateExtensionName;
   static const std::string_view kGetSkSLsExtensionName;
   static const std::string_view kEstimateRasterCacheMemoryExtensionName;
+  static const std::string_view kGetMemoryAccountingExtensionName;
   static const std::string_view kReloadAssetFonts;
 
   class Handler {
@@ -0,0 +1,36 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_IMPELLER_VULKAN_BENCHMARK_UTILS_H_
+#define FLUTTER_SHELL_COMMON_IMPELLER_VULKAN_BENCHMARK_UTILS_H_
+
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/mapping.h"
+#include "impeller/entity/vk/entity_shaders_vk.h"             // nogncheck
+#include "impeller/entity/vk/framebuffer_blend_shaders_vk.h"  // nogncheck
+#include "impeller/entity/vk/modern_shaders_vk.h"             // nogncheck
+#include "impeller/renderer/vk/compute_shaders_vk.h"          // nogncheck
+
+namespace flutter {
+
+/// The shader libraries needed by the Impeller entity framework on Vulkan.
+inline std::vector<std::shared_ptr<fml::Mapping>> ShaderLibraryMappings() {
+  return {
+      std::make_shared<fml::NonOwnedMapping>(impeller_entity_shaders_vk_data,
+                                             impeller_entity_shaders_vk_length),
+      std::make_shared<fml::NonOwnedMapping>(impeller_modern_shaders_vk_data,
+                                             impeller_modern_shaders_vk_length),
+      std::make_shared<fml::NonOwnedMapping>(
+          impeller_framebuffer_blend_shaders_vk_data,
+          impeller_framebuffer_blend_shaders_vk_length),
+      std::make_shared<fml::NonOwnedMapping>(
+          impeller_compute_shaders_vk_data, impeller_compute_shaders_vk_length),
+  };
+}
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_IMPELLER_VULKAN_BENCHMARK_UTILS_H_
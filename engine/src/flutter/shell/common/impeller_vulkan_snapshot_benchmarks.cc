@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vulkan/vulkan.h>  // nogncheck
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/fml/logging.h"
+#include "flutter/shell/common/impeller_vulkan_benchmark_utils.h"
+#include "impeller/display_list/aiks_context.h"           // nogncheck
+#include "impeller/display_list/dl_dispatcher.h"          // nogncheck
+#include "impeller/renderer/backend/vulkan/context_vk.h"  // nogncheck
+#include "impeller/typographer/backends/skia/typographer_context_skia.h"  // nogncheck
+
+namespace flutter {
+
+namespace {
+
+constexpr impeller::ISize kThumbnailSize(128, 128);
+
+std::vector<sk_sp<DisplayList>> MakeThumbnails(int64_t count) {
+  std::vector<sk_sp<DisplayList>> display_lists;
+  for (int64_t i = 0; i < count; i++) {
+    DisplayListBuilder builder;
+    DlPaint paint;
+    paint.setColor(DlColor::kWhite());
+    builder.DrawPaint(paint);
+    paint.setColor(DlColor::kBlue().withAlpha(128 + i % 128));
+    builder.DrawRect(SkRect::MakeXYWH(8, 8, 112, 64), paint);
+    paint.setColor(DlColor::kRed());
+    builder.DrawCircle(SkPoint::Make(32 + i % 64, 96), 16, paint);
+    display_lists.push_back(builder.Build());
+  }
+  return display_lists;
+}
+
+// Snapshots `state.range(0)` small pictures with a single submission when
+// `batched` is true, and with a submission per picture otherwise, waiting for
+// the GPU to finish in both cases. Uses the statically linked SwiftShader
+// Vulkan implementation, so absolute numbers are only comparable between runs
+// on the same host.
+void SnapshotThumbnails(benchmark::State& state, bool batched) {
+  impeller::ContextVK::Settings settings;
+  settings.proc_address_callback = &vkGetInstanceProcAddr;
+  settings.shader_libraries_data = ShaderLibraryMappings();
+  std::shared_ptr<impeller::ContextVK> context =
+      impeller::ContextVK::Create(std::move(settings));
+  FML_CHECK(context && context->IsValid());
+  {
+    impeller::AiksContext aiks_context(
+        context, impeller::TypographerContextSkia::Make());
+    FML_CHECK(aiks_context.IsValid());
+
+    const std::vector<sk_sp<DisplayList>> display_lists =
+        MakeThumbnails(state.range(0));
+    const std::vector<impeller::ISize> sizes(display_lists.size(),
+                                             kThumbnailSize);
+    while (state.KeepRunning()) {
+      std::vector<std::shared_ptr<impeller::Texture>> textures;
+      if (batched) {
+        textures = impeller::DisplayListsToTextures(
+            display_lists, sizes, aiks_context,
+            /*reset_host_buffer=*/false, /*generate_mips=*/true);
+      } else {
+        for (const auto& display_list : display_lists) {
+          textures.push_back(impeller::DisplayListToTexture(
+              display_list, kThumbnailSize, aiks_context,
+              /*reset_host_buffer=*/false, /*generate_mips=*/true));
+        }
+      }
+      context->GetIdleWaiter()->WaitIdle();
+      benchmark::DoNotOptimize(textures);
+
+      // Recycle the host buffer as the rasterizer would at the end of a frame.
+      benchmarking::ScopedPauseTiming pause(state, true);
+      aiks_context.GetContentContext().GetTransientsBuffer().Reset();
+    }
+    state.SetItemsProcessed(state.iterations() * display_lists.size());
+  }
+  context->Shutdown();
+}
+
+}  // namespace
+
+static void BM_ImpellerSnapshotSequential(benchmark::State& state) {
+  SnapshotThumbnails(state, /*batched=*/false);
+}
+
+static void BM_ImpellerSnapshotBatched(benchmark::State& state) {
+  SnapshotThumbnails(state, /*batched=*/true);
+}
+
+BENCHMARK(BM_ImpellerSnapshotSequential)
+    ->RangeMultiplier(4)
+    ->Range(4, 256)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ImpellerSnapshotBatched)
+    ->RangeMultiplier(4)
+    ->Range(4, 256)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace flutter
@@ -0,0 +1,57 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vulkan/vulkan.h>  // nogncheck
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/logging.h"
+#include "flutter/shell/common/impeller_vulkan_benchmark_utils.h"
+#include "impeller/entity/contents/content_context.h"             // nogncheck
+#include "impeller/renderer/backend/vulkan/context_vk.h"          // nogncheck
+#include "impeller/typographer/backends/skia/typographer_context_skia.h"  // nogncheck
+
+namespace flutter {
+
+// Measures the time from Vulkan context creation until the pipelines used by
+// a typical first frame (solid fills, textures, text, and clips) are ready.
+// Uses the statically linked SwiftShader Vulkan implementation, so absolute
+// numbers are only comparable between runs on the same host.
+//
+// The argument selects whether shader modules are created in parallel (1) or
+// serially (0), so that both can be compared in the same run.
+static void BM_ImpellerVulkanTimeToFirstFrame(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    impeller::ContextVK::Settings settings;
+    settings.proc_address_callback = &vkGetInstanceProcAddr;
+    settings.shader_libraries_data = ShaderLibraryMappings();
+    settings.enable_parallel_shader_module_creation = state.range(0) != 0;
+    auto context = impeller::ContextVK::Create(std::move(settings));
+    FML_CHECK(context && context->IsValid());
+
+    auto content_context = std::make_unique<impeller::ContentContext>(
+        context, impeller::TypographerContextSkia::Make());
+    FML_CHECK(content_context->IsValid());
+
+    // Fetching a pipeline blocks until it has been created.
+    const auto options = impeller::ContentContextOptions{
+        .sample_count = impeller::SampleCount::kCount4,
+        .color_attachment_pixel_format =
+            context->GetCapabilities()->GetDefaultColorFormat()};
+    FML_CHECK(content_context->GetSolidFillPipeline(options));
+    FML_CHECK(content_context->GetTexturePipeline(options));
+    FML_CHECK(content_context->GetGlyphAtlasPipeline(options));
+    FML_CHECK(content_context->GetClipPipeline(options));
+
+    benchmarking::ScopedPauseTiming pause(state, true);
+    content_context.reset();
+    context->Shutdown();
+  }
+}
+
+BENCHMARK(BM_ImpellerVulkanTimeToFirstFrame)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace flutter
@@ -166,6 +166,27 @@ TEST_F(PersistentCacheTest, CanPurgePersistentCache) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(PersistentCacheTest, StoresFontFallbackCacheOnShutdown) {
+  fml::ScopedTemporaryDirectory base_dir;
+  ASSERT_TRUE(base_dir.fd().is_valid());
+  PersistentCache::SetCacheDirectoryPath(base_dir.path());
+  PersistentCache::ResetCacheForProcess();
+
+  auto settings = CreateSettingsForFixture();
+  auto config = RunConfiguration::InferFromSettings(settings);
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+  RunEngine(shell.get(), std::move(config));
+  DestroyShell(std::move(shell));
+
+  const auto& cache_dir =
+      PersistentCache::GetCacheForProcess()->GetCacheDirectory();
+  ASSERT_TRUE(cache_dir->is_valid());
+  EXPECT_TRUE(fml::FileExists(*cache_dir, "font_fallback_cache"));
+
+  // Cleanup
+  fml::RemoveFilesInDirectory(base_dir.fd());
+}
+
 TEST_F(PersistentCacheTest, PurgeAllowsFutureSkSLCache) {
   sk_sp<SkData> shader_key = SkData::MakeWithCString("key");
   sk_sp<SkData> shader_value = SkData::MakeWithCString("value");
@@ -449,6 +449,14 @@ sk_sp<DlImage> Rasterizer::MakeRasterSnapshotSync(
                                                       picture_size);
 }
 
+void Rasterizer::MakeRasterSnapshots(
+    std::vector<sk_sp<DisplayList>> display_lists,
+    std::vector<SkISize> picture_sizes,
+    std::function<void(const std::vector<sk_sp<DlImage>>&)> callback) {
+  return snapshot_controller_->MakeRasterSnapshots(
+      std::move(display_lists), std::move(picture_sizes), callback);
+}
+
 sk_sp<SkImage> Rasterizer::ConvertToRasterImage(sk_sp<SkImage> image) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   return snapshot_controller_->ConvertToRasterImage(image);
@@ -897,6 +905,12 @@ Rasterizer::ScreenshotFormat ToScreenshotFormat(impeller::PixelFormat format) {
     case impeller::PixelFormat::kR32G32B32A32Float:
     case impeller::PixelFormat::kB10G10R10XR:
     case impeller::PixelFormat::kB10G10R10A10XR:
+    case impeller::PixelFormat::kBC1RGBAUNorm:
+    case impeller::PixelFormat::kBC3RGBAUNorm:
+    case impeller::PixelFormat::kBC7RGBAUNorm:
+    case impeller::PixelFormat::kETC2R8G8B8UNorm:
+    case impeller::PixelFormat::kETC2R8G8B8A8UNorm:
+    case impeller::PixelFormat::kASTC4x4UNorm:
       FML_DCHECK(false);
       return Rasterizer::ScreenshotFormat::kUnknown;
     case impeller::PixelFormat::kR8G8B8A8UNormInt:
@@ -652,6 +652,13 @@ class Rasterizer final : public SnapshotDelegate,
   sk_sp<DlImage> MakeRasterSnapshotSync(sk_sp<DisplayList> display_list,
                                         SkISize picture_size) override;
 
+  // |SnapshotDelegate|
+  void MakeRasterSnapshots(
+      std::vector<sk_sp<DisplayList>> display_lists,
+      std::vector<SkISize> picture_sizes,
+      std::function<void(const std::vector<sk_sp<DlImage>>&)> callback)
+      override;
+
   // |SnapshotDelegate|
   sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) override;
 
@@ -7,6 +7,7 @@
 #include "flutter/shell/common/shell.h"
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -20,6 +21,7 @@
 #include "flutter/fml/log_settings.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/memory/memory_accounting.h"
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
@@ -42,6 +44,7 @@
 #include "third_party/skia/include/codec/SkWebpDecoder.h"
 #include "third_party/skia/include/core/SkGraphics.h"
 #include "third_party/tonic/common/log.h"
+#include "txt/font_fallback_cache.h"
 
 namespace flutter {
 
@@ -49,6 +52,7 @@ constexpr char kSkiaChannel[] = "flutter/skia";
 constexpr char kSystemChannel[] = "flutter/system";
 constexpr char kTypeKey[] = "type";
 constexpr char kFontChange[] = "fontsChange";
+constexpr char kFontFallbackCacheFileName[] = "font_fallback_cache";
 
 namespace {
 
@@ -118,6 +122,10 @@ void PerformInitializationTasks(Settings& settings) {
       InitSkiaEventTracer(settings.trace_skia, settings.trace_skia_allowlist);
     }
 
+    if (settings.track_memory_high_water_marks) {
+      fml::MemoryAccounting::SetHighWaterMarkTrackingEnabled(true);
+    }
+
     if (!settings.trace_allowlist.empty()) {
       fml::tracing::TraceSetAllowlist(settings.trace_allowlist);
     }
@@ -499,6 +507,11 @@ Shell::Shell(DartVMRef vm,
           task_runners_.GetRasterTaskRunner(),
           std::bind(&Shell::OnServiceProtocolEstimateRasterCacheMemory, this,
                     std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetMemoryAccountingExtensionName] = {
+          task_runners_.GetUITaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetMemoryAccounting, this,
+                    std::placeholders::_1, std::placeholders::_2)};
   service_protocol_handlers_[ServiceProtocol::kReloadAssetFonts] = {
       task_runners_.GetPlatformTaskRunner(),
       std::bind(&Shell::OnServiceProtocolReloadAssetFonts, this,
@@ -507,6 +520,18 @@ Shell::Shell(DartVMRef vm,
 
 Shell::~Shell() {
 #if !SLIMPELLER
+  // Keep the fallback fonts found by this shell for the next run. The task
+  // runs before the IO task runner is drained below.
+  if (!PersistentCache::GetCacheForProcess()->IsReadOnly()) {
+    task_runners_.GetIOTaskRunner()->PostTask(
+        [cache_directory =
+             PersistentCache::GetCacheForProcess()->GetCacheDirectory()]() {
+          if (cache_directory->is_valid()) {
+            txt::FontFallbackCache::GetShared()->Save(
+                *cache_directory, kFontFallbackCacheFileName);
+          }
+        });
+  }
   PersistentCache::GetCacheForProcess()->RemoveWorkerTaskRunner(
       task_runners_.GetIOTaskRunner());
 #endif  //  !SLIMPELLER
@@ -630,6 +655,13 @@ void Shell::NotifyLowMemoryWarning() const {
         TRACE_EVENT_ASYNC_END0("flutter", "Shell::NotifyLowMemoryWarning",
                                trace_id);
       });
+  task_runners_.GetUITaskRunner()->PostTask([engine = weak_engine_]() {
+    if (engine) {
+      if (auto image_decoder = engine->GetImageDecoderWeakPtr()) {
+        image_decoder->PurgeDecodedImageCache();
+      }
+    }
+  });
   // The IO Manager uses resource cache limits of 0, so it is not necessary
   // to purge them.
 }
@@ -782,6 +814,21 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
   if (settings_.purge_persistent_cache) {
     PersistentCache::GetCacheForProcess()->Purge();
   }
+
+  // Finding the fallback font of a character is slow on some platforms, so
+  // reuse the fallbacks of previous runs. They are only loaded once per
+  // process, and are validated against the fonts of the platform when used.
+  static std::once_flag font_fallback_cache_loaded;
+  task_runners_.GetIOTaskRunner()->PostTask(
+      [cache_directory =
+           PersistentCache::GetCacheForProcess()->GetCacheDirectory()]() {
+        std::call_once(font_fallback_cache_loaded, [&cache_directory]() {
+          if (cache_directory->is_valid()) {
+            txt::FontFallbackCache::GetShared()->Load(
+                *cache_directory, kFontFallbackCacheFileName);
+          }
+        });
+      });
 #endif  //  !SLIMPELLER
 
   return true;
@@ -1946,6 +1993,69 @@ bool Shell::OnServiceProtocolEstimateRasterCacheMemory(
   return true;
 }
 
+bool Shell::OnServiceProtocolGetMemoryAccounting(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
+
+  auto track_high_water_marks = params.find("trackHighWaterMarks");
+  if (track_high_water_marks != params.end()) {
+    fml::MemoryAccounting::SetHighWaterMarkTrackingEnabled(
+        track_high_water_marks->second == "true");
+  }
+  auto reset_high_water_marks = params.find("resetHighWaterMarks");
+  if (reset_high_water_marks != params.end() &&
+      reset_high_water_marks->second == "true") {
+    fml::MemoryAccounting::ResetHighWaterMarks();
+  }
+
+  bool tracking = fml::MemoryAccounting::IsHighWaterMarkTrackingEnabled();
+  fml::MemoryAccounting::Snapshot snapshot = GetMemoryAccountingSnapshot();
+  auto& allocator = response->GetAllocator();
+  rapidjson::Value categories(rapidjson::kObjectType);
+  for (size_t i = 0; i < fml::kMemoryCategoryCount; i++) {
+    auto category = static_cast<fml::MemoryCategory>(i);
+    rapidjson::Value domains(rapidjson::kObjectType);
+    for (size_t j = 0; j < fml::kMemoryDomainCount; j++) {
+      auto domain = static_cast<fml::MemoryDomain>(j);
+      const fml::MemoryAccounting::Counter& counter =
+          snapshot.Get(category, domain);
+      rapidjson::Value counter_json(rapidjson::kObjectType);
+      counter_json.AddMember<int64_t>("bytes", counter.bytes, allocator);
+      if (tracking) {
+        counter_json.AddMember<int64_t>("highWaterMarkBytes",
+                                        counter.high_water_mark_bytes,
+                                        allocator);
+      }
+      domains.AddMember(rapidjson::StringRef(
+                            fml::MemoryAccounting::GetDomainName(domain)),
+                        counter_json, allocator);
+    }
+    categories.AddMember(
+        rapidjson::StringRef(fml::MemoryAccounting::GetCategoryName(category)),
+        domains, allocator);
+  }
+
+  response->SetObject();
+  response->AddMember("type", "MemoryAccounting", allocator);
+  response->AddMember("highWaterMarksTracked", tracking, allocator);
+  response->AddMember("categories", categories, allocator);
+  return true;
+}
+
+fml::MemoryAccounting::Snapshot Shell::GetMemoryAccountingSnapshot() {
+  // The font cache of Skia is shared by all shells of the process, and is
+  // sampled when the counters are read instead of on every glyph.
+  static std::mutex font_cache_mutex;
+  static fml::AccountedMemory* font_cache =
+      new fml::AccountedMemory(fml::MemoryCategory::kFontCache);
+  {
+    std::scoped_lock lock(font_cache_mutex);
+    font_cache->SetBytes(SkGraphics::GetFontCacheUsed());
+  }
+  return fml::MemoryAccounting::GetSnapshot();
+}
+
 // Service protocol handler
 bool Shell::OnServiceProtocolSetAssetBundlePath(
     const ServiceProtocol::Handler::ServiceProtocolMap& params,
@@ -2167,7 +2277,7 @@ bool Shell::ReloadSystemFonts() {
     return false;
   }
   engine_->SetupDefaultFontManager();
-  engine_->GetFontCollection().GetFontCollection()->ClearFontFamilyCache();
+  engine_->GetFontCollection().GetFontCollection()->ClearFontFallbackCache();
   // After system fonts are reloaded, we send a system channel message
   // to notify flutter framework.
   SendFontChangeNotification();
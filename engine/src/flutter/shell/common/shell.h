@@ -17,6 +17,7 @@
 #include "flutter/flow/surface.h"
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/memory/memory_accounting.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/fml/memory/thread_checker.h"
 #include "flutter/fml/memory/weak_ptr.h"
@@ -418,6 +419,15 @@ class Shell final : public PlatformView::Delegate,
 
   const std::weak_ptr<VsyncWaiter> GetVsyncWaiter() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the memory accounting counters of the process, after
+  ///             updating the ones that are sampled rather than updated by
+  ///             their subsystems, like the one of the font cache.
+  ///
+  ///             This method is thread-safe.
+  ///
+  static fml::MemoryAccounting::Snapshot GetMemoryAccountingSnapshot();
+
   const std::shared_ptr<fml::ConcurrentTaskRunner>
   GetConcurrentWorkerTaskRunner() const;
 
@@ -765,6 +775,15 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Service protocol handler
+  //
+  // The optional 'trackHighWaterMarks' parameter enables or disables the
+  // tracking of the high-water marks, and the optional 'resetHighWaterMarks'
+  // parameter resets them before the counters are returned.
+  bool OnServiceProtocolGetMemoryAccounting(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
   // Service protocol handler
   //
   // Forces the FontCollection to reload the font manifest. Used to support
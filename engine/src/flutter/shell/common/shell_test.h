@@ -138,6 +138,7 @@ class ShellTest : public FixtureTest {
   enum ServiceProtocolEnum {
     kGetSkSLs,
     kEstimateRasterCacheMemory,
+    kGetMemoryAccounting,
     kSetAssetBundlePath,
     kRunInView,
   };
@@ -29,6 +29,7 @@
 #include "flutter/fml/backtrace.h"
 #include "flutter/fml/command_line.h"
 #include "flutter/fml/message_loop.h"
+#include "flutter/fml/memory/memory_accounting.h"
 #include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/runtime/dart_vm.h"
@@ -2487,6 +2488,43 @@ TEST_F(ShellTest, RasterizerMakeRasterSnapshot) {
   DestroyShell(std::move(shell), task_runners);
 }
 
+TEST_F(ShellTest, RasterizerMakeRasterSnapshots) {
+  Settings settings = CreateSettingsForFixture();
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  auto task_runner = CreateNewThread();
+  TaskRunners task_runners("test", task_runner, task_runner, task_runner,
+                           task_runner);
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  PlatformViewNotifyCreated(shell.get());
+
+  RunEngine(shell.get(), std::move(configuration));
+
+  auto latch = std::make_shared<fml::AutoResetWaitableEvent>();
+
+  PumpOneFrame(shell.get());
+
+  fml::TaskRunner::RunNowOrPostTask(
+      shell->GetTaskRunners().GetRasterTaskRunner(), [&shell, &latch]() {
+        SnapshotDelegate* delegate =
+            reinterpret_cast<Rasterizer*>(shell->GetRasterizer().get());
+        delegate->MakeRasterSnapshots(
+            {MakeSizedDisplayList(50, 50), MakeSizedDisplayList(20, 30)},
+            {SkISize::Make(50, 50), SkISize::Make(20, 30)},
+            [&latch](const std::vector<sk_sp<DlImage>>& images) {
+              ASSERT_EQ(images.size(), 2u);
+              ASSERT_NE(images[0], nullptr);
+              ASSERT_NE(images[1], nullptr);
+              EXPECT_EQ(images[0]->dimensions(), SkISize::Make(50, 50));
+              EXPECT_EQ(images[1]->dimensions(), SkISize::Make(20, 30));
+              latch->Signal();
+            });
+      });
+  latch->Wait();
+  DestroyShell(std::move(shell), task_runners);
+}
+
 TEST_F(ShellTest, OnServiceProtocolEstimateRasterCacheMemoryWorks) {
   Settings settings = CreateSettingsForFixture();
   std::unique_ptr<Shell> shell = CreateShell(settings);
@@ -2592,6 +2630,32 @@ TEST_F(ShellTest, OnServiceProtocolEstimateRasterCacheMemoryWorks) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(ShellTest, OnServiceProtocolGetMemoryAccountingWorks) {
+  Settings settings = CreateSettingsForFixture();
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+
+  fml::AccountedMemory memory(fml::MemoryCategory::kImage,
+                              fml::MemoryDomain::kGpu, 1000);
+  ServiceProtocol::Handler::ServiceProtocolMap params;
+  params["trackHighWaterMarks"] = "true";
+  rapidjson::Document document;
+  OnServiceProtocol(shell.get(), ServiceProtocolEnum::kGetMemoryAccounting,
+                    shell->GetTaskRunners().GetUITaskRunner(), params,
+                    &document);
+  DestroyShell(std::move(shell));
+
+  ASSERT_TRUE(document.IsObject());
+  EXPECT_STREQ(document["type"].GetString(), "MemoryAccounting");
+  EXPECT_TRUE(document["highWaterMarksTracked"].GetBool());
+  const rapidjson::Value& image_gpu = document["categories"]["image"]["gpu"];
+  EXPECT_GE(image_gpu["bytes"].GetInt64(), 1000);
+  EXPECT_GE(image_gpu["highWaterMarkBytes"].GetInt64(),
+            image_gpu["bytes"].GetInt64());
+  EXPECT_TRUE(document["categories"].HasMember("fontCache"));
+
+  fml::MemoryAccounting::SetHighWaterMarkTrackingEnabled(false);
+}
+
 // TODO(https://github.com/flutter/flutter/issues/100273): Disabled due to
 // flakiness.
 // TODO(https://github.com/flutter/flutter/issues/100299): Fix it when
@@ -2968,6 +3032,13 @@ TEST_F(ShellTest, AssetManagerSingle) {
                      mapping->GetSize());
 
   ASSERT_TRUE(result == content);
+
+  AssetResolver::AssetResolverType resolver_type;
+  mapping =
+      asset_manager.GetAsMappingWithResolverType(filename, &resolver_type);
+  ASSERT_TRUE(mapping != nullptr);
+  ASSERT_EQ(resolver_type,
+            AssetResolver::AssetResolverType::kDirectoryAssetBundle);
 }
 
 TEST_F(ShellTest, AssetManagerMulti) {
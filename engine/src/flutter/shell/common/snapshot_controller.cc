@@ -32,4 +32,34 @@ std::unique_ptr<SnapshotController> SnapshotController::Make(
 SnapshotController::SnapshotController(const Delegate& delegate)
     : delegate_(delegate) {}
 
+void SnapshotController::MakeRasterSnapshots(
+    std::vector<sk_sp<DisplayList>> display_lists,
+    std::vector<SkISize> picture_sizes,
+    std::function<void(const std::vector<sk_sp<DlImage>>&)> callback) {
+  FML_DCHECK(display_lists.size() == picture_sizes.size());
+  if (display_lists.empty()) {
+    callback({});
+    return;
+  }
+
+  // The snapshots may complete asynchronously, but always on this thread.
+  struct PendingSnapshots {
+    std::vector<sk_sp<DlImage>> images;
+    size_t remaining;
+    std::function<void(const std::vector<sk_sp<DlImage>>&)> callback;
+  };
+  auto pending = std::make_shared<PendingSnapshots>(PendingSnapshots{
+      std::vector<sk_sp<DlImage>>(display_lists.size()), display_lists.size(),
+      std::move(callback)});
+  for (size_t i = 0; i < display_lists.size(); i++) {
+    MakeRasterSnapshot(std::move(display_lists[i]), picture_sizes[i],
+                       [pending, i](const sk_sp<DlImage>& image) {
+                         pending->images[i] = image;
+                         if (--pending->remaining == 0) {
+                           pending->callback(pending->images);
+                         }
+                       });
+  }
+}
+
 }  // namespace flutter
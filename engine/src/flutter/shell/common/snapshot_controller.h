@@ -5,6 +5,9 @@
 #ifndef FLUTTER_SHELL_COMMON_SNAPSHOT_CONTROLLER_H_
 #define FLUTTER_SHELL_COMMON_SNAPSHOT_CONTROLLER_H_
 
+#include <functional>
+#include <vector>
+
 #include "flutter/common/settings.h"
 #include "flutter/display_list/image/dl_image.h"
 #include "flutter/flow/surface.h"
@@ -41,6 +44,17 @@ class SnapshotController {
       SkISize picture_size,
       std::function<void(const sk_sp<DlImage>&)> callback) = 0;
 
+  // Renders each display list at the corresponding size and invokes the
+  // callback once with all of the images, in the same order. Images that
+  // could not be rendered are null.
+  //
+  // The default implementation takes each snapshot separately. Backends may
+  // override this to submit the rendering work for all of them at once.
+  virtual void MakeRasterSnapshots(
+      std::vector<sk_sp<DisplayList>> display_lists,
+      std::vector<SkISize> picture_sizes,
+      std::function<void(const std::vector<sk_sp<DlImage>>&)> callback);
+
   // Note that this image is not guaranteed to be UIThreadSafe and must
   // be converted to a DlImageGPU if it is to be handed back to the UI
   // thread.
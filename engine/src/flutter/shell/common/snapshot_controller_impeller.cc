@@ -5,6 +5,8 @@
 #include "flutter/shell/common/snapshot_controller_impeller.h"
 
 #include <algorithm>
+#include <string>
+#include <vector>
 
 #include "flutter/flow/surface.h"
 #include "flutter/fml/build_config.h"
@@ -19,16 +21,10 @@ namespace flutter {
 
 namespace {
 
-sk_sp<DlImage> DoMakeRasterSnapshot(
-    const sk_sp<DisplayList>& display_list,
+impeller::ISize ComputeRenderTargetSize(
     SkISize size,
-    const std::shared_ptr<impeller::AiksContext>& context) {
-  TRACE_EVENT0("flutter", __FUNCTION__);
-  if (!context) {
-    return nullptr;
-  }
-  // Determine render target size.
-  auto max_size = context->GetContext()
+    const impeller::AiksContext& context) {
+  auto max_size = context.GetContext()
                       ->GetResourceAllocator()
                       ->GetMaxTextureSizeSupported();
   double scale_factor_x =
@@ -46,21 +42,61 @@ sk_sp<DlImage> DoMakeRasterSnapshot(
     render_target_size.width *= scale_factor;
     render_target_size.height *= scale_factor;
   }
+  return render_target_size;
+}
 
+sk_sp<DlImage> DoMakeRasterSnapshot(
+    const sk_sp<DisplayList>& display_list,
+    SkISize size,
+    const std::shared_ptr<impeller::AiksContext>& context) {
+  TRACE_EVENT0("flutter", __FUNCTION__);
+  if (!context) {
+    return nullptr;
+  }
   return impeller::DlImageImpeller::Make(
-      impeller::DisplayListToTexture(display_list, render_target_size, *context,
+      impeller::DisplayListToTexture(display_list,
+                                     ComputeRenderTargetSize(size, *context),
+                                     *context,
                                      /*reset_host_buffer=*/false,
                                      /*generate_mips=*/true),
       DlImage::OwningContext::kRaster);
 }
 
-sk_sp<DlImage> DoMakeRasterSnapshot(
-    const sk_sp<DisplayList>& display_list,
-    SkISize size,
+std::vector<sk_sp<DlImage>> DoMakeRasterSnapshots(
+    const std::vector<sk_sp<DisplayList>>& display_lists,
+    const std::vector<SkISize>& sizes,
+    const std::shared_ptr<impeller::AiksContext>& context) {
+  TRACE_EVENT1("flutter", __FUNCTION__, "count",
+               std::to_string(display_lists.size()).c_str());
+  std::vector<sk_sp<DlImage>> images(display_lists.size());
+  if (!context) {
+    return images;
+  }
+  std::vector<impeller::ISize> render_target_sizes;
+  render_target_sizes.reserve(sizes.size());
+  for (const SkISize& size : sizes) {
+    render_target_sizes.push_back(ComputeRenderTargetSize(size, *context));
+  }
+  std::vector<std::shared_ptr<impeller::Texture>> textures =
+      impeller::DisplayListsToTextures(display_lists, render_target_sizes,
+                                       *context,
+                                       /*reset_host_buffer=*/false,
+                                       /*generate_mips=*/true);
+  for (size_t i = 0; i < textures.size(); i++) {
+    images[i] = impeller::DlImageImpeller::Make(
+        std::move(textures[i]), DlImage::OwningContext::kRaster);
+  }
+  return images;
+}
+
+// Ensures that the current thread has a rendering context.  This must be done
+// before calling GetAiksContext because constructing the AiksContext may
+// invoke graphics APIs.
+//
+// Returns the offscreen surface that was made current, if any, which must be
+// kept alive while rendering.
+std::unique_ptr<Surface> MakeRenderContextCurrent(
     const SnapshotController::Delegate& delegate) {
-  // Ensure that the current thread has a rendering context.  This must be done
-  // before calling GetAiksContext because constructing the AiksContext may
-  // invoke graphics APIs.
   std::unique_ptr<Surface> pbuffer_surface;
   if (delegate.GetSurface()) {
     delegate.GetSurface()->MakeRenderContextCurrent();
@@ -71,10 +107,26 @@ sk_sp<DlImage> DoMakeRasterSnapshot(
       pbuffer_surface->MakeRenderContextCurrent();
     }
   }
+  return pbuffer_surface;
+}
 
+sk_sp<DlImage> DoMakeRasterSnapshot(
+    const sk_sp<DisplayList>& display_list,
+    SkISize size,
+    const SnapshotController::Delegate& delegate) {
+  std::unique_ptr<Surface> pbuffer_surface = MakeRenderContextCurrent(delegate);
   return DoMakeRasterSnapshot(display_list, size, delegate.GetAiksContext());
 }
 
+std::vector<sk_sp<DlImage>> DoMakeRasterSnapshots(
+    const std::vector<sk_sp<DisplayList>>& display_lists,
+    const std::vector<SkISize>& sizes,
+    const SnapshotController::Delegate& delegate) {
+  std::unique_ptr<Surface> pbuffer_surface = MakeRenderContextCurrent(delegate);
+  return DoMakeRasterSnapshots(display_lists, sizes,
+                               delegate.GetAiksContext());
+}
+
 sk_sp<DlImage> DoMakeRasterSnapshot(
     sk_sp<DisplayList> display_list,
     SkISize picture_size,
@@ -92,6 +144,36 @@ sk_sp<DlImage> DoMakeRasterSnapshot(
 
   return result;
 }
+
+std::vector<sk_sp<DlImage>> DoMakeRasterSnapshots(
+    const std::vector<sk_sp<DisplayList>>& display_lists,
+    const std::vector<SkISize>& sizes,
+    const std::shared_ptr<const fml::SyncSwitch>& sync_switch,
+    const std::shared_ptr<impeller::AiksContext>& context) {
+  std::vector<sk_sp<DlImage>> result(display_lists.size());
+  sync_switch->Execute(fml::SyncSwitch::Handlers()
+                           .SetIfTrue([&] {
+                             // Do nothing.
+                           })
+                           .SetIfFalse([&] {
+                             result = DoMakeRasterSnapshots(display_lists,
+                                                            sizes, context);
+                           }));
+
+  return result;
+}
+
+#if FML_OS_IOS_SIMULATOR
+std::vector<sk_sp<DlImage>> MakeFakeImages(size_t count) {
+  std::vector<sk_sp<DlImage>> images;
+  for (size_t i = 0; i < count; i++) {
+    images.push_back(impeller::DlImageImpeller::Make(
+        nullptr, DlImage::OwningContext::kRaster,
+        /*is_fake_image=*/true));
+  }
+  return images;
+}
+#endif  // FML_OS_IOS_SIMULATOR
 }  // namespace
 
 void SnapshotControllerImpeller::MakeRasterSnapshot(
@@ -138,6 +220,50 @@ void SnapshotControllerImpeller::MakeRasterSnapshot(
           }));
 }
 
+void SnapshotControllerImpeller::MakeRasterSnapshots(
+    std::vector<sk_sp<DisplayList>> display_lists,
+    std::vector<SkISize> picture_sizes,
+    std::function<void(const std::vector<sk_sp<DlImage>>&)> callback) {
+  FML_DCHECK(display_lists.size() == picture_sizes.size());
+  const size_t count = display_lists.size();
+  std::shared_ptr<const fml::SyncSwitch> sync_switch =
+      GetDelegate().GetIsGpuDisabledSyncSwitch();
+  sync_switch->Execute(
+      fml::SyncSwitch::Handlers()
+          .SetIfTrue([&] {
+            std::shared_ptr<impeller::AiksContext> context =
+                GetDelegate().GetAiksContext();
+            if (context) {
+              context->GetContext()->StoreTaskForGPU(
+                  [context, sync_switch,
+                   display_lists = std::move(display_lists),
+                   picture_sizes = std::move(picture_sizes), callback] {
+                    callback(DoMakeRasterSnapshots(display_lists, picture_sizes,
+                                                   sync_switch, context));
+                  },
+                  [callback, count]() {
+                    callback(std::vector<sk_sp<DlImage>>(count));
+                  });
+            } else {
+#if FML_OS_IOS_SIMULATOR
+              callback(MakeFakeImages(count));
+#else
+              callback(std::vector<sk_sp<DlImage>>(count));
+#endif  // FML_OS_IOS_SIMULATOR
+            }
+          })
+          .SetIfFalse([&] {
+#if FML_OS_IOS_SIMULATOR
+            if (!GetDelegate().GetAiksContext()) {
+              callback(MakeFakeImages(count));
+              return;
+            }
+#endif
+            callback(DoMakeRasterSnapshots(display_lists, picture_sizes,
+                                           GetDelegate()));
+          }));
+}
+
 sk_sp<DlImage> SnapshotControllerImpeller::MakeRasterSnapshotSync(
     sk_sp<DisplayList> display_list,
     SkISize picture_size) {
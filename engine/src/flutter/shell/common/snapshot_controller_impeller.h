@@ -21,6 +21,12 @@ class SnapshotControllerImpeller : public SnapshotController {
       SkISize picture_size,
       std::function<void(const sk_sp<DlImage>&)> callback) override;
 
+  void MakeRasterSnapshots(
+      std::vector<sk_sp<DisplayList>> display_lists,
+      std::vector<SkISize> picture_sizes,
+      std::function<void(const std::vector<sk_sp<DlImage>>&)> callback)
+      override;
+
   sk_sp<DlImage> MakeRasterSnapshotSync(sk_sp<DisplayList> display_list,
                                         SkISize picture_size) override;
 
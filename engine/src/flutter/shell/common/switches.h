@@ -191,6 +191,11 @@ DEF_SWITCH(PurgePersistentCache,
            "purge-persistent-cache",
            "Remove all existing persistent cache. This is mainly for debugging "
            "purposes such as reproducing the shader compilation jank.")
+DEF_SWITCH(TrackMemoryHighWaterMarks,
+           "track-memory-high-water-marks",
+           "Track the high-water marks of the memory accounting counters of "
+           "the engine from startup. By default, this is not enabled to "
+           "reduce the overhead.")
 DEF_SWITCH(
     TraceSystrace,
     "trace-systrace",
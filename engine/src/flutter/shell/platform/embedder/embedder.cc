@@ -46,6 +46,7 @@ extern const intptr_t kPlatformStrongDillSize;
 #include "flutter/fml/command_line.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/memory/memory_accounting.h"
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
@@ -3583,6 +3584,65 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
   return kSuccess;
 }
 
+static_assert(static_cast<size_t>(kFlutterEngineMemoryCategoryFontCache) + 1 ==
+                  fml::kMemoryCategoryCount,
+              "The memory categories of the embedder API must match the ones "
+              "of the memory accounting.");
+
+FlutterEngineResult FlutterEngineGetMemoryAccounting(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterEngineMemoryAccountingCallback callback,
+    void* user_data) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (callback == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Memory accounting callback was null.");
+  }
+
+  fml::MemoryAccounting::Snapshot snapshot =
+      flutter::Shell::GetMemoryAccountingSnapshot();
+  std::vector<FlutterEngineMemoryAccountingEntry> entries;
+  entries.reserve(fml::kMemoryCategoryCount);
+  for (size_t i = 0; i < fml::kMemoryCategoryCount; i++) {
+    auto category = static_cast<fml::MemoryCategory>(i);
+    const fml::MemoryAccounting::Counter& cpu =
+        snapshot.Get(category, fml::MemoryDomain::kCpu);
+    const fml::MemoryAccounting::Counter& gpu =
+        snapshot.Get(category, fml::MemoryDomain::kGpu);
+    entries.push_back({
+        .struct_size = sizeof(FlutterEngineMemoryAccountingEntry),
+        .category = static_cast<FlutterEngineMemoryCategory>(i),
+        .name = fml::MemoryAccounting::GetCategoryName(category),
+        .cpu_bytes = cpu.bytes,
+        .gpu_bytes = gpu.bytes,
+        .cpu_high_water_mark_bytes = cpu.high_water_mark_bytes,
+        .gpu_high_water_mark_bytes = gpu.high_water_mark_bytes,
+    });
+  }
+  callback(entries.data(), entries.size(), user_data);
+
+  return kSuccess;
+}
+
+FlutterEngineResult FlutterEngineSetMemoryHighWaterMarkTracking(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    bool enabled,
+    bool reset) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  fml::MemoryAccounting::SetHighWaterMarkTrackingEnabled(enabled);
+  if (enabled && reset) {
+    fml::MemoryAccounting::ResetHighWaterMarks();
+  }
+
+  return kSuccess;
+}
+
 FlutterEngineResult FlutterEngineGetProcAddresses(
     FlutterEngineProcTable* table) {
   if (!table) {
@@ -3637,6 +3697,9 @@ FlutterEngineResult FlutterEngineGetProcAddresses(
   SET_PROC(SetNextFrameCallback, FlutterEngineSetNextFrameCallback);
   SET_PROC(AddView, FlutterEngineAddView);
   SET_PROC(RemoveView, FlutterEngineRemoveView);
+  SET_PROC(GetMemoryAccounting, FlutterEngineGetMemoryAccounting);
+  SET_PROC(SetMemoryHighWaterMarkTracking,
+           FlutterEngineSetMemoryHighWaterMarkTracking);
 #undef SET_PROC
 
   return kSuccess;
@@ -2122,6 +2122,53 @@ typedef enum {
   kFlutterEngineDisplaysUpdateTypeCount,
 } FlutterEngineDisplaysUpdateType;
 
+/// The subsystems of the engine whose memory is accounted for, as reported by
+/// `FlutterEngineGetMemoryAccounting`.
+typedef enum {
+  /// The storage of the display lists.
+  kFlutterEngineMemoryCategoryDisplayList,
+  /// The images held by `dart:ui` images, each counted once however many
+  /// `dart:ui` images share it.
+  kFlutterEngineMemoryCategoryImage,
+  /// The entries of the raster caches.
+  kFlutterEngineMemoryCategoryRasterCache,
+  /// The buffers of the Impeller host buffers.
+  kFlutterEngineMemoryCategoryHostBuffer,
+  /// The textures of the Impeller glyph atlases.
+  kFlutterEngineMemoryCategoryGlyphAtlas,
+  /// The textures of the Impeller render target caches.
+  kFlutterEngineMemoryCategoryRenderTargetCache,
+  /// The glyph cache shared by text layout and rendering.
+  kFlutterEngineMemoryCategoryFontCache,
+} FlutterEngineMemoryCategory;
+
+typedef struct {
+  /// The size of this struct. Must be
+  /// sizeof(FlutterEngineMemoryAccountingEntry).
+  size_t struct_size;
+  FlutterEngineMemoryCategory category;
+  /// A stable name of the category, like "displayList".
+  const char* name;
+  /// The bytes of the category that reside in CPU memory.
+  int64_t cpu_bytes;
+  /// The bytes of the category that reside in GPU memory, or in memory shared
+  /// with the GPU.
+  int64_t gpu_bytes;
+  /// The largest value of `cpu_bytes` since the high-water marks were last
+  /// reset, or 0 if they are not tracked.
+  int64_t cpu_high_water_mark_bytes;
+  /// The largest value of `gpu_bytes` since the high-water marks were last
+  /// reset, or 0 if they are not tracked.
+  int64_t gpu_high_water_mark_bytes;
+} FlutterEngineMemoryAccountingEntry;
+
+/// The callback invoked by `FlutterEngineGetMemoryAccounting` with one entry
+/// per category. The entries are only valid for the duration of the call.
+typedef void (*FlutterEngineMemoryAccountingCallback)(
+    const FlutterEngineMemoryAccountingEntry* /* entries */,
+    size_t /* entry count */,
+    void* /* user data */);
+
 typedef int64_t FlutterEngineDartPort;
 
 typedef enum {
@@ -3301,6 +3348,47 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
     VoidCallback callback,
     void* user_data);
 
+//------------------------------------------------------------------------------
+/// @brief      Reports the bytes of memory used by the subsystems of the
+///             engine, split into CPU and GPU memory. The counters are shared
+///             by all engines of the process.
+///
+///             The callback is invoked synchronously, on the calling thread,
+///             before this call returns. This may be called from any thread.
+///
+/// @param[in]  engine     A running engine instance.
+/// @param[in]  callback   The callback to invoke with the entries.
+/// @param[in]  user_data  A baton passed by the engine to the callback. This
+///                        baton is not interpreted by the engine in any way.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineGetMemoryAccounting(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterEngineMemoryAccountingCallback callback,
+    void* user_data);
+
+//------------------------------------------------------------------------------
+/// @brief      Enables or disables the tracking of the high-water marks
+///             reported by `FlutterEngineGetMemoryAccounting`. Tracking adds
+///             a small cost to every update of the counters, so it is
+///             disabled by default. Enabling it, or passing true for `reset`
+///             while it is enabled, starts the high-water marks at the
+///             current values of the counters.
+///
+/// @param[in]  engine   A running engine instance.
+/// @param[in]  enabled  Whether the high-water marks are tracked.
+/// @param[in]  reset    Whether the high-water marks are reset.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineSetMemoryHighWaterMarkTracking(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    bool enabled,
+    bool reset);
+
 #endif  // !FLUTTER_ENGINE_NO_PROTOTYPES
 
 // Typedefs for the function pointers in FlutterEngineProcTable.
@@ -3429,6 +3517,14 @@ typedef FlutterEngineResult (*FlutterEngineAddViewFnPtr)(
 typedef FlutterEngineResult (*FlutterEngineRemoveViewFnPtr)(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     const FlutterRemoveViewInfo* info);
+typedef FlutterEngineResult (*FlutterEngineGetMemoryAccountingFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterEngineMemoryAccountingCallback callback,
+    void* user_data);
+typedef FlutterEngineResult (*FlutterEngineSetMemoryHighWaterMarkTrackingFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    bool enabled,
+    bool reset);
 
 /// Function-pointer-based versions of the APIs above.
 typedef struct {
@@ -3477,6 +3573,9 @@ typedef struct {
   FlutterEngineSetNextFrameCallbackFnPtr SetNextFrameCallback;
   FlutterEngineAddViewFnPtr AddView;
   FlutterEngineRemoveViewFnPtr RemoveView;
+  FlutterEngineGetMemoryAccountingFnPtr GetMemoryAccounting;
+  FlutterEngineSetMemoryHighWaterMarkTrackingFnPtr
+      SetMemoryHighWaterMarkTracking;
 } FlutterEngineProcTable;
 
 //------------------------------------------------------------------------------
@@ -3385,6 +3385,50 @@ TEST_F(EmbedderTest, CanScheduleFrame) {
   check_latch.Wait();
 }
 
+TEST_F(EmbedderTest, CanGetMemoryAccounting) {
+  auto& context = GetEmbedderContext<EmbedderTestContextSoftware>();
+  EmbedderConfigBuilder builder(context);
+  builder.SetSurface(SkISize::Make(1, 1));
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  ASSERT_EQ(FlutterEngineSetMemoryHighWaterMarkTracking(engine.get(), true,
+                                                        /*reset=*/true),
+            kSuccess);
+
+  std::vector<FlutterEngineMemoryAccountingEntry> entries;
+  FlutterEngineMemoryAccountingCallback callback =
+      [](const FlutterEngineMemoryAccountingEntry* entries, size_t count,
+         void* user_data) {
+        auto* result =
+            static_cast<std::vector<FlutterEngineMemoryAccountingEntry>*>(
+                user_data);
+        result->assign(entries, entries + count);
+      };
+  ASSERT_EQ(
+      FlutterEngineGetMemoryAccounting(engine.get(), callback, &entries),
+      kSuccess);
+
+  ASSERT_EQ(entries.size(),
+            static_cast<size_t>(kFlutterEngineMemoryCategoryFontCache) + 1);
+  for (size_t i = 0; i < entries.size(); i++) {
+    const FlutterEngineMemoryAccountingEntry& entry = entries[i];
+    EXPECT_EQ(entry.struct_size, sizeof(FlutterEngineMemoryAccountingEntry));
+    EXPECT_EQ(static_cast<size_t>(entry.category), i);
+    EXPECT_GE(entry.cpu_high_water_mark_bytes, entry.cpu_bytes);
+    EXPECT_GE(entry.gpu_high_water_mark_bytes, entry.gpu_bytes);
+  }
+  EXPECT_STREQ(entries[kFlutterEngineMemoryCategoryFontCache].name,
+               "fontCache");
+
+  ASSERT_EQ(FlutterEngineSetMemoryHighWaterMarkTracking(engine.get(), false,
+                                                        /*reset=*/false),
+            kSuccess);
+  EXPECT_EQ(FlutterEngineGetMemoryAccounting(engine.get(), nullptr, nullptr),
+            kInvalidArguments);
+}
+
 TEST_F(EmbedderTest, CanSetNextFrameCallback) {
   auto& context = GetEmbedderContext<EmbedderTestContextSoftware>();
   EmbedderConfigBuilder builder(context);
@@ -577,6 +577,54 @@ void main() async {
     expect(data.buffer.asUint8List(), equals(dataSync.buffer.asUint8List()));
   });
 
+  test('Picture.toImages returns the same images as toImage', () async {
+    Picture makePicture(Color color) {
+      final PictureRecorder recorder = PictureRecorder();
+      final Canvas canvas = Canvas(recorder);
+      canvas.drawRect(const Rect.fromLTWH(2, 3, 10, 10), Paint()..color = color);
+      return recorder.endRecording();
+    }
+
+    final List<Picture> pictures = <Picture>[
+      makePicture(const Color(0xFF123456)),
+      makePicture(const Color(0x80FF0000)),
+      makePicture(const Color(0xFF00FF00)),
+    ];
+    final List<int> widths = <int>[20, 7, 16];
+    final List<int> heights = <int>[12, 30, 16];
+    final List<Image> images = await Picture.toImages(pictures, widths, heights);
+    expect(images.length, pictures.length);
+
+    for (int index = 0; index < pictures.length; index += 1) {
+      final Image image = images[index];
+      expect(image.width, widths[index]);
+      expect(image.height, heights[index]);
+
+      final Image expected = await pictures[index].toImage(widths[index], heights[index]);
+      final ByteData data = (await image.toByteData())!;
+      final ByteData expectedData = (await expected.toByteData())!;
+      expect(data.buffer.asUint8List(), equals(expectedData.buffer.asUint8List()));
+      image.dispose();
+      expected.dispose();
+    }
+
+    expect(await Picture.toImages(<Picture>[], <int>[], <int>[]), isEmpty);
+    for (final Picture picture in pictures) {
+      picture.dispose();
+    }
+  });
+
+  test('Picture.toImages throws on invalid dimensions', () async {
+    final PictureRecorder recorder = PictureRecorder();
+    Canvas(recorder).drawPaint(Paint());
+    final Picture picture = recorder.endRecording();
+    expect(
+      () => Picture.toImages(<Picture>[picture, picture], <int>[10, 0], <int>[10, 10]),
+      throwsException,
+    );
+    picture.dispose();
+  });
+
   test('Canvas.drawParagraph throws when Paragraph.layout was not called',
       () async {
     // Regression test for https://github.com/flutter/flutter/issues/97172
@@ -723,6 +771,45 @@ void main() async {
     await comparer.addGoldenImage(image, 'render_unordered_rects.png');
   });
 
+  test('Canvas.getSaveCount reflects batched saves and restores', () async {
+    final PictureRecorder recorder = PictureRecorder();
+    final Canvas canvas = Canvas(recorder);
+    for (int i = 0; i < 5000; i++) {
+      canvas.save();
+    }
+    expect(canvas.getSaveCount(), 5001);
+    canvas.restore();
+    canvas.restore();
+    expect(canvas.getSaveCount(), 4999);
+    canvas.restoreToCount(1);
+    expect(canvas.getSaveCount(), 1);
+    recorder.endRecording().dispose();
+  });
+
+  test('Canvas draws use the paint as it was when the draw was recorded', () async {
+    final PictureRecorder recorder = PictureRecorder();
+    final Canvas canvas = Canvas(recorder);
+    final Paint paint = Paint()..color = const Color(0xFFFF0000);
+    canvas.drawRect(const Rect.fromLTWH(0, 0, 10, 10), paint);
+    paint.color = const Color(0xFF0000FF);
+    canvas.drawRect(const Rect.fromLTWH(10, 0, 10, 10), paint);
+    paint.shader = Gradient.linear(
+      Offset.zero,
+      const Offset(10, 0),
+      const <Color>[Color(0xFF00FF00), Color(0xFF00FF00)],
+    );
+    canvas.drawRect(const Rect.fromLTWH(20, 0, 10, 10), paint);
+    final Picture picture = recorder.endRecording();
+    final Image image = await picture.toImage(30, 10);
+    final ByteData data = (await image.toByteData())!;
+    int pixelAt(int x, int y) => data.getUint32((y * 30 + x) * 4);
+    expect(pixelAt(5, 5), 0xFF0000FF);
+    expect(pixelAt(15, 5), 0x0000FFFF);
+    expect(pixelAt(25, 5), 0x00FF00FF);
+    image.dispose();
+    picture.dispose();
+  });
+
   test('Canvas.translate affects canvas.getTransform', () async {
     final PictureRecorder recorder = PictureRecorder();
     final Canvas canvas = Canvas(recorder);
@@ -55,6 +55,67 @@ void main() {
     }
   });
 
+  test('layoutAll lays out paragraphs as layout does', () {
+    Paragraph build(int index) {
+      final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
+        fontFamily: 'FlutterTest',
+        fontSize: 10.0 + index % 4,
+      ));
+      builder.addText('Test ' * (index + 1));
+      return builder.build();
+    }
+
+    const int count = 32;
+    final List<Paragraph> batch = List<Paragraph>.generate(count, build);
+    final List<ParagraphConstraints> constraints = List<ParagraphConstraints>.generate(
+      count,
+      (int index) => ParagraphConstraints(width: 50.0 + index * 10),
+    );
+    Paragraph.layoutAll(batch, constraints);
+
+    for (int index = 0; index < count; index += 1) {
+      final Paragraph expected = build(index)..layout(constraints[index]);
+      expect(batch[index].width, expected.width);
+      expect(batch[index].height, expected.height);
+      expect(batch[index].numberOfLines, expected.numberOfLines);
+      expect(batch[index].longestLine, expected.longestLine);
+    }
+  });
+
+  test('buildIncremental lays out paragraphs as build does', () {
+    ParagraphBuilder builder(String text) {
+      return ParagraphBuilder(ParagraphStyle(
+        fontFamily: 'FlutterTest',
+        fontSize: 10.0,
+      ))..addText(text);
+    }
+
+    const ParagraphConstraints constraints = ParagraphConstraints(width: 80.0);
+    final Paragraph previous = builder('First line\n\nSecond line\nLast line').buildIncremental(null);
+    previous.layout(constraints);
+
+    const String text = 'First line\n\nSecond edited line\nLast line';
+    final Paragraph paragraph = builder(text).buildIncremental(previous)..layout(constraints);
+    final Paragraph expected = builder(text).build()..layout(constraints);
+    expect(paragraph.width, expected.width);
+    expect(paragraph.height, expected.height);
+    expect(paragraph.numberOfLines, expected.numberOfLines);
+    expect(paragraph.longestLine, expected.longestLine);
+    expect(paragraph.maxIntrinsicWidth, expected.maxIntrinsicWidth);
+    expect(
+      paragraph.getBoxesForRange(13, 25),
+      expected.getBoxesForRange(13, 25),
+    );
+    expect(
+      paragraph.getPositionForOffset(const Offset(20.0, 35.0)),
+      expected.getPositionForOffset(const Offset(20.0, 35.0)),
+    );
+
+    // The previous paragraph can still be used.
+    previous.layout(const ParagraphConstraints(width: 60.0));
+    expect(previous.numberOfLines, greaterThanOrEqualTo(4));
+  });
+
   test('predictably lays out a multi-line paragraph', () {
     for (final double fontSize in <double>[10.0, 20.0, 30.0, 40.0]) {
       final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
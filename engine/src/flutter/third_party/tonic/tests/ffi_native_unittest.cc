@@ -315,6 +315,28 @@ TEST_F(FfiNativeTest, SerialiseEchoTypedList) {
       /*leaf=*/false, "Handle", "Object", "Handle", "Object");
 }
 
+// Call and serialise function with a pointer to the data of a TypedList.
+
+double SumTypedDataPointer(const double* values, int32_t count) {
+  EXPECT_EQ(count, 3);
+  double sum = 0;
+  for (int32_t i = 0; i < count; i++) {
+    sum += values[i];
+  }
+  return sum;
+}
+
+TEST_F(FfiNativeTest, FfiBindingCallSumTypedDataPointer) {
+  DoCallThroughTest<void, decltype(&SumTypedDataPointer),
+                    &SumTypedDataPointer>("SumTypedDataPointer",
+                                          "callSumTypedDataPointer");
+}
+
+TEST_F(FfiNativeTest, SerialiseSumTypedDataPointer) {
+  DoSerialiseTest<void, decltype(&SumTypedDataPointer), &SumTypedDataPointer>(
+      /*leaf=*/true, "Double", "double", "Pointer, Int32", "Pointer, int");
+}
+
 // Call and serialise a static class member function.
 
 TEST_F(FfiNativeTest, FfiBindingCallClassMemberFunction) {
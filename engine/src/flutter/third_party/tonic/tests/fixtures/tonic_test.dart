@@ -166,6 +166,19 @@ void callEchoTypedList() {
   }
 }
 
+// Test helpers for calls with the address of a TypedData through Tonic.
+
+@Native<Double Function(Pointer<Double>, Int32)>(symbol: 'SumTypedDataPointer', isLeaf: true)
+external double sumTypedDataPointer(Pointer<Double> values, int count);
+
+@pragma('vm:entry-point')
+void callSumTypedDataPointer() {
+  final typedList = Float64List.fromList([1.0, 2.0, 3.5]);
+  if (sumTypedDataPointer(typedList.address, typedList.length) == 6.5) {
+    signalDone();
+  }
+}
+
 //
 
 @pragma('vm:entry-point')
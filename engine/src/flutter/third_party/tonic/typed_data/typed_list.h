@@ -5,6 +5,8 @@
 #ifndef LIB_TONIC_TYPED_DATA_TYPED_LIST_H_
 #define LIB_TONIC_TYPED_DATA_TYPED_LIST_H_
 
+#include <type_traits>
+
 #include "third_party/dart/runtime/include/dart_api.h"
 #include "tonic/converter/dart_converter.h"
 
@@ -74,6 +76,32 @@ struct DartConverter<TypedList<kTypeName, ElemType>> {
   static bool AllowedInLeafCall() { return kAllowedInLeafCall; }
 };
 
+// A pointer to the elements of a Dart TypedData object, for FFI calls that
+// pass |TypedData.address| instead of the list itself.
+//
+// Unlike |TypedList|, this neither creates a handle nor acquires the data of
+// the list, so it is allowed in leaf calls. The pointer is only valid for the
+// duration of the call, and the number of elements must be passed separately.
+// Leaf calls block the garbage collector, so this is meant for small lists
+// that are processed quickly.
+template <typename T>
+struct DartConverter<
+    T*,
+    typename std::enable_if<
+        std::is_arithmetic<typename std::remove_const<T>::type>::value>::type> {
+  using NativeType = T*;
+  using FfiType = T*;
+  static constexpr const char* kFfiRepresentation = "Pointer";
+  static constexpr const char* kDartRepresentation = "Pointer";
+  static constexpr bool kAllowedInLeafCall = true;
+
+  static NativeType FromFfi(FfiType val) { return val; }
+  static FfiType ToFfi(NativeType val) { return val; }
+  static const char* GetFfiRepresentation() { return kFfiRepresentation; }
+  static const char* GetDartRepresentation() { return kDartRepresentation; }
+  static bool AllowedInLeafCall() { return kAllowedInLeafCall; }
+};
+
 #define TONIC_TYPED_DATA_FOREACH(F) \
   F(Int8, int8_t)                   \
   F(Uint8, uint8_t)                 \
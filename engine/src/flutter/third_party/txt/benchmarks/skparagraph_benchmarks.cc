@@ -14,10 +14,20 @@
  * limitations under the License.
  */
 
+#include <iterator>
 #include <sstream>
 
+#include "flutter/display_list/dl_builder.h"
 #include "flutter/fml/command_line.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/logging.h"
+#include "flutter/third_party/txt/src/skia/paragraph_builder_skia.h"
+#include "flutter/third_party/txt/src/skia/paragraph_skia.h"
+#include "flutter/third_party/txt/src/txt/asset_font_manager.h"
+#include "flutter/third_party/txt/src/txt/font_collection.h"
+#include "flutter/third_party/txt/src/txt/font_fallback_cache.h"
+#include "flutter/third_party/txt/src/txt/paragraph_batch_layout.h"
+#include "flutter/third_party/txt/src/txt/platform.h"
 #include "flutter/third_party/txt/tests/txt_test_utils.h"
 #include "third_party/benchmark/include/benchmark/benchmark.h"
 #include "third_party/icu/source/common/unicode/unistr.h"
@@ -32,6 +42,26 @@
 
 namespace sktxt = skia::textlayout;
 
+static const char* kPaintLargeText =
+    "Hello world! This is a simple sentence to test drawing. Hello world! "
+    "This is a simple sentence to test drawing. Hello world! This is a "
+    "simple sentence to test drawing.Hello world! This is a simple sentence "
+    "to test drawing. Hello world! "
+    "This is a simple sentence to test drawing. Hello world! This is a "
+    "simple sentence to test drawing.Hello world! This is a simple sentence "
+    "to test drawing. Hello world! "
+    "This is a simple sentence to test drawing. Hello world! This is a "
+    "simple sentence to test drawing.Hello world! This is a simple sentence "
+    "to test drawing. Hello world! "
+    "This is a simple sentence to test drawing. Hello world! This is a "
+    "simple sentence to test drawing.Hello world! This is a simple sentence "
+    "to test drawing. Hello world! "
+    "This is a simple sentence to test drawing. Hello world! This is a "
+    "simple sentence to test drawing.Hello world! This is a simple sentence "
+    "to test drawing. Hello world! "
+    "This is a simple sentence to test drawing. Hello world! This is a "
+    "simple sentence to test drawing.";
+
 class SkParagraphFixture : public benchmark::Fixture {
  public:
   void SetUp(const ::benchmark::State& state) {
@@ -44,6 +74,39 @@ class SkParagraphFixture : public benchmark::Fixture {
   }
 
  protected:
+  // Builds a paragraph that paints to DisplayLists as it does on Impeller,
+  // with Impeller text frames, or glyph paths for strokes wider than 4.
+  std::unique_ptr<txt::ParagraphSkia> MakeImpellerParagraph(
+      const char* text,
+      const flutter::DlPaint& paint,
+      std::shared_ptr<impeller::TextFrameCache> text_frame_cache = nullptr) {
+    sktxt::ParagraphStyle paragraph_style;
+    sktxt::TextStyle text_style;
+    text_style.setFontFamilies({SkString("Roboto")});
+    text_style.setForegroundPaintID(0);
+    auto builder = sktxt::ParagraphBuilder::make(
+        paragraph_style, font_collection_, SkUnicodes::ICU::Make());
+    builder->pushStyle(text_style);
+    builder->addText(text);
+    builder->pop();
+    return std::make_unique<txt::ParagraphSkia>(
+        builder->Build(), std::vector<flutter::DlPaint>{paint},
+        /*impeller_enabled=*/true, /*font_collection=*/nullptr,
+        /*typeface_queries=*/{}, std::move(text_frame_cache));
+  }
+
+  void PaintImpellerParagraph(benchmark::State& state,
+                              txt::ParagraphSkia& paragraph) {
+    paragraph.Layout(300);
+    int offset = 0;
+    while (state.KeepRunning()) {
+      flutter::DisplayListBuilder builder;
+      paragraph.Paint(&builder, offset % 700, 10);
+      benchmark::DoNotOptimize(builder.Build());
+      offset++;
+    }
+  }
+
   sk_sp<sktxt::TestFontCollection> font_collection_;
   std::unique_ptr<SkCanvas> canvas_;
   std::unique_ptr<SkBitmap> bitmap_;
@@ -184,6 +247,118 @@ BENCHMARK_REGISTER_F(SkParagraphFixture, TextBigO)
     ->Range(1 << 6, 1 << 14)
     ->Complexity(benchmark::oN);
 
+// Lays out batches of paragraphs of different lengths, as for a large
+// document, on the number of threads given by the second argument.
+BENCHMARK_DEFINE_F(SkParagraphFixture, BatchLayoutBigO)
+(benchmark::State& state) {
+  const size_t paragraph_count = state.range(0);
+  const size_t thread_count = state.range(1);
+
+  auto font_manager = sk_make_sp<txt::DynamicFontManager>();
+  font_manager->font_provider().RegisterTypeface(
+      txt::GetDefaultFontManager()->makeFromFile(
+          (txt::GetFontDir() + "/Roboto-Regular.ttf").c_str()));
+  auto font_collection = std::make_shared<txt::FontCollection>();
+  font_collection->SetDynamicFontManager(font_manager);
+  // Shape the text on every layout instead of reusing the cached results.
+  font_collection->CreateSktFontCollection()->getParagraphCache()->turnOn(
+      false);
+
+  std::vector<std::u16string> texts;
+  for (size_t i = 0; i < paragraph_count; i++) {
+    std::u16string text;
+    for (size_t j = 0; j < 32 * (i % 16 + 1); j++) {
+      text.push_back(j % 5 == 0 ? u' '
+                                : static_cast<char16_t>(u'a' + (i + j) % 26));
+    }
+    texts.push_back(std::move(text));
+  }
+  txt::TextStyle text_style;
+  text_style.font_families = {"Roboto"};
+
+  std::shared_ptr<fml::ConcurrentMessageLoop> loop;
+  if (thread_count > 1) {
+    loop = fml::ConcurrentMessageLoop::Create(thread_count - 1);
+  }
+  auto task_runner = loop ? loop->GetTaskRunner() : nullptr;
+
+  std::vector<double> widths(paragraph_count, 300);
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::vector<std::unique_ptr<txt::Paragraph>> paragraphs;
+    std::vector<txt::Paragraph*> batch;
+    for (const std::u16string& text : texts) {
+      txt::ParagraphBuilderSkia builder(txt::ParagraphStyle(), font_collection,
+                                        /*impeller_enabled=*/false);
+      builder.PushStyle(text_style);
+      builder.AddText(text);
+      builder.Pop();
+      paragraphs.push_back(builder.Build());
+      batch.push_back(paragraphs.back().get());
+    }
+    state.ResumeTiming();
+
+    txt::LayoutParagraphs(batch, widths, task_runner.get(), thread_count);
+  }
+  state.SetComplexityN(paragraph_count);
+}
+BENCHMARK_REGISTER_F(SkParagraphFixture, BatchLayoutBigO)
+    ->ArgsProduct({{64, 256, 1024}, {1, 2, 4, 8}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Measures the latency from a keystroke to the layout of the edited text of
+// a large text field, building the paragraph incrementally from the previous
+// one if the second argument is 1.
+BENCHMARK_DEFINE_F(SkParagraphFixture, EditLayoutBigO)
+(benchmark::State& state) {
+  const size_t text_length = state.range(0);
+  const bool incremental = state.range(1) != 0;
+
+  auto font_manager = sk_make_sp<txt::DynamicFontManager>();
+  font_manager->font_provider().RegisterTypeface(
+      txt::GetDefaultFontManager()->makeFromFile(
+          (txt::GetFontDir() + "/Roboto-Regular.ttf").c_str()));
+  auto font_collection = std::make_shared<txt::FontCollection>();
+  font_collection->SetDynamicFontManager(font_manager);
+  // Shape the text on every layout instead of reusing the cached results.
+  font_collection->CreateSktFontCollection()->getParagraphCache()->turnOn(
+      false);
+
+  // Lines of about 80 characters.
+  std::u16string text;
+  for (size_t i = 0; i < text_length; i++) {
+    if (i % 80 == 79) {
+      text.push_back(u'\n');
+    } else {
+      text.push_back(i % 5 == 0 ? u' '
+                                : static_cast<char16_t>(u'a' + i % 26));
+    }
+  }
+  txt::TextStyle text_style;
+  text_style.font_families = {"Roboto"};
+
+  std::unique_ptr<txt::Paragraph> paragraph;
+  size_t edit = 0;
+  while (state.KeepRunning()) {
+    // Type over a character in the middle of the text.
+    text[text_length / 2] = static_cast<char16_t>(u'a' + edit % 26);
+    edit++;
+    txt::ParagraphBuilderSkia builder(txt::ParagraphStyle(), font_collection,
+                                      /*impeller_enabled=*/false);
+    builder.PushStyle(text_style);
+    builder.AddText(text);
+    builder.Pop();
+    paragraph = incremental ? builder.BuildIncremental(paragraph.get())
+                            : builder.Build();
+    paragraph->Layout(300);
+  }
+  state.SetComplexityN(text_length);
+}
+BENCHMARK_REGISTER_F(SkParagraphFixture, EditLayoutBigO)
+    ->ArgsProduct({{1 << 12, 1 << 14, 50000}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_DEFINE_F(SkParagraphFixture, StylesBigO)(benchmark::State& state) {
   const char* text = "vry shrt ";
   sktxt::ParagraphStyle paragraph_style;
@@ -210,6 +385,40 @@ BENCHMARK_REGISTER_F(SkParagraphFixture, StylesBigO)
     ->Range(1 << 3, 1 << 12)
     ->Complexity(benchmark::oN);
 
+// Lays out text in scripts that the requested family does not cover, which
+// the platform's font manager finds fallback fonts for.
+BENCHMARK_F(SkParagraphFixture, MixedScriptLayout)(benchmark::State& state) {
+  const char* text =
+      "Hello world! \u4f60\u597d\uff0c\u4e16\u754c\uff01 "
+      "\u041f\u0440\u0438\u0432\u0435\u0442, \u043c\u0438\u0440! "
+      "\u0645\u0631\u062d\u0628\u0627 \u0628\u0627\u0644\u0639\u0627"
+      "\u0644\u0645! \u0928\u092e\u0938\u094d\u0924\u0947 "
+      "\u3053\u3093\u306b\u3061\u306f \U0001F600\U0001F389";
+  txt::FontCollection txt_font_collection;
+  txt_font_collection.SetupDefaultFontManager(0);
+  auto font_collection = txt_font_collection.CreateSktFontCollection();
+  // Shape the text on every layout instead of reusing the cached results.
+  font_collection->getParagraphCache()->turnOn(false);
+
+  sktxt::ParagraphStyle paragraph_style;
+  sktxt::TextStyle text_style;
+  text_style.setFontFamilies({SkString("Roboto")});
+  text_style.setColor(SK_ColorBLACK);
+  auto builder = sktxt::ParagraphBuilder::make(
+      paragraph_style, font_collection, SkUnicodes::ICU::Make());
+  builder->pushStyle(text_style);
+  builder->addText(text);
+  builder->pop();
+  auto paragraph = builder->Build();
+  while (state.KeepRunning()) {
+    paragraph->markDirty();
+    paragraph->layout(300);
+  }
+  auto stats = txt::FontFallbackCache::GetShared()->GetStats();
+  state.counters["FallbackHits"] = stats.hits;
+  state.counters["FallbackMisses"] = stats.misses;
+}
+
 BENCHMARK_F(SkParagraphFixture, PaintSimple)(benchmark::State& state) {
   const char* text = "This is a simple sentence to test drawing.";
   sktxt::ParagraphStyle paragraph_style;
@@ -231,25 +440,7 @@ BENCHMARK_F(SkParagraphFixture, PaintSimple)(benchmark::State& state) {
 }
 
 BENCHMARK_F(SkParagraphFixture, PaintLarge)(benchmark::State& state) {
-  const char* text =
-      "Hello world! This is a simple sentence to test drawing. Hello world! "
-      "This is a simple sentence to test drawing. Hello world! This is a "
-      "simple sentence to test drawing.Hello world! This is a simple sentence "
-      "to test drawing. Hello world! "
-      "This is a simple sentence to test drawing. Hello world! This is a "
-      "simple sentence to test drawing.Hello world! This is a simple sentence "
-      "to test drawing. Hello world! "
-      "This is a simple sentence to test drawing. Hello world! This is a "
-      "simple sentence to test drawing.Hello world! This is a simple sentence "
-      "to test drawing. Hello world! "
-      "This is a simple sentence to test drawing. Hello world! This is a "
-      "simple sentence to test drawing.Hello world! This is a simple sentence "
-      "to test drawing. Hello world! "
-      "This is a simple sentence to test drawing. Hello world! This is a "
-      "simple sentence to test drawing.Hello world! This is a simple sentence "
-      "to test drawing. Hello world! "
-      "This is a simple sentence to test drawing. Hello world! This is a "
-      "simple sentence to test drawing.";
+  const char* text = kPaintLargeText;
   sktxt::ParagraphStyle paragraph_style;
   sktxt::TextStyle text_style;
   text_style.setFontFamilies({SkString("Roboto")});
@@ -268,6 +459,61 @@ BENCHMARK_F(SkParagraphFixture, PaintLarge)(benchmark::State& state) {
   }
 }
 
+#ifdef IMPELLER_SUPPORTS_RENDERING
+BENCHMARK_F(SkParagraphFixture, PaintSimpleImpeller)(benchmark::State& state) {
+  auto paragraph =
+      MakeImpellerParagraph("This is a simple sentence to test drawing.",
+                            flutter::DlPaint(flutter::DlColor::kBlack()));
+  PaintImpellerParagraph(state, *paragraph);
+}
+
+BENCHMARK_F(SkParagraphFixture, PaintLargeImpeller)(benchmark::State& state) {
+  auto paragraph = MakeImpellerParagraph(
+      kPaintLargeText, flutter::DlPaint(flutter::DlColor::kBlack()));
+  PaintImpellerParagraph(state, *paragraph);
+}
+
+BENCHMARK_F(SkParagraphFixture, PaintLargeImpellerPath)
+(benchmark::State& state) {
+  flutter::DlPaint paint(flutter::DlColor::kBlack());
+  paint.setDrawStyle(flutter::DlDrawStyle::kStroke);
+  paint.setStrokeWidth(5);
+  auto paragraph = MakeImpellerParagraph(kPaintLargeText, paint);
+  PaintImpellerParagraph(state, *paragraph);
+}
+
+// Builds and paints the items of a list on every frame, as a rebuilt list
+// does, while the picture of the previous frame is alive. The labels of the
+// items repeat, so their text frames are shared when they are interned.
+BENCHMARK_DEFINE_F(SkParagraphFixture, PaintListImpeller)
+(benchmark::State& state) {
+  const char* labels[] = {"Inbox", "Starred", "Snoozed", "Important",
+                          "Sent",  "Drafts",  "Spam",    "Trash"};
+  const int64_t item_count = state.range(0);
+  std::shared_ptr<impeller::TextFrameCache> text_frame_cache;
+  if (state.range(1)) {
+    text_frame_cache = std::make_shared<impeller::TextFrameCache>();
+  }
+  flutter::DlPaint paint(flutter::DlColor::kBlack());
+  sk_sp<flutter::DisplayList> previous_frame;
+  while (state.KeepRunning()) {
+    flutter::DisplayListBuilder builder;
+    for (int64_t i = 0; i < item_count; i++) {
+      auto paragraph = MakeImpellerParagraph(labels[i % std::size(labels)],
+                                             paint, text_frame_cache);
+      paragraph->Layout(300);
+      paragraph->Paint(&builder, 16, i * 48);
+    }
+    previous_frame = builder.Build();
+    benchmark::DoNotOptimize(previous_frame);
+  }
+  state.SetItemsProcessed(state.iterations() * item_count);
+}
+BENCHMARK_REGISTER_F(SkParagraphFixture, PaintListImpeller)
+    ->ArgsProduct({{100, 1000}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 BENCHMARK_F(SkParagraphFixture, PaintDecoration)(benchmark::State& state) {
   const char* text =
       "Hello world! This is a simple sentence to test drawing. Hello world! "
@@ -49,22 +49,39 @@ ParagraphBuilderSkia::ParagraphBuilderSkia(
     const ParagraphStyle& style,
     std::shared_ptr<FontCollection> font_collection,
     const bool impeller_enabled)
-    : base_style_(style.GetTextStyle()), impeller_enabled_(impeller_enabled) {
-  builder_ = skt::ParagraphBuilder::make(
-      TxtToSkia(style), font_collection->CreateSktFontCollection(),
-      SkUnicodes::ICU::Make());
+    : font_collection_(font_collection->CreateSktFontCollection()),
+      paragraph_style_(style),
+      txt_font_collection_(std::move(font_collection)),
+      base_style_(style.GetTextStyle()),
+      impeller_enabled_(impeller_enabled) {
+  skt::ParagraphStyle skia_style = TxtToSkia(style);
+  const skt::TextStyle& text_style = skia_style.getTextStyle();
+  AddTypefaceQuery(text_style.getFontFamilies(), text_style.getFontStyle(),
+                   text_style.getFontArguments());
+  const skt::StrutStyle& strut_style = skia_style.getStrutStyle();
+  if (strut_style.getStrutEnabled()) {
+    AddTypefaceQuery(strut_style.getFontFamilies(),
+                     strut_style.getFontStyle(), std::nullopt);
+  }
+  builder_ = skt::ParagraphBuilder::make(skia_style, font_collection_,
+                                         SkUnicodes::ICU::Make());
 }
 
 ParagraphBuilderSkia::~ParagraphBuilderSkia() = default;
 
 void ParagraphBuilderSkia::PushStyle(const TextStyle& style) {
-  builder_->pushStyle(TxtToSkia(style));
+  skt::TextStyle skia_style = TxtToSkia(style);
+  AddTypefaceQuery(skia_style.getFontFamilies(), skia_style.getFontStyle(),
+                   skia_style.getFontArguments());
+  builder_->pushStyle(skia_style);
   txt_style_stack_.push(style);
+  recorder_.PushStyle(style);
 }
 
 void ParagraphBuilderSkia::Pop() {
   builder_->pop();
   txt_style_stack_.pop();
+  recorder_.Pop();
 }
 
 const TextStyle& ParagraphBuilderSkia::PeekStyle() {
@@ -73,11 +90,13 @@ const TextStyle& ParagraphBuilderSkia::PeekStyle() {
 
 void ParagraphBuilderSkia::AddText(const std::u16string& text) {
   builder_->addText(text);
+  recorder_.AddText(text);
 }
 
 void ParagraphBuilderSkia::AddText(const uint8_t* utf8_data,
                                    size_t byte_length) {
   builder_->addText(reinterpret_cast<const char*>(utf8_data), byte_length);
+  recorder_.Invalidate();
 }
 
 void ParagraphBuilderSkia::AddPlaceholder(PlaceholderRun& span) {
@@ -90,11 +109,45 @@ void ParagraphBuilderSkia::AddPlaceholder(PlaceholderRun& span) {
       static_cast<skt::PlaceholderAlignment>(span.alignment);
 
   builder_->addPlaceholder(placeholder_style);
+  recorder_.AddPlaceholder(span);
 }
 
 std::unique_ptr<Paragraph> ParagraphBuilderSkia::Build() {
   return std::make_unique<ParagraphSkia>(
-      builder_->Build(), std::move(dl_paints_), impeller_enabled_);
+      builder_->Build(), std::move(dl_paints_), impeller_enabled_,
+      font_collection_, std::move(typeface_queries_),
+      impeller_enabled_ ? txt_font_collection_->GetTextFrameCache() : nullptr);
+}
+
+std::unique_ptr<Paragraph> ParagraphBuilderSkia::BuildIncremental(
+    Paragraph* previous) {
+  std::vector<IncrementalParagraph::Source> sources;
+  if (recorder_.is_valid()) {
+    sources = recorder_.TakeSources();
+  }
+  if (!IncrementalParagraph::CanLayOut(paragraph_style_, sources)) {
+    return Build();
+  }
+  return std::make_unique<IncrementalParagraph>(
+      paragraph_style_, txt_font_collection_, impeller_enabled_,
+      std::move(sources),
+      previous ? previous->AsIncrementalParagraph() : nullptr);
+}
+
+void ParagraphBuilderSkia::AddTypefaceQuery(
+    const std::vector<SkString>& font_families,
+    SkFontStyle font_style,
+    const std::optional<skt::FontArguments>& font_arguments) {
+  // Consecutive styles usually only differ in attributes other than the font.
+  if (!typeface_queries_.empty()) {
+    const ParagraphSkia::TypefaceQuery& last = typeface_queries_.back();
+    if (last.font_style == font_style &&
+        last.font_arguments == font_arguments &&
+        last.font_families == font_families) {
+      return;
+    }
+  }
+  typeface_queries_.push_back({font_families, font_style, font_arguments});
 }
 
 skt::ParagraphPainter::PaintID ParagraphBuilderSkia::CreatePaintID(
@@ -20,7 +20,9 @@
 #include "txt/paragraph_builder.h"
 
 #include "flutter/display_list/dl_paint.h"
+#include "paragraph_skia.h"
 #include "third_party/skia/modules/skparagraph/include/ParagraphBuilder.h"
+#include "txt/incremental_paragraph.h"
 
 namespace txt {
 
@@ -44,6 +46,8 @@ class ParagraphBuilderSkia : public ParagraphBuilder {
   virtual void AddText(const uint8_t* utf8_data, size_t byte_length) override;
   virtual void AddPlaceholder(PlaceholderRun& span) override;
   virtual std::unique_ptr<Paragraph> Build() override;
+  virtual std::unique_ptr<Paragraph> BuildIncremental(
+      Paragraph* previous) override;
 
  private:
   friend class SkiaParagraphBuilderTests_ParagraphStrutStyle_Test;
@@ -52,8 +56,15 @@ class ParagraphBuilderSkia : public ParagraphBuilder {
       const flutter::DlPaint& dl_paint);
   skia::textlayout::ParagraphStyle TxtToSkia(const ParagraphStyle& txt);
   skia::textlayout::TextStyle TxtToSkia(const TextStyle& txt);
+  void AddTypefaceQuery(
+      const std::vector<SkString>& font_families,
+      SkFontStyle font_style,
+      const std::optional<skia::textlayout::FontArguments>& font_arguments);
 
+  sk_sp<skia::textlayout::FontCollection> font_collection_;
   std::shared_ptr<skia::textlayout::ParagraphBuilder> builder_;
+  ParagraphStyle paragraph_style_;
+  std::shared_ptr<FontCollection> txt_font_collection_;
   TextStyle base_style_;
 
   /// @brief      Whether Impeller is enabled in the runtime.
@@ -65,6 +76,8 @@ class ParagraphBuilderSkia : public ParagraphBuilder {
   const bool impeller_enabled_;
   std::stack<TextStyle> txt_style_stack_;
   std::vector<flutter::DlPaint> dl_paints_;
+  std::vector<ParagraphSkia::TypefaceQuery> typeface_queries_;
+  IncrementalParagraph::Recorder recorder_;
 };
 
 }  // namespace txt
@@ -55,6 +55,8 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
   ///
   /// @param      builder  The display list builder.
   /// @param[in]  dl_paints The paints referenced by ID in the `drawX` methods.
+  /// @param      text_blob_cache  The conversions of the text blobs of the
+  ///                              paragraph, reused across paints.
   /// @param[in]  draw_path_effect  If true, draw path effects directly by
   ///                               drawing multiple lines instead of providing
   //                                a path effect to the paint.
@@ -67,11 +69,16 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
   ///             See https://github.com/flutter/flutter/issues/126673. It
   ///             probably makes sense to eventually make this a compile-time
   ///             decision (i.e. with `#ifdef`) instead of a runtime option.
-  DisplayListParagraphPainter(DisplayListBuilder* builder,
-                              const std::vector<DlPaint>& dl_paints,
-                              bool impeller_enabled)
+  DisplayListParagraphPainter(
+      DisplayListBuilder* builder,
+      const std::vector<DlPaint>& dl_paints,
+      std::unordered_map<uint32_t, CachedTextBlob>* text_blob_cache,
+      impeller::TextFrameCache* text_frame_cache,
+      bool impeller_enabled)
       : builder_(builder),
         dl_paints_(dl_paints),
+        text_blob_cache_(text_blob_cache),
+        text_frame_cache_(text_frame_cache),
         impeller_enabled_(impeller_enabled) {}
 
   void drawTextBlob(const sk_sp<SkTextBlob>& blob,
@@ -86,25 +93,34 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
 
 #ifdef IMPELLER_SUPPORTS_RENDERING
     if (impeller_enabled_) {
-      SkTextBlobRunIterator run(blob.get());
+      CachedTextBlob& cached = GetCachedTextBlob(blob);
       if (ShouldRenderAsPath(dl_paints_[paint_id])) {
-        auto path = skia::textlayout::Paragraph::GetPath(blob.get());
+        if (!cached.glyph_path.has_value()) {
+          cached.glyph_path = skia::textlayout::Paragraph::GetPath(blob.get());
+        }
         // If there is no path, this is an emoji and should be drawn as is,
         // ignoring the color source.
-        if (path.isEmpty()) {
-          builder_->DrawTextFrame(impeller::MakeTextFrameFromTextBlobSkia(blob),
-                                  x, y, dl_paints_[paint_id]);
+        if (cached.glyph_path->isEmpty()) {
+          builder_->DrawTextFrame(GetTextFrame(cached, blob), x, y,
+                                  dl_paints_[paint_id]);
 
           return;
         }
 
-        auto transformed = path.makeTransform(SkMatrix::Translate(
-            x + blob->bounds().left(), y + blob->bounds().top()));
-        builder_->DrawPath(transformed, dl_paints_[paint_id]);
+        SkPoint translation = SkPoint::Make(x + blob->bounds().left(),
+                                            y + blob->bounds().top());
+        if (!cached.translated_path.has_value() ||
+            cached.translation != translation) {
+          cached.translated_path = DlPath(cached.glyph_path->makeTransform(
+              SkMatrix::Translate(translation.fX, translation.fY)));
+          cached.translation = translation;
+        }
+        builder_->DrawPath(cached.translated_path.value(),
+                           dl_paints_[paint_id]);
         return;
       }
-      builder_->DrawTextFrame(impeller::MakeTextFrameFromTextBlobSkia(blob), x,
-                              y, dl_paints_[paint_id]);
+      builder_->DrawTextFrame(GetTextFrame(cached, blob), x, y,
+                              dl_paints_[paint_id]);
       return;
     }
 #endif  // IMPELLER_SUPPORTS_RENDERING
@@ -126,7 +142,7 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
       paint.setMaskFilter(&filter);
     }
     if (impeller_enabled_) {
-      builder_->DrawTextFrame(impeller::MakeTextFrameFromTextBlobSkia(blob), x,
+      builder_->DrawTextFrame(GetTextFrame(GetCachedTextBlob(blob), blob), x,
                               y, paint);
       return;
     }
@@ -180,6 +196,26 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
   void restore() override { builder_->Restore(); }
 
  private:
+  CachedTextBlob& GetCachedTextBlob(const sk_sp<SkTextBlob>& blob) {
+    // The blobs of a laid out paragraph are created once and reused by each
+    // paint, so their unique IDs identify them until the next layout.
+    CachedTextBlob& cached = (*text_blob_cache_)[blob->uniqueID()];
+    cached.painted = true;
+    return cached;
+  }
+
+  const std::shared_ptr<impeller::TextFrame>& GetTextFrame(
+      CachedTextBlob& cached,
+      const sk_sp<SkTextBlob>& blob) const {
+    if (!cached.text_frame) {
+      cached.text_frame = impeller::MakeTextFrameFromTextBlobSkia(blob);
+      if (text_frame_cache_) {
+        cached.text_frame = text_frame_cache_->Intern(cached.text_frame);
+      }
+    }
+    return cached.text_frame;
+  }
+
   bool ShouldRenderAsPath(const DlPaint& paint) const {
     FML_DCHECK(impeller_enabled_);
     // Text with non-trivial color sources should be rendered as a path when
@@ -208,6 +244,8 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
 
   DisplayListBuilder* builder_;
   const std::vector<DlPaint>& dl_paints_;
+  std::unordered_map<uint32_t, CachedTextBlob>* text_blob_cache_;
+  impeller::TextFrameCache* text_frame_cache_;
   const bool impeller_enabled_;
 };
 
@@ -215,9 +253,16 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
 
 ParagraphSkia::ParagraphSkia(std::unique_ptr<skt::Paragraph> paragraph,
                              std::vector<flutter::DlPaint>&& dl_paints,
-                             bool impeller_enabled)
+                             bool impeller_enabled,
+                             sk_sp<skt::FontCollection> font_collection,
+                             std::vector<TypefaceQuery> typeface_queries,
+                             std::shared_ptr<impeller::TextFrameCache>
+                                 text_frame_cache)
     : paragraph_(std::move(paragraph)),
       dl_paints_(dl_paints),
+      font_collection_(std::move(font_collection)),
+      typeface_queries_(std::move(typeface_queries)),
+      text_frame_cache_(std::move(text_frame_cache)),
       impeller_enabled_(impeller_enabled) {}
 
 double ParagraphSkia::GetMaxWidth() {
@@ -299,12 +344,38 @@ bool ParagraphSkia::DidExceedMaxLines() {
 void ParagraphSkia::Layout(double width) {
   line_metrics_.reset();
   line_metrics_styles_.clear();
+  text_blob_cache_.clear();
   paragraph_->layout(width);
 }
 
+void ParagraphSkia::PrepareForConcurrentLayout() {
+  if (!font_collection_) {
+    return;
+  }
+  // Fallback typefaces are not cached by the font collection, so these are
+  // the only lookups of a layout that fill its caches.
+  for (const TypefaceQuery& query : typeface_queries_) {
+    font_collection_->findTypefaces(query.font_families, query.font_style,
+                                    query.font_arguments);
+  }
+}
+
 bool ParagraphSkia::Paint(DisplayListBuilder* builder, double x, double y) {
-  DisplayListParagraphPainter painter(builder, dl_paints_, impeller_enabled_);
+  DisplayListParagraphPainter painter(builder, dl_paints_, &text_blob_cache_,
+                                      text_frame_cache_.get(),
+                                      impeller_enabled_);
   paragraph_->paint(&painter, x, y);
+
+  // Drop the conversions of blobs that are no longer drawn, such as those
+  // replaced after an update of the paragraph that did not lay it out again.
+  for (auto it = text_blob_cache_.begin(); it != text_blob_cache_.end();) {
+    if (it->second.painted) {
+      it->second.painted = false;
+      ++it;
+    } else {
+      it = text_blob_cache_.erase(it);
+    }
+  }
   return true;
 }
 
@@ -17,20 +17,59 @@
 #ifndef LIB_TXT_SRC_PARAGRAPH_SKIA_H_
 #define LIB_TXT_SRC_PARAGRAPH_SKIA_H_
 
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include "txt/paragraph.h"
 
+#include "flutter/display_list/geometry/dl_path.h"
+#include "flutter/impeller/typographer/text_frame.h"
+#include "flutter/impeller/typographer/text_frame_cache.h"
+#include "third_party/skia/include/core/SkPath.h"
+#include "third_party/skia/include/core/SkPoint.h"
+#include "third_party/skia/modules/skparagraph/include/FontArguments.h"
+#include "third_party/skia/modules/skparagraph/include/FontCollection.h"
 #include "third_party/skia/modules/skparagraph/include/Paragraph.h"
 
 namespace txt {
 
+// The conversions of a text blob of a laid out paragraph that are reused by
+// its paints on Impeller until the next layout.
+struct CachedTextBlob {
+  // The text frame of the blob, which the display lists of several paints
+  // may draw in the same frame.
+  std::shared_ptr<impeller::TextFrame> text_frame;
+  // The outlines of the glyphs of the blob, which are empty for emoji.
+  std::optional<SkPath> glyph_path;
+  // The glyph path translated to |translation|, the offset it was last
+  // drawn at.
+  std::optional<flutter::DlPath> translated_path;
+  SkPoint translation;
+  // Whether the blob was drawn by the current paint.
+  bool painted = false;
+};
+
 // Implementation of Paragraph based on Skia's text layout module.
 class ParagraphSkia : public Paragraph {
  public:
-  ParagraphSkia(std::unique_ptr<skia::textlayout::Paragraph> paragraph,
-                std::vector<flutter::DlPaint>&& dl_paints,
-                bool impeller_enabled);
+  // The font families and style of a text style of the paragraph, which a
+  // layout looks up typefaces for in the font collection.
+  struct TypefaceQuery {
+    std::vector<SkString> font_families;
+    SkFontStyle font_style;
+    std::optional<skia::textlayout::FontArguments> font_arguments;
+  };
+
+  ParagraphSkia(
+      std::unique_ptr<skia::textlayout::Paragraph> paragraph,
+      std::vector<flutter::DlPaint>&& dl_paints,
+      bool impeller_enabled,
+      sk_sp<skia::textlayout::FontCollection> font_collection = nullptr,
+      std::vector<TypefaceQuery> typeface_queries = {},
+      std::shared_ptr<impeller::TextFrameCache> text_frame_cache = nullptr);
 
   virtual ~ParagraphSkia() = default;
 
@@ -62,6 +101,8 @@ class ParagraphSkia : public Paragraph {
 
   void Layout(double width) override;
 
+  void PrepareForConcurrentLayout() override;
+
   bool Paint(flutter::DisplayListBuilder* builder, double x, double y) override;
 
   std::vector<TextBox> GetRectsForRange(
@@ -91,8 +132,14 @@ class ParagraphSkia : public Paragraph {
 
   std::unique_ptr<skia::textlayout::Paragraph> paragraph_;
   std::vector<flutter::DlPaint> dl_paints_;
+  sk_sp<skia::textlayout::FontCollection> font_collection_;
+  std::vector<TypefaceQuery> typeface_queries_;
   std::optional<std::vector<LineMetrics>> line_metrics_;
   std::vector<TextStyle> line_metrics_styles_;
+  // Keyed by the unique ID of the text blob.
+  std::unordered_map<uint32_t, CachedTextBlob> text_blob_cache_;
+  // The cache that the text frames of the blobs are interned in, if any.
+  std::shared_ptr<impeller::TextFrameCache> text_frame_cache_;
   const bool impeller_enabled_;
 };
 
@@ -26,12 +26,15 @@
 #include <vector>
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
+#include "txt/font_fallback_cache.h"
 #include "txt/platform.h"
 #include "txt/text_style.h"
 
 namespace txt {
 
-FontCollection::FontCollection() : enable_font_fallback_(true) {}
+FontCollection::FontCollection()
+    : enable_font_fallback_(true),
+      text_frame_cache_(std::make_shared<impeller::TextFrameCache>()) {}
 
 FontCollection::~FontCollection() {
   if (skt_collection_) {
@@ -45,7 +48,11 @@ size_t FontCollection::GetFontManagersCount() const {
 
 void FontCollection::SetupDefaultFontManager(
     uint32_t font_initialization_data) {
-  default_font_manager_ = GetDefaultFontManager(font_initialization_data);
+  // Finding the fallback font of a character can be slow on some platforms,
+  // and is otherwise repeated for every paragraph that needs it.
+  default_font_manager_ = sk_make_sp<FallbackCachingFontManager>(
+      GetDefaultFontManager(font_initialization_data),
+      FontFallbackCache::GetShared());
   skt_collection_.reset();
 }
 
@@ -96,6 +103,11 @@ void FontCollection::ClearFontFamilyCache() {
   }
 }
 
+void FontCollection::ClearFontFallbackCache() {
+  FontFallbackCache::GetShared()->Clear();
+  ClearFontFamilyCache();
+}
+
 sk_sp<skia::textlayout::FontCollection>
 FontCollection::CreateSktFontCollection() {
   if (!skt_collection_) {
@@ -118,4 +130,9 @@ FontCollection::CreateSktFontCollection() {
   return skt_collection_;
 }
 
+const std::shared_ptr<impeller::TextFrameCache>&
+FontCollection::GetTextFrameCache() const {
+  return text_frame_cache_;
+}
+
 }  // namespace txt
@@ -23,6 +23,7 @@
 #include <unordered_map>
 
 #include "flutter/fml/macros.h"
+#include "flutter/impeller/typographer/text_frame_cache.h"
 #include "third_party/googletest/googletest/include/gtest/gtest_prod.h"  // nogncheck
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkRefCnt.h"
@@ -53,15 +54,25 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
   // Remove all entries in the font family cache.
   void ClearFontFamilyCache();
 
+  // Remove all entries in the font family cache, and in the cache of the
+  // fallback fonts of the default font manager shared by all collections.
+  void ClearFontFallbackCache();
+
   // Construct a Skia text layout FontCollection based on this collection.
   sk_sp<skia::textlayout::FontCollection> CreateSktFontCollection();
 
+  // The cache that paragraphs of this collection intern the text frames that
+  // they paint on Impeller in, so that text shaped again with the same fonts
+  // is drawn with the same text frames.
+  const std::shared_ptr<impeller::TextFrameCache>& GetTextFrameCache() const;
+
  private:
   sk_sp<SkFontMgr> default_font_manager_;
   sk_sp<SkFontMgr> asset_font_manager_;
   sk_sp<SkFontMgr> dynamic_font_manager_;
   sk_sp<SkFontMgr> test_font_manager_;
   bool enable_font_fallback_;
+  std::shared_ptr<impeller::TextFrameCache> text_frame_cache_;
 
   // An equivalent font collection usable by the Skia text shaper library.
   sk_sp<skia::textlayout::FontCollection> skt_collection_;
@@ -0,0 +1,305 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "txt/font_fallback_cache.h"
+
+#include <sstream>
+#include <utility>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/trace_event.h"
+
+namespace txt {
+
+namespace {
+
+// The number of code points in each block of the cache, which is small
+// enough for a typeface to usually cover all the characters of a block that
+// it covers one of.
+constexpr int kCodePointsPerBlockShift = 7;
+
+// Marks the keys of characters that are cached individually, which is above
+// the largest code point so that they do not collide with the keys of blocks.
+constexpr SkUnichar kCharacterKeyFlag = 1 << 21;
+
+// The version of the format of the files written by |Save|.
+constexpr char kFileHeader[] = "FontFallbackCache 2";
+
+std::string GetLocale(const char* bcp47[], int bcp47_count) {
+  std::string locale;
+  for (int i = 0; i < bcp47_count; i++) {
+    if (i > 0) {
+      locale += ',';
+    }
+    locale += bcp47[i];
+  }
+  return locale;
+}
+
+// Whether the fallback of |character| can differ from the fallback of the
+// other characters of its block. Platforms choose between text and emoji
+// fonts for symbols character by character, for example in the Miscellaneous
+// Symbols block where U+2600 has a text presentation and U+2614 an emoji one.
+bool IsEmojiOrSymbol(SkUnichar character) {
+  return (character >= 0x2000 && character <= 0x2BFF) ||
+         character == 0x3030 || character == 0x303D || character == 0x3297 ||
+         character == 0x3299 || (character >= 0xFE00 && character <= 0xFE0F) ||
+         (character >= 0x1F000 && character <= 0x1FAFF) ||
+         (character >= 0xE0020 && character <= 0xE007F);
+}
+
+bool Covers(const sk_sp<SkTypeface>& typeface, SkUnichar character) {
+  return typeface && typeface->unicharToGlyph(character) != 0;
+}
+
+}  // namespace
+
+bool FontFallbackCache::Key::operator==(const Key& other) const {
+  return code_points == other.code_points && weight == other.weight &&
+         width == other.width && slant == other.slant &&
+         locale == other.locale;
+}
+
+std::size_t FontFallbackCache::Key::Hash::operator()(const Key& key) const {
+  return fml::HashCombine(key.code_points, key.weight, key.width, key.slant,
+                          std::hash<std::string>{}(key.locale));
+}
+
+FontFallbackCache::FontFallbackCache() = default;
+
+FontFallbackCache::~FontFallbackCache() = default;
+
+const std::shared_ptr<FontFallbackCache>& FontFallbackCache::GetShared() {
+  static const std::shared_ptr<FontFallbackCache> cache =
+      std::make_shared<FontFallbackCache>();
+  return cache;
+}
+
+sk_sp<SkTypeface> FontFallbackCache::MatchCharacter(
+    const SkFontMgr& font_manager,
+    const SkFontStyle& style,
+    const char* bcp47[],
+    int bcp47_count,
+    SkUnichar character) {
+  Key key{IsEmojiOrSymbol(character) ? character | kCharacterKeyFlag
+                                      : character >> kCodePointsPerBlockShift,
+          GetLocale(bcp47, bcp47_count), style.weight(), style.width(),
+          style.slant()};
+  Key character_key = key;
+  character_key.code_points = character;
+
+  SkString family_name;
+  {
+    std::scoped_lock lock(mutex_);
+    if (uncovered_characters_.count(character_key) > 0) {
+      hits_++;
+      return nullptr;
+    }
+    auto found = entries_.find(key);
+    if (found != entries_.end()) {
+      if (Covers(found->second.typeface, character)) {
+        hits_++;
+        return found->second.typeface;
+      }
+      if (!found->second.typeface) {
+        family_name = found->second.family_name;
+      }
+    }
+  }
+
+  // Resolve an entry loaded from a file by its family name, which is much
+  // cheaper than querying the coverage of all the fonts of the platform.
+  if (!family_name.isEmpty()) {
+    sk_sp<SkTypeface> typeface =
+        font_manager.matchFamilyStyle(family_name.c_str(), style);
+    std::scoped_lock lock(mutex_);
+    entries_[key].typeface = typeface;
+    if (Covers(typeface, character)) {
+      hits_++;
+      return typeface;
+    }
+  }
+
+  TRACE_EVENT0("flutter", "FontFallbackCache::MatchCharacter");
+  sk_sp<SkTypeface> typeface = font_manager.matchFamilyStyleCharacter(
+      nullptr, style, bcp47, bcp47_count, character);
+
+  std::scoped_lock lock(mutex_);
+  misses_++;
+  if (typeface) {
+    Entry& entry = entries_[key];
+    entry.typeface = typeface;
+    typeface->getFamilyName(&entry.family_name);
+  } else {
+    uncovered_characters_.insert(std::move(character_key));
+  }
+  TraceStatsToTimeline();
+  return typeface;
+}
+
+void FontFallbackCache::Clear() {
+  std::scoped_lock lock(mutex_);
+  entries_.clear();
+  uncovered_characters_.clear();
+}
+
+FontFallbackCache::Stats FontFallbackCache::GetStats() const {
+  std::scoped_lock lock(mutex_);
+  return {
+      .hits = hits_,
+      .misses = misses_,
+      .entries = entries_.size() + uncovered_characters_.size(),
+  };
+}
+
+bool FontFallbackCache::Save(const fml::UniqueFD& directory,
+                             const char* file_name) const {
+  std::ostringstream stream;
+  stream << kFileHeader << '\n';
+  {
+    std::scoped_lock lock(mutex_);
+    for (const auto& [key, entry] : entries_) {
+      if (entry.family_name.isEmpty()) {
+        continue;
+      }
+      stream << key.code_points << '\t' << key.weight << '\t' << key.width
+             << '\t' << key.slant << '\t' << key.locale << '\t'
+             << entry.family_name.c_str() << '\n';
+    }
+  }
+  return fml::WriteAtomically(directory, file_name,
+                              fml::DataMapping(stream.str()));
+}
+
+bool FontFallbackCache::Load(const fml::UniqueFD& directory,
+                             const char* file_name) {
+  auto mapping = fml::FileMapping::CreateReadOnly(directory, file_name);
+  if (!mapping || mapping->GetMapping() == nullptr) {
+    return false;
+  }
+  std::istringstream stream(
+      std::string(reinterpret_cast<const char*>(mapping->GetMapping()),
+                  mapping->GetSize()));
+
+  std::string line;
+  if (!std::getline(stream, line) || line != kFileHeader) {
+    FML_DLOG(WARNING) << "Ignoring font fallback cache with unknown format.";
+    return false;
+  }
+
+  std::scoped_lock lock(mutex_);
+  while (std::getline(stream, line)) {
+    std::istringstream fields(line);
+    Key key;
+    std::string family_name;
+    if (!(fields >> key.code_points >> key.weight >> key.width >>
+          key.slant) ||
+        fields.get() != '\t' || !std::getline(fields, key.locale, '\t') ||
+        !std::getline(fields, family_name) || family_name.empty()) {
+      FML_DLOG(WARNING) << "Ignoring malformed font fallback cache entry.";
+      continue;
+    }
+    // Entries found in this run take precedence over the loaded ones.
+    entries_.try_emplace(std::move(key),
+                         Entry{nullptr, SkString(family_name)});
+  }
+  return true;
+}
+
+void FontFallbackCache::TraceStatsToTimeline() const {
+#if !FLUTTER_RELEASE
+  FML_TRACE_COUNTER(
+      "flutter",                                                  //
+      "FontFallbackCache", reinterpret_cast<int64_t>(this),       //
+      "Hits", hits_,                                              //
+      "Misses", misses_,                                          //
+      "Entries", entries_.size() + uncovered_characters_.size());
+#endif  // !FLUTTER_RELEASE
+}
+
+FallbackCachingFontManager::FallbackCachingFontManager(
+    sk_sp<SkFontMgr> font_manager,
+    std::shared_ptr<FontFallbackCache> cache)
+    : font_manager_(std::move(font_manager)), cache_(std::move(cache)) {
+  FML_DCHECK(font_manager_);
+  FML_DCHECK(cache_);
+}
+
+FallbackCachingFontManager::~FallbackCachingFontManager() = default;
+
+int FallbackCachingFontManager::onCountFamilies() const {
+  return font_manager_->countFamilies();
+}
+
+void FallbackCachingFontManager::onGetFamilyName(int index,
+                                                 SkString* familyName) const {
+  font_manager_->getFamilyName(index, familyName);
+}
+
+sk_sp<SkFontStyleSet> FallbackCachingFontManager::onCreateStyleSet(
+    int index) const {
+  return font_manager_->createStyleSet(index);
+}
+
+sk_sp<SkFontStyleSet> FallbackCachingFontManager::onMatchFamily(
+    const char familyName[]) const {
+  return font_manager_->matchFamily(familyName);
+}
+
+sk_sp<SkTypeface> FallbackCachingFontManager::onMatchFamilyStyle(
+    const char familyName[],
+    const SkFontStyle& style) const {
+  return font_manager_->matchFamilyStyle(familyName, style);
+}
+
+sk_sp<SkTypeface> FallbackCachingFontManager::onMatchFamilyStyleCharacter(
+    const char familyName[],
+    const SkFontStyle& style,
+    const char* bcp47[],
+    int bcp47Count,
+    SkUnichar character) const {
+  // Only fallbacks that are not specific to a family are cached, which are
+  // the ones that the Skia text layout module asks for.
+  if (familyName != nullptr && familyName[0] != '\0') {
+    return font_manager_->matchFamilyStyleCharacter(familyName, style, bcp47,
+                                                    bcp47Count, character);
+  }
+  return cache_->MatchCharacter(*font_manager_, style, bcp47, bcp47Count,
+                                character);
+}
+
+sk_sp<SkTypeface> FallbackCachingFontManager::onMakeFromData(
+    sk_sp<SkData> data,
+    int ttcIndex) const {
+  return font_manager_->makeFromData(std::move(data), ttcIndex);
+}
+
+sk_sp<SkTypeface> FallbackCachingFontManager::onMakeFromStreamIndex(
+    std::unique_ptr<SkStreamAsset> stream,
+    int ttcIndex) const {
+  return font_manager_->makeFromStream(std::move(stream), ttcIndex);
+}
+
+sk_sp<SkTypeface> FallbackCachingFontManager::onMakeFromStreamArgs(
+    std::unique_ptr<SkStreamAsset> stream,
+    const SkFontArguments& args) const {
+  return font_manager_->makeFromStream(std::move(stream), args);
+}
+
+sk_sp<SkTypeface> FallbackCachingFontManager::onMakeFromFile(
+    const char path[],
+    int ttcIndex) const {
+  return font_manager_->makeFromFile(path, ttcIndex);
+}
+
+sk_sp<SkTypeface> FallbackCachingFontManager::onLegacyMakeTypeface(
+    const char familyName[],
+    SkFontStyle style) const {
+  return font_manager_->legacyMakeTypeface(familyName, style);
+}
+
+}  // namespace txt
@@ -0,0 +1,167 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TXT_FONT_FALLBACK_CACHE_H_
+#define TXT_FONT_FALLBACK_CACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/unique_fd.h"
+#include "third_party/skia/include/core/SkFontMgr.h"
+#include "third_party/skia/include/core/SkFontStyle.h"
+#include "third_party/skia/include/core/SkRefCnt.h"
+#include "third_party/skia/include/core/SkString.h"
+#include "third_party/skia/include/core/SkTypeface.h"
+
+namespace txt {
+
+// A cache of the typefaces that a font manager falls back to for characters
+// that are not covered by the requested font families.
+//
+// A fallback typeface usually covers the whole script of the character it was
+// chosen for, so results are cached per block of code points, locale and font
+// style, and a cached typeface is only returned for the characters it covers.
+// Emoji and symbols, for which platforms pick a typeface character by
+// character, and characters that no typeface covers are cached individually.
+//
+// This class is thread-safe.
+class FontFallbackCache {
+ public:
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t entries = 0;
+  };
+
+  FontFallbackCache();
+
+  ~FontFallbackCache();
+
+  // The cache of the platform's default font manager, which is shared by all
+  // font collections of the process.
+  static const std::shared_ptr<FontFallbackCache>& GetShared();
+
+  // Returns the typeface that |font_manager| falls back to for |character|,
+  // querying it only if no cached typeface covers the character.
+  sk_sp<SkTypeface> MatchCharacter(const SkFontMgr& font_manager,
+                                   const SkFontStyle& style,
+                                   const char* bcp47[],
+                                   int bcp47_count,
+                                   SkUnichar character);
+
+  // Remove all entries, for example after the system fonts have changed.
+  void Clear();
+
+  Stats GetStats() const;
+
+  // Writes the family names of the cached typefaces to a file, so that a
+  // later run can resolve fallbacks without querying character coverage.
+  bool Save(const fml::UniqueFD& directory, const char* file_name) const;
+
+  // Adds the entries of a file written by |Save|. Their typefaces are matched
+  // by family name when they are first used.
+  bool Load(const fml::UniqueFD& directory, const char* file_name);
+
+ private:
+  struct Key {
+    // The block of code points, or the character itself for emoji, symbols
+    // and the characters that are not covered by any typeface.
+    SkUnichar code_points;
+    std::string locale;
+    int weight;
+    int width;
+    int slant;
+
+    bool operator==(const Key& other) const;
+
+    struct Hash {
+      std::size_t operator()(const Key& key) const;
+    };
+  };
+
+  struct Entry {
+    // Null for entries loaded from a file until they are first used.
+    sk_sp<SkTypeface> typeface;
+    SkString family_name;
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<Key, Entry, Key::Hash> entries_;
+  std::unordered_set<Key, Key::Hash> uncovered_characters_;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+
+  void TraceStatsToTimeline() const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FontFallbackCache);
+};
+
+// A font manager that forwards to another one, and caches the typefaces it
+// falls back to for characters in a |FontFallbackCache|.
+class FallbackCachingFontManager : public SkFontMgr {
+ public:
+  FallbackCachingFontManager(sk_sp<SkFontMgr> font_manager,
+                             std::shared_ptr<FontFallbackCache> cache);
+
+  ~FallbackCachingFontManager() override;
+
+ private:
+  sk_sp<SkFontMgr> font_manager_;
+  std::shared_ptr<FontFallbackCache> cache_;
+
+  // |SkFontMgr|
+  int onCountFamilies() const override;
+
+  // |SkFontMgr|
+  void onGetFamilyName(int index, SkString* familyName) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkFontStyleSet> onCreateStyleSet(int index) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkFontStyleSet> onMatchFamily(const char familyName[]) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyle(const char familyName[],
+                                       const SkFontStyle&) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyleCharacter(
+      const char familyName[],
+      const SkFontStyle&,
+      const char* bcp47[],
+      int bcp47Count,
+      SkUnichar character) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromData(sk_sp<SkData>, int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset>,
+                                          int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromStreamArgs(std::unique_ptr<SkStreamAsset>,
+                                         const SkFontArguments&) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromFile(const char path[],
+                                   int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onLegacyMakeTypeface(const char familyName[],
+                                         SkFontStyle) const override;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FallbackCachingFontManager);
+};
+
+}  // namespace txt
+
+#endif  // TXT_FONT_FALLBACK_CACHE_H_
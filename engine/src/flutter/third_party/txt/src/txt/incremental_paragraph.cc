@@ -0,0 +1,554 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "txt/incremental_paragraph.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "txt/paragraph_builder.h"
+
+namespace txt {
+
+namespace {
+
+// |TextStyle::equals| leaves out some of the attributes that affect layout.
+bool IsSameStyle(const std::shared_ptr<const TextStyle>& a,
+                 const std::shared_ptr<const TextStyle>& b) {
+  if (a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  return a->equals(*b) && a->font_size == b->font_size &&
+         a->text_baseline == b->text_baseline &&
+         a->background == b->background &&
+         a->font_features.GetFontFeatures() ==
+             b->font_features.GetFontFeatures() &&
+         a->font_variations.GetAxisValues() ==
+             b->font_variations.GetAxisValues();
+}
+
+bool IsSamePlaceholder(const std::optional<PlaceholderRun>& a,
+                       const std::optional<PlaceholderRun>& b) {
+  if (!a || !b) {
+    return a.has_value() == b.has_value();
+  }
+  return a->width == b->width && a->height == b->height &&
+         a->alignment == b->alignment && a->baseline == b->baseline &&
+         a->baseline_offset == b->baseline_offset;
+}
+
+// Compares the attributes of the styles that apply to all blocks. The text
+// height behavior is compared per block, and the lines of an incremental
+// paragraph are never truncated.
+bool IsSameParagraphStyle(const ParagraphStyle& a, const ParagraphStyle& b) {
+  return a.font_weight == b.font_weight && a.font_style == b.font_style &&
+         a.font_family == b.font_family && a.font_size == b.font_size &&
+         a.height == b.height &&
+         a.has_height_override == b.has_height_override &&
+         a.strut_enabled == b.strut_enabled &&
+         a.strut_font_weight == b.strut_font_weight &&
+         a.strut_font_style == b.strut_font_style &&
+         a.strut_font_families == b.strut_font_families &&
+         a.strut_font_size == b.strut_font_size &&
+         a.strut_height == b.strut_height &&
+         a.strut_has_height_override == b.strut_has_height_override &&
+         a.strut_half_leading == b.strut_half_leading &&
+         a.strut_leading == b.strut_leading &&
+         a.force_strut_height == b.force_strut_height &&
+         a.text_align == b.text_align &&
+         a.text_direction == b.text_direction && a.locale == b.locale;
+}
+
+void ShiftGlyphInfo(size_t start,
+                    double y,
+                    skia::textlayout::Paragraph::GlyphInfo* glyph_info) {
+  glyph_info->fGraphemeLayoutBounds.offset(0, y);
+  glyph_info->fGraphemeClusterTextRange.start += start;
+  glyph_info->fGraphemeClusterTextRange.end += start;
+}
+
+}  // namespace
+
+bool IncrementalParagraph::Source::operator==(const Source& other) const {
+  if (length != other.length || runs.size() != other.runs.size()) {
+    return false;
+  }
+  if (runs.empty()) {
+    return IsSameStyle(empty_style, other.empty_style);
+  }
+  for (size_t i = 0; i < runs.size(); i++) {
+    const Run& run = runs[i];
+    const Run& other_run = other.runs[i];
+    if (run.text != other_run.text ||
+        !IsSamePlaceholder(run.placeholder, other_run.placeholder) ||
+        !IsSameStyle(run.style, other_run.style)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+IncrementalParagraph::Recorder::Recorder() : style_stack_(1), sources_(1) {}
+
+IncrementalParagraph::Recorder::~Recorder() = default;
+
+void IncrementalParagraph::Recorder::PushStyle(const TextStyle& style) {
+  style_stack_.push_back(std::make_shared<const TextStyle>(style));
+}
+
+void IncrementalParagraph::Recorder::Pop() {
+  if (style_stack_.size() > 1) {
+    style_stack_.pop_back();
+  }
+}
+
+void IncrementalParagraph::Recorder::AddText(const std::u16string& text) {
+  if (!valid_) {
+    return;
+  }
+  // The other hard line breaks are rare, so text that contains them is laid
+  // out as a single paragraph.
+  if (text.find_first_of(u"\r\v\f\u0085\u2028\u2029") !=
+      std::u16string::npos) {
+    Invalidate();
+    return;
+  }
+  size_t begin = 0;
+  while (true) {
+    size_t line_break = text.find(u'\n', begin);
+    size_t end = std::min(line_break, text.size());
+    if (end > begin) {
+      Source& source = sources_.back();
+      if (!source.runs.empty() && !source.runs.back().placeholder &&
+          source.runs.back().style == GetStyle()) {
+        source.runs.back().text.append(text, begin, end - begin);
+      } else {
+        source.runs.push_back({GetStyle(), text.substr(begin, end - begin)});
+      }
+      source.length += end - begin;
+    }
+    if (line_break == std::u16string::npos) {
+      break;
+    }
+    sources_.back().empty_style = GetStyle();
+    sources_.emplace_back();
+    // A trailing line break also sets the height of the empty last line.
+    sources_.back().empty_style = GetStyle();
+    begin = line_break + 1;
+  }
+}
+
+void IncrementalParagraph::Recorder::AddPlaceholder(
+    const PlaceholderRun& placeholder) {
+  Source& source = sources_.back();
+  source.runs.push_back({GetStyle(), std::u16string(), placeholder});
+  // The object replacement character of the placeholder.
+  source.length++;
+}
+
+std::vector<IncrementalParagraph::Source>
+IncrementalParagraph::Recorder::TakeSources() {
+  return std::move(sources_);
+}
+
+const std::shared_ptr<const TextStyle>&
+IncrementalParagraph::Recorder::GetStyle() const {
+  return style_stack_.back();
+}
+
+bool IncrementalParagraph::CanLayOut(const ParagraphStyle& style,
+                                     const std::vector<Source>& sources) {
+  return sources.size() > 1 && style.unlimited_lines() && !style.ellipsized();
+}
+
+IncrementalParagraph::IncrementalParagraph(
+    const ParagraphStyle& style,
+    std::shared_ptr<FontCollection> font_collection,
+    bool impeller_enabled,
+    std::vector<Source> sources,
+    IncrementalParagraph* previous)
+    : style_(style),
+      font_collection_(std::move(font_collection)),
+      impeller_enabled_(impeller_enabled) {
+  FML_DCHECK(!sources.empty());
+  blocks_.resize(sources.size());
+  size_t start = 0;
+  for (size_t i = 0; i < sources.size(); i++) {
+    Block& block = blocks_[i];
+    block.source = std::move(sources[i]);
+    block.text_height_behavior = style_.text_height_behavior;
+    if (i > 0) {
+      block.text_height_behavior &= ~TextHeightBehavior::kDisableFirstAscent;
+    }
+    if (i + 1 < sources.size()) {
+      block.text_height_behavior &= ~TextHeightBehavior::kDisableLastDescent;
+    }
+    block.start = start;
+    // Skip the hard line break.
+    start += block.source.length + 1;
+  }
+
+  if (!previous || !CanTakeOver(*previous)) {
+    return;
+  }
+
+  // Take over the blocks before and after the edited ones.
+  std::vector<Block>& previous_blocks = previous->blocks_;
+  auto take_over = [&](Block& block, Block& previous_block) {
+    if (block.text_height_behavior != previous_block.text_height_behavior ||
+        !(block.source == previous_block.source)) {
+      return false;
+    }
+    if (previous_block.paragraph) {
+      block.paragraph = std::move(previous_block.paragraph);
+      block.width = previous_block.width;
+      previous_block.width.reset();
+      reused_block_count_++;
+    }
+    return true;
+  };
+  size_t count = std::min(blocks_.size(), previous_blocks.size());
+  size_t prefix = 0;
+  while (prefix < count &&
+         take_over(blocks_[prefix], previous_blocks[prefix])) {
+    prefix++;
+  }
+  for (size_t suffix = 1; prefix + suffix <= count; suffix++) {
+    if (!take_over(blocks_[blocks_.size() - suffix],
+                   previous_blocks[previous_blocks.size() - suffix])) {
+      break;
+    }
+  }
+  // The line metrics of the previous paragraph refer to the styles of the
+  // paragraphs of its blocks.
+  previous->line_metrics_.reset();
+}
+
+IncrementalParagraph::~IncrementalParagraph() = default;
+
+bool IncrementalParagraph::CanTakeOver(
+    const IncrementalParagraph& previous) const {
+  return font_collection_ == previous.font_collection_ &&
+         impeller_enabled_ == previous.impeller_enabled_ &&
+         IsSameParagraphStyle(style_, previous.style_);
+}
+
+std::unique_ptr<Paragraph> IncrementalParagraph::BuildBlock(
+    const Block& block) const {
+  ParagraphStyle style = style_;
+  style.text_height_behavior = block.text_height_behavior;
+  std::unique_ptr<ParagraphBuilder> builder =
+      ParagraphBuilder::CreateSkiaBuilder(style, font_collection_,
+                                          impeller_enabled_);
+  // An empty paragraph takes its height from the last style pushed, which is
+  // dropped again if it is popped before any text is added.
+  if (block.source.runs.empty() && block.source.empty_style) {
+    builder->PushStyle(*block.source.empty_style);
+  }
+  for (const Run& run : block.source.runs) {
+    if (run.style) {
+      builder->PushStyle(*run.style);
+    }
+    if (run.placeholder) {
+      PlaceholderRun placeholder = run.placeholder.value();
+      builder->AddPlaceholder(placeholder);
+    } else {
+      builder->AddText(run.text);
+    }
+    if (run.style) {
+      builder->Pop();
+    }
+  }
+  return builder->Build();
+}
+
+Paragraph& IncrementalParagraph::GetBlock(const Block& block) const {
+  if (!block.paragraph) {
+    block.paragraph = BuildBlock(block);
+    block.width.reset();
+  }
+  return *block.paragraph;
+}
+
+Paragraph& IncrementalParagraph::GetLaidOutBlock(const Block& block) const {
+  Paragraph& paragraph = GetBlock(block);
+  if (block.width != width_) {
+    paragraph.Layout(width_);
+    block.width = width_;
+  }
+  return paragraph;
+}
+
+const IncrementalParagraph::Block& IncrementalParagraph::GetBlockAtOffset(
+    size_t offset) const {
+  auto it = std::upper_bound(
+      blocks_.begin(), blocks_.end(), offset,
+      [](size_t value, const Block& block) { return value < block.start; });
+  return *(it - 1);
+}
+
+const IncrementalParagraph::Block& IncrementalParagraph::GetBlockAtY(
+    double dy) const {
+  auto it = std::upper_bound(
+      blocks_.begin(), blocks_.end(), dy,
+      [](double value, const Block& block) { return value < block.y; });
+  return it == blocks_.begin() ? blocks_.front() : *(it - 1);
+}
+
+const IncrementalParagraph::Block* IncrementalParagraph::GetBlockAtLine(
+    size_t line) const {
+  auto it = std::upper_bound(
+      blocks_.begin(), blocks_.end(), line,
+      [](size_t value, const Block& block) {
+        return value < block.first_line;
+      });
+  const Block& block = *(it - 1);
+  if (line - block.first_line >= GetLaidOutBlock(block).GetNumberOfLines()) {
+    return nullptr;
+  }
+  return &block;
+}
+
+double IncrementalParagraph::GetMaxWidth() {
+  return max_width_;
+}
+
+double IncrementalParagraph::GetHeight() {
+  return height_;
+}
+
+double IncrementalParagraph::GetLongestLine() {
+  return longest_line_;
+}
+
+double IncrementalParagraph::GetMinIntrinsicWidth() {
+  return min_intrinsic_width_;
+}
+
+double IncrementalParagraph::GetMaxIntrinsicWidth() {
+  return max_intrinsic_width_;
+}
+
+double IncrementalParagraph::GetAlphabeticBaseline() {
+  return GetLaidOutBlock(blocks_.front()).GetAlphabeticBaseline();
+}
+
+double IncrementalParagraph::GetIdeographicBaseline() {
+  return GetLaidOutBlock(blocks_.front()).GetIdeographicBaseline();
+}
+
+bool IncrementalParagraph::DidExceedMaxLines() {
+  return false;
+}
+
+void IncrementalParagraph::Layout(double width) {
+  TRACE_EVENT0("flutter", "IncrementalParagraph::Layout");
+  width_ = width;
+  height_ = 0;
+  longest_line_ = 0;
+  min_intrinsic_width_ = 0;
+  max_intrinsic_width_ = 0;
+  line_count_ = 0;
+  for (Block& block : blocks_) {
+    Paragraph& paragraph = GetLaidOutBlock(block);
+    block.y = height_;
+    block.first_line = line_count_;
+    height_ += paragraph.GetHeight();
+    line_count_ += paragraph.GetNumberOfLines();
+    longest_line_ = std::max(longest_line_, paragraph.GetLongestLine());
+    min_intrinsic_width_ =
+        std::max(min_intrinsic_width_, paragraph.GetMinIntrinsicWidth());
+    max_intrinsic_width_ =
+        std::max(max_intrinsic_width_, paragraph.GetMaxIntrinsicWidth());
+  }
+  max_width_ = blocks_.front().paragraph->GetMaxWidth();
+  line_metrics_.reset();
+}
+
+void IncrementalParagraph::PrepareForConcurrentLayout() {
+  // Build the missing blocks here, as the font collection is not thread-safe.
+  for (const Block& block : blocks_) {
+    GetBlock(block).PrepareForConcurrentLayout();
+  }
+}
+
+bool IncrementalParagraph::Paint(flutter::DisplayListBuilder* builder,
+                                 double x,
+                                 double y) {
+  for (const Block& block : blocks_) {
+    GetLaidOutBlock(block).Paint(builder, x, y + block.y);
+  }
+  return true;
+}
+
+std::vector<Paragraph::TextBox> IncrementalParagraph::GetRectsForRange(
+    size_t start,
+    size_t end,
+    RectHeightStyle rect_height_style,
+    RectWidthStyle rect_width_style) {
+  std::vector<TextBox> boxes;
+  for (const Block& block : blocks_) {
+    if (block.start >= end) {
+      break;
+    }
+    size_t block_start = std::max(start, block.start);
+    size_t block_end = std::min(end, block.start + block.source.length);
+    if (block_start >= block_end) {
+      continue;
+    }
+    for (TextBox& box : GetLaidOutBlock(block).GetRectsForRange(
+             block_start - block.start, block_end - block.start,
+             rect_height_style, rect_width_style)) {
+      box.rect.offset(0, block.y);
+      boxes.push_back(box);
+    }
+  }
+  return boxes;
+}
+
+std::vector<Paragraph::TextBox>
+IncrementalParagraph::GetRectsForPlaceholders() {
+  std::vector<TextBox> boxes;
+  for (const Block& block : blocks_) {
+    for (TextBox& box : GetLaidOutBlock(block).GetRectsForPlaceholders()) {
+      box.rect.offset(0, block.y);
+      boxes.push_back(box);
+    }
+  }
+  return boxes;
+}
+
+Paragraph::PositionWithAffinity
+IncrementalParagraph::GetGlyphPositionAtCoordinate(double dx, double dy) {
+  const Block& block = GetBlockAtY(dy);
+  PositionWithAffinity position =
+      GetLaidOutBlock(block).GetGlyphPositionAtCoordinate(dx, dy - block.y);
+  return PositionWithAffinity(position.position + block.start,
+                              position.affinity);
+}
+
+bool IncrementalParagraph::GetGlyphInfoAt(
+    unsigned offset,
+    skia::textlayout::Paragraph::GlyphInfo* glyphInfo) const {
+  const Block& block = GetBlockAtOffset(offset);
+  if (!GetLaidOutBlock(block).GetGlyphInfoAt(offset - block.start,
+                                             glyphInfo)) {
+    return false;
+  }
+  ShiftGlyphInfo(block.start, block.y, glyphInfo);
+  return true;
+}
+
+bool IncrementalParagraph::GetClosestGlyphInfoAtCoordinate(
+    double dx,
+    double dy,
+    skia::textlayout::Paragraph::GlyphInfo* glyphInfo) const {
+  const Block& block = GetBlockAtY(dy);
+  if (!GetLaidOutBlock(block).GetClosestGlyphInfoAtCoordinate(
+          dx, dy - block.y, glyphInfo)) {
+    return false;
+  }
+  ShiftGlyphInfo(block.start, block.y, glyphInfo);
+  return true;
+}
+
+Paragraph::Range<size_t> IncrementalParagraph::GetWordBoundary(size_t offset) {
+  const Block& block = GetBlockAtOffset(offset);
+  if (offset - block.start >= block.source.length &&
+      &block != &blocks_.back()) {
+    // The hard line break is a word of its own.
+    return Range<size_t>(offset, offset + 1);
+  }
+  Range<size_t> range =
+      GetLaidOutBlock(block).GetWordBoundary(offset - block.start);
+  range.Shift(block.start);
+  return range;
+}
+
+std::vector<LineMetrics>& IncrementalParagraph::GetLineMetrics() {
+  if (!line_metrics_) {
+    line_metrics_.emplace();
+    line_metrics_->reserve(line_count_);
+    for (const Block& block : blocks_) {
+      for (const LineMetrics& block_metrics :
+           GetLaidOutBlock(block).GetLineMetrics()) {
+        LineMetrics& metrics = line_metrics_->emplace_back(block_metrics);
+        metrics.start_index += block.start;
+        metrics.end_index += block.start;
+        metrics.end_excluding_whitespace += block.start;
+        metrics.end_including_newline += block.start;
+        metrics.baseline += block.y;
+        metrics.line_number += block.first_line;
+        metrics.run_metrics.clear();
+        for (const auto& [index, run_metrics] : block_metrics.run_metrics) {
+          metrics.run_metrics.emplace(index + block.start, run_metrics);
+        }
+      }
+      if (&block != &blocks_.back()) {
+        LineMetrics& last_line = line_metrics_->back();
+        last_line.hard_break = true;
+        last_line.end_including_newline++;
+      }
+    }
+  }
+  return line_metrics_.value();
+}
+
+bool IncrementalParagraph::GetLineMetricsAt(
+    int lineNumber,
+    skia::textlayout::LineMetrics* lineMetrics) const {
+  if (lineNumber < 0) {
+    return false;
+  }
+  const Block* block = GetBlockAtLine(lineNumber);
+  if (!block) {
+    return false;
+  }
+  Paragraph& paragraph = GetLaidOutBlock(*block);
+  size_t block_line = lineNumber - block->first_line;
+  if (!paragraph.GetLineMetricsAt(block_line, lineMetrics)) {
+    return false;
+  }
+  lineMetrics->fStartIndex += block->start;
+  lineMetrics->fEndIndex += block->start;
+  lineMetrics->fEndExcludingWhitespaces += block->start;
+  lineMetrics->fEndIncludingNewline += block->start;
+  lineMetrics->fBaseline += block->y;
+  lineMetrics->fLineNumber += block->first_line;
+  if (block_line + 1 == paragraph.GetNumberOfLines() &&
+      block != &blocks_.back()) {
+    lineMetrics->fHardBreak = true;
+    lineMetrics->fEndIncludingNewline++;
+  }
+  std::map<size_t, skia::textlayout::StyleMetrics> style_metrics;
+  for (const auto& [index, metrics] : lineMetrics->fLineMetrics) {
+    style_metrics.emplace(index + block->start, metrics);
+  }
+  lineMetrics->fLineMetrics = std::move(style_metrics);
+  return true;
+}
+
+size_t IncrementalParagraph::GetNumberOfLines() const {
+  return line_count_;
+}
+
+int IncrementalParagraph::GetLineNumberAt(size_t utf16Offset) const {
+  const Block& block = GetBlockAtOffset(utf16Offset);
+  Paragraph& paragraph = GetLaidOutBlock(block);
+  if (utf16Offset - block.start >= block.source.length &&
+      &block != &blocks_.back()) {
+    // The hard line break belongs to the last line of its block.
+    return block.first_line + paragraph.GetNumberOfLines() - 1;
+  }
+  int line = paragraph.GetLineNumberAt(utf16Offset - block.start);
+  return line < 0 ? line : line + block.first_line;
+}
+
+}  // namespace txt
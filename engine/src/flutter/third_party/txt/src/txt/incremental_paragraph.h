@@ -0,0 +1,240 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TXT_INCREMENTAL_PARAGRAPH_H_
+#define TXT_INCREMENTAL_PARAGRAPH_H_
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "txt/font_collection.h"
+#include "txt/paragraph.h"
+#include "txt/paragraph_style.h"
+#include "txt/placeholder_run.h"
+#include "txt/text_style.h"
+
+namespace txt {
+
+// A paragraph that is laid out as a column of paragraphs, one for the text
+// between each pair of hard line breaks, so that an edit only needs to shape
+// and break the lines of the blocks that it changed.
+//
+// The blocks whose text and styles did not change since the previous
+// paragraph of the same text are taken over from it instead of being shaped
+// again. The previous paragraph rebuilds the blocks that it gave away if it is
+// used again.
+class IncrementalParagraph : public Paragraph {
+ public:
+  // A run of text with a single style, or a placeholder.
+  struct Run {
+    // Null for the default text style of the paragraph.
+    std::shared_ptr<const TextStyle> style;
+    std::u16string text;
+    std::optional<PlaceholderRun> placeholder;
+  };
+
+  // The text and styles of a block, without its hard line break.
+  struct Source {
+    std::vector<Run> runs;
+    // The number of UTF-16 code units of the runs.
+    size_t length = 0;
+    // The style of the line break that ends the block, or of the end of the
+    // text for the last block. It sets the height of a block without runs.
+    std::shared_ptr<const TextStyle> empty_style;
+
+    bool operator==(const Source& other) const;
+  };
+
+  // Records the text and styles added to a paragraph builder as blocks.
+  class Recorder {
+   public:
+    Recorder();
+
+    ~Recorder();
+
+    void PushStyle(const TextStyle& style);
+
+    void Pop();
+
+    void AddText(const std::u16string& text);
+
+    void AddPlaceholder(const PlaceholderRun& placeholder);
+
+    // Called for input that cannot be recorded, like UTF-8 text or line
+    // breaks that are not a single line feed.
+    void Invalidate() { valid_ = false; }
+
+    bool is_valid() const { return valid_; }
+
+    std::vector<Source> TakeSources();
+
+   private:
+    std::vector<std::shared_ptr<const TextStyle>> style_stack_;
+    std::vector<Source> sources_;
+    bool valid_ = true;
+
+    const std::shared_ptr<const TextStyle>& GetStyle() const;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(Recorder);
+  };
+
+  // Whether a paragraph of these blocks is laid out like a single paragraph
+  // of their text, which is not the case if its lines may be truncated.
+  static bool CanLayOut(const ParagraphStyle& style,
+                        const std::vector<Source>& sources);
+
+  // Creates a paragraph of |sources| that takes over the unchanged blocks of
+  // |previous|, which may be null.
+  IncrementalParagraph(const ParagraphStyle& style,
+                       std::shared_ptr<FontCollection> font_collection,
+                       bool impeller_enabled,
+                       std::vector<Source> sources,
+                       IncrementalParagraph* previous);
+
+  ~IncrementalParagraph() override;
+
+  // The number of blocks taken over from the previous paragraph.
+  size_t reused_block_count() const { return reused_block_count_; }
+
+  // |Paragraph|
+  IncrementalParagraph* AsIncrementalParagraph() override { return this; }
+
+  // |Paragraph|
+  double GetMaxWidth() override;
+
+  // |Paragraph|
+  double GetHeight() override;
+
+  // |Paragraph|
+  double GetLongestLine() override;
+
+  // |Paragraph|
+  double GetMinIntrinsicWidth() override;
+
+  // |Paragraph|
+  double GetMaxIntrinsicWidth() override;
+
+  // |Paragraph|
+  double GetAlphabeticBaseline() override;
+
+  // |Paragraph|
+  double GetIdeographicBaseline() override;
+
+  // |Paragraph|
+  bool DidExceedMaxLines() override;
+
+  // |Paragraph|
+  void Layout(double width) override;
+
+  // |Paragraph|
+  void PrepareForConcurrentLayout() override;
+
+  // |Paragraph|
+  bool Paint(flutter::DisplayListBuilder* builder,
+             double x,
+             double y) override;
+
+  // |Paragraph|
+  std::vector<TextBox> GetRectsForRange(
+      size_t start,
+      size_t end,
+      RectHeightStyle rect_height_style,
+      RectWidthStyle rect_width_style) override;
+
+  // |Paragraph|
+  std::vector<TextBox> GetRectsForPlaceholders() override;
+
+  // |Paragraph|
+  PositionWithAffinity GetGlyphPositionAtCoordinate(double dx,
+                                                    double dy) override;
+
+  // |Paragraph|
+  bool GetGlyphInfoAt(
+      unsigned offset,
+      skia::textlayout::Paragraph::GlyphInfo* glyphInfo) const override;
+
+  // |Paragraph|
+  bool GetClosestGlyphInfoAtCoordinate(
+      double dx,
+      double dy,
+      skia::textlayout::Paragraph::GlyphInfo* glyphInfo) const override;
+
+  // |Paragraph|
+  Range<size_t> GetWordBoundary(size_t offset) override;
+
+  // |Paragraph|
+  std::vector<LineMetrics>& GetLineMetrics() override;
+
+  // |Paragraph|
+  bool GetLineMetricsAt(
+      int lineNumber,
+      skia::textlayout::LineMetrics* lineMetrics) const override;
+
+  // |Paragraph|
+  size_t GetNumberOfLines() const override;
+
+  // |Paragraph|
+  int GetLineNumberAt(size_t utf16Offset) const override;
+
+ private:
+  struct Block {
+    Source source;
+    // The text height behavior that the block is built with, which only
+    // adjusts the first and the last line of the whole paragraph.
+    size_t text_height_behavior = TextHeightBehavior::kAll;
+    // Null until the block is first used, and after a later paragraph took
+    // it over.
+    mutable std::unique_ptr<Paragraph> paragraph;
+    // The width that |paragraph| was last laid out to.
+    mutable std::optional<double> width;
+    // The position of the block in the paragraph.
+    size_t start = 0;
+    double y = 0;
+    size_t first_line = 0;
+  };
+
+  const ParagraphStyle style_;
+  const std::shared_ptr<FontCollection> font_collection_;
+  const bool impeller_enabled_;
+  std::vector<Block> blocks_;
+  size_t reused_block_count_ = 0;
+
+  double width_ = 0;
+  double max_width_ = 0;
+  double height_ = 0;
+  double longest_line_ = 0;
+  double min_intrinsic_width_ = 0;
+  double max_intrinsic_width_ = 0;
+  size_t line_count_ = 0;
+  std::optional<std::vector<LineMetrics>> line_metrics_;
+
+  bool CanTakeOver(const IncrementalParagraph& previous) const;
+
+  std::unique_ptr<Paragraph> BuildBlock(const Block& block) const;
+
+  // Returns the paragraph of a block, building it if needed.
+  Paragraph& GetBlock(const Block& block) const;
+
+  // Returns the paragraph of a block, laid out to the width of this one.
+  Paragraph& GetLaidOutBlock(const Block& block) const;
+
+  // Returns the block that contains a UTF-16 offset, including the hard line
+  // break that ends it.
+  const Block& GetBlockAtOffset(size_t offset) const;
+
+  // Returns the block that is closest to a vertical coordinate.
+  const Block& GetBlockAtY(double dy) const;
+
+  // Returns the block that contains a line number.
+  const Block* GetBlockAtLine(size_t line) const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(IncrementalParagraph);
+};
+
+}  // namespace txt
+
+#endif  // TXT_INCREMENTAL_PARAGRAPH_H_
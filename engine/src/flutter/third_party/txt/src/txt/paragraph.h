@@ -30,6 +30,8 @@ class SkCanvas;
 
 namespace txt {
 
+class IncrementalParagraph;
+
 // Interface for text layout engines.  The current implementation is based on
 // Skia's SkShaper/SkParagraph text layout module.
 class Paragraph {
@@ -108,6 +110,10 @@ class Paragraph {
 
   virtual ~Paragraph() = default;
 
+  // Returns this paragraph if it is laid out by blocks between hard line
+  // breaks, or null otherwise.
+  virtual IncrementalParagraph* AsIncrementalParagraph() { return nullptr; }
+
   // Returns the width provided in the Layout() method. This is the maximum
   // width any line in the laid out paragraph can occupy. We expect that
   // GetMaxWidth() >= GetLayoutWidth().
@@ -146,6 +152,12 @@ class Paragraph {
   // before Painting and getting any statistics from this class.
   virtual void Layout(double width) = 0;
 
+  // Looks up the typefaces that Layout uses in the caches of the font
+  // collection, which are not thread-safe to fill. Once this is called,
+  // paragraphs that share a font collection may be laid out concurrently on
+  // different threads until the font collection changes.
+  virtual void PrepareForConcurrentLayout() = 0;
+
   // Paints the laid out text onto the supplied DisplayListBuilder at
   // (x, y) offset from the origin. Only valid after Layout() is called.
   virtual bool Paint(flutter::DisplayListBuilder* builder,
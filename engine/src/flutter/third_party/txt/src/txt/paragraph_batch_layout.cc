@@ -0,0 +1,97 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "txt/paragraph_batch_layout.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace txt {
+
+namespace {
+
+// The state of a batch, which is shared with the posted tasks because they
+// may only start after the batch is done.
+struct BatchLayout {
+  BatchLayout(const std::vector<Paragraph*>& paragraphs,
+              const std::vector<double>& widths,
+              size_t count)
+      : paragraphs(paragraphs.begin(), paragraphs.begin() + count),
+        widths(widths.begin(), widths.begin() + count) {}
+
+  const std::vector<Paragraph*> paragraphs;
+  const std::vector<double> widths;
+  std::atomic<size_t> next_index = 0;
+
+  std::mutex mutex;
+  std::condition_variable laid_out_all;
+  size_t laid_out_count = 0;
+
+  // Paragraphs vary widely in length, so each thread takes the next paragraph
+  // when it is done rather than a fixed share of them. A thread that finds no
+  // paragraph left returns without touching any of them.
+  void LayoutRemainingParagraphs() {
+    size_t laid_out = 0;
+    for (size_t i = next_index++; i < paragraphs.size(); i = next_index++) {
+      paragraphs[i]->Layout(widths[i]);
+      laid_out++;
+    }
+    if (laid_out == 0) {
+      return;
+    }
+    std::scoped_lock lock(mutex);
+    laid_out_count += laid_out;
+    if (laid_out_count == paragraphs.size()) {
+      laid_out_all.notify_all();
+    }
+  }
+
+  // Waits for the threads that took a paragraph to finish laying it out.
+  void Wait() {
+    std::unique_lock lock(mutex);
+    laid_out_all.wait(lock,
+                      [this]() { return laid_out_count == paragraphs.size(); });
+  }
+};
+
+}  // namespace
+
+void LayoutParagraphs(const std::vector<Paragraph*>& paragraphs,
+                      const std::vector<double>& widths,
+                      fml::BasicTaskRunner* task_runner,
+                      size_t concurrency) {
+  FML_DCHECK(paragraphs.size() == widths.size());
+  const size_t count = std::min(paragraphs.size(), widths.size());
+  TRACE_EVENT0("flutter", "LayoutParagraphs");
+
+  const size_t task_count = std::min(concurrency, count);
+  if (task_runner == nullptr || task_count <= 1) {
+    for (size_t i = 0; i < count; i++) {
+      paragraphs[i]->Layout(widths[i]);
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    paragraphs[i]->PrepareForConcurrentLayout();
+  }
+
+  auto batch = std::make_shared<BatchLayout>(paragraphs, widths, count);
+  for (size_t i = 1; i < task_count; i++) {
+    task_runner->PostTask([batch]() {
+      TRACE_EVENT0("flutter", "LayoutParagraphs::Worker");
+      batch->LayoutRemainingParagraphs();
+    });
+  }
+  batch->LayoutRemainingParagraphs();
+  batch->Wait();
+}
+
+}  // namespace txt
@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TXT_PARAGRAPH_BATCH_LAYOUT_H_
+#define TXT_PARAGRAPH_BATCH_LAYOUT_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "flutter/fml/task_runner.h"
+#include "txt/paragraph.h"
+
+namespace txt {
+
+// Lays out each of |paragraphs| to the width at the same index of |widths|,
+// and returns once all of them are laid out.
+//
+// The paragraphs are laid out concurrently by the calling thread and up to
+// |concurrency| - 1 tasks posted to |task_runner|, which must run them on
+// other threads. Only the tasks that started laying out a paragraph are
+// waited for, so a busy task runner does not delay the return. The paragraphs
+// must be distinct, and must not be used by other threads until this returns.
+void LayoutParagraphs(const std::vector<Paragraph*>& paragraphs,
+                      const std::vector<double>& widths,
+                      fml::BasicTaskRunner* task_runner,
+                      size_t concurrency);
+
+}  // namespace txt
+
+#endif  // TXT_PARAGRAPH_BATCH_LAYOUT_H_
@@ -80,6 +80,15 @@ class ParagraphBuilder {
   // to a SkCanvas.
   virtual std::unique_ptr<Paragraph> Build() = 0;
 
+  // Constructs a Paragraph like Build, whose text is laid out by blocks
+  // between hard line breaks if possible. The blocks whose text and styles are
+  // the same as in |previous|, which may be null, are taken over from it
+  // instead of being shaped and broken into lines again.
+  //
+  // This is meant for text that is edited, where |previous| is the paragraph
+  // of the text before the edit, which is rarely used afterwards.
+  virtual std::unique_ptr<Paragraph> BuildIncremental(Paragraph* previous) = 0;
+
  protected:
   ParagraphBuilder() = default;
 
@@ -18,7 +18,12 @@
 
 #include <sstream>
 
+#include "flutter/fml/file.h"
+#include "runtime/test_font_data.h"
+#include "txt/asset_font_manager.h"
 #include "txt/font_collection.h"
+#include "txt/font_fallback_cache.h"
+#include "txt/typeface_font_asset_provider.h"
 
 namespace txt {
 namespace testing {
@@ -39,5 +44,142 @@ TEST_F(FontCollectionTests, SettingUpDefaultFontManagerClearsCache) {
   sk_font_collection = font_collection.CreateSktFontCollection();
   ASSERT_NE(sk_font_collection->getFallbackManager().get(), nullptr);
 }
+
+namespace {
+
+// A font manager with the test fonts that counts the queries for fallbacks.
+class FallbackFontManager : public AssetFontManager {
+ public:
+  FallbackFontManager() : AssetFontManager(MakeFontProvider()) {}
+
+  int fallback_query_count() const { return fallback_query_count_; }
+
+ private:
+  mutable int fallback_query_count_ = 0;
+
+  static std::unique_ptr<FontAssetProvider> MakeFontProvider() {
+    auto font_provider = std::make_unique<TypefaceFontAssetProvider>();
+    for (auto& typeface : flutter::GetTestFontData()) {
+      font_provider->RegisterTypeface(typeface);
+    }
+    return font_provider;
+  }
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyleCharacter(
+      const char familyName[],
+      const SkFontStyle&,
+      const char* bcp47[],
+      int bcp47Count,
+      SkUnichar character) const override {
+    fallback_query_count_++;
+    for (auto& typeface : flutter::GetTestFontData()) {
+      if (typeface->unicharToGlyph(character) != 0) {
+        return typeface;
+      }
+    }
+    return nullptr;
+  }
+};
+
+// A character that none of the test fonts cover.
+constexpr SkUnichar kUncoveredCharacter = 0x10FFFD;
+
+}  // namespace
+
+TEST_F(FontCollectionTests, FallbackCacheReusesTypefaceForCodePointBlock) {
+  FallbackFontManager font_manager;
+  FontFallbackCache cache;
+
+  sk_sp<SkTypeface> a =
+      cache.MatchCharacter(font_manager, SkFontStyle(), nullptr, 0, 'a');
+  ASSERT_NE(a, nullptr);
+  sk_sp<SkTypeface> b =
+      cache.MatchCharacter(font_manager, SkFontStyle(), nullptr, 0, 'b');
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(font_manager.fallback_query_count(), 1);
+
+  // A different style is cached separately.
+  cache.MatchCharacter(font_manager, SkFontStyle::Bold(), nullptr, 0, 'a');
+  EXPECT_EQ(font_manager.fallback_query_count(), 2);
+
+  FontFallbackCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.misses, 2u);
+  EXPECT_EQ(stats.entries, 2u);
+
+  cache.Clear();
+  cache.MatchCharacter(font_manager, SkFontStyle(), nullptr, 0, 'a');
+  EXPECT_EQ(font_manager.fallback_query_count(), 3);
+}
+
+TEST_F(FontCollectionTests, FallbackCacheQueriesSymbolsIndividually) {
+  FallbackFontManager font_manager;
+  FontFallbackCache cache;
+
+  // An en dash and an em dash share a block of code points, but the platform
+  // may choose different typefaces for symbols of the same block.
+  ASSERT_NE(cache.MatchCharacter(font_manager, SkFontStyle(), nullptr, 0,
+                                 0x2013),
+            nullptr);
+  ASSERT_NE(cache.MatchCharacter(font_manager, SkFontStyle(), nullptr, 0,
+                                 0x2014),
+            nullptr);
+  EXPECT_EQ(font_manager.fallback_query_count(), 2);
+
+  cache.MatchCharacter(font_manager, SkFontStyle(), nullptr, 0, 0x2013);
+  EXPECT_EQ(font_manager.fallback_query_count(), 2);
+  EXPECT_EQ(cache.GetStats().entries, 2u);
+}
+
+TEST_F(FontCollectionTests, FallbackCacheRemembersUncoveredCharacters) {
+  FallbackFontManager font_manager;
+  FontFallbackCache cache;
+
+  EXPECT_EQ(cache.MatchCharacter(font_manager, SkFontStyle(), nullptr, 0,
+                                 kUncoveredCharacter),
+            nullptr);
+  EXPECT_EQ(cache.MatchCharacter(font_manager, SkFontStyle(), nullptr, 0,
+                                 kUncoveredCharacter),
+            nullptr);
+  EXPECT_EQ(font_manager.fallback_query_count(), 1);
+}
+
+TEST_F(FontCollectionTests, FallbackCacheIsPersisted) {
+  fml::ScopedTemporaryDirectory directory;
+  FallbackFontManager font_manager;
+  const char* locales[] = {"en-US"};
+  {
+    FontFallbackCache cache;
+    ASSERT_NE(cache.MatchCharacter(font_manager, SkFontStyle(), locales, 1,
+                                   'a'),
+              nullptr);
+    ASSERT_TRUE(cache.Save(directory.fd(), "fallbacks"));
+  }
+  ASSERT_EQ(font_manager.fallback_query_count(), 1);
+
+  FontFallbackCache cache;
+  ASSERT_TRUE(cache.Load(directory.fd(), "fallbacks"));
+  EXPECT_EQ(cache.GetStats().entries, 1u);
+  EXPECT_NE(cache.MatchCharacter(font_manager, SkFontStyle(), locales, 1, 'a'),
+            nullptr);
+  EXPECT_EQ(font_manager.fallback_query_count(), 1);
+  EXPECT_EQ(cache.GetStats().hits, 1u);
+}
+
+TEST_F(FontCollectionTests, FallbackCachingFontManagerCachesFallbacks) {
+  auto font_manager = sk_make_sp<FallbackFontManager>();
+  auto cache = std::make_shared<FontFallbackCache>();
+  auto caching_manager =
+      sk_make_sp<FallbackCachingFontManager>(font_manager, cache);
+
+  for (int i = 0; i < 3; i++) {
+    EXPECT_NE(caching_manager->matchFamilyStyleCharacter(
+                  nullptr, SkFontStyle(), nullptr, 0, 'a'),
+              nullptr);
+  }
+  EXPECT_EQ(font_manager->fallback_query_count(), 1);
+  EXPECT_EQ(cache->GetStats().hits, 2u);
+}
 }  // namespace testing
 }  // namespace txt
@@ -8,12 +8,14 @@
 #include "display_list/dl_tile_mode.h"
 #include "display_list/effects/dl_color_source.h"
 #include "display_list/utils/dl_receiver_utils.h"
+#include "fml/concurrent_message_loop.h"
 #include "gtest/gtest.h"
 #include "include/core/SkScalar.h"
 #include "runtime/test_font_data.h"
 #include "skia/paragraph_builder_skia.h"
 #include "testing/canvas_test.h"
 #include "testing/testing.h"
+#include "txt/paragraph_batch_layout.h"
 #include "txt/platform.h"
 
 namespace flutter {
@@ -48,6 +50,9 @@ class DlOpRecorder final : public virtual DlOpReceiver,
   int pathCount() const { return paths_.size(); }
   int textFrameCount() const { return text_frames_.size(); }
   int blobCount() const { return blobs_.size(); }
+  const std::vector<std::shared_ptr<impeller::TextFrame>>& textFrames() const {
+    return text_frames_;
+  }
 
  private:
   void drawLine(const DlPoint& p0, const DlPoint& p1) override {
@@ -123,6 +128,27 @@ class PainterTestBase : public CanvasTestBase<T> {
     return t_style;
   }
 
+  std::unique_ptr<txt::Paragraph> makeParagraph(
+      txt::TextStyle style,
+      const std::u16string& text = u"Hello World!") const {
+    auto pb_skia = makeParagraphBuilder();
+    pb_skia.PushStyle(style);
+    pb_skia.AddText(text);
+    pb_skia.Pop();
+    return pb_skia.Build();
+  }
+
+  std::unique_ptr<txt::Paragraph> makeIncrementalParagraph(
+      txt::TextStyle style,
+      const std::u16string& text,
+      txt::Paragraph* previous) const {
+    auto pb_skia = makeParagraphBuilder();
+    pb_skia.PushStyle(style);
+    pb_skia.AddText(text);
+    pb_skia.Pop();
+    return pb_skia.BuildIncremental(previous);
+  }
+
   sk_sp<DisplayList> drawText(txt::TextStyle style, std::u16string text) const {
     auto pb_skia = makeParagraphBuilder();
     pb_skia.PushStyle(style);
@@ -174,11 +200,16 @@ class PainterTestBase : public CanvasTestBase<T> {
 
   txt::ParagraphBuilderSkia makeParagraphBuilder() const {
     auto p_style = txt::ParagraphStyle();
-    auto f_collection = makeFontCollection();
-    return txt::ParagraphBuilderSkia(p_style, f_collection, impeller_);
+    // Incremental paragraphs only take over the layout of paragraphs of the
+    // same font collection.
+    if (!font_collection_) {
+      font_collection_ = makeFontCollection();
+    }
+    return txt::ParagraphBuilderSkia(p_style, font_collection_, impeller_);
   }
 
   bool impeller_ = false;
+  mutable std::shared_ptr<txt::FontCollection> font_collection_;
 };
 
 using PainterTest = PainterTestBase<::testing::Test>;
@@ -207,6 +238,177 @@ TEST_F(PainterTest, DrawDashedLineSkia) {
   EXPECT_EQ(recorder.dashedLineCount(), 1);
 }
 
+TEST_F(PainterTest, LayoutParagraphsConcurrently) {
+  std::vector<std::unique_ptr<txt::Paragraph>> paragraphs;
+  std::vector<txt::Paragraph*> batch;
+  std::vector<double> widths;
+  for (int i = 0; i < 16; i++) {
+    paragraphs.push_back(makeParagraph(makeStyle()));
+    batch.push_back(paragraphs.back().get());
+    widths.push_back(20 + i * 10);
+  }
+
+  auto loop = fml::ConcurrentMessageLoop::Create(3);
+  txt::LayoutParagraphs(batch, widths, loop->GetTaskRunner().get(), 4);
+
+  for (size_t i = 0; i < paragraphs.size(); i++) {
+    auto expected = makeParagraph(makeStyle());
+    expected->Layout(widths[i]);
+    EXPECT_EQ(paragraphs[i]->GetMaxWidth(), expected->GetMaxWidth());
+    EXPECT_EQ(paragraphs[i]->GetHeight(), expected->GetHeight());
+    EXPECT_EQ(paragraphs[i]->GetLongestLine(), expected->GetLongestLine());
+  }
+}
+
+namespace {
+
+// Holds on to the posted tasks until they are run by the test.
+class DeferredTaskRunner : public fml::BasicTaskRunner {
+ public:
+  void PostTask(const fml::closure& task) override { tasks_.push_back(task); }
+
+  void RunTasks() {
+    for (const auto& task : tasks_) {
+      task();
+    }
+    tasks_.clear();
+  }
+
+  size_t task_count() const { return tasks_.size(); }
+
+ private:
+  std::vector<fml::closure> tasks_;
+};
+
+}  // namespace
+
+TEST_F(PainterTest, LayoutParagraphsDoesNotWaitForTasksThatDidNotStart) {
+  DeferredTaskRunner task_runner;
+  {
+    std::vector<std::unique_ptr<txt::Paragraph>> paragraphs;
+    std::vector<txt::Paragraph*> batch;
+    std::vector<double> widths;
+    for (int i = 0; i < 4; i++) {
+      paragraphs.push_back(makeParagraph(makeStyle()));
+      batch.push_back(paragraphs.back().get());
+      widths.push_back(100);
+    }
+
+    // The calling thread lays out all the paragraphs, since none of the posted
+    // tasks run until the batch is done.
+    txt::LayoutParagraphs(batch, widths, &task_runner, 4);
+    EXPECT_EQ(task_runner.task_count(), 3u);
+    for (const auto& paragraph : paragraphs) {
+      EXPECT_GT(paragraph->GetHeight(), 0);
+    }
+  }
+
+  // The late tasks must not touch the paragraphs, which are gone by now.
+  task_runner.RunTasks();
+}
+
+TEST_F(PainterTest, IncrementalParagraphMatchesParagraphWithBlankLines) {
+  // The font size differs from the one of the paragraph style, so that the
+  // empty lines are only as tall as expected if they use the text style.
+  txt::TextStyle style = makeStyle();
+  style.font_size = 40;
+  const std::u16string text = u"Hello\n\nWorld\n";
+  auto expected = makeParagraph(style, text);
+  auto paragraph = makeIncrementalParagraph(style, text, nullptr);
+  ASSERT_NE(paragraph->AsIncrementalParagraph(), nullptr);
+
+  expected->Layout(1000);
+  paragraph->Layout(1000);
+  EXPECT_FLOAT_EQ(paragraph->GetHeight(), expected->GetHeight());
+  EXPECT_FLOAT_EQ(paragraph->GetAlphabeticBaseline(),
+                  expected->GetAlphabeticBaseline());
+  ASSERT_EQ(paragraph->GetNumberOfLines(), expected->GetNumberOfLines());
+  const auto& lines = paragraph->GetLineMetrics();
+  const auto& expected_lines = expected->GetLineMetrics();
+  ASSERT_EQ(lines.size(), expected_lines.size());
+  for (size_t i = 0; i < lines.size(); i++) {
+    EXPECT_FLOAT_EQ(lines[i].height, expected_lines[i].height) << i;
+    EXPECT_FLOAT_EQ(lines[i].baseline, expected_lines[i].baseline) << i;
+  }
+}
+
+TEST_F(PainterTest, IncrementalParagraphMatchesParagraph) {
+  const std::u16string text = u"Hello World!\n\nA second line\nThe end";
+  auto expected = makeParagraph(makeStyle(), text);
+  auto paragraph = makeIncrementalParagraph(makeStyle(), text, nullptr);
+  ASSERT_NE(paragraph->AsIncrementalParagraph(), nullptr);
+
+  expected->Layout(100);
+  paragraph->Layout(100);
+  EXPECT_FLOAT_EQ(paragraph->GetHeight(), expected->GetHeight());
+  EXPECT_FLOAT_EQ(paragraph->GetLongestLine(), expected->GetLongestLine());
+  EXPECT_FLOAT_EQ(paragraph->GetMaxIntrinsicWidth(),
+                  expected->GetMaxIntrinsicWidth());
+  EXPECT_FLOAT_EQ(paragraph->GetAlphabeticBaseline(),
+                  expected->GetAlphabeticBaseline());
+  ASSERT_EQ(paragraph->GetNumberOfLines(), expected->GetNumberOfLines());
+  for (size_t offset = 0; offset <= text.size(); offset++) {
+    EXPECT_EQ(paragraph->GetLineNumberAt(offset),
+              expected->GetLineNumberAt(offset));
+  }
+
+  auto rects = paragraph->GetRectsForRange(
+      16, 24, txt::Paragraph::RectHeightStyle::kTight,
+      txt::Paragraph::RectWidthStyle::kTight);
+  auto expected_rects = expected->GetRectsForRange(
+      16, 24, txt::Paragraph::RectHeightStyle::kTight,
+      txt::Paragraph::RectWidthStyle::kTight);
+  ASSERT_EQ(rects.size(), expected_rects.size());
+  for (size_t i = 0; i < rects.size(); i++) {
+    EXPECT_EQ(rects[i].rect, expected_rects[i].rect);
+  }
+
+  auto& line_metrics = paragraph->GetLineMetrics();
+  auto& expected_line_metrics = expected->GetLineMetrics();
+  ASSERT_EQ(line_metrics.size(), expected_line_metrics.size());
+  for (size_t i = 0; i < line_metrics.size(); i++) {
+    EXPECT_EQ(line_metrics[i].start_index,
+              expected_line_metrics[i].start_index);
+    EXPECT_EQ(line_metrics[i].hard_break, expected_line_metrics[i].hard_break);
+    EXPECT_FLOAT_EQ(line_metrics[i].baseline,
+                    expected_line_metrics[i].baseline);
+  }
+
+  auto position = paragraph->GetGlyphPositionAtCoordinate(30, 40);
+  auto expected_position = expected->GetGlyphPositionAtCoordinate(30, 40);
+  EXPECT_EQ(position.position, expected_position.position);
+  EXPECT_EQ(position.affinity, expected_position.affinity);
+}
+
+TEST_F(PainterTest, IncrementalParagraphReusesUnchangedLines) {
+  auto previous = makeIncrementalParagraph(
+      makeStyle(), u"First line\nSecond line\nThird line", nullptr);
+  previous->Layout(100);
+  const double previous_height = previous->GetHeight();
+
+  // Edit the second line.
+  const std::u16string text = u"First line\nSecond lines\nThird line";
+  auto paragraph = makeIncrementalParagraph(makeStyle(), text, previous.get());
+  ASSERT_NE(paragraph->AsIncrementalParagraph(), nullptr);
+  EXPECT_EQ(paragraph->AsIncrementalParagraph()->reused_block_count(), 2u);
+
+  auto expected = makeParagraph(makeStyle(), text);
+  expected->Layout(100);
+  paragraph->Layout(100);
+  EXPECT_FLOAT_EQ(paragraph->GetHeight(), expected->GetHeight());
+  EXPECT_EQ(paragraph->GetNumberOfLines(), expected->GetNumberOfLines());
+
+  // The previous paragraph builds the lines it gave away again.
+  previous->Layout(100);
+  EXPECT_FLOAT_EQ(previous->GetHeight(), previous_height);
+
+  // A change of style does not take over any line.
+  auto style = makeStyle();
+  style.font_size = 20;
+  auto restyled = makeIncrementalParagraph(style, text, paragraph.get());
+  EXPECT_EQ(restyled->AsIncrementalParagraph()->reused_block_count(), 0u);
+}
+
 #ifdef IMPELLER_SUPPORTS_RENDERING
 TEST_F(PainterTest, DrawsSolidLineImpeller) {
   PretendImpellerIsEnabled(true);
@@ -318,6 +520,34 @@ TEST_F(PainterTest, DrawEmojiTextWithGradientImpeller) {
   EXPECT_EQ(recorder.pathCount(), 0);
 }
 
+TEST_F(PainterTest, RepaintReusesTextFrameImpeller) {
+  PretendImpellerIsEnabled(true);
+
+  auto paragraph = makeParagraph(makeStyle());
+  auto paint = [&paragraph]() {
+    auto builder = DisplayListBuilder();
+    paragraph->Paint(&builder, 0, 0);
+    auto recorder = DlOpRecorder();
+    builder.Build()->Dispatch(recorder);
+    return recorder.textFrames();
+  };
+
+  paragraph->Layout(10000);
+  auto first = paint();
+  auto second = paint();
+  ASSERT_EQ(first.size(), 1u);
+  ASSERT_EQ(second.size(), 1u);
+  // The text frame is reused even while the first paint still holds it, as
+  // the glyph atlas handles a text frame drawn more than once per frame.
+  EXPECT_EQ(first[0], second[0]);
+
+  // A new layout creates new text blobs, which are converted again.
+  paragraph->Layout(5000);
+  auto relaid = paint();
+  ASSERT_EQ(relaid.size(), 1u);
+  EXPECT_NE(first[0], relaid[0]);
+}
+
 TEST_F(PainterTest, DrawTextBlobNoImpeller) {
   PretendImpellerIsEnabled(false);
 